@@ -0,0 +1,1039 @@
+#include "brotli.h"
+
+#include "util.h"
+
+/* Helper results: the unit being decoded is incomplete, so the caller
+ * rewinds to its mark and waits for more input.
+ */
+enum {
+	BR_OK = 0,
+	BR_MORE = 1,
+};
+
+enum {
+	ST_STREAM = 0, /* WBITS */
+	ST_META,       /* meta-block header, prefix codes and context maps */
+	ST_RAW,        /* uncompressed meta-block bytes */
+	ST_SKIP,       /* metadata bytes */
+	ST_CMD,
+	ST_LIT,
+	ST_COPY,
+	ST_END,
+};
+
+/* Dictionary word transforms (RFC 7932 Appendix B). */
+enum {
+	BT_IDENTITY = 0,
+	BT_OMIT_LAST_1, BT_OMIT_LAST_2, BT_OMIT_LAST_3, BT_OMIT_LAST_4, BT_OMIT_LAST_5,
+	BT_OMIT_LAST_6, BT_OMIT_LAST_7, BT_OMIT_LAST_8, BT_OMIT_LAST_9,
+	BT_UPPER_FIRST,
+	BT_UPPER_ALL,
+	BT_OMIT_FIRST_1, BT_OMIT_FIRST_2, BT_OMIT_FIRST_3, BT_OMIT_FIRST_4, BT_OMIT_FIRST_5,
+	BT_OMIT_FIRST_6, BT_OMIT_FIRST_7, BT_OMIT_FIRST_8, BT_OMIT_FIRST_9,
+};
+
+struct br_transform {
+	const char *prefix;
+	uint8_t type;
+	const char *suffix;
+};
+
+static const struct br_transform transforms[121] = {
+	{ "", BT_IDENTITY, "" },
+	{ "", BT_IDENTITY, " " },
+	{ " ", BT_IDENTITY, " " },
+	{ "", BT_OMIT_FIRST_1, "" },
+	{ "", BT_UPPER_FIRST, " " },
+	{ "", BT_IDENTITY, " the " },
+	{ " ", BT_IDENTITY, "" },
+	{ "s ", BT_IDENTITY, " " },
+	{ "", BT_IDENTITY, " of " },
+	{ "", BT_UPPER_FIRST, "" },
+	{ "", BT_IDENTITY, " and " },
+	{ "", BT_OMIT_FIRST_2, "" },
+	{ "", BT_OMIT_LAST_1, "" },
+	{ ", ", BT_IDENTITY, " " },
+	{ "", BT_IDENTITY, ", " },
+	{ " ", BT_UPPER_FIRST, " " },
+	{ "", BT_IDENTITY, " in " },
+	{ "", BT_IDENTITY, " to " },
+	{ "e ", BT_IDENTITY, " " },
+	{ "", BT_IDENTITY, "\"" },
+	{ "", BT_IDENTITY, "." },
+	{ "", BT_IDENTITY, "\">" },
+	{ "", BT_IDENTITY, "\n" },
+	{ "", BT_OMIT_LAST_3, "" },
+	{ "", BT_IDENTITY, "]" },
+	{ "", BT_IDENTITY, " for " },
+	{ "", BT_OMIT_FIRST_3, "" },
+	{ "", BT_OMIT_LAST_2, "" },
+	{ "", BT_IDENTITY, " a " },
+	{ "", BT_IDENTITY, " that " },
+	{ " ", BT_UPPER_FIRST, "" },
+	{ "", BT_IDENTITY, ". " },
+	{ ".", BT_IDENTITY, "" },
+	{ " ", BT_IDENTITY, ", " },
+	{ "", BT_OMIT_FIRST_4, "" },
+	{ "", BT_IDENTITY, " with " },
+	{ "", BT_IDENTITY, "'" },
+	{ "", BT_IDENTITY, " from " },
+	{ "", BT_IDENTITY, " by " },
+	{ "", BT_OMIT_FIRST_5, "" },
+	{ "", BT_OMIT_FIRST_6, "" },
+	{ " the ", BT_IDENTITY, "" },
+	{ "", BT_OMIT_LAST_4, "" },
+	{ "", BT_IDENTITY, ". The " },
+	{ "", BT_UPPER_ALL, "" },
+	{ "", BT_IDENTITY, " on " },
+	{ "", BT_IDENTITY, " as " },
+	{ "", BT_IDENTITY, " is " },
+	{ "", BT_OMIT_LAST_7, "" },
+	{ "", BT_OMIT_LAST_1, "ing " },
+	{ "", BT_IDENTITY, "\n\t" },
+	{ "", BT_IDENTITY, ":" },
+	{ " ", BT_IDENTITY, ". " },
+	{ "", BT_IDENTITY, "ed " },
+	{ "", BT_OMIT_FIRST_9, "" },
+	{ "", BT_OMIT_FIRST_7, "" },
+	{ "", BT_OMIT_LAST_6, "" },
+	{ "", BT_IDENTITY, "(" },
+	{ "", BT_UPPER_FIRST, ", " },
+	{ "", BT_OMIT_LAST_8, "" },
+	{ "", BT_IDENTITY, " at " },
+	{ "", BT_IDENTITY, "ly " },
+	{ " the ", BT_IDENTITY, " of " },
+	{ "", BT_OMIT_LAST_5, "" },
+	{ "", BT_OMIT_LAST_9, "" },
+	{ " ", BT_UPPER_FIRST, ", " },
+	{ "", BT_UPPER_FIRST, "\"" },
+	{ ".", BT_IDENTITY, "(" },
+	{ "", BT_UPPER_ALL, " " },
+	{ "", BT_UPPER_FIRST, "\">" },
+	{ "", BT_IDENTITY, "=\"" },
+	{ " ", BT_IDENTITY, "." },
+	{ ".com/", BT_IDENTITY, "" },
+	{ " the ", BT_IDENTITY, " of the " },
+	{ "", BT_UPPER_FIRST, "'" },
+	{ "", BT_IDENTITY, ". This " },
+	{ "", BT_IDENTITY, "," },
+	{ ".", BT_IDENTITY, " " },
+	{ "", BT_UPPER_FIRST, "(" },
+	{ "", BT_UPPER_FIRST, "." },
+	{ "", BT_IDENTITY, " not " },
+	{ " ", BT_IDENTITY, "=\"" },
+	{ "", BT_IDENTITY, "er " },
+	{ " ", BT_UPPER_ALL, " " },
+	{ "", BT_IDENTITY, "al " },
+	{ " ", BT_UPPER_ALL, "" },
+	{ "", BT_IDENTITY, "='" },
+	{ "", BT_UPPER_ALL, "\"" },
+	{ "", BT_UPPER_FIRST, ". " },
+	{ " ", BT_IDENTITY, "(" },
+	{ "", BT_IDENTITY, "ful " },
+	{ " ", BT_UPPER_FIRST, ". " },
+	{ "", BT_IDENTITY, "ive " },
+	{ "", BT_IDENTITY, "less " },
+	{ "", BT_UPPER_ALL, "'" },
+	{ "", BT_IDENTITY, "est " },
+	{ " ", BT_UPPER_FIRST, "." },
+	{ "", BT_UPPER_ALL, "\">" },
+	{ " ", BT_IDENTITY, "='" },
+	{ "", BT_UPPER_FIRST, "," },
+	{ "", BT_IDENTITY, "ize " },
+	{ "", BT_UPPER_ALL, "." },
+	{ "\302\240", BT_IDENTITY, "" },
+	{ " ", BT_IDENTITY, "," },
+	{ "", BT_UPPER_FIRST, "=\"" },
+	{ "", BT_UPPER_ALL, "=\"" },
+	{ "", BT_IDENTITY, "ous " },
+	{ "", BT_UPPER_ALL, ", " },
+	{ "", BT_UPPER_FIRST, "='" },
+	{ " ", BT_UPPER_FIRST, "," },
+	{ " ", BT_UPPER_ALL, "=\"" },
+	{ " ", BT_UPPER_ALL, ", " },
+	{ "", BT_UPPER_ALL, "," },
+	{ "", BT_UPPER_ALL, "(" },
+	{ "", BT_UPPER_ALL, ". " },
+	{ " ", BT_UPPER_ALL, "." },
+	{ "", BT_UPPER_ALL, "='" },
+	{ " ", BT_UPPER_ALL, ". " },
+	{ " ", BT_UPPER_FIRST, "=\"" },
+	{ " ", BT_UPPER_ALL, "='" },
+	{ " ", BT_UPPER_FIRST, "='" },
+};
+
+/* Dictionary words of each length 4..24: log2 of the count and the offset. */
+static const uint8_t dict_nbits[25] = {
+	0, 0, 0, 0, 10, 10, 11, 11, 10, 10, 10, 10, 10, 9, 9, 8, 7, 7, 8, 7, 7, 6, 6, 5, 5
+};
+static const uint32_t dict_off[25] = {
+	0, 0, 0, 0, 0, 4096, 9216, 21504, 35840, 44032, 53248, 63488, 74752,
+	87040, 93696, 100864, 104704, 106752, 108928, 113536, 115968, 118528,
+	119872, 121280, 122016
+};
+
+/* Literal context lookup for the UTF8 and signed context modes (RFC 7932
+ * section 7.1).
+ */
+static const uint8_t ctx_utf8_p1[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8, 12, 16, 12, 12, 20, 12, 16, 24, 28, 12, 12, 32, 12, 36, 12,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 32, 32, 24, 40, 28, 12,
+	12, 48, 52, 52, 52, 48, 52, 52, 52, 48, 52, 52, 52, 52, 52, 48,
+	52, 52, 52, 52, 52, 48, 52, 52, 52, 52, 52, 24, 12, 28, 12, 12,
+	12, 56, 60, 60, 60, 56, 60, 60, 60, 56, 60, 60, 60, 60, 60, 56,
+	60, 60, 60, 60, 60, 56, 60, 60, 60, 60, 60, 24, 12, 28, 12, 0,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+	2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+};
+static const uint8_t ctx_utf8_p2[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+	1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+	1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+static const uint8_t ctx_signed[256] = {
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+};
+
+static const uint16_t blen_base[26] = {
+	1, 5, 9, 13, 17, 25, 33, 41, 49, 65, 81, 97, 113, 145, 177, 209,
+	241, 305, 369, 497, 753, 1265, 2289, 4337, 8433, 16625
+};
+static const uint8_t blen_extra[26] = {
+	2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5,
+	6, 6, 7, 8, 9, 10, 11, 12, 13, 24
+};
+static const uint16_t ins_base[24] = {
+	0, 1, 2, 3, 4, 5, 6, 8, 10, 14, 18, 26, 34, 50, 66, 98,
+	130, 194, 322, 578, 1090, 2114, 6210, 22594
+};
+static const uint8_t ins_extra[24] = {
+	0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+	6, 7, 8, 9, 10, 12, 14, 24
+};
+static const uint16_t copy_base[24] = {
+	2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 18, 22, 30, 38, 54,
+	70, 102, 134, 198, 326, 582, 1094, 2118
+};
+static const uint8_t copy_extra[24] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4,
+	5, 5, 6, 7, 8, 9, 10, 24
+};
+/* Insert-and-copy symbol >> 6 selects the insert and copy code ranges. */
+static const uint8_t cmd_ins_code[11] = { 0, 0, 0, 0, 8, 8, 0, 16, 8, 16, 16 };
+static const uint8_t cmd_copy_code[11] = { 0, 8, 0, 8, 0, 8, 16, 0, 16, 8, 16 };
+
+/* Distance short codes 0..15: which recent distance, and the delta. */
+static const uint8_t short_idx[16] = { 0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1 };
+static const signed char short_delta[16] = { 0, 0, 0, 0, -1, 1, -2, 2, -3, 3, -1, 1, -2, 2, -3, 3 };
+
+/* The fixed code for code length code lengths, indexed by the next 4 bits. */
+static const uint8_t cl_code_len[16] = { 2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 3, 2, 2, 2, 4 };
+static const uint8_t cl_code_val[16] = { 0, 4, 3, 2, 0, 4, 3, 1, 0, 4, 3, 2, 0, 4, 3, 5 };
+static const uint8_t cl_order[18] = { 1, 2, 3, 4, 0, 5, 17, 6, 16, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+static int br_need(struct brotli_stream *s, uint32_t n)
+{
+	struct brotli_cursor *c = &s->cur;
+	while (c->bitcount < n) {
+		if (c->in_pos >= s->in_len) return BR_MORE;
+		c->bitbuf |= ((uint32_t)s->in[c->in_pos++]) << c->bitcount;
+		c->bitcount += 8;
+	}
+	return BR_OK;
+}
+
+static int br_bits(struct brotli_stream *s, uint32_t n, uint32_t *out)
+{
+	struct brotli_cursor *c = &s->cur;
+	if (n == 0) { *out = 0; return BR_OK; }
+	if (n > 24) return -1;
+	int r = br_need(s, n);
+	if (r != BR_OK) return r;
+	*out = c->bitbuf & ((1u << n) - 1u);
+	c->bitbuf >>= n;
+	c->bitcount -= n;
+	return BR_OK;
+}
+
+/* Skips to the next byte boundary; the padding bits must be zero. */
+static int br_align(struct brotli_stream *s)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t drop = c->bitcount & 7u;
+	if (c->bitbuf & ((1u << drop) - 1u)) return -1;
+	c->bitbuf >>= drop;
+	c->bitcount -= drop;
+	return BR_OK;
+}
+
+static void huff_single(struct brotli_huff *h, uint32_t sym)
+{
+	h->maxbits = 0;
+	h->only = (uint16_t)sym;
+}
+
+/* Canonical prefix code from code lengths (0 = unused), with its fast table
+ * and symbol list carved out of s->pool.
+ */
+static int huff_build(struct brotli_stream *s, struct brotli_huff *h, const uint8_t *lens, uint32_t nsyms)
+{
+	uint16_t cnt[16];
+	c_memset(cnt, 0, sizeof(cnt));
+	uint32_t used = 0;
+	uint8_t maxb = 0;
+	for (uint32_t i = 0; i < nsyms; i++) {
+		uint8_t L = lens[i];
+		if (L > 15) return -1;
+		if (L) { cnt[L]++; used++; if (L > maxb) maxb = L; }
+	}
+	if (used == 0) return -1;
+	if (s->pool_used + 256u + used > BROTLI_POOL) return -1;
+	h->off = s->pool_used;
+	s->pool_used += 256u + used;
+	uint16_t *fast = s->pool + h->off;
+	uint16_t *syms = fast + 256;
+
+	h->maxbits = maxb;
+	h->count[0] = 0;
+	h->first_code[0] = 0;
+	h->first_sym[0] = 0;
+	uint32_t code = 0;
+	uint32_t sym = 0;
+	for (uint32_t bits = 1; bits <= 15; bits++) {
+		code = (code + cnt[bits - 1]) << 1;
+		h->first_code[bits] = (uint16_t)code;
+		h->first_sym[bits] = (uint16_t)sym;
+		h->count[bits] = cnt[bits];
+		sym += cnt[bits];
+	}
+	uint16_t next[16];
+	for (uint32_t bits = 1; bits <= 15; bits++) next[bits] = h->first_sym[bits];
+	for (uint32_t i = 0; i < nsyms; i++) {
+		if (lens[i]) syms[next[lens[i]]++] = (uint16_t)i;
+	}
+
+	/* Fast table over the next 8 bits: (len << 12) | symbol, 0 = slow path.
+	 * Codes are packed MSB first, so the table index is the reversed code.
+	 */
+	c_memset(fast, 0, 256 * sizeof(fast[0]));
+	for (uint32_t bits = 1; bits <= 8; bits++) {
+		for (uint32_t j = 0; j < h->count[bits]; j++) {
+			uint32_t codev = h->first_code[bits] + j;
+			uint32_t rev = 0;
+			for (uint32_t k = 0; k < bits; k++) rev = (rev << 1) | ((codev >> k) & 1u);
+			uint16_t e = (uint16_t)((bits << 12) | syms[h->first_sym[bits] + j]);
+			for (uint32_t t = 0; t < (1u << (8 - bits)); t++) fast[((t << bits) | rev) & 0xffu] = e;
+		}
+	}
+	return 0;
+}
+
+static int huff_decode(struct brotli_stream *s, const struct brotli_huff *h, uint32_t *out_sym)
+{
+	struct brotli_cursor *c = &s->cur;
+	if (h->maxbits == 0) {
+		*out_sym = h->only;
+		return BR_OK;
+	}
+	/* As in inflate: near the end of the input the missing high bits read as
+	 * zero, and a code that fits in what is there still decodes correctly.
+	 */
+	int need = br_need(s, 8);
+	if (need < 0) return need;
+	uint16_t e = s->pool[h->off + (c->bitbuf & 0xffu)];
+	uint32_t L = (uint32_t)e >> 12;
+	if (L && L <= c->bitcount) {
+		c->bitbuf >>= L;
+		c->bitcount -= L;
+		*out_sym = e & 0x0fffu;
+		return BR_OK;
+	}
+	if (need == BR_MORE) return BR_MORE;
+	uint32_t code = 0;
+	for (uint32_t bits = 1; bits <= h->maxbits; bits++) {
+		uint32_t bit = 0;
+		int r = br_bits(s, 1, &bit);
+		if (r != BR_OK) return r;
+		code = (code << 1) | bit;
+		uint32_t diff = code - h->first_code[bits];
+		if (code >= h->first_code[bits] && diff < h->count[bits]) {
+			*out_sym = s->pool[h->off + 256u + h->first_sym[bits] + diff];
+			return BR_OK;
+		}
+	}
+	return -1;
+}
+
+static uint32_t alphabet_bits(uint32_t alphabet)
+{
+	uint32_t bits = 0;
+	while ((1u << bits) < alphabet) bits++;
+	return bits;
+}
+
+/* Simple prefix code: 1..4 symbols with implied lengths (section 3.4). */
+static int read_simple_code(struct brotli_stream *s, struct brotli_huff *h, uint32_t alphabet)
+{
+	uint32_t nsym = 0;
+	int r;
+	if ((r = br_bits(s, 2, &nsym)) != BR_OK) return r;
+	nsym++;
+	uint32_t sym[4];
+	uint32_t width = alphabet_bits(alphabet);
+	for (uint32_t i = 0; i < nsym; i++) {
+		if ((r = br_bits(s, width, &sym[i])) != BR_OK) return r;
+		if (sym[i] >= alphabet) return -1;
+		for (uint32_t j = 0; j < i; j++) {
+			if (sym[j] == sym[i]) return -1;
+		}
+	}
+	if (nsym == 1) {
+		huff_single(h, sym[0]);
+		return BR_OK;
+	}
+	static const uint8_t implied[5][4] = {
+		{ 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 1, 1, 0, 0 }, { 1, 2, 2, 0 }, { 2, 2, 2, 2 },
+	};
+	uint8_t lens[704];
+	c_memset(lens, 0, alphabet);
+	for (uint32_t i = 0; i < nsym; i++) lens[sym[i]] = implied[nsym][i];
+	if (nsym == 4) {
+		uint32_t tree_select = 0;
+		if ((r = br_bits(s, 1, &tree_select)) != BR_OK) return r;
+		if (tree_select) {
+			lens[sym[0]] = 1;
+			lens[sym[1]] = 2;
+			lens[sym[2]] = 3;
+			lens[sym[3]] = 3;
+		}
+	}
+	return huff_build(s, h, lens, alphabet) == 0 ? BR_OK : -1;
+}
+
+/* Prefix code for an alphabet of up to 704 symbols (sections 3.4 and 3.5). */
+static int read_prefix_code(struct brotli_stream *s, struct brotli_huff *h, uint32_t alphabet)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t hskip = 0;
+	int r;
+	if (alphabet > 704) return -1;
+	if ((r = br_bits(s, 2, &hskip)) != BR_OK) return r;
+	if (hskip == 1) return read_simple_code(s, h, alphabet);
+
+	/* Code lengths of the code length alphabet, in their fixed code. */
+	uint8_t cl[18];
+	c_memset(cl, 0, sizeof(cl));
+	int32_t space = 32;
+	uint32_t nonzero = 0;
+	uint32_t last = 0;
+	for (uint32_t i = hskip; i < 18; i++) {
+		int need = br_need(s, 4);
+		if (need < 0) return need;
+		uint32_t idx = c->bitbuf & 15u;
+		uint32_t L = cl_code_len[idx];
+		if (L > c->bitcount) return BR_MORE;
+		c->bitbuf >>= L;
+		c->bitcount -= L;
+		uint32_t v = cl_code_val[idx];
+		cl[cl_order[i]] = (uint8_t)v;
+		if (v) {
+			space -= (int32_t)(32u >> v);
+			nonzero++;
+			last = cl_order[i];
+			if (space <= 0) break;
+		}
+	}
+	if (nonzero != 1 && space != 0) return -1;
+
+	/* The code length tree is only needed while the lengths are read. */
+	uint32_t pool_mark = s->pool_used;
+	struct brotli_huff clh;
+	if (nonzero == 1) huff_single(&clh, last);
+	else if (huff_build(s, &clh, cl, 18) != 0) return -1;
+
+	uint8_t lens[704];
+	c_memset(lens, 0, alphabet);
+	uint32_t sym = 0;
+	uint32_t prev_len = 8;
+	uint32_t repeat = 0;
+	uint32_t repeat_len = 0;
+	space = 32768;
+	while (sym < alphabet && space > 0) {
+		uint32_t p = 0;
+		if ((r = huff_decode(s, &clh, &p)) != BR_OK) return r;
+		if (p < 16) {
+			repeat = 0;
+			lens[sym++] = (uint8_t)p;
+			if (p) {
+				prev_len = p;
+				space -= (int32_t)(32768u >> p);
+			}
+			continue;
+		}
+		/* 16 repeats the previous non-zero length, 17 repeats zero; runs of
+		 * the same code extend the previous repeat count.
+		 */
+		uint32_t extra_bits = (p == 16) ? 2u : 3u;
+		uint32_t new_len = (p == 16) ? prev_len : 0u;
+		if (repeat_len != new_len) {
+			repeat = 0;
+			repeat_len = new_len;
+		}
+		uint32_t old_repeat = repeat;
+		if (repeat > 0) repeat = (repeat - 2u) << extra_bits;
+		uint32_t extra = 0;
+		if ((r = br_bits(s, extra_bits, &extra)) != BR_OK) return r;
+		repeat += extra + 3u;
+		uint32_t delta = repeat - old_repeat;
+		if (delta > alphabet - sym) return -1;
+		for (uint32_t k = 0; k < delta; k++) lens[sym++] = (uint8_t)repeat_len;
+		if (repeat_len) space -= (int32_t)(delta << (15u - repeat_len));
+	}
+	if (space != 0) return -1;
+	s->pool_used = pool_mark;
+	return huff_build(s, h, lens, alphabet) == 0 ? BR_OK : -1;
+}
+
+/* 1..256 encoded as in section 9.2 (NBLTYPES, NTREES). */
+static int read_var8(struct brotli_stream *s, uint32_t *out)
+{
+	uint32_t b = 0, n = 0, v = 0;
+	int r;
+	if ((r = br_bits(s, 1, &b)) != BR_OK) return r;
+	if (!b) { *out = 1; return BR_OK; }
+	if ((r = br_bits(s, 3, &n)) != BR_OK) return r;
+	if ((r = br_bits(s, n, &v)) != BR_OK) return r;
+	*out = (1u << n) + v + 1u;
+	return BR_OK;
+}
+
+static int read_block_len(struct brotli_stream *s, const struct brotli_huff *h, uint32_t *out)
+{
+	uint32_t code = 0, v = 0;
+	int r;
+	if ((r = huff_decode(s, h, &code)) != BR_OK) return r;
+	if (code >= 26) return -1;
+	if ((r = br_bits(s, blen_extra[code], &v)) != BR_OK) return r;
+	*out = blen_base[code] + v;
+	return BR_OK;
+}
+
+/* Context map with zero run lengths and an optional inverse move-to-front
+ * (section 7.3).
+ */
+static int read_context_map(struct brotli_stream *s, uint8_t *map, uint32_t size, uint32_t ntrees)
+{
+	uint32_t rle = 0, rlemax = 0;
+	int r;
+	if ((r = br_bits(s, 1, &rle)) != BR_OK) return r;
+	if (rle) {
+		if ((r = br_bits(s, 4, &rlemax)) != BR_OK) return r;
+		rlemax++;
+	}
+	uint32_t pool_mark = s->pool_used;
+	struct brotli_huff h;
+	if ((r = read_prefix_code(s, &h, ntrees + rlemax)) != BR_OK) return r;
+	uint32_t i = 0;
+	while (i < size) {
+		uint32_t sym = 0;
+		if ((r = huff_decode(s, &h, &sym)) != BR_OK) return r;
+		if (sym == 0) {
+			map[i++] = 0;
+		} else if (sym <= rlemax) {
+			uint32_t v = 0;
+			if ((r = br_bits(s, sym, &v)) != BR_OK) return r;
+			uint32_t run = (1u << sym) + v;
+			if (run > size - i) return -1;
+			c_memset(map + i, 0, run);
+			i += run;
+		} else {
+			map[i++] = (uint8_t)(sym - rlemax);
+		}
+	}
+	s->pool_used = pool_mark;
+	uint32_t imtf = 0;
+	if ((r = br_bits(s, 1, &imtf)) != BR_OK) return r;
+	if (imtf) {
+		uint8_t mtf[256];
+		for (uint32_t k = 0; k < 256; k++) mtf[k] = (uint8_t)k;
+		for (uint32_t k = 0; k < size; k++) {
+			uint32_t idx = map[k];
+			uint8_t v = mtf[idx];
+			map[k] = v;
+			for (; idx; idx--) mtf[idx] = mtf[idx - 1];
+			mtf[0] = v;
+		}
+	}
+	return BR_OK;
+}
+
+static int br_stream_header(struct brotli_stream *s)
+{
+	uint32_t b = 0, n = 0;
+	uint32_t wbits = 16;
+	int r;
+	if ((r = br_bits(s, 1, &b)) != BR_OK) return r;
+	if (b) {
+		if ((r = br_bits(s, 3, &n)) != BR_OK) return r;
+		if (n) {
+			wbits = 17 + n;
+		} else {
+			if ((r = br_bits(s, 3, &n)) != BR_OK) return r;
+			if (n == 1) return -1; /* large window extension */
+			wbits = n ? 8 + n : 17;
+		}
+	}
+	s->window = (1u << wbits) - 16u;
+	return BR_OK;
+}
+
+static int br_meta_header(struct brotli_stream *s)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t v = 0;
+	int r;
+	if ((r = br_bits(s, 1, &v)) != BR_OK) return r;
+	s->last_mb = (uint8_t)v;
+	if (s->last_mb) {
+		if ((r = br_bits(s, 1, &v)) != BR_OK) return r;
+		if (v) { /* ISLASTEMPTY */
+			s->state = ST_END;
+			return BR_OK;
+		}
+	}
+	uint32_t mn = 0;
+	if ((r = br_bits(s, 2, &mn)) != BR_OK) return r;
+	if (mn == 3) {
+		/* Metadata: reserved bit, MSKIPBYTES, MSKIPLEN - 1, then skipped bytes. */
+		uint32_t nbytes = 0, len = 0;
+		if ((r = br_bits(s, 1, &v)) != BR_OK) return r;
+		if (v) return -1;
+		if ((r = br_bits(s, 2, &nbytes)) != BR_OK) return r;
+		for (uint32_t i = 0; i < nbytes; i++) {
+			if ((r = br_bits(s, 8, &v)) != BR_OK) return r;
+			if (i + 1 == nbytes && nbytes > 1 && v == 0) return -1;
+			len |= v << (8 * i);
+		}
+		if (br_align(s) != BR_OK) return -1;
+		c->mb_rem = nbytes ? len + 1u : 0u;
+		s->state = ST_SKIP;
+		return BR_OK;
+	}
+	uint32_t nibbles = mn + 4;
+	uint32_t len = 0;
+	for (uint32_t i = 0; i < nibbles; i++) {
+		if ((r = br_bits(s, 4, &v)) != BR_OK) return r;
+		if (i + 1 == nibbles && nibbles > 4 && v == 0) return -1;
+		len |= v << (4 * i);
+	}
+	c->mb_rem = len + 1u;
+	if (!s->last_mb) {
+		if ((r = br_bits(s, 1, &v)) != BR_OK) return r;
+		if (v) { /* ISUNCOMPRESSED */
+			if (br_align(s) != BR_OK) return -1;
+			s->state = ST_RAW;
+			return BR_OK;
+		}
+	}
+
+	s->pool_used = 0;
+	for (uint32_t k = 0; k < 3; k++) {
+		if ((r = read_var8(s, &s->nbltypes[k])) != BR_OK) return r;
+		c->btype[k] = 0;
+		c->btype_prev[k] = 1;
+		c->blen[k] = 1u << 24;
+		if (s->nbltypes[k] < 2) continue;
+		if ((r = read_prefix_code(s, &s->btype_tree[k], s->nbltypes[k] + 2u)) != BR_OK) return r;
+		if ((r = read_prefix_code(s, &s->blen_tree[k], 26)) != BR_OK) return r;
+		if ((r = read_block_len(s, &s->blen_tree[k], &c->blen[k])) != BR_OK) return r;
+	}
+	if ((r = br_bits(s, 2, &s->npostfix)) != BR_OK) return r;
+	if ((r = br_bits(s, 4, &s->ndirect)) != BR_OK) return r;
+	s->ndirect <<= s->npostfix;
+	for (uint32_t i = 0; i < s->nbltypes[0]; i++) {
+		if ((r = br_bits(s, 2, &v)) != BR_OK) return r;
+		s->cmode[i] = (uint8_t)v;
+	}
+
+	uint32_t ntrees_lit = 0, ntrees_dist = 0;
+	if ((r = read_var8(s, &ntrees_lit)) != BR_OK) return r;
+	if (ntrees_lit >= 2) {
+		if ((r = read_context_map(s, s->cmap_lit, 64u * s->nbltypes[0], ntrees_lit)) != BR_OK) return r;
+	} else {
+		c_memset(s->cmap_lit, 0, 64u * s->nbltypes[0]);
+	}
+	if ((r = read_var8(s, &ntrees_dist)) != BR_OK) return r;
+	if (ntrees_dist >= 2) {
+		if ((r = read_context_map(s, s->cmap_dist, 4u * s->nbltypes[2], ntrees_dist)) != BR_OK) return r;
+	} else {
+		c_memset(s->cmap_dist, 0, 4u * s->nbltypes[2]);
+	}
+
+	for (uint32_t i = 0; i < ntrees_lit; i++) {
+		if ((r = read_prefix_code(s, &s->lit[i], 256)) != BR_OK) return r;
+	}
+	for (uint32_t i = 0; i < s->nbltypes[1]; i++) {
+		if ((r = read_prefix_code(s, &s->cmd[i], 704)) != BR_OK) return r;
+	}
+	uint32_t dist_alphabet = 16u + s->ndirect + (48u << s->npostfix);
+	for (uint32_t i = 0; i < ntrees_dist; i++) {
+		if ((r = read_prefix_code(s, &s->dist[i], dist_alphabet)) != BR_OK) return r;
+	}
+	s->state = ST_CMD;
+	return BR_OK;
+}
+
+/* Block type and count for category k once its current block runs out. */
+static int br_block_switch(struct brotli_stream *s, uint32_t k)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t n = s->nbltypes[k];
+	uint32_t code = 0;
+	int r;
+	if (n < 2) return -1;
+	if ((r = huff_decode(s, &s->btype_tree[k], &code)) != BR_OK) return r;
+	uint32_t t;
+	if (code == 0) t = c->btype_prev[k];
+	else if (code == 1) t = c->btype[k] + 1u;
+	else t = code - 2u;
+	if (t >= n) t -= n;
+	if ((r = read_block_len(s, &s->blen_tree[k], &c->blen[k])) != BR_OK) return r;
+	c->btype_prev[k] = c->btype[k];
+	c->btype[k] = t;
+	return BR_OK;
+}
+
+static int br_command(struct brotli_stream *s)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t sym = 0, iv = 0, cv = 0;
+	int r;
+	if (c->blen[1] == 0 && (r = br_block_switch(s, 1)) != BR_OK) return r;
+	c->blen[1]--;
+	if ((r = huff_decode(s, &s->cmd[c->btype[1]], &sym)) != BR_OK) return r;
+	uint32_t range = sym >> 6;
+	if (range > 10) return -1;
+	uint32_t ic = cmd_ins_code[range] + ((sym >> 3) & 7u);
+	uint32_t cc = cmd_copy_code[range] + (sym & 7u);
+	if ((r = br_bits(s, ins_extra[ic], &iv)) != BR_OK) return r;
+	if ((r = br_bits(s, copy_extra[cc], &cv)) != BR_OK) return r;
+	c->insert_rem = ins_base[ic] + iv;
+	c->copy_len = copy_base[cc] + cv;
+	c->implicit_dist = (uint8_t)(range < 2);
+	return BR_OK;
+}
+
+static int br_literal(struct brotli_stream *s)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t sym = 0;
+	int r;
+	if (c->mb_rem == 0) return -1;
+	if (c->blen[0] == 0 && (r = br_block_switch(s, 0)) != BR_OK) return r;
+	c->blen[0]--;
+	uint32_t p1 = s->out_len > 0 ? s->out[s->out_len - 1] : 0;
+	uint32_t p2 = s->out_len > 1 ? s->out[s->out_len - 2] : 0;
+	uint32_t t = c->btype[0];
+	uint32_t ctx;
+	switch (s->cmode[t]) {
+	case 0: ctx = p1 & 0x3fu; break;                                      /* LSB6 */
+	case 1: ctx = p1 >> 2; break;                                         /* MSB6 */
+	case 2: ctx = (uint32_t)ctx_utf8_p1[p1] | ctx_utf8_p2[p2]; break;      /* UTF8 */
+	default: ctx = ((uint32_t)ctx_signed[p1] << 3) | ctx_signed[p2]; break; /* Signed */
+	}
+	if ((r = huff_decode(s, &s->lit[s->cmap_lit[64u * t + ctx]], &sym)) != BR_OK) return r;
+	if (s->out_len >= s->out_cap) return BROTLI_FULL;
+	s->out[s->out_len++] = (uint8_t)sym;
+	c->insert_rem--;
+	c->mb_rem--;
+	return BR_OK;
+}
+
+/* Uppercases one UTF-8 sequence the way RFC 7932 does; returns its length. */
+static uint32_t upcase(uint8_t *p, uint32_t rem)
+{
+	if (p[0] < 0xc0u) {
+		if (p[0] >= 'a' && p[0] <= 'z') p[0] ^= 32u;
+		return 1;
+	}
+	if (p[0] < 0xe0u) {
+		if (rem > 1) p[1] ^= 32u;
+		return 2;
+	}
+	if (rem > 2) p[2] ^= 5u;
+	return 3;
+}
+
+static uint32_t transform_word(uint8_t *dst, const uint8_t *word, uint32_t len, uint32_t id)
+{
+	const struct br_transform *t = &transforms[id];
+	uint32_t n = 0;
+	for (const char *p = t->prefix; *p; p++) dst[n++] = (uint8_t)*p;
+	if (t->type >= BT_OMIT_FIRST_1) {
+		uint32_t skip = (uint32_t)t->type - BT_OMIT_FIRST_1 + 1u;
+		if (skip > len) skip = len;
+		word += skip;
+		len -= skip;
+	} else if (t->type >= BT_OMIT_LAST_1 && t->type <= BT_OMIT_LAST_9) {
+		len = (t->type > len) ? 0 : len - t->type;
+	}
+	uint8_t *w = dst + n;
+	c_memcpy(w, word, len);
+	n += len;
+	if (t->type == BT_UPPER_FIRST && len) {
+		upcase(w, len);
+	} else if (t->type == BT_UPPER_ALL) {
+		for (uint32_t i = 0; i < len;) i += upcase(w + i, len - i);
+	}
+	for (const char *p = t->suffix; *p; p++) dst[n++] = (uint8_t)*p;
+	return n;
+}
+
+/* Distance and copy of one command: a back-reference into the output, or a
+ * static dictionary word when the distance reaches past it.
+ */
+static int br_copy(struct brotli_stream *s)
+{
+	struct brotli_cursor *c = &s->cur;
+	uint32_t code = 0;
+	uint32_t dist = 0;
+	int r;
+	if (!c->implicit_dist) {
+		if (c->blen[2] == 0 && (r = br_block_switch(s, 2)) != BR_OK) return r;
+		c->blen[2]--;
+		uint32_t ctx = c->copy_len > 4 ? 3u : c->copy_len - 2u;
+		if ((r = huff_decode(s, &s->dist[s->cmap_dist[4u * c->btype[2] + ctx]], &code)) != BR_OK) return r;
+		if (code >= 16u + s->ndirect) {
+			uint32_t x = code - s->ndirect - 16u;
+			uint32_t ndistbits = 1u + (x >> (s->npostfix + 1u));
+			uint32_t hcode = x >> s->npostfix;
+			uint32_t lcode = x & ((1u << s->npostfix) - 1u);
+			uint32_t offset = ((2u + (hcode & 1u)) << ndistbits) - 4u;
+			uint32_t extra = 0;
+			if ((r = br_bits(s, ndistbits, &extra)) != BR_OK) return r;
+			dist = ((offset + extra) << s->npostfix) + lcode + s->ndirect + 1u;
+		} else if (code >= 16u) {
+			dist = code - 15u;
+		}
+	}
+	if (code < 16u) {
+		int64_t d = (int64_t)c->dist[short_idx[code]] + short_delta[code];
+		if (d <= 0) return -1;
+		dist = (uint32_t)d;
+	}
+
+	size_t max_dist = s->out_len < s->window ? s->out_len : s->window;
+	if (dist > max_dist) {
+		uint32_t len = c->copy_len;
+		if (len < 4 || len > 24) return -1;
+		uint32_t id = dist - (uint32_t)max_dist - 1u;
+		uint32_t nbits = dict_nbits[len];
+		uint32_t word = id & ((1u << nbits) - 1u);
+		uint32_t tid = id >> nbits;
+		if (tid >= 121) return -1;
+		uint8_t buf[64];
+		uint32_t n = transform_word(buf, brotli_dict + dict_off[len] + word * len, len, tid);
+		if (n > c->mb_rem) return -1;
+		c->mb_rem -= n;
+		if (n > s->out_cap - s->out_len) {
+			n = (uint32_t)(s->out_cap - s->out_len);
+			c_memcpy(s->out + s->out_len, buf, n);
+			s->out_len += n;
+			return BROTLI_FULL;
+		}
+		c_memcpy(s->out + s->out_len, buf, n);
+		s->out_len += n;
+		return BR_OK;
+	}
+
+	size_t length = c->copy_len;
+	if (length > c->mb_rem) return -1;
+	c->mb_rem -= (uint32_t)length;
+	if (code != 0) {
+		c->dist[3] = c->dist[2];
+		c->dist[2] = c->dist[1];
+		c->dist[1] = c->dist[0];
+		c->dist[0] = dist;
+	}
+	int full = 0;
+	if (length > s->out_cap - s->out_len) {
+		length = s->out_cap - s->out_len;
+		full = 1;
+	}
+	uint8_t *dst = s->out + s->out_len;
+	const uint8_t *src = dst - dist;
+	for (size_t i = 0; i < length; i++) dst[i] = src[i];
+	s->out_len += length;
+	return full ? BROTLI_FULL : BR_OK;
+}
+
+/* Uncompressed or metadata bytes; copies (or drops) as it goes. */
+static int br_raw(struct brotli_stream *s, int keep)
+{
+	struct brotli_cursor *c = &s->cur;
+	while (c->mb_rem) {
+		if (keep && s->out_len >= s->out_cap) return BROTLI_FULL;
+		if (c->bitcount >= 8u) {
+			/* Whole bytes left in the bit buffer after the header. */
+			if (keep) s->out[s->out_len++] = (uint8_t)c->bitbuf;
+			c->bitbuf >>= 8;
+			c->bitcount -= 8;
+			c->mb_rem--;
+			continue;
+		}
+		size_t avail = s->in_len - c->in_pos;
+		if (avail == 0) return BR_MORE;
+		size_t n = c->mb_rem;
+		if (n > avail) n = avail;
+		if (keep) {
+			if (n > s->out_cap - s->out_len) n = s->out_cap - s->out_len;
+			c_memcpy(s->out + s->out_len, s->in + c->in_pos, n);
+			s->out_len += n;
+		}
+		c->in_pos += n;
+		c->mb_rem -= (uint32_t)n;
+	}
+	s->state = s->last_mb ? ST_END : ST_META;
+	return BR_OK;
+}
+
+/* Runs the state machine over the buffered input. The stream header, each
+ * meta-block header, command, literal and copy is all-or-nothing: if the
+ * input ends inside one, the cursor is rewound to its start.
+ */
+static int br_run(struct brotli_stream *s)
+{
+	for (;;) {
+		struct brotli_cursor m = s->cur;
+		int r;
+		switch (s->state) {
+		case ST_STREAM:
+			r = br_stream_header(s);
+			if (r == BR_OK) s->state = ST_META;
+			break;
+		case ST_META:
+			r = br_meta_header(s);
+			break;
+		case ST_RAW:
+		case ST_SKIP:
+			r = br_raw(s, s->state == ST_RAW);
+			if (r == BR_MORE) return BROTLI_NEED_INPUT;
+			break;
+		case ST_CMD:
+			if (s->cur.mb_rem == 0) {
+				s->state = s->last_mb ? ST_END : ST_META;
+				continue;
+			}
+			r = br_command(s);
+			if (r == BR_OK) s->state = ST_LIT;
+			break;
+		case ST_LIT:
+			if (s->cur.insert_rem == 0) {
+				/* A meta-block can end right after the literals. */
+				s->state = s->cur.mb_rem ? ST_COPY : ST_CMD;
+				continue;
+			}
+			r = br_literal(s);
+			break;
+		case ST_COPY:
+			r = br_copy(s);
+			if (r == BR_OK) s->state = ST_CMD;
+			break;
+		default:
+			return BROTLI_DONE;
+		}
+		if (r == BR_MORE) {
+			s->cur = m;
+			return BROTLI_NEED_INPUT;
+		}
+		if (r != BR_OK) return r; /* BROTLI_FULL or -1 */
+	}
+}
+
+void brotli_init(struct brotli_stream *s, uint8_t *out, size_t out_cap)
+{
+	if (!s) return;
+	s->out = out;
+	s->out_cap = out ? out_cap : 0;
+	s->out_len = 0;
+	s->status = 0;
+	s->state = ST_STREAM;
+	s->last_mb = 0;
+	s->window = 0;
+	c_memset(&s->cur, 0, sizeof(s->cur));
+	s->cur.dist[0] = 4;
+	s->cur.dist[1] = 11;
+	s->cur.dist[2] = 15;
+	s->cur.dist[3] = 16;
+	s->in_len = 0;
+	s->pool_used = 0;
+}
+
+int brotli_feed(struct brotli_stream *s, const uint8_t *in, size_t n)
+{
+	if (!s || (!in && n)) return -1;
+	if (s->status) return s->status;
+	for (;;) {
+		/* Keep only the unread tail (it starts at the last rewind mark). */
+		if (s->cur.in_pos) {
+			size_t rem = s->in_len - s->cur.in_pos;
+			for (size_t i = 0; i < rem; i++) s->in[i] = s->in[s->cur.in_pos + i];
+			s->in_len = rem;
+			s->cur.in_pos = 0;
+		}
+		size_t k = BROTLI_IN_BUF - s->in_len;
+		if (k > n) k = n;
+		if (k) c_memcpy(s->in + s->in_len, in, k);
+		s->in_len += k;
+		in += k;
+		n -= k;
+
+		int r = br_run(s);
+		if (r != BROTLI_NEED_INPUT) {
+			s->status = r;
+			return r;
+		}
+		if (n == 0) return BROTLI_NEED_INPUT;
+		/* A meta-block header larger than the buffer. */
+		if (k == 0) {
+			s->status = -1;
+			return -1;
+		}
+	}
+}
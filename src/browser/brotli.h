@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../core/syscall.h"
+
+/* Streaming Brotli decoder (RFC 7932) for Content-Encoding: br bodies.
+ *
+ * Works like inflate.h: the caller owns one flat output buffer and it is the
+ * whole sliding window, and input can arrive in pieces of any size. A
+ * meta-block header, command, literal or copy cut off by the end of a piece
+ * is rolled back and decoded again once brotli_feed() is called with more
+ * bytes.
+ *
+ * struct brotli_stream holds prefix code tables for the worst case of 256
+ * trees per category (about 1.3 MiB), so callers keep it in static storage.
+ */
+
+enum {
+	BROTLI_DICT_SIZE = 122784,
+};
+
+/* RFC 7932 Appendix A, in brotli_dict.c (source and checksum there). */
+extern const uint8_t brotli_dict[BROTLI_DICT_SIZE];
+
+/* brotli_feed() results, matching the INFLATE_* values. */
+enum {
+	BROTLI_NEED_INPUT = 0,
+	BROTLI_DONE = 1,  /* last meta-block decoded; later input is ignored */
+	BROTLI_FULL = 2,  /* output buffer filled; later input is ignored */
+};
+
+enum {
+	BROTLI_IN_BUF = 32768,
+	/* Fast tables (256 entries) plus sorted symbols for every tree:
+	 * literal, insert-and-copy and distance trees, block type and block
+	 * count trees, and one temporary tree while a header is read.
+	 */
+	BROTLI_POOL = 256 * (256 + 256) + 256 * (256 + 704) + 256 * (256 + 520) +
+		      3 * (256 + 258) + 3 * (256 + 26) + (256 + 272),
+};
+
+struct brotli_huff {
+	uint32_t off;    /* fast[256] then the symbols ordered by (len, code) */
+	uint16_t first_code[16];
+	uint16_t first_sym[16];
+	uint16_t count[16];
+	uint8_t maxbits; /* 0: a single symbol coded with zero bits */
+	uint16_t only;
+};
+
+/* Everything one command, literal or copy can change before it completes;
+ * saved as a whole for the rollback.
+ */
+struct brotli_cursor {
+	size_t in_pos;
+	uint32_t bitbuf;
+	uint32_t bitcount;
+	uint32_t mb_rem;        /* bytes left in the current meta-block */
+	uint32_t insert_rem;
+	uint32_t copy_len;
+	uint8_t implicit_dist;  /* insert-and-copy code below 128 */
+	uint32_t btype[3];      /* literal, insert-and-copy, distance */
+	uint32_t btype_prev[3];
+	uint32_t blen[3];
+	uint32_t dist[4];       /* dist[0] is the last distance */
+};
+
+struct brotli_stream {
+	uint8_t *out;
+	size_t out_cap;
+	size_t out_len;
+
+	int status; /* BROTLI_DONE, BROTLI_FULL or -1 once finished, else 0 */
+	uint8_t state;
+	uint8_t last_mb;
+	uint32_t window; /* (1 << WBITS) - 16 */
+
+	struct brotli_cursor cur;
+	size_t in_len;
+	uint8_t in[BROTLI_IN_BUF];
+
+	/* Current meta-block header. */
+	uint32_t nbltypes[3];
+	uint32_t npostfix;
+	uint32_t ndirect;
+	uint8_t cmode[256];
+	uint8_t cmap_lit[64 * 256];
+	uint8_t cmap_dist[4 * 256];
+	struct brotli_huff btype_tree[3];
+	struct brotli_huff blen_tree[3];
+	struct brotli_huff lit[256];
+	struct brotli_huff cmd[256];
+	struct brotli_huff dist[256];
+	uint32_t pool_used;
+	uint16_t pool[BROTLI_POOL];
+};
+
+void brotli_init(struct brotli_stream *s, uint8_t *out, size_t out_cap);
+
+/* Decodes as much of in[0..n) as possible into the output buffer.
+ * Returns BROTLI_NEED_INPUT, BROTLI_DONE, BROTLI_FULL, or -1 on corrupt
+ * data. s->out_len is the number of bytes produced so far.
+ */
+int brotli_feed(struct brotli_stream *s, const uint8_t *in, size_t n);
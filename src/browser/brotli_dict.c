@@ -0,0 +1,1926 @@
+/* The RFC 7932 static dictionary (Appendix A) as a C string literal; the same
+ * 122784 bytes libbrotlicommon's BrotliGetDictionary() returns.
+ * SHA-256: 20e42eb1b511c21806d4d227d07e5dd06877d8ce7b3a817f378f313653f35c70
+ */
+#include "brotli.h"
+
+const uint8_t brotli_dict[BROTLI_DICT_SIZE] =
+	"timedownlifeleftbackcodedatashowonlysitecityopenjustlikefreework"
+	"textyearoverbodyloveformbookplaylivelinehelphomesidemorewordlong"
+	"themviewfindpagedaysfullheadtermeachareafromtruemarkableuponhigh"
+	"datelandnewsevennextcasebothpostusedmadehandherewhatnameLinkblog"
+	"sizebaseheldmakemainuser') +holdendswithNewsreadweresigntakehave"
+	"gameseencallpathwellplusmenufilmpartjointhislistgoodneedwayswest"
+	"jobsmindalsologorichuseslastteamarmyfoodkingwilleastwardbestfire"
+	"Pageknowaway.pngmovethanloadgiveselfnotemuchfeedmanyrockicononce"
+	"lookhidediedHomerulehostajaxinfoclublawslesshalfsomesuchzone100%"
+	"onescareTimeracebluefourweekfacehopegavehardlostwhenparkkeptpass"
+	"shiproomHTMLplanTypedonesavekeepflaglinksoldfivetookratetownjump"
+	"thusdarkcardfilefearstaykillthatfallautoever.comtalkshopvotedeep"
+	"moderestturnbornbandfellroseurl(skinrolecomeactsagesmeetgold.jpg"
+	"itemvaryfeltthensenddropViewcopy1.0\"</a>stopelseliestourpack.gif"
+	"pastcss\?graymean&gt;rideshotlatesaidroadvar feeljohnrickportfast"
+	"'UA-dead</b>poorbilltypeU.S.woodmust2px;Inforankwidewantwalllead"
+	"[0];paulwavesure$('#waitmassarmsgoesgainlangpaid!-- lockunitroot"
+	"walkfirmwifexml\"songtest20pxkindrowstoolfontmailsafestarmapscore"
+	"rainflowbabyspansays4px;6px;artsfootrealwikiheatsteptriporg/lake"
+	"weaktoldFormcastfansbankveryrunsjulytask1px;goalgrewslowedgeid=\""
+	"sets5px;.js\?40pxif (soonseatnonetubezerosentreedfactintogiftharm"
+	"18pxcamehillboldzoomvoideasyringfillpeakinitcost3px;jacktagsbits"
+	"rolleditknewnear<!--growJSONdutyNamesaleyou lotspainjazzcoldeyes"
+	"fishwww.risktabsprev10pxrise25pxBlueding300,ballfordearnwildbox."
+	"fairlackverspairjunetechif(!pickevil$(\"#warmlorddoespull,000idea"
+	"drawhugespotfundburnhrefcellkeystickhourlossfuel12pxsuitdealRSS\""
+	"agedgreyGET\"easeaimsgirlaids8px;navygridtips#999warsladycars); }"
+	"php\?helltallwhomzh:\345*/\015\012 100hall.\012\012A7px;pushchat0px;crew*/</hash"
+	"75pxflatrare && tellcampontolaidmissskiptentfinemalegetsplot400,"
+	"\015\012\015\012coolfeet.php<br>ericmostguidbelldeschairmathatom/img&#82luck"
+	"cent000;tinygonehtmlselldrugFREEnodenick\?id=losenullvastwindRSS "
+	"wearrelybeensamedukenasacapewishgulfT23:hitsslotgatekickblurthey"
+	"15px''););\">msiewinsbirdsortbetaseekT18:ordstreemall60pxfarm\342\200\231s"
+	"boys[0].');\"POSTbearkids);}}marytend(UK)quadzh:\346-siz----prop');\015"
+	"liftT19:viceandydebt>RSSpoolneckblowT16:doorevalT17:letsfailoral"
+	"pollnovacolsgene \342\200\224softrometillross<h3>pourfadepink<tr>mini)|!("
+	"minezh:\350barshear00);milk -->ironfreddiskwentsoilputs/js/holyT22:"
+	"ISBNT20:adamsees<h2>json', 'contT21: RSSloopasiamoon</p>soulLINE"
+	"fortcartT14:<h1>80px!--<9px;T04:mike:46ZniceinchYorkricezh:\344'));"
+	"puremageparatonebond:37Z_of_']);000,zh:\347tankyardbowlbush:56ZJava"
+	"30px\012|}\012%C3%:34ZjeffEXPIcashvisagolfsnowzh:\351quer.csssickmeatmin."
+	"binddellhirepicsrent:36ZHTTP-201fotowolfEND xbox:54ZBODYdick;\012}\012"
+	"exit:35Zvarsbeat'});diet999;anne}}</[i].Langkm\302\262wiretoysaddsseal"
+	"alex;\012\011}echonine.org005)tonyjewssandlegsroof000) 200winegeardogs"
+	"bootgarycutstyletemption.xmlcockgang$('.50pxPh.Dmiscalanloandesk"
+	"mileryanunixdisc);}\012dustclip).\012\01270px-200DVDs7]><tapedemoi++)wage"
+	"europhiloptsholeFAQsasin-26TlabspetsURL bulkcook;}\015\012HEAD[0])abbr"
+	"juan(198leshtwin</i>sonyguysfuckpipe|-\012!002)ndow[1];[];\012Log salt"
+	"\015\012\011\011bangtrimbath){\015\01200px\012});ko:\354feesad>\015s:// [];tollplug(){\012{\015\012 "
+	".js'200pdualboat.JPG);\012}quot);\012\012');\012\015\012}\015201420152016201720182019"
+	"2020202120222023202420252026202720282029203020312032203320342035"
+	"2036203720132012201120102009200820072006200520042003200220012000"
+	"1999199819971996199519941993199219911990198919881987198619851984"
+	"1983198219811980197919781977197619751974197319721971197019691968"
+	"1967196619651964196319621961196019591958195719561955195419531952"
+	"1951195010001024139400009999comom\303\241sesteestaperotodohacecadaa\303\261o"
+	"biend\303\255aas\303\255vidacasootroforosolootracualdijosidograntipotemadebe"
+	"algoqu\303\251estonadatrespococasabajotodasinoaguapuesunosantediceluis"
+	"ellamayozonaamorpisoobraclicellodioshoracasi\320\267\320\260\320\275\320\260\320\276\320\274\321\200\320\260\321\200\321\203"
+	"\321\202\320\260\320\275\320\265\320\277\320\276\320\276\321\202\320\270\320\267\320\275\320\276\320\264\320\276\321\202\320\276\320\266\320\265\320\276\320\275\320\270\321\205\320\235\320\260\320\265\320\265\320\261\321\213\320\274\321\213\320\222\321\213"
+	"\321\201\320\276\320\262\321\213\320\262\320\276\320\235\320\276\320\276\320\261\320\237\320\276\320\273\320\270\320\275\320\270\320\240\320\244\320\235\320\265\320\234\321\213\321\202\321\213\320\236\320\275\320\270\320\274\320\264\320\260\320\227\320\260"
+	"\320\224\320\260\320\235\321\203\320\236\320\261\321\202\320\265\320\230\320\267\320\265\320\271\320\275\321\203\320\274\320\274\320\242\321\213\321\203\320\266\331\201\331\212\330\243\331\206\331\205\330\247\331\205\330\271\331\203\331\204\330\243\331\210"
+	"\330\261\330\257\331\212\330\247\331\201\331\211\331\207\331\210\331\204\331\205\331\204\331\203\330\247\331\210\331\204\331\207\330\250\330\263\330\247\331\204\330\245\331\206\331\207\331\212\330\243\331\212\331\202\330\257\331\207\331\204\330\253\331\205"
+	"\330\250\331\207\331\204\331\210\331\204\331\212\330\250\331\204\330\247\331\212\330\250\331\203\330\264\331\212\330\247\331\205\330\243\331\205\331\206\330\252\330\250\331\212\331\204\331\206\330\255\330\250\331\207\331\205\331\205\330\264\331\210\330\264"
+	"firstvideolightworldmediawhitecloseblackrightsmallbooksplacemusi"
+	"cfieldorderpointvalueleveltableboardhousegroupworksyearsstatetod"
+	"aywaterstartstyledeathpowerphonenighterrorinputabouttermstitleto"
+	"olseventlocaltimeslargewordsgamesshortspacefocusclearmodelblockg"
+	"uideradiosharewomenagainmoneyimagenamesyounglineslatercolorgreen"
+	"front&amp;watchforcepricerulesbeginaftervisitissueareasbelowinde"
+	"xtotalhourslabelprintpressbuiltlinksspeedstudytradefoundsenseund"
+	"ershownformsrangeaddedstillmovedtakenaboveflashfixedoftenothervi"
+	"ewschecklegalriveritemsquickshapehumanexistgoingmoviethirdbasicp"
+	"eacestagewidthloginideaswrotepagesusersdrivestorebreaksouthvoice"
+	"sitesmonthwherebuildwhichearthforumthreesportpartyClicklowerlive"
+	"sclasslayerentrystoryusagesoundcourtyour birthpopuptypesapplyIma"
+	"gebeinguppernoteseveryshowsmeansextramatchtrackknownearlybegansu"
+	"perpapernorthlearngivennamedendedTermspartsGroupbrandusingwomanf"
+	"alsereadyaudiotakeswhile.com/livedcasesdailychildgreatjudgethose"
+	"unitsneverbroadcoastcoverapplefilescyclesceneplansclickwritequee"
+	"npieceemailframeolderphotolimitcachecivilscaleenterthemetheretou"
+	"chboundroyalaskedwholesincestock namefaithheartemptyofferscopeow"
+	"nedmightalbumthinkbloodarraymajortrustcanonunioncountvalidstoneS"
+	"tyleLoginhappyoccurleft:freshquitefilmsgradeneedsurbanfightbasis"
+	"hoverauto;route.htmlmixedfinalYour slidetopicbrownalonedrawnspli"
+	"treachRightdatesmarchquotegoodsLinksdoubtasyncthumballowchiefyou"
+	"thnovel10px;serveuntilhandsCheckSpacequeryjamesequaltwice0,000St"
+	"artpanelsongsroundeightshiftworthpostsleadsweeksavoidthesemilesp"
+	"lanesmartalphaplantmarksratesplaysclaimsalestextsstarswrong</h3>"
+	"thing.org/multiheardPowerstandtokensolid(thisbringshipsstafftrie"
+	"dcallsfullyfactsagentThis //-->adminegyptEvent15px;Emailtrue\"cro"
+	"ssspentblogsbox\">notedleavechinasizesguest</h4>robotheavytrue,se"
+	"vengrandcrimesignsawaredancephase><!--en_US&#39;200px_namelatine"
+	"njoyajax.ationsmithU.S. holdspeterindianav\">chainscorecomesdoing"
+	"priorShare1990sromanlistsjapanfallstrialowneragree</h2>abusealer"
+	"topera\"-//WcardshillsteamsPhototruthclean.php\?saintmetallouismea"
+	"ntproofbriefrow\">genretrucklooksValueFrame.net/-->\012<try {\012var ma"
+	"kescostsplainadultquesttrainlaborhelpscausemagicmotortheir250pxl"
+	"eaststepsCountcouldglasssidesfundshotelawardmouthmovesparisgives"
+	"dutchtexasfruitnull,||[];top\">\012<!--POST\"ocean<br/>floorspeakdept"
+	"h sizebankscatchchart20px;aligndealswould50px;url=\"parksmouseMos"
+	"t ...</amongbrainbody none;basedcarrydraftreferpage_home.meterde"
+	"laydreamprovejoint</tr>drugs<!-- aprilidealallenexactforthcodesl"
+	"ogicView seemsblankports (200saved_linkgoalsgrantgreekhomesrings"
+	"rated30px;whoseparse();\" Blocklinuxjonespixel');\">);if(-leftdavi"
+	"dhorseFocusraiseboxesTrackement</em>bar\">.src=toweralt=\"cablehen"
+	"ry24px;setupitalysharpminortastewantsthis.resetwheelgirls/css/10"
+	"0%;clubsstuffbiblevotes 1000korea});\015\012bandsqueue= {};80px;cking{"
+	"\015\012\011\011aheadclockirishlike ratiostatsForm\"yahoo)[0];Aboutfinds</h1>"
+	"debugtasksURL =cells})();12px;primetellsturns0x600.jpg\"spainbeac"
+	"htaxesmicroangel--></giftssteve-linkbody.});\012\011mount (199FAQ</rog"
+	"erfrankClass28px;feeds<h1><scotttests22px;drink) || lewisshall#0"
+	"39; for lovedwaste00px;ja:\343\202simon<fontreplymeetsuntercheaptightB"
+	"rand) != dressclipsroomsonkeymobilmain.Name platefunnytreescom/\""
+	"1.jpgwmodeparamSTARTleft idden, 201);\012}\012form.viruschairtranswors"
+	"tPagesitionpatch<!--\012o-cacfirmstours,000 asiani++){adobe')[0]id="
+	"10both;menu .2.mi.png\"kevincoachChildbruce2.jpgURL)+.jpg|suitesl"
+	"iceharry120\" sweettr>\015\012name=diegopage swiss-->\012\012#fff;\">Log.com\"t"
+	"reatsheet) && 14px;sleepntentfiledja:\343\203id=\"cName\"worseshots-box-"
+	"delta\012&lt;bears:48Z<data-rural</a> spendbakershops= \"\";php\">ctio"
+	"n13px;brianhellosize=o=%2F joinmaybe<img img\">, fjsimg\" \")[0]MTo"
+	"pBType\"newlyDanskczechtrailknows</h5>faq\">zh-cn10);\012-1\");type=bl"
+	"uestrulydavis.js';>\015\012<!steel you h2>\015\012form jesus100% menu.\015\012\011\015\012w"
+	"alesrisksumentddingb-likteachgif\" vegasdanskeestishqipsuomisobre"
+	"desdeentretodospuedea\303\261osest\303\241tienehastaotrospartedondenuevohace"
+	"rformamismomejormundoaqu\303\255d\303\255ass\303\263loayudafechatodastantomenosdat"
+	"osotrassitiomuchoahoralugarmayorestoshorastenerantesfotosestaspa"
+	"\303\255snuevasaludforosmedioquienmesespoderchileser\303\241vecesdecirjos\303\251e"
+	"starventagrupohechoellostengoamigocosasnivelgentemismaairesjulio"
+	"temashaciafavorjuniolibrepuntobuenoautorabrilbuenatextomarzosabe"
+	"rlistaluegoc\303\263moenerojuegoper\303\272haberestoynuncamujervalorfueralib"
+	"rogustaigualvotoscasosgu\303\255apuedosomosavisousteddebennochebuscafa"
+	"ltaeurosseriedichocursoclavecasasle\303\263nplazolargoobrasvistaapoyoj"
+	"untotratavistocrearcampohemoscincocargopisosordenhacen\303\241readisco"
+	"pedrocercapuedapapelmenor\303\272tilclarojorgecalleponertardenadiemarc"
+	"asigueellassiglocochemotosmadreclaserestoni\303\261oquedapasarbancohij"
+	"osviajepablo\303\251stevienereinodejarfondocanalnorteletracausatomarma"
+	"noslunesautosvillavendopesartipostengamarcollevapadreunidovamosz"
+	"onasambosbandamariaabusomuchasubirriojavivirgradochicaall\303\255joven"
+	"dichaestantalessalirsuelopesosfinesllamabusco\303\251stalleganegroplaz"
+	"ahumorpagarjuntadobleislasbolsaba\303\261ohablalucha\303\201readicenjugarnot"
+	"asvalleall\303\241cargadolorabajoest\303\251gustomentemariofirmacostofichapl"
+	"atahogarartesleyesaquelmuseobasespocosmitadcielochicomiedoganars"
+	"antoetapadebesplayaredessietecortecoreadudasdeseoviejodeseaaguas"
+	"&quot;domaincommonstatuseventsmastersystemactionbannerremovescro"
+	"llupdateglobalmediumfilternumberchangeresultpublicscreenchooseno"
+	"rmaltravelissuessourcetargetspringmodulemobileswitchphotosborder"
+	"regionitselfsocialactivecolumnrecordfollowtitle>eitherlengthfami"
+	"lyfriendlayoutauthorcreatereviewsummerserverplayedplayerexpandpo"
+	"licyformatdoublepointsseriespersonlivingdesignmonthsforcesunique"
+	"weightpeopleenergynaturesearchfigurehavingcustomoffsetletterwind"
+	"owsubmitrendergroupsuploadhealthmethodvideosschoolfutureshadowde"
+	"batevaluesObjectothersrightsleaguechromesimplenoticesharedending"
+	"seasonreportonlinesquarebuttonimagesenablemovinglatestwinterFran"
+	"ceperiodstrongrepeatLondondetailformeddemandsecurepassedtogglepl"
+	"acesdevicestaticcitiesstreamyellowattackstreetflighthiddeninfo\">"
+	"openedusefulvalleycausesleadersecretseconddamagesportsexceptrati"
+	"ngsignedthingseffectfieldsstatesofficevisualeditorvolumeReportmu"
+	"seummoviesparentaccessmostlymother\" id=\"marketgroundchancesurvey"
+	"beforesymbolmomentspeechmotioninsidematterCenterobjectexistsmidd"
+	"leEuropegrowthlegacymannerenoughcareeransweroriginportalclientse"
+	"lectrandomclosedtopicscomingfatheroptionsimplyraisedescapechosen"
+	"churchdefinereasoncorneroutputmemoryiframepolicemodelsNumberduri"
+	"ngoffersstyleskilledlistedcalledsilvermargindeletebetterbrowseli"
+	"mitsGlobalsinglewidgetcenterbudgetnowrapcreditclaimsenginesafety"
+	"choicespirit-stylespreadmakingneededrussiapleaseextentScriptbrok"
+	"enallowschargedividefactormember-basedtheoryconfigaroundworkedhe"
+	"lpedChurchimpactshouldalwayslogo\" bottomlist\">){var prefixorange"
+	"Header.push(couplegardenbridgelaunchReviewtakingvisionlittledati"
+	"ngButtonbeautythemesforgotSearchanchoralmostloadedChangereturnst"
+	"ringreloadMobileincomesupplySourceordersviewed&nbsp;courseAbout "
+	"island<html cookiename=\"amazonmodernadvicein</a>: The dialoghous"
+	"esBEGIN MexicostartscentreheightaddingIslandassetsEmpireSchoolef"
+	"fortdirectnearlymanualSelect.\012\012Onejoinedmenu\">Philipawardshandle"
+	"importOfficeregardskillsnationSportsdegreeweekly (e.g.behinddoct"
+	"orloggedunited</b></beginsplantsassistartistissued300px|canadaag"
+	"encyschemeremainBrazilsamplelogo\">beyond-scaleacceptservedmarine"
+	"Footercamera</h1>\012_form\"leavesstress\" />\015\012.gif\" onloadloaderOxfo"
+	"rdsistersurvivlistenfemaleDesignsize=\"appealtext\">levelsthankshi"
+	"gherforcedanimalanyoneAfricaagreedrecentPeople<br />wonderprices"
+	"turned|| {};main\">inlinesundaywrap\">failedcensusminutebeaconquot"
+	"es150px|estateremoteemail\"linkedright;signalformal1.htmlsignuppr"
+	"incefloat:.png\" forum.AccesspaperssoundsextendHeightsliderUTF-8\""
+	"&amp; Before. WithstudioownersmanageprofitjQueryannualparamsboug"
+	"htfamousgooglelongeri++) {israelsayingdecidehome\">headerensurebr"
+	"anchpiecesblock;statedtop\"><racingresize--&gt;pacitysexualbureau"
+	".jpg\" 10,000obtaintitlesamount, Inc.comedymenu\" lyricstoday.inde"
+	"edcounty_logo.FamilylookedMarketlse ifPlayerturkey);var forestgi"
+	"vingerrorsDomain}else{insertBlog</footerlogin.fasteragents<body "
+	"10px 0pragmafridayjuniordollarplacedcoversplugin5,000 page\">bost"
+	"on.test(avatartested_countforumsschemaindex,filledsharesreaderal"
+	"ert(appearSubmitline\">body\">\012* TheThoughseeingjerseyNews</verify"
+	"expertinjurywidth=CookieSTART across_imagethreadnativepocketbox\""
+	">\012System DavidcancertablesprovedApril reallydriveritem\">more\">bo"
+	"ardscolorscampusfirst || [];media.guitarfinishwidth:showedOther "
+	".php\" assumelayerswilsonstoresreliefswedenCustomeasily your Stri"
+	"ng\012\012Whiltaylorclear:resortfrenchthough\") + \"<body>buyingbrandsMe"
+	"mbername\">oppingsector5px;\">vspacepostermajor coffeemartinmature"
+	"happen</nav>kansaslink\">Images=falsewhile hspace0&amp; \012\012In  pow"
+	"erPolski-colorjordanBottomStart -count2.htmlnews\">01.jpgOnline-r"
+	"ightmillerseniorISBN 00,000 guidesvalue)ectionrepair.xml\"  right"
+	"s.html-blockregExp:hoverwithinvirginphones</tr>\015using \012\011var >');"
+	"\012\011</td>\012</tr>\012bahasabrasilgalegomagyarpolskisrpski\330\261\330\257\331\210\344\270\255\346\226\207\347\256"
+	"\200\344\275\223\347\271\201\351\253\224\344\277\241\346\201\257\344\270\255\345\233\275\346\210\221\344\273\254\344\270\200\344\270\252\345\205\254\345\217\270\347\256\241\347\220\206\350\256\272\345\235\233\345\217\257\344\273\245\346\234\215\345\212\241"
+	"\346\227\266\351\227\264\344\270\252\344\272\272\344\272\247\345\223\201\350\207\252\345\267\261\344\274\201\344\270\232\346\237\245\347\234\213\345\267\245\344\275\234\350\201\224\347\263\273\346\262\241\346\234\211\347\275\221\347\253\231\346\211\200\346"
+	"\234\211\350\257\204\350\256\272\344\270\255\345\277\203\346\226\207\347\253\240\347\224\250\346\210\267\351\246\226\351\241\265\344\275\234\350\200\205\346\212\200\346\234\257\351\227\256\351\242\230\347\233\270\345\205\263\344\270\213\350\275\275\346\220"
+	"\234\347\264\242\344\275\277\347\224\250\350\275\257\344\273\266\345\234\250\347\272\277\344\270\273\351\242\230\350\265\204\346\226\231\350\247\206\351\242\221\345\233\236\345\244\215\346\263\250\345\206\214\347\275\221\347\273\234\346\224\266\350\227\217"
+	"\345\206\205\345\256\271\346\216\250\350\215\220\345\270\202\345\234\272\346\266\210\346\201\257\347\251\272\351\227\264\345\217\221\345\270\203\344\273\200\344\271\210\345\245\275\345\217\213\347\224\237\346\264\273\345\233\276\347\211\207\345\217\221\345"
+	"\261\225\345\246\202\346\236\234\346\211\213\346\234\272\346\226\260\351\227\273\346\234\200\346\226\260\346\226\271\345\274\217\345\214\227\344\272\254\346\217\220\344\276\233\345\205\263\344\272\216\346\233\264\345\244\232\350\277\231\344\270\252\347\263"
+	"\273\347\273\237\347\237\245\351\201\223\346\270\270\346\210\217\345\271\277\345\221\212\345\205\266\344\273\226\345\217\221\350\241\250\345\256\211\345\205\250\347\254\254\344\270\200\344\274\232\345\221\230\350\277\233\350\241\214\347\202\271\345\207\273"
+	"\347\211\210\346\235\203\347\224\265\345\255\220\344\270\226\347\225\214\350\256\276\350\256\241\345\205\215\350\264\271\346\225\231\350\202\262\345\212\240\345\205\245\346\264\273\345\212\250\344\273\226\344\273\254\345\225\206\345\223\201\345\215\232\345"
+	"\256\242\347\216\260\345\234\250\344\270\212\346\265\267\345\246\202\344\275\225\345\267\262\347\273\217\347\225\231\350\250\200\350\257\246\347\273\206\347\244\276\345\214\272\347\231\273\345\275\225\346\234\254\347\253\231\351\234\200\350\246\201\344\273"
+	"\267\346\240\274\346\224\257\346\214\201\345\233\275\351\231\205\351\223\276\346\216\245\345\233\275\345\256\266\345\273\272\350\256\276\346\234\213\345\217\213\351\230\205\350\257\273\346\263\225\345\276\213\344\275\215\347\275\256\347\273\217\346\265\216"
+	"\351\200\211\346\213\251\350\277\231\346\240\267\345\275\223\345\211\215\345\210\206\347\261\273\346\216\222\350\241\214\345\233\240\344\270\272\344\272\244\346\230\223\346\234\200\345\220\216\351\237\263\344\271\220\344\270\215\350\203\275\351\200\232\350"
+	"\277\207\350\241\214\344\270\232\347\247\221\346\212\200\345\217\257\350\203\275\350\256\276\345\244\207\345\220\210\344\275\234\345\244\247\345\256\266\347\244\276\344\274\232\347\240\224\347\251\266\344\270\223\344\270\232\345\205\250\351\203\250\351\241"
+	"\271\347\233\256\350\277\231\351\207\214\350\277\230\346\230\257\345\274\200\345\247\213\346\203\205\345\206\265\347\224\265\350\204\221\346\226\207\344\273\266\345\223\201\347\211\214\345\270\256\345\212\251\346\226\207\345\214\226\350\265\204\346\272\220"
+	"\345\244\247\345\255\246\345\255\246\344\271\240\345\234\260\345\235\200\346\265\217\350\247\210\346\212\225\350\265\204\345\267\245\347\250\213\350\246\201\346\261\202\346\200\216\344\271\210\346\227\266\345\200\231\345\212\237\350\203\275\344\270\273\350"
+	"\246\201\347\233\256\345\211\215\350\265\204\350\256\257\345\237\216\345\270\202\346\226\271\346\263\225\347\224\265\345\275\261\346\213\233\350\201\230\345\243\260\346\230\216\344\273\273\344\275\225\345\201\245\345\272\267\346\225\260\346\215\256\347\276"
+	"\216\345\233\275\346\261\275\350\275\246\344\273\213\347\273\215\344\275\206\346\230\257\344\272\244\346\265\201\347\224\237\344\272\247\346\211\200\344\273\245\347\224\265\350\257\235\346\230\276\347\244\272\344\270\200\344\272\233\345\215\225\344\275\215"
+	"\344\272\272\345\221\230\345\210\206\346\236\220\345\234\260\345\233\276\346\227\205\346\270\270\345\267\245\345\205\267\345\255\246\347\224\237\347\263\273\345\210\227\347\275\221\345\217\213\345\270\226\345\255\220\345\257\206\347\240\201\351\242\221\351"
+	"\201\223\346\216\247\345\210\266\345\234\260\345\214\272\345\237\272\346\234\254\345\205\250\345\233\275\347\275\221\344\270\212\351\207\215\350\246\201\347\254\254\344\272\214\345\226\234\346\254\242\350\277\233\345\205\245\345\217\213\346\203\205\350\277"
+	"\231\344\272\233\350\200\203\350\257\225\345\217\221\347\216\260\345\237\271\350\256\255\344\273\245\344\270\212\346\224\277\345\272\234\346\210\220\344\270\272\347\216\257\345\242\203\351\246\231\346\270\257\345\220\214\346\227\266\345\250\261\344\271\220"
+	"\345\217\221\351\200\201\344\270\200\345\256\232\345\274\200\345\217\221\344\275\234\345\223\201\346\240\207\345\207\206\346\254\242\350\277\216\350\247\243\345\206\263\345\234\260\346\226\271\344\270\200\344\270\213\344\273\245\345\217\212\350\264\243\344"
+	"\273\273\346\210\226\350\200\205\345\256\242\346\210\267\344\273\243\350\241\250\347\247\257\345\210\206\345\245\263\344\272\272\346\225\260\347\240\201\351\224\200\345\224\256\345\207\272\347\216\260\347\246\273\347\272\277\345\272\224\347\224\250\345\210"
+	"\227\350\241\250\344\270\215\345\220\214\347\274\226\350\276\221\347\273\237\350\256\241\346\237\245\350\257\242\344\270\215\350\246\201\346\234\211\345\205\263\346\234\272\346\236\204\345\276\210\345\244\232\346\222\255\346\224\276\347\273\204\347\273\207"
+	"\346\224\277\347\255\226\347\233\264\346\216\245\350\203\275\345\212\233\346\235\245\346\272\220\346\231\202\351\226\223\347\234\213\345\210\260\347\203\255\351\227\250\345\205\263\351\224\256\344\270\223\345\214\272\351\235\236\345\270\270\350\213\261\350"
+	"\257\255\347\231\276\345\272\246\345\270\214\346\234\233\347\276\216\345\245\263\346\257\224\350\276\203\347\237\245\350\257\206\350\247\204\345\256\232\345\273\272\350\256\256\351\203\250\351\227\250\346\204\217\350\247\201\347\262\276\345\275\251\346\227"
+	"\245\346\234\254\346\217\220\351\253\230\345\217\221\350\250\200\346\226\271\351\235\242\345\237\272\351\207\221\345\244\204\347\220\206\346\235\203\351\231\220\345\275\261\347\211\207\351\223\266\350\241\214\350\277\230\346\234\211\345\210\206\344\272\253"
+	"\347\211\251\345\223\201\347\273\217\350\220\245\346\267\273\345\212\240\344\270\223\345\256\266\350\277\231\347\247\215\350\257\235\351\242\230\350\265\267\346\235\245\344\270\232\345\212\241\345\205\254\345\221\212\350\256\260\345\275\225\347\256\200\344"
+	"\273\213\350\264\250\351\207\217\347\224\267\344\272\272\345\275\261\345\223\215\345\274\225\347\224\250\346\212\245\345\221\212\351\203\250\345\210\206\345\277\253\351\200\237\345\222\250\350\257\242\346\227\266\345\260\232\346\263\250\346\204\217\347\224"
+	"\263\350\257\267\345\255\246\346\240\241\345\272\224\350\257\245\345\216\206\345\217\262\345\217\252\346\230\257\350\277\224\345\233\236\350\264\255\344\271\260\345\220\215\347\247\260\344\270\272\344\272\206\346\210\220\345\212\237\350\257\264\346\230\216"
+	"\344\276\233\345\272\224\345\255\251\345\255\220\344\270\223\351\242\230\347\250\213\345\272\217\344\270\200\350\210\254\346\234\203\345\223\241\345\217\252\346\234\211\345\205\266\345\256\203\344\277\235\346\212\244\350\200\214\344\270\224\344\273\212\345"
+	"\244\251\347\252\227\345\217\243\345\212\250\346\200\201\347\212\266\346\200\201\347\211\271\345\210\253\350\256\244\344\270\272\345\277\205\351\241\273\346\233\264\346\226\260\345\260\217\350\257\264\346\210\221\345\200\221\344\275\234\344\270\272\345\252"
+	"\222\344\275\223\345\214\205\346\213\254\351\202\243\344\271\210\344\270\200\346\240\267\345\233\275\345\206\205\346\230\257\345\220\246\346\240\271\346\215\256\347\224\265\350\247\206\345\255\246\351\231\242\345\205\267\346\234\211\350\277\207\347\250\213"
+	"\347\224\261\344\272\216\344\272\272\346\211\215\345\207\272\346\235\245\344\270\215\350\277\207\346\255\243\345\234\250\346\230\216\346\230\237\346\225\205\344\272\213\345\205\263\347\263\273\346\240\207\351\242\230\345\225\206\345\212\241\350\276\223\345"
+	"\205\245\344\270\200\347\233\264\345\237\272\347\241\200\346\225\231\345\255\246\344\272\206\350\247\243\345\273\272\347\255\221\347\273\223\346\236\234\345\205\250\347\220\203\351\200\232\347\237\245\350\256\241\345\210\222\345\257\271\344\272\216\350\211"
+	"\272\346\234\257\347\233\270\345\206\214\345\217\221\347\224\237\347\234\237\347\232\204\345\273\272\347\253\213\347\255\211\347\272\247\347\261\273\345\236\213\347\273\217\351\252\214\345\256\236\347\216\260\345\210\266\344\275\234\346\235\245\350\207\252"
+	"\346\240\207\347\255\276\344\273\245\344\270\213\345\216\237\345\210\233\346\227\240\346\263\225\345\205\266\344\270\255\345\200\213\344\272\272\344\270\200\345\210\207\346\214\207\345\215\227\345\205\263\351\227\255\351\233\206\345\233\242\347\254\254\344"
+	"\270\211\345\205\263\346\263\250\345\233\240\346\255\244\347\205\247\347\211\207\346\267\261\345\234\263\345\225\206\344\270\232\345\271\277\345\267\236\346\227\245\346\234\237\351\253\230\347\272\247\346\234\200\350\277\221\347\273\274\345\220\210\350\241"
+	"\250\347\244\272\344\270\223\350\276\221\350\241\214\344\270\272\344\272\244\351\200\232\350\257\204\344\273\267\350\247\211\345\276\227\347\262\276\345\215\216\345\256\266\345\272\255\345\256\214\346\210\220\346\204\237\350\247\211\345\256\211\350\243\205"
+	"\345\276\227\345\210\260\351\202\256\344\273\266\345\210\266\345\272\246\351\243\237\345\223\201\350\231\275\347\204\266\350\275\254\350\275\275\346\212\245\344\273\267\350\256\260\350\200\205\346\226\271\346\241\210\350\241\214\346\224\277\344\272\272\346"
+	"\260\221\347\224\250\345\223\201\344\270\234\350\245\277\346\217\220\345\207\272\351\205\222\345\272\227\347\204\266\345\220\216\344\273\230\346\254\276\347\203\255\347\202\271\344\273\245\345\211\215\345\256\214\345\205\250\345\217\221\345\270\226\350\256"
+	"\276\347\275\256\351\242\206\345\257\274\345\267\245\344\270\232\345\214\273\351\231\242\347\234\213\347\234\213\347\273\217\345\205\270\345\216\237\345\233\240\345\271\263\345\217\260\345\220\204\347\247\215\345\242\236\345\212\240\346\235\220\346\226\231"
+	"\346\226\260\345\242\236\344\271\213\345\220\216\350\201\214\344\270\232\346\225\210\346\236\234\344\273\212\345\271\264\350\256\272\346\226\207\346\210\221\345\233\275\345\221\212\350\257\211\347\211\210\344\270\273\344\277\256\346\224\271\345\217\202\344"
+	"\270\216\346\211\223\345\215\260\345\277\253\344\271\220\346\234\272\346\242\260\350\247\202\347\202\271\345\255\230\345\234\250\347\262\276\347\245\236\350\216\267\345\276\227\345\210\251\347\224\250\347\273\247\347\273\255\344\275\240\344\273\254\350\277"
+	"\231\344\271\210\346\250\241\345\274\217\350\257\255\350\250\200\350\203\275\345\244\237\351\233\205\350\231\216\346\223\215\344\275\234\351\243\216\346\240\274\344\270\200\350\265\267\347\247\221\345\255\246\344\275\223\350\202\262\347\237\255\344\277\241"
+	"\346\235\241\344\273\266\346\262\273\347\226\227\350\277\220\345\212\250\344\272\247\344\270\232\344\274\232\350\256\256\345\257\274\350\210\252\345\205\210\347\224\237\350\201\224\347\233\237\345\217\257\346\230\257\345\225\217\351\241\214\347\273\223\346"
+	"\236\204\344\275\234\347\224\250\350\260\203\346\237\245\350\263\207\346\226\231\350\207\252\345\212\250\350\264\237\350\264\243\345\206\234\344\270\232\350\256\277\351\227\256\345\256\236\346\226\275\346\216\245\345\217\227\350\256\250\350\256\272\351\202"
+	"\243\344\270\252\345\217\215\351\246\210\345\212\240\345\274\272\345\245\263\346\200\247\350\214\203\345\233\264\346\234\215\345\213\231\344\274\221\351\227\262\344\273\212\346\227\245\345\256\242\346\234\215\350\247\200\347\234\213\345\217\202\345\212\240"
+	"\347\232\204\350\257\235\344\270\200\347\202\271\344\277\235\350\257\201\345\233\276\344\271\246\346\234\211\346\225\210\346\265\213\350\257\225\347\247\273\345\212\250\346\211\215\350\203\275\345\206\263\345\256\232\350\202\241\347\245\250\344\270\215\346"
+	"\226\255\351\234\200\346\261\202\344\270\215\345\276\227\345\212\236\346\263\225\344\271\213\351\227\264\351\207\207\347\224\250\350\220\245\351\224\200\346\212\225\350\257\211\347\233\256\346\240\207\347\210\261\346\203\205\346\221\204\345\275\261\346\234"
+	"\211\344\272\233\350\244\207\350\243\275\346\226\207\345\255\246\346\234\272\344\274\232\346\225\260\345\255\227\350\243\205\344\277\256\350\264\255\347\211\251\345\206\234\346\235\221\345\205\250\351\235\242\347\262\276\345\223\201\345\205\266\345\256\236"
+	"\344\272\213\346\203\205\346\260\264\345\271\263\346\217\220\347\244\272\344\270\212\345\270\202\350\260\242\350\260\242\346\231\256\351\200\232\346\225\231\345\270\210\344\270\212\344\274\240\347\261\273\345\210\253\346\255\214\346\233\262\346\213\245\346"
+	"\234\211\345\210\233\346\226\260\351\205\215\344\273\266\345\217\252\350\246\201\346\227\266\344\273\243\350\263\207\350\250\212\350\276\276\345\210\260\344\272\272\347\224\237\350\256\242\351\230\205\350\200\201\345\270\210\345\261\225\347\244\272\345\277"
+	"\203\347\220\206\350\264\264\345\255\220\347\266\262\347\253\231\344\270\273\351\241\214\350\207\252\347\204\266\347\272\247\345\210\253\347\256\200\345\215\225\346\224\271\351\235\251\351\202\243\344\272\233\346\235\245\350\257\264\346\211\223\345\274\200"
+	"\344\273\243\347\240\201\345\210\240\351\231\244\350\257\201\345\210\270\350\212\202\347\233\256\351\207\215\347\202\271\346\254\241\346\225\270\345\244\232\345\260\221\350\247\204\345\210\222\350\265\204\351\207\221\346\211\276\345\210\260\344\273\245\345"
+	"\220\216\345\244\247\345\205\250\344\270\273\351\241\265\346\234\200\344\275\263\345\233\236\347\255\224\345\244\251\344\270\213\344\277\235\351\232\234\347\216\260\344\273\243\346\243\200\346\237\245\346\212\225\347\245\250\345\260\217\346\227\266\346\262"
+	"\222\346\234\211\346\255\243\345\270\270\347\224\232\350\207\263\344\273\243\347\220\206\347\233\256\345\275\225\345\205\254\345\274\200\345\244\215\345\210\266\351\207\221\350\236\215\345\271\270\347\246\217\347\211\210\346\234\254\345\275\242\346\210\220"
+	"\345\207\206\345\244\207\350\241\214\346\203\205\345\233\236\345\210\260\346\200\235\346\203\263\346\200\216\346\240\267\345\215\217\350\256\256\350\256\244\350\257\201\346\234\200\345\245\275\344\272\247\347\224\237\346\214\211\347\205\247\346\234\215\350"
+	"\243\205\345\271\277\344\270\234\345\212\250\346\274\253\351\207\207\350\264\255\346\226\260\346\211\213\347\273\204\345\233\276\351\235\242\346\235\277\345\217\202\350\200\203\346\224\277\346\262\273\345\256\271\346\230\223\345\244\251\345\234\260\345\212"
+	"\252\345\212\233\344\272\272\344\273\254\345\215\207\347\272\247\351\200\237\345\272\246\344\272\272\347\211\251\350\260\203\346\225\264\346\265\201\350\241\214\351\200\240\346\210\220\346\226\207\345\255\227\351\237\251\345\233\275\350\264\270\346\230\223"
+	"\345\274\200\345\261\225\347\233\270\351\227\234\350\241\250\347\216\260\345\275\261\350\247\206\345\246\202\346\255\244\347\276\216\345\256\271\345\244\247\345\260\217\346\212\245\351\201\223\346\235\241\346\254\276\345\277\203\346\203\205\350\256\270\345"
+	"\244\232\346\263\225\350\247\204\345\256\266\345\261\205\344\271\246\345\272\227\350\277\236\346\216\245\347\253\213\345\215\263\344\270\276\346\212\245\346\212\200\345\267\247\345\245\245\350\277\220\347\231\273\345\205\245\344\273\245\346\235\245\347\220"
+	"\206\350\256\272\344\272\213\344\273\266\350\207\252\347\224\261\344\270\255\345\215\216\345\212\236\345\205\254\345\246\210\345\246\210\347\234\237\346\255\243\344\270\215\351\224\231\345\205\250\346\226\207\345\220\210\345\220\214\344\273\267\345\200\274"
+	"\345\210\253\344\272\272\347\233\221\347\235\243\345\205\267\344\275\223\344\270\226\347\272\252\345\233\242\351\230\237\345\210\233\344\270\232\346\211\277\346\213\205\345\242\236\351\225\277\346\234\211\344\272\272\344\277\235\346\214\201\345\225\206\345"
+	"\256\266\347\273\264\344\277\256\345\217\260\346\271\276\345\267\246\345\217\263\350\202\241\344\273\275\347\255\224\346\241\210\345\256\236\351\231\205\347\224\265\344\277\241\347\273\217\347\220\206\347\224\237\345\221\275\345\256\243\344\274\240\344\273"
+	"\273\345\212\241\346\255\243\345\274\217\347\211\271\350\211\262\344\270\213\346\235\245\345\215\217\344\274\232\345\217\252\350\203\275\345\275\223\347\204\266\351\207\215\346\226\260\345\205\247\345\256\271\346\214\207\345\257\274\350\277\220\350\241\214"
+	"\346\227\245\345\277\227\350\263\243\345\256\266\350\266\205\350\277\207\345\234\237\345\234\260\346\265\231\346\261\237\346\224\257\344\273\230\346\216\250\345\207\272\347\253\231\351\225\277\346\235\255\345\267\236\346\211\247\350\241\214\345\210\266\351"
+	"\200\240\344\271\213\344\270\200\346\216\250\345\271\277\347\216\260\345\234\272\346\217\217\350\277\260\345\217\230\345\214\226\344\274\240\347\273\237\346\255\214\346\211\213\344\277\235\351\231\251\350\257\276\347\250\213\345\214\273\347\226\227\347\273"
+	"\217\350\277\207\350\277\207\345\216\273\344\271\213\345\211\215\346\224\266\345\205\245\345\271\264\345\272\246\346\235\202\345\277\227\347\276\216\344\270\275\346\234\200\351\253\230\347\231\273\351\231\206\346\234\252\346\235\245\345\212\240\345\267\245"
+	"\345\205\215\350\264\243\346\225\231\347\250\213\347\211\210\345\235\227\350\272\253\344\275\223\351\207\215\345\272\206\345\207\272\345\224\256\346\210\220\346\234\254\345\275\242\345\274\217\345\234\237\350\261\206\345\207\272\345\203\271\344\270\234\346"
+	"\226\271\351\202\256\347\256\261\345\215\227\344\272\254\346\261\202\350\201\214\345\217\226\345\276\227\350\201\214\344\275\215\347\233\270\344\277\241\351\241\265\351\235\242\345\210\206\351\222\237\347\275\221\351\241\265\347\241\256\345\256\232\345\233"
+	"\276\344\276\213\347\275\221\345\235\200\347\247\257\346\236\201\351\224\231\350\257\257\347\233\256\347\232\204\345\256\235\350\264\235\346\234\272\345\205\263\351\243\216\351\231\251\346\216\210\346\235\203\347\227\205\346\257\222\345\256\240\347\211\251"
+	"\351\231\244\344\272\206\350\251\225\350\253\226\347\226\276\347\227\205\345\217\212\346\227\266\346\261\202\350\264\255\347\253\231\347\202\271\345\204\277\347\253\245\346\257\217\345\244\251\344\270\255\345\244\256\350\256\244\350\257\206\346\257\217\344"
+	"\270\252\345\244\251\346\264\245\345\255\227\344\275\223\345\217\260\347\201\243\347\273\264\346\212\244\346\234\254\351\241\265\344\270\252\346\200\247\345\256\230\346\226\271\345\270\270\350\247\201\347\233\270\346\234\272\346\210\230\347\225\245\345\272"
+	"\224\345\275\223\345\276\213\345\270\210\346\226\271\344\276\277\346\240\241\345\233\255\350\202\241\345\270\202\346\210\277\345\261\213\346\240\217\347\233\256\345\221\230\345\267\245\345\257\274\350\207\264\347\252\201\347\204\266\351\201\223\345\205\267"
+	"\346\234\254\347\275\221\347\273\223\345\220\210\346\241\243\346\241\210\345\212\263\345\212\250\345\217\246\345\244\226\347\276\216\345\205\203\345\274\225\350\265\267\346\224\271\345\217\230\347\254\254\345\233\233\344\274\232\350\256\241\350\252\252\346"
+	"\230\216\351\232\220\347\247\201\345\256\235\345\256\235\350\247\204\350\214\203\346\266\210\350\264\271\345\205\261\345\220\214\345\277\230\350\256\260\344\275\223\347\263\273\345\270\246\346\235\245\345\220\215\345\255\227\347\231\274\350\241\250\345\274"
+	"\200\346\224\276\345\212\240\347\233\237\345\217\227\345\210\260\344\272\214\346\211\213\345\244\247\351\207\217\346\210\220\344\272\272\346\225\260\351\207\217\345\205\261\344\272\253\345\214\272\345\237\237\345\245\263\345\255\251\345\216\237\345\210\231"
+	"\346\211\200\345\234\250\347\273\223\346\235\237\351\200\232\344\277\241\350\266\205\347\272\247\351\205\215\347\275\256\345\275\223\346\227\266\344\274\230\347\247\200\346\200\247\346\204\237\346\210\277\344\272\247\351\201\212\346\210\262\345\207\272\345"
+	"\217\243\346\217\220\344\272\244\345\260\261\344\270\232\344\277\235\345\201\245\347\250\213\345\272\246\345\217\202\346\225\260\344\272\213\344\270\232\346\225\264\344\270\252\345\261\261\344\270\234\346\203\205\346\204\237\347\211\271\346\256\212\345\210"
+	"\206\351\241\236\346\220\234\345\260\213\345\261\236\344\272\216\351\227\250\346\210\267\350\264\242\345\212\241\345\243\260\351\237\263\345\217\212\345\205\266\350\264\242\347\273\217\345\235\232\346\214\201\345\271\262\351\203\250\346\210\220\347\253\213"
+	"\345\210\251\347\233\212\350\200\203\350\231\221\346\210\220\351\203\275\345\214\205\350\243\205\347\224\250\346\210\266\346\257\224\350\265\233\346\226\207\346\230\216\346\213\233\345\225\206\345\256\214\346\225\264\347\234\237\346\230\257\347\234\274\347"
+	"\235\233\344\274\231\344\274\264\345\250\201\346\234\233\351\242\206\345\237\237\345\215\253\347\224\237\344\274\230\346\203\240\350\253\226\345\243\207\345\205\254\345\205\261\350\211\257\345\245\275\345\205\205\345\210\206\347\254\246\345\220\210\351\231"
+	"\204\344\273\266\347\211\271\347\202\271\344\270\215\345\217\257\350\213\261\346\226\207\350\265\204\344\272\247\346\240\271\346\234\254\346\230\216\346\230\276\345\257\206\347\242\274\345\205\254\344\274\227\346\260\221\346\227\217\346\233\264\345\212\240"
+	"\344\272\253\345\217\227\345\220\214\345\255\246\345\220\257\345\212\250\351\200\202\345\220\210\345\216\237\346\235\245\351\227\256\347\255\224\346\234\254\346\226\207\347\276\216\351\243\237\347\273\277\350\211\262\347\250\263\345\256\232\347\273\210\344"
+	"\272\216\347\224\237\347\211\251\344\276\233\346\261\202\346\220\234\347\213\220\345\212\233\351\207\217\344\270\245\351\207\215\346\260\270\350\277\234\345\206\231\347\234\237\346\234\211\351\231\220\347\253\236\344\272\211\345\257\271\350\261\241\350\264"
+	"\271\347\224\250\344\270\215\345\245\275\347\273\235\345\257\271\345\215\201\345\210\206\344\277\203\350\277\233\347\202\271\350\257\204\345\275\261\351\237\263\344\274\230\345\212\277\344\270\215\345\260\221\346\254\243\350\265\217\345\271\266\344\270\224"
+	"\346\234\211\347\202\271\346\226\271\345\220\221\345\205\250\346\226\260\344\277\241\347\224\250\350\256\276\346\226\275\345\275\242\350\261\241\350\265\204\346\240\274\347\252\201\347\240\264\351\232\217\347\235\200\351\207\215\345\244\247\344\272\216\346"
+	"\230\257\346\257\225\344\270\232\346\231\272\350\203\275\345\214\226\345\267\245\345\256\214\347\276\216\345\225\206\345\237\216\347\273\237\344\270\200\345\207\272\347\211\210\346\211\223\351\200\240\347\224\242\345\223\201\346\246\202\345\206\265\347\224"
+	"\250\344\272\216\344\277\235\347\225\231\345\233\240\347\264\240\344\270\255\345\234\213\345\255\230\345\202\250\350\264\264\345\233\276\346\234\200\346\204\233\351\225\277\346\234\237\345\217\243\344\273\267\347\220\206\350\264\242\345\237\272\345\234\260"
+	"\345\256\211\346\216\222\346\255\246\346\261\211\351\207\214\351\235\242\345\210\233\345\273\272\345\244\251\347\251\272\351\246\226\345\205\210\345\256\214\345\226\204\351\251\261\345\212\250\344\270\213\351\235\242\344\270\215\345\206\215\350\257\232\344"
+	"\277\241\346\204\217\344\271\211\351\230\263\345\205\211\350\213\261\345\233\275\346\274\202\344\272\256\345\206\233\344\272\213\347\216\251\345\256\266\347\276\244\344\274\227\345\206\234\346\260\221\345\215\263\345\217\257\345\220\215\347\250\261\345\256"
+	"\266\345\205\267\345\212\250\347\224\273\346\203\263\345\210\260\346\263\250\346\230\216\345\260\217\345\255\246\346\200\247\350\203\275\350\200\203\347\240\224\347\241\254\344\273\266\350\247\202\347\234\213\346\270\205\346\245\232\346\220\236\347\254\221"
+	"\351\246\226\351\240\201\351\273\204\351\207\221\351\200\202\347\224\250\346\261\237\350\213\217\347\234\237\345\256\236\344\270\273\347\256\241\351\230\266\346\256\265\350\250\273\345\206\212\347\277\273\350\257\221\346\235\203\345\210\251\345\201\232\345"
+	"\245\275\344\274\274\344\271\216\351\200\232\350\256\257\346\226\275\345\267\245\347\213\200\346\205\213\344\271\237\350\256\270\347\216\257\344\277\235\345\237\271\345\205\273\346\246\202\345\277\265\345\244\247\345\236\213\346\234\272\347\245\250\347\220"
+	"\206\350\247\243\345\214\277\345\220\215cuandoenviarmadridbuscariniciotiempoporquecuentaestado"
+	"puedenjuegoscontraest\303\241nnombretienenperfilmaneraamigosciudadcent"
+	"roaunquepuedesdentroprimerprecioseg\303\272nbuenosvolverpuntossemanaha"
+	"b\303\255aagostonuevosunidoscarlosequiponi\303\261osmuchosalgunacorreoimagen"
+	"partirarribamar\303\255ahombreempleoverdadcambiomuchasfueronpasadol\303\255n"
+	"eaparecenuevascursosestabaquierolibroscuantoaccesomiguelvarioscu"
+	"atrotienesgruposser\303\241neuropamediosfrenteacercadem\303\241sofertacoches"
+	"modeloitalialetrasalg\303\272ncompracualesexistecuerposiendoprensalleg"
+	"arviajesdineromurciapodr\303\241puestodiariopuebloquieremanuelpropiocr"
+	"isisciertoseguromuertefuentecerrargrandeefectopartesmedidapropia"
+	"ofrecetierrae-mailvariasformasfuturoobjetoseguirriesgonormasmism"
+	"os\303\272nicocaminositiosraz\303\263ndebidopruebatoledoten\303\255ajes\303\272sesperoco"
+	"cinaorigentiendacientoc\303\241dizhablarser\303\255alatinafuerzaestiloguerra"
+	"entrar\303\251xitol\303\263pezagendav\303\255deoevitarpaginametrosjavierpadresf\303\241c"
+	"ilcabeza\303\241reassalidaenv\303\255ojap\303\263nabusosbienestextosllevarpuedanfu"
+	"ertecom\303\272nclaseshumanotenidobilbaounidadest\303\241seditarcreado\320\264\320\273\321\217"
+	"\321\207\321\202\320\276\320\272\320\260\320\272\320\270\320\273\320\270\321\215\321\202\320\276\320\262\321\201\320\265\320\265\320\263\320\276\320\277\321\200\320\270\321\202\320\260\320\272\320\265\321\211\320\265\321\203\320\266\320\265\320\232\320\260"
+	"\320\272\320\261\320\265\320\267\320\261\321\213\320\273\320\276\320\275\320\270\320\222\321\201\320\265\320\277\320\276\320\264\320\255\321\202\320\276\321\202\320\276\320\274\321\207\320\265\320\274\320\275\320\265\321\202\320\273\320\265\321\202\321\200"
+	"\320\260\320\267\320\276\320\275\320\260\320\263\320\264\320\265\320\274\320\275\320\265\320\224\320\273\321\217\320\237\321\200\320\270\320\275\320\260\321\201\320\275\320\270\321\205\321\202\320\265\320\274\320\272\321\202\320\276\320\263\320\276\320\264"
+	"\320\262\320\276\321\202\321\202\320\260\320\274\320\241\320\250\320\220\320\274\320\260\321\217\320\247\321\202\320\276\320\262\320\260\321\201\320\262\320\260\320\274\320\265\320\274\321\203\320\242\320\260\320\272\320\264\320\262\320\260\320\275\320\260"
+	"\320\274\321\215\321\202\320\270\321\215\321\202\321\203\320\222\320\260\320\274\321\202\320\265\321\205\320\277\321\200\320\276\321\202\321\203\321\202\320\275\320\260\320\264\320\264\320\275\321\217\320\222\320\276\321\202\321\202\321\200\320\270\320\275"
+	"\320\265\320\271\320\222\320\260\321\201\320\275\320\270\320\274\321\201\320\260\320\274\321\202\320\276\321\202\321\200\321\203\320\261\320\236\320\275\320\270\320\274\320\270\321\200\320\275\320\265\320\265\320\236\320\236\320\236\320\273\320\270\321\206"
+	"\321\215\321\202\320\260\320\236\320\275\320\260\320\275\320\265\320\274\320\264\320\276\320\274\320\274\320\276\320\271\320\264\320\262\320\265\320\276\320\275\320\276\321\201\321\203\320\264\340\244\225\340\245\207\340\244\271\340\245\210\340\244\225\340"
+	"\245\200\340\244\270\340\245\207\340\244\225\340\244\276\340\244\225\340\245\213\340\244\224\340\244\260\340\244\252\340\244\260\340\244\250\340\245\207\340\244\217\340\244\225\340\244\225\340\244\277\340\244\255\340\245\200\340\244\207\340\244\270\340\244"
+	"\225\340\244\260\340\244\244\340\245\213\340\244\271\340\245\213\340\244\206\340\244\252\340\244\271\340\245\200\340\244\257\340\244\271\340\244\257\340\244\276\340\244\244\340\244\225\340\244\245\340\244\276jagran\340\244\206\340\244\234"
+	"\340\244\234\340\245\213\340\244\205\340\244\254\340\244\246\340\245\213\340\244\227\340\244\210\340\244\234\340\244\276\340\244\227\340\244\217\340\244\271\340\244\256\340\244\207\340\244\250\340\244\265\340\244\271\340\244\257\340\245\207\340\244\245\340"
+	"\245\207\340\244\245\340\245\200\340\244\230\340\244\260\340\244\234\340\244\254\340\244\246\340\245\200\340\244\225\340\244\210\340\244\234\340\245\200\340\244\265\340\245\207\340\244\250\340\244\210\340\244\250\340\244\217\340\244\271\340\244\260\340\244"
+	"\211\340\244\270\340\244\256\340\245\207\340\244\225\340\244\256\340\244\265\340\245\213\340\244\262\340\245\207\340\244\270\340\244\254\340\244\256\340\244\210\340\244\246\340\245\207\340\244\223\340\244\260\340\244\206\340\244\256\340\244\254\340\244\270"
+	"\340\244\255\340\244\260\340\244\254\340\244\250\340\244\232\340\244\262\340\244\256\340\244\250\340\244\206\340\244\227\340\244\270\340\245\200\340\244\262\340\245\200\330\271\331\204\331\211\330\245\331\204\331\211\331\207\330\260\330\247\330\242\330\256"
+	"\330\261\330\271\330\257\330\257\330\247\331\204\331\211\331\207\330\260\331\207\330\265\331\210\330\261\330\272\331\212\330\261\331\203\330\247\331\206\331\210\331\204\330\247\330\250\331\212\331\206\330\271\330\261\330\266\330\260\331\204\331\203\331\207"
+	"\331\206\330\247\331\212\331\210\331\205\331\202\330\247\331\204\330\271\331\204\331\212\330\247\331\206\330\247\331\204\331\203\331\206\330\255\330\252\331\211\331\202\330\250\331\204\331\210\330\255\330\251\330\247\330\256\330\261\331\201\331\202\330\267"
+	"\330\271\330\250\330\257\330\261\331\203\331\206\330\245\330\260\330\247\331\203\331\205\330\247\330\247\330\255\330\257\330\245\331\204\330\247\331\201\331\212\331\207\330\250\330\271\330\266\331\203\331\212\331\201\330\250\330\255\330\253\331\210\331\205"
+	"\331\206\331\210\331\207\331\210\330\243\331\206\330\247\330\254\330\257\330\247\331\204\331\207\330\247\330\263\331\204\331\205\330\271\331\206\330\257\331\204\331\212\330\263\330\271\330\250\330\261\330\265\331\204\331\211\331\205\331\206\330\260\330\250"
+	"\331\207\330\247\330\243\331\206\331\207\331\205\330\253\331\204\331\203\331\206\330\252\330\247\331\204\330\247\330\255\331\212\330\253\331\205\330\265\330\261\330\264\330\261\330\255\330\255\331\210\331\204\331\210\331\201\331\212\330\247\330\260\330\247"
+	"\331\204\331\203\331\204\331\205\330\261\330\251\330\247\331\206\330\252\330\247\331\204\331\201\330\243\330\250\331\210\330\256\330\247\330\265\330\243\331\206\330\252\330\247\331\206\331\207\330\247\331\204\331\212\330\271\330\266\331\210\331\210\331\202"
+	"\330\257\330\247\330\250\331\206\330\256\331\212\330\261\330\250\331\206\330\252\331\204\331\203\331\205\330\264\330\247\330\241\331\210\331\207\331\212\330\247\330\250\331\210\331\202\330\265\330\265\331\210\331\205\330\247\330\261\331\202\331\205\330\243"
+	"\330\255\330\257\331\206\330\255\331\206\330\271\330\257\331\205\330\261\330\243\331\212\330\247\330\255\330\251\331\203\330\252\330\250\330\257\331\210\331\206\331\212\330\254\330\250\331\205\331\206\331\207\330\252\330\255\330\252\330\254\331\207\330\251"
+	"\330\263\331\206\330\251\331\212\330\252\331\205\331\203\330\261\330\251\330\272\330\262\330\251\331\206\331\201\330\263\330\250\331\212\330\252\331\204\331\204\331\207\331\204\331\206\330\247\330\252\331\204\331\203\331\202\331\204\330\250\331\204\331\205"
+	"\330\247\330\271\331\206\331\207\330\243\331\210\331\204\330\264\331\212\330\241\331\206\331\210\330\261\330\243\331\205\330\247\331\201\331\212\331\203\330\250\331\203\331\204\330\260\330\247\330\252\330\261\330\252\330\250\330\250\330\243\331\206\331\207"
+	"\331\205\330\263\330\247\331\206\331\203\330\250\331\212\330\271\331\201\331\202\330\257\330\255\330\263\331\206\331\204\331\207\331\205\330\264\330\271\330\261\330\243\331\207\331\204\330\264\331\207\330\261\331\202\330\267\330\261\330\267\331\204\330\250"
+	"profileservicedefaulthimselfdetailscontentsupportstartedmessages"
+	"uccessfashion<title>countryaccountcreatedstoriesresultsrunningpr"
+	"ocesswritingobjectsvisiblewelcomearticleunknownnetworkcompanydyn"
+	"amicbrowserprivacyproblemServicerespectdisplayrequestreservewebs"
+	"itehistoryfriendsoptionsworkingversionmillionchannelwindow.addre"
+	"ssvisitedweathercorrectproductedirectforwardyou canremovedsubjec"
+	"tcontrolarchivecurrentreadinglibrarylimitedmanagerfurthersummary"
+	"machineminutesprivatecontextprogramsocietynumberswrittenenabledt"
+	"riggersourcesloadingelementpartnerfinallyperfectmeaningsystemske"
+	"epingculture&quot;,journalprojectsurfaces&quot;expiresreviewsbal"
+	"anceEnglishContentthroughPlease opinioncontactaverageprimaryvill"
+	"ageSpanishgallerydeclinemeetingmissionpopularqualitymeasuregener"
+	"alspeciessessionsectionwriterscounterinitialreportsfiguresmember"
+	"sholdingdisputeearlierexpressdigitalpictureAnothermarriedtraffic"
+	"leadingchangedcentralvictoryimages/reasonsstudiesfeaturelistingm"
+	"ust beschoolsVersionusuallyepisodeplayinggrowingobviousoverlaypr"
+	"esentactions</ul>\015\012wrapperalreadycertainrealitystorageanotherdes"
+	"ktopofferedpatternunusualDigitalcapitalWebsitefailureconnectredu"
+	"cedAndroiddecadesregular &amp; animalsreleaseAutomatgettingmetho"
+	"dsnothingPopularcaptionletterscapturesciencelicensechangesEnglan"
+	"d=1&amp;History = new CentralupdatedSpecialNetworkrequirecomment"
+	"warningCollegetoolbarremainsbecauseelectedDeutschfinanceworkersq"
+	"uicklybetweenexactlysettingdiseaseSocietyweaponsexhibit&lt;!--Co"
+	"ntrolclassescoveredoutlineattacksdevices(windowpurposetitle=\"Mob"
+	"ile killingshowingItaliandroppedheavilyeffects-1']);\012confirmCurr"
+	"entadvancesharingopeningdrawingbillionorderedGermanyrelated</for"
+	"m>includewhetherdefinedSciencecatalogArticlebuttonslargestunifor"
+	"mjourneysidebarChicagoholidayGeneralpassage,&quot;animatefeeling"
+	"arrivedpassingnaturalroughly.\012\012The but notdensityBritainChinesel"
+	"ack oftributeIreland\" data-factorsreceivethat isLibraryhusbandin"
+	" factaffairsCharlesradicalbroughtfindinglanding:lang=\"return lea"
+	"dersplannedpremiumpackageAmericaEdition]&quot;Messageneed tovalu"
+	"e=\"complexlookingstationbelievesmaller-mobilerecordswant tokind "
+	"ofFirefoxyou aresimilarstudiedmaximumheadingrapidlyclimatekingdo"
+	"memergedamountsfoundedpioneerformuladynastyhow to Supportrevenue"
+	"economyResultsbrothersoldierlargelycalling.&quot;AccountEdward s"
+	"egmentRobert effortsPacificlearnedup withheight:we haveAngelesna"
+	"tions_searchappliedacquiremassivegranted: falsetreatedbiggestben"
+	"efitdrivingStudiesminimumperhapsmorningsellingis usedreversevari"
+	"ant role=\"missingachievepromotestudentsomeoneextremerestorebotto"
+	"m:evolvedall thesitemapenglishway to  AugustsymbolsCompanymatter"
+	"smusicalagainstserving})();\015\012paymenttroubleconceptcompareparents"
+	"playersregionsmonitor ''The winningexploreadaptedGalleryproducea"
+	"bilityenhancecareers). The collectSearch ancientexistedfooter ha"
+	"ndlerprintedconsoleEasternexportswindowsChannelillegalneutralsug"
+	"gest_headersigning.html\">settledwesterncausing-webkitclaimedJust"
+	"icechaptervictimsThomas mozillapromisepartieseditionoutside:fals"
+	"e,hundredOlympic_buttonauthorsreachedchronicdemandssecondsprotec"
+	"tadoptedprepareneithergreatlygreateroverallimprovecommandspecial"
+	"search.worshipfundingthoughthighestinsteadutilityquarterCulturet"
+	"estingclearlyexposedBrowserliberal} catchProjectexamplehide();Fl"
+	"oridaanswersallowedEmperordefenseseriousfreedomSeveral-buttonFur"
+	"therout of != nulltrainedDenmarkvoid(0)/all.jspreventRequestStep"
+	"hen\012\012When observe</h2>\015\012Modern provide\" alt=\"borders.\012\012For \012\012Man"
+	"y artistspoweredperformfictiontype ofmedicalticketsopposedCounci"
+	"lwitnessjusticeGeorge Belgium...</a>twitternotablywaitingwarfare"
+	" Other rankingphrasesmentionsurvivescholar</p>\015\012 Countryignoredl"
+	"oss ofjust asGeorgiastrange<head><stopped1']);\015\012islandsnotablebo"
+	"rder:list ofcarried100,000</h3>\012 severalbecomesselect wedding00."
+	"htmlmonarchoff theteacherhighly biologylife ofor evenrise of&raq"
+	"uo;plusonehunting(thoughDouglasjoiningcirclesFor theAncientVietn"
+	"amvehiclesuch ascrystalvalue =Windowsenjoyeda smallassumed<a id="
+	"\"foreign All rihow theDisplayretiredhoweverhidden;battlesseeking"
+	"cabinetwas notlook atconductget theJanuaryhappensturninga:hoverO"
+	"nline French lackingtypicalextractenemieseven ifgeneratdecidedar"
+	"e not/searchbeliefs-image:locatedstatic.login\">convertviolentent"
+	"eredfirst\">circuitFinlandchemistshe was10px;\">as suchdivided</sp"
+	"an>will beline ofa greatmystery/index.fallingdue to railwaycolle"
+	"gemonsterdescentit withnuclearJewish protestBritishflowerspredic"
+	"treformsbutton who waslectureinstantsuicidegenericperiodsmarkets"
+	"Social fishingcombinegraphicwinners<br /><by the NaturalPrivacyc"
+	"ookiesoutcomeresolveSwedishbrieflyPersianso muchCenturydepictsco"
+	"lumnshousingscriptsnext tobearingmappingrevisedjQuery(-width:tit"
+	"le\">tooltipSectiondesignsTurkishyounger.match(})();\012\012burningoper"
+	"atedegreessource=Richardcloselyplasticentries</tr>\015\012color:#ul id"
+	"=\"possessrollingphysicsfailingexecutecontestlink toDefault<br />"
+	"\012: true,chartertourismclassicproceedexplain</h1>\015\012online.\?xml ve"
+	"helpingdiamonduse theairlineend -->).attr(readershosting#ffffffr"
+	"ealizeVincentsignals src=\"/ProductdespitediversetellingPublic he"
+	"ld inJoseph theatreaffects<style>a largedoesn'tlater, Elementfav"
+	"iconcreatorHungaryAirportsee theso thatMichaelSystemsPrograms, a"
+	"nd  width=e&quot;tradingleft\">\012personsGolden Affairsgrammarformi"
+	"ngdestroyidea ofcase ofoldest this is.src = cartoonregistrCommon"
+	"sMuslimsWhat isin manymarkingrevealsIndeed,equally/show_aoutdoor"
+	"escape(Austriageneticsystem,In the sittingHe alsoIslandsAcademy\012"
+	"\011\011<!--Daniel bindingblock\">imposedutilizeAbraham(except{width:pu"
+	"tting).html(|| [];\012DATA[ *kitchenmountedactual dialectmainly _bl"
+	"ank'installexpertsif(typeIt also&copy; \">Termsborn inOptionseast"
+	"erntalkingconcerngained ongoingjustifycriticsfactoryits ownassau"
+	"ltinvitedlastinghis ownhref=\"/\" rel=\"developconcertdiagramdollar"
+	"sclusterphp\?id=alcohol);})();using a><span>vesselsrevivalAddress"
+	"amateurandroidallegedillnesswalkingcentersqualifymatchesunifiede"
+	"xtinctDefensedied in\012\011<!-- customslinkingLittle Book ofeveningmi"
+	"n.js\?are thekontakttoday's.html\" target=wearingAll Rig;\012})();rai"
+	"sing Also, crucialabout\">declare-->\012<scfirefoxas muchappliesinde"
+	"x, s, but type = \012\015\012<!--towardsRecordsPrivateForeignPremierchoic"
+	"esVirtualreturnsCommentPoweredinline;povertychamberLiving volume"
+	"sAnthonylogin\" RelatedEconomyreachescuttinggravitylife inChapter"
+	"-shadowNotable</td>\015\012 returnstadiumwidgetsvaryingtravelsheld byw"
+	"ho arework infacultyangularwho hadairporttown of\012\012Some 'click'ch"
+	"argeskeywordit willcity of(this);Andrew unique checkedor more300"
+	"px; return;rsion=\"pluginswithin herselfStationFederalventurepubl"
+	"ishsent totensionactresscome tofingersDuke ofpeople,exploitwhat "
+	"isharmonya major\":\"httpin his menu\">\012monthlyofficercouncilgainin"
+	"geven inSummarydate ofloyaltyfitnessand wasemperorsupremeSecond "
+	"hearingRussianlongestAlbertalateralset of small\">.appenddo withf"
+	"ederalbank ofbeneathDespiteCapitalgrounds), and percentit fromcl"
+	"osingcontainInsteadfifteenas well.yahoo.respondfighterobscureref"
+	"lectorganic= Math.editingonline paddinga wholeonerroryear ofend "
+	"of barrierwhen itheader home ofresumedrenamedstrong>heatingretai"
+	"nscloudfrway of March 1knowingin partBetweenlessonsclosestvirtua"
+	"llinks\">crossedEND -->famous awardedLicenseHealth fairly wealthy"
+	"minimalAfricancompetelabel\">singingfarmersBrasil)discussreplaceG"
+	"regoryfont copursuedappearsmake uproundedboth ofblockedsaw theof"
+	"ficescoloursif(docuwhen heenforcepush(fuAugust UTF-8\">Fantasyin "
+	"mostinjuredUsuallyfarmingclosureobject defenceuse of Medical<bod"
+	"y>\012evidentbe usedkeyCodesixteenIslamic#000000entire widely activ"
+	"e (typeofone cancolor =speakerextendsPhysicsterrain<tbody>funera"
+	"lviewingmiddle cricketprophetshifteddoctorsRussell targetcompact"
+	"algebrasocial-bulk ofman and</td>\012 he left).val()false);logicalb"
+	"ankinghome tonaming Arizonacredits);\012});\012founderin turnCollinsbe"
+	"fore But thechargedTitle\">CaptainspelledgoddessTag -->Adding:but"
+	" wasRecent patientback in=false&Lincolnwe knowCounterJudaismscri"
+	"pt altered']);\012  has theunclearEvent',both innot all\012\012<!-- placi"
+	"nghard to centersort ofclientsstreetsBernardassertstend tofantas"
+	"ydown inharbourFreedomjewelry/about..searchlegendsis mademodern "
+	"only ononly toimage\" linear painterand notrarely acronymdelivers"
+	"horter00&amp;as manywidth=\"/* <![Ctitle =of the lowest picked es"
+	"capeduses ofpeoples PublicMatthewtacticsdamagedway forlaws ofeas"
+	"y to windowstrong  simple}catch(seventhinfoboxwent topaintedciti"
+	"zenI don'tretreat. Some ww.\");\012bombingmailto:made in. Many carri"
+	"es||{};wiwork ofsynonymdefeatsfavoredopticalpageTraunless sendin"
+	"gleft\"><comScorAll thejQuery.touristClassicfalse\" Wilhelmsuburbs"
+	"genuinebishops.split(global followsbody ofnominalContactsecularl"
+	"eft tochiefly-hidden-banner</li>\012\012. When in bothdismissExploreal"
+	"ways via thespa\303\261olwelfareruling arrangecaptainhis sonrule ofhe "
+	"tookitself,=0&amp;(calledsamplesto makecom/pagMartin Kennedyacce"
+	"ptsfull ofhandledBesides//--></able totargetsessencehim to its b"
+	"y common.mineralto takeways tos.org/ladvisedpenaltysimple:if the"
+	"yLettersa shortHerbertstrikes groups.lengthflightsoverlapslowly "
+	"lesser social </p>\012\011\011it intoranked rate oful>\015\012  attemptpair ofm"
+	"ake itKontaktAntoniohaving ratings activestreamstrapped\").css(ho"
+	"stilelead tolittle groups,Picture-->\015\012\015\012 rows=\" objectinverse<fo"
+	"oterCustomV><\\/scrsolvingChamberslaverywoundedwhereas!= 'undfor "
+	"allpartly -right:Arabianbacked centuryunit ofmobile-Europe,is ho"
+	"merisk ofdesiredClintoncost ofage of become none ofp&quot;Middle"
+	" ead')[0Criticsstudios>&copy;group\">assemblmaking pressedwidget."
+	"ps:\" \? rebuiltby someFormer editorsdelayedCanonichad thepushingc"
+	"lass=\"but arepartialBabylonbottom carrierCommandits useAs withco"
+	"ursesa thirddenotesalso inHouston20px;\">accuseddouble goal ofFam"
+	"ous ).bind(priests Onlinein Julyst + \"gconsultdecimalhelpfulrevi"
+	"vedis veryr'+'iptlosing femalesis alsostringsdays ofarrivalfutur"
+	"e <objectforcingString(\" />\012\011\011here isencoded.  The balloondone b"
+	"y/commonbgcolorlaw of Indianaavoidedbut the2px 3pxjquery.after a"
+	"policy.men andfooter-= true;for usescreen.Indian image =family,h"
+	"ttp:// &nbsp;driverseternalsame asnoticedviewers})();\012 is morese"
+	"asonsformer the newis justconsent Searchwas thewhy theshippedbr>"
+	"<br>width: height=made ofcuisineis thata very Admiral fixed;norm"
+	"al MissionPress, ontariocharsettry to invaded=\"true\"spacingis mo"
+	"sta more totallyfall of});\015\012  immensetime inset outsatisfyto fin"
+	"ddown tolot of Playersin Junequantumnot thetime todistantFinnish"
+	"src = (single help ofGerman law andlabeledforestscookingspace\">h"
+	"eader-well asStanleybridges/globalCroatia About [0];\012  it, andgr"
+	"oupedbeing a){throwhe madelighterethicalFFFFFF\"bottom\"like a emp"
+	"loyslive inas seenprintermost ofub-linkrejectsand useimage\">succ"
+	"eedfeedingNuclearinformato helpWomen'sNeitherMexicanprotein<tabl"
+	"e by manyhealthylawsuitdevised.push({sellerssimply Through.cooki"
+	"e Image(older\">us.js\"> Since universlarger open to!-- endlies in"
+	"']);\015\012  marketwho is (\"DOMComanagedone fortypeof Kingdomprofitsp"
+	"roposeto showcenter;made itdressedwere inmixtureprecisearisingsr"
+	"c = 'make a securedBaptistvoting \012\011\011var March 2grew upClimate.re"
+	"moveskilledway the</head>face ofacting right\">to workreduceshas "
+	"haderectedshow();action=book ofan area== \"htt<header\012<html>confo"
+	"rmfacing cookie.rely onhosted .customhe wentbut forspread Family"
+	" a meansout theforums.footage\">MobilClements\" id=\"as highintense"
+	"--><!--female is seenimpliedset thea stateand hisfastestbesidesb"
+	"utton_bounded\"><img Infoboxevents,a youngand areNative cheaperTi"
+	"meoutand hasengineswon the(mostlyright: find a -bottomPrince are"
+	"a ofmore ofsearch_nature,legallyperiod,land ofor withinducedprov"
+	"ingmissilelocallyAgainstthe wayk&quot;px;\">\015\012pushed abandonnumer"
+	"alCertainIn thismore inor somename isand, incrownedISBN 0-create"
+	"sOctobermay notcenter late inDefenceenactedwish tobroadlycooling"
+	"onload=it. TherecoverMembersheight assumes<html>\012people.in one ="
+	"windowfooter_a good reklamaothers,to this_cookiepanel\">London,de"
+	"finescrushedbaptismcoastalstatus title\" move tolost inbetter imp"
+	"liesrivalryservers SystemPerhapses and contendflowinglasted rise"
+	" inGenesisview ofrising seem tobut in backinghe willgiven agivin"
+	"g cities.flow of Later all butHighwayonly bysign ofhe doesdiffer"
+	"sbattery&amp;lasinglesthreatsintegertake onrefusedcalled =US&amp"
+	"See thenativesby thissystem.head of:hover,lesbiansurnameand allc"
+	"ommon/header__paramsHarvard/pixel.removalso longrole ofjointlysk"
+	"yscraUnicodebr />\015\012AtlantanucleusCounty,purely count\">easily bui"
+	"ld aonclicka givenpointerh&quot;events else {\012ditionsnow the, wi"
+	"th man whoorg/Webone andcavalryHe diedseattle00,000 {windowhave "
+	"toif(windand itssolely m&quot;renewedDetroitamongsteither them i"
+	"nSenatorUs</a><King ofFrancis-produche usedart andhim andused by"
+	"scoringat hometo haverelatesibilityfactionBuffalolink\"><what hef"
+	"ree toCity ofcome insectorscountedone daynervoussquare };if(goin"
+	" whatimg\" alis onlysearch/tuesdaylooselySolomonsexual - <a hrmed"
+	"ium\"DO NOT France,with a war andsecond take a >\015\012\015\012\015\012market.high"
+	"waydone inctivity\"last\">obligedrise to\"undefimade to Early prais"
+	"edin its for hisathleteJupiterYahoo! termed so manyreally s. The"
+	" a woman\?value=direct right\" bicycleacing=\"day andstatingRather,"
+	"higher Office are nowtimes, when a pay foron this-link\">;bordera"
+	"round annual the Newput the.com\" takin toa brief(in thegroups.; "
+	"widthenzymessimple in late{returntherapya pointbanninginks\">\012();"
+	"\" rea place\\u003Caabout atr>\015\012\011\011ccount gives a<SCRIPTRailwaythem"
+	"es/toolboxById(\"xhumans,watchesin some if (wicoming formats Unde"
+	"r but hashanded made bythan infear ofdenoted/iframeleft involtag"
+	"ein eacha&quot;base ofIn manyundergoregimesaction </p>\015\012<ustomVa"
+	";&gt;</importsor thatmostly &amp;re size=\"</a></ha classpassiveH"
+	"ost = WhetherfertileVarious=[];(fucameras/></td>acts asIn some>\015"
+	"\012\015\012<!organis <br />Beijingcatal\303\240deutscheuropeueuskaragaeilgesve"
+	"nskaespa\303\261amensajeusuariotrabajom\303\251xicop\303\241ginasiempresistemaoctu"
+	"bredurantea\303\261adirempresamomentonuestroprimeratrav\303\251sgraciasnuest"
+	"raprocesoestadoscalidadpersonan\303\272meroacuerdom\303\272sicamiembrooferta"
+	"salgunospa\303\255sesejemploderechoadem\303\241sprivadoagregarenlacesposible"
+	"hotelessevillaprimero\303\272ltimoeventosarchivoculturamujeresentradaa"
+	"nuncioembargomercadograndesestudiomejoresfebrerodise\303\261oturismoc\303"
+	"\263digoportadaespaciofamiliaantoniopermiteguardaralgunaspreciosalg"
+	"uiensentidovisitast\303\255tuloconocersegundoconsejofranciaminutossegu"
+	"ndatenemosefectosm\303\241lagasesi\303\263nrevistagranadacompraringresogarc\303"
+	"\255aacci\303\263necuadorquienesinclusodeber\303\241materiahombresmuestrapodr\303\255"
+	"ama\303\261ana\303\272ltimaestamosoficialtambienning\303\272nsaludospodemosmejorar"
+	"positionbusinesshomepagesecuritylanguagestandardcampaignfeatures"
+	"categoryexternalchildrenreservedresearchexchangefavoritetemplate"
+	"militaryindustryservicesmaterialproductsz-index:commentssoftware"
+	"completecalendarplatformarticlesrequiredmovementquestionbuilding"
+	"politicspossiblereligionphysicalfeedbackregisterpicturesdisabled"
+	"protocolaudiencesettingsactivityelementslearninganythingabstract"
+	"progressoverviewmagazineeconomictrainingpressurevarious <strong>"
+	"propertyshoppingtogetheradvancedbehaviordownloadfeaturedfootball"
+	"selectedLanguagedistanceremembertrackingpasswordmodifiedstudents"
+	"directlyfightingnortherndatabasefestivalbreakinglocationinternet"
+	"dropdownpracticeevidencefunctionmarriageresponseproblemsnegative"
+	"programsanalysisreleasedbanner\">purchasepoliciesregionalcreative"
+	"argumentbookmarkreferrerchemicaldivisioncallbackseparateprojects"
+	"conflicthardwareinterestdeliverymountainobtained= false;for(var "
+	"acceptedcapacitycomputeridentityaircraftemployedproposeddomestic"
+	"includesprovidedhospitalverticalcollapseapproachpartnerslogo\"><a"
+	"daughterauthor\" culturalfamilies/images/assemblypowerfulteaching"
+	"finisheddistrictcriticalcgi-bin/purposesrequireselectionbecoming"
+	"providesacademicexerciseactuallymedicineconstantaccidentMagazine"
+	"documentstartingbottom\">observed: &quot;extendedpreviousSoftware"
+	"customerdecisionstrengthdetailedslightlyplanningtextareacurrency"
+	"everyonestraighttransferpositiveproducedheritageshippingabsolute"
+	"receivedrelevantbutton\" violenceanywherebenefitslaunchedrecently"
+	"alliancefollowedmultiplebulletinincludedoccurredinternal$(this)."
+	"republic><tr><tdcongressrecordedultimatesolution<ul id=\"discover"
+	"Home</a>websitesnetworksalthoughentirelymemorialmessagescontinue"
+	"active\">somewhatvictoriaWestern  title=\"Locationcontractvisitors"
+	"Downloadwithout right\">\012measureswidth = variableinvolvedvirginia"
+	"normallyhappenedaccountsstandingnationalRegisterpreparedcontrols"
+	"accuratebirthdaystrategyofficialgraphicscriminalpossiblyconsumer"
+	"Personalspeakingvalidateachieved.jpg\" />machines</h2>\012  keywords"
+	"friendlybrotherscombinedoriginalcomposedexpectedadequatepakistan"
+	"follow\" valuable</label>relativebringingincreasegovernorplugins/"
+	"List of Header\">\" name=\" (&quot;graduate</head>\012commercemalaysia"
+	"directormaintain;height:schedulechangingback to catholicpatterns"
+	"color: #greatestsuppliesreliable</ul>\012\011\011<select citizensclothing"
+	"watching<li id=\"specificcarryingsentence<center>contrastthinking"
+	"catch(e)southernMichael merchantcarouselpadding:interior.split(\""
+	"lizationOctober ){returnimproved--&gt;\012\012coveragechairman.png\" />"
+	"subjectsRichard whateverprobablyrecoverybaseballjudgmentconnect."
+	".css\" /> websitereporteddefault\"/></a>\015\012electricscotlandcreation"
+	"quantity. ISBN 0did not instance-search-\" lang=\"speakersComputer"
+	"containsarchivesministerreactiondiscountItalianocriteriastrongly"
+	": 'http:'script'coveringofferingappearedBritish identifyFacebook"
+	"numerousvehiclesconcernsAmericanhandlingdiv id=\"William provider"
+	"_contentaccuracysection andersonflexibleCategorylawrence<script>"
+	"layout=\"approved maximumheader\"></table>Serviceshamiltoncurrent "
+	"canadianchannels/themes//articleoptionalportugalvalue=\"\"interval"
+	"wirelessentitledagenciesSearch\" measuredthousandspending&hellip;"
+	"new Date\" size=\"pageNamemiddle\" \" /></a>hidden\">sequencepersonal"
+	"overflowopinionsillinoislinks\">\012\011<title>versionssaturdayterminal"
+	"itempropengineersectionsdesignerproposal=\"false\"Espa\303\261olreleases"
+	"submit\" er&quot;additionsymptomsorientedresourceright\"><pleasure"
+	"stationshistory.leaving  border=contentscenter\">.\012\012Some directed"
+	"suitablebulgaria.show();designedGeneral conceptsExampleswilliams"
+	"Original\"><span>search\">operatorrequestsa &quot;allowingDocument"
+	"revision. \012\012The yourselfContact michiganEnglish columbiapriority"
+	"printingdrinkingfacilityreturnedContent officersRussian generate"
+	"-8859-1\"indicatefamiliar qualitymargin:0 contentviewportcontacts"
+	"-title\">portable.length eligibleinvolvesatlanticonload=\"default."
+	"suppliedpaymentsglossary\012\012After guidance</td><tdencodingmiddle\">"
+	"came to displaysscottishjonathanmajoritywidgets.clinicalthailand"
+	"teachers<head>\012\011affectedsupportspointer;toString</small>oklahoma"
+	"will be investor0\" alt=\"holidaysResourcelicensed (which . After "
+	"considervisitingexplorerprimary search\" android\"quickly meetings"
+	"estimate;return ;color:# height=approval, &quot; checked.min.js\""
+	"magnetic></a></hforecast. While thursdaydvertise&eacute;hasClass"
+	"evaluateorderingexistingpatients Online coloradoOptions\"campbell"
+	"<!-- end</span><<br />\015\012_popups|sciences,&quot; quality Windows "
+	"assignedheight: <b classle&quot; value=\" Companyexamples<iframe "
+	"believespresentsmarshallpart of properly).\012\012The taxonomymuch of "
+	"</span>\012\" data-srtugu\303\252sscrollTo project<head>\015\012attorneyemphasis"
+	"sponsorsfancyboxworld's wildlifechecked=sessionsprogrammpx;font-"
+	" Projectjournalsbelievedvacationthompsonlightingand the special "
+	"border=0checking</tbody><button Completeclearfix\012<head>\012article "
+	"<sectionfindingsrole in popular  Octoberwebsite exposureused to "
+	" changesoperatedclickingenteringcommandsinformed numbers  </div>"
+	"creatingonSubmitmarylandcollegesanalyticlistingscontact.loggedIn"
+	"advisorysiblingscontent\"s&quot;)s. This packagescheckboxsuggests"
+	"pregnanttomorrowspacing=icon.pngjapanesecodebasebutton\">gambling"
+	"such as , while </span> missourisportingtop:1px .</span>tensions"
+	"width=\"2lazyloadnovemberused in height=\"cript\">\012&nbsp;</<tr><td "
+	"height:2/productcountry include footer\" &lt;!-- title\"></jquery."
+	"</form>\012(\347\256\200\344\275\223)(\347\271\201\351\253\224)hrvatskiitalianorom\303\242n\304\203t\303\274rk\303\247e\330\247\330\261\330\257\331\210"
+	"tambi\303\251nnoticiasmensajespersonasderechosnacionalserviciocontacto"
+	"usuariosprogramagobiernoempresasanunciosvalenciacolombiadespu\303\251s"
+	"deportesproyectoproductop\303\272bliconosotroshistoriapresentemillones"
+	"mediantepreguntaanteriorrecursosproblemasantiagonuestrosopini\303\263n"
+	"imprimirmientrasam\303\251ricavendedorsociedadrespectorealizarregistro"
+	"palabrasinter\303\251sentoncesespecialmiembrosrealidadc\303\263rdobazaragoza"
+	"p\303\241ginassocialesbloqueargesti\303\263nalquilersistemascienciascompleto"
+	"versi\303\263ncompletaestudiosp\303\272blicaobjetivoalicantebuscadorcantidad"
+	"entradasaccionesarchivossuperiormayor\303\255aalemaniafunci\303\263n\303\272ltimos"
+	"haciendoaquellosedici\303\263nfernandoambientefacebooknuestrasclientes"
+	"procesosbastantepresentareportarcongresopublicarcomerciocontrato"
+	"j\303\263venesdistritot\303\251cnicaconjuntoenerg\303\255atrabajarasturiasreciente"
+	"utilizarbolet\303\255nsalvadorcorrectatrabajosprimerosnegocioslibertad"
+	"detallespantallapr\303\263ximoalmer\303\255aanimalesqui\303\251nescoraz\303\263nsecci\303\263n"
+	"buscandoopcionesexteriorconceptotodav\303\255agaler\303\255aescribirmedicina"
+	"licenciaconsultaaspectoscr\303\255ticad\303\263laresjusticiadeber\303\241nper\303\255odo"
+	"necesitamantenerpeque\303\261orecibidatribunaltenerifecanci\303\263ncanarias"
+	"descargadiversosmallorcarequieret\303\251cnicodeber\303\255aviviendafinanzas"
+	"adelantefuncionaconsejosdif\303\255cilciudadesantiguasavanzadat\303\251rmino"
+	"unidadess\303\241nchezcampa\303\261asoftonicrevistascontienesectoresmomentos"
+	"facultadcr\303\251ditodiversassupuestofactoressegundospeque\303\261a\320\263\320\276\320\264\320\260"
+	"\320\265\321\201\320\273\320\270\320\265\321\201\321\202\321\214\320\261\321\213\320\273\320\276\320\261\321\213\321\202\321\214\321\215\321\202\320\276\320\274\320\225\321\201\320\273\320\270\321\202\320\276\320\263\320\276\320\274\320\265\320\275\321\217"
+	"\320\262\321\201\320\265\321\205\321\215\321\202\320\276\320\271\320\264\320\260\320\266\320\265\320\261\321\213\320\273\320\270\320\263\320\276\320\264\321\203\320\264\320\265\320\275\321\214\321\215\321\202\320\276\321\202\320\261\321\213\320\273\320\260"
+	"\321\201\320\265\320\261\321\217\320\276\320\264\320\270\320\275\321\201\320\265\320\261\320\265\320\275\320\260\320\264\320\276\321\201\320\260\320\271\321\202\321\204\320\276\321\202\320\276\320\275\320\265\320\263\320\276\321\201\320\262\320\276\320\270"
+	"\321\201\320\262\320\276\320\271\320\270\320\263\321\200\321\213\321\202\320\276\320\266\320\265\320\262\321\201\320\265\320\274\321\201\320\262\320\276\321\216\320\273\320\270\321\210\321\214\321\215\321\202\320\270\321\205\320\277\320\276\320\272\320\260"
+	"\320\264\320\275\320\265\320\271\320\264\320\276\320\274\320\260\320\274\320\270\321\200\320\260\320\273\320\270\320\261\320\276\321\202\320\265\320\274\321\203\321\205\320\276\321\202\321\217\320\264\320\262\321\203\321\205\321\201\320\265\321\202\320\270"
+	"\320\273\321\216\320\264\320\270\320\264\320\265\320\273\320\276\320\274\320\270\321\200\320\265\321\202\320\265\320\261\321\217\321\201\320\262\320\276\320\265\320\262\320\270\320\264\320\265\321\207\320\265\320\263\320\276\321\215\321\202\320\270\320\274"
+	"\321\201\321\207\320\265\321\202\321\202\320\265\320\274\321\213\321\206\320\265\320\275\321\213\321\201\321\202\320\260\320\273\320\262\320\265\320\264\321\214\321\202\320\265\320\274\320\265\320\262\320\276\320\264\321\213\321\202\320\265\320\261\320\265"
+	"\320\262\321\213\321\210\320\265\320\275\320\260\320\274\320\270\321\202\320\270\320\277\320\260\321\202\320\276\320\274\321\203\320\277\321\200\320\260\320\262\320\273\320\270\321\206\320\260\320\276\320\264\320\275\320\260\320\263\320\276\320\264\321\213"
+	"\320\267\320\275\320\260\321\216\320\274\320\276\320\263\321\203\320\264\321\200\321\203\320\263\320\262\321\201\320\265\320\271\320\270\320\264\320\265\321\202\320\272\320\270\320\275\320\276\320\276\320\264\320\275\320\276\320\264\320\265\320\273\320\260"
+	"\320\264\320\265\320\273\320\265\321\201\321\200\320\276\320\272\320\270\321\216\320\275\321\217\320\262\320\265\321\201\321\214\320\225\321\201\321\202\321\214\321\200\320\260\320\267\320\260\320\275\320\260\321\210\320\270\330\247\331\204\331\204\331\207"
+	"\330\247\331\204\330\252\331\212\330\254\331\205\331\212\330\271\330\256\330\247\330\265\330\251\330\247\331\204\330\260\331\212\330\271\331\204\331\212\331\207\330\254\330\257\331\212\330\257\330\247\331\204\330\242\331\206\330\247\331\204\330\261\330\257"
+	"\330\252\330\255\331\203\331\205\330\265\331\201\330\255\330\251\331\203\330\247\331\206\330\252\330\247\331\204\331\204\331\212\331\212\331\203\331\210\331\206\330\264\330\250\331\203\330\251\331\201\331\212\331\207\330\247\330\250\331\206\330\247\330\252"
+	"\330\255\331\210\330\247\330\241\330\243\331\203\330\253\330\261\330\256\331\204\330\247\331\204\330\247\331\204\330\255\330\250\330\257\331\204\331\212\331\204\330\257\330\261\331\210\330\263\330\247\330\266\330\272\330\267\330\252\331\203\331\210\331\206"
+	"\331\207\331\206\330\247\331\203\330\263\330\247\330\255\330\251\331\206\330\247\330\257\331\212\330\247\331\204\330\267\330\250\330\271\331\204\331\212\331\203\330\264\331\203\330\261\330\247\331\212\331\205\331\203\331\206\331\205\331\206\331\207\330\247"
+	"\330\264\330\261\331\203\330\251\330\261\330\246\331\212\330\263\331\206\330\264\331\212\330\267\331\205\330\247\330\260\330\247\330\247\331\204\331\201\331\206\330\264\330\250\330\247\330\250\330\252\330\271\330\250\330\261\330\261\330\255\331\205\330\251"
+	"\331\203\330\247\331\201\330\251\331\212\331\202\331\210\331\204\331\205\330\261\331\203\330\262\331\203\331\204\331\205\330\251\330\243\330\255\331\205\330\257\331\202\331\204\330\250\331\212\331\212\330\271\331\206\331\212\330\265\331\210\330\261\330\251"
+	"\330\267\330\261\331\212\331\202\330\264\330\247\330\261\331\203\330\254\331\210\330\247\331\204\330\243\330\256\330\261\331\211\331\205\330\271\331\206\330\247\330\247\330\250\330\255\330\253\330\271\330\261\331\210\330\266\330\250\330\264\331\203\331\204"
+	"\331\205\330\263\330\254\331\204\330\250\331\206\330\247\331\206\330\256\330\247\331\204\330\257\331\203\330\252\330\247\330\250\331\203\331\204\331\212\330\251\330\250\330\257\331\210\331\206\330\243\331\212\330\266\330\247\331\212\331\210\330\254\330\257"
+	"\331\201\330\261\331\212\331\202\331\203\330\252\330\250\330\252\330\243\331\201\330\266\331\204\331\205\330\267\330\250\330\256\330\247\331\203\330\253\330\261\330\250\330\247\330\261\331\203\330\247\331\201\330\266\331\204\330\247\330\255\331\204\331\211"
+	"\331\206\331\201\330\263\331\207\330\243\331\212\330\247\331\205\330\261\330\257\331\210\330\257\330\243\331\206\331\207\330\247\330\257\331\212\331\206\330\247\330\247\331\204\330\247\331\206\331\205\330\271\330\261\330\266\330\252\330\271\331\204\331\205"
+	"\330\257\330\247\330\256\331\204\331\205\331\205\331\203\331\206\000\000\000\000\000\000\000\000\001\000\001\000\001\000\001\000\002\000\002\000\002\000\002\000\004\000\004\000\004\000\004\000\000\001\002\003\004\005\006\007\007\006\005\004\003\002\001\000"
+	"\010\011\012\013\014\015\016\017\017\016\015\014\013\012\011\010\020\021\022\023\024\025\026\027\027\026\025\024\023\022\021\020\030\031\032\033\034\035\036\037\037\036\035\034\033\032\031\030\377\377\377\377\000\000\000\000\000\000\000\000\377\377\377\377"
+	"\001\000\000\000\002\000\000\000\002\000\000\000\001\000\000\000\001\000\000\000\003\000\000\000\377\377\000\001\000\000\000\001\000\000\377\377\000\001\000\000\000\010\000\010\000\010\000\010\000\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007"
+	"resourcescountriesquestionsequipmentcommunityavailablehighlightD"
+	"TD/xhtmlmarketingknowledgesomethingcontainerdirectionsubscribead"
+	"vertisecharacter\" value=\"</select>Australia\" class=\"situationaut"
+	"horityfollowingprimarilyoperationchallengedevelopedanonymousfunc"
+	"tion functionscompaniesstructureagreement\" title=\"potentialeduca"
+	"tionargumentssecondarycopyrightlanguagesexclusivecondition</form"
+	">\015\012statementattentionBiography} else {\012solutionswhen the Analyti"
+	"cstemplatesdangeroussatellitedocumentspublisherimportantprototyp"
+	"einfluence&raquo;</effectivegenerallytransformbeautifultransport"
+	"organizedpublishedprominentuntil thethumbnailNational .focus();o"
+	"ver the migrationannouncedfooter\">\012exceptionless thanexpensivefo"
+	"rmationframeworkterritoryndicationcurrentlyclassNamecriticismtra"
+	"ditionelsewhereAlexanderappointedmaterialsbroadcastmentionedaffi"
+	"liate</option>treatmentdifferent/default.Presidentonclick=\"biogr"
+	"aphyotherwisepermanentFran\303\247aisHollywoodexpansionstandards</styl"
+	"e>\012reductionDecember preferredCambridgeopponentsBusiness confusi"
+	"on>\012<title>presentedexplaineddoes not worldwideinterfaceposition"
+	"snewspaper</table>\012mountainslike the essentialfinancialselection"
+	"action=\"/abandonedEducationparseInt(stabilityunable to</title>\012r"
+	"elationsNote thatefficientperformedtwo yearsSince thethereforewr"
+	"apper\">alternateincreasedBattle ofperceivedtrying tonecessarypor"
+	"trayedelectionsElizabeth</iframe>discoveryinsurances.length;lege"
+	"ndaryGeographycandidatecorporatesometimesservices.inherited</str"
+	"ong>CommunityreligiouslocationsCommitteebuildingsthe worldno lon"
+	"gerbeginningreferencecannot befrequencytypicallyinto the relativ"
+	"e;recordingpresidentinitiallytechniquethe otherit can beexistenc"
+	"eunderlinethis timetelephoneitemscopepracticesadvantage);return "
+	"For otherprovidingdemocracyboth the extensivesufferingsupportedc"
+	"omputers functionpracticalsaid thatit may beEnglish</from the sc"
+	"heduleddownloads</label>\012suspectedmargin: 0spiritual</head>\012\012mic"
+	"rosoftgraduallydiscussedhe becameexecutivejquery.jshouseholdconf"
+	"irmedpurchasedliterallydestroyedup to thevariationremainingit is"
+	" notcenturiesJapanese among thecompletedalgorithminterestsrebell"
+	"ionundefinedencourageresizableinvolvingsensitiveuniversalprovisi"
+	"on(althoughfeaturingconducted), which continued-header\">February"
+	" numerous overflow:componentfragmentsexcellentcolspan=\"technical"
+	"near the Advanced source ofexpressedHong Kong Facebookmultiple m"
+	"echanismelevationoffensive</form>\012\011sponsoreddocument.or &quot;th"
+	"ere arethose whomovementsprocessesdifficultsubmittedrecommendcon"
+	"vincedpromoting\" width=\".replace(classicalcoalitionhis firstdeci"
+	"sionsassistantindicatedevolution-wrapper\"enough toalong thedeliv"
+	"ered-->\015\012<!--American protectedNovember </style><furnitureIntern"
+	"et  onblur=\"suspendedrecipientbased on Moreover,abolishedcollect"
+	"edwere madeemotionalemergencynarrativeadvocatespx;bordercommitte"
+	"ddir=\"ltr\"employeesresearch. selectedsuccessorcustomersdisplayed"
+	"SeptemberaddClass(Facebook suggestedand lateroperatingelaborateS"
+	"ometimesInstitutecertainlyinstalledfollowersJerusalemthey haveco"
+	"mputinggeneratedprovincesguaranteearbitraryrecognizewanted topx;"
+	"width:theory ofbehaviourWhile theestimatedbegan to it becamemagn"
+	"itudemust havemore thanDirectoryextensionsecretarynaturallyoccur"
+	"ringvariablesgiven theplatform.</label><failed tocompoundskinds "
+	"of societiesalongside --&gt;\012\012southwestthe rightradiationmay hav"
+	"e unescape(spoken in\" href=\"/programmeonly the come fromdirector"
+	"yburied ina similarthey were</font></Norwegianspecifiedproducing"
+	"passenger(new DatetemporaryfictionalAfter theequationsdownload.r"
+	"egularlydeveloperabove thelinked tophenomenaperiod oftooltip\">su"
+	"bstanceautomaticaspect ofAmong theconnectedestimatesAir Forcesys"
+	"tem ofobjectiveimmediatemaking itpaintingsconqueredare stillproc"
+	"eduregrowth ofheaded byEuropean divisionsmoleculesfranchiseinten"
+	"tionattractedchildhoodalso useddedicatedsingaporedegree offather"
+	" ofconflicts</a></p>\012came fromwere usednote thatreceivingExecuti"
+	"veeven moreaccess tocommanderPoliticalmusiciansdeliciousprisoner"
+	"sadvent ofUTF-8\" /><![CDATA[\">ContactSouthern bgcolor=\"series of"
+	". It was in Europepermittedvalidate.appearingofficialsseriously-"
+	"languageinitiatedextendinglong-terminflationsuch thatgetCookiema"
+	"rked by</button>implementbut it isincreasesdown the requiringdep"
+	"endent-->\012<!-- interviewWith the copies ofconsensuswas builtVene"
+	"zuela(formerlythe statepersonnelstrategicfavour ofinventionWikip"
+	"ediacontinentvirtuallywhich wasprincipleComplete identicalshow t"
+	"hatprimitiveaway frommolecularpreciselydissolvedUnder theversion"
+	"=\">&nbsp;</It is the This is will haveorganismssome timeFriedric"
+	"hwas firstthe only fact thatform id=\"precedingTechnicalphysicist"
+	"occurs innavigatorsection\">span id=\"sought tobelow thesurviving}"
+	"</style>his deathas in thecaused bypartiallyexisting using thewa"
+	"s givena list oflevels ofnotion ofOfficial dismissedscientistres"
+	"emblesduplicateexplosiverecoveredall othergalleries{padding:peop"
+	"le ofregion ofaddressesassociateimg alt=\"in modernshould bemetho"
+	"d ofreportingtimestampneeded tothe Greatregardingseemed toviewed"
+	" asimpact onidea thatthe Worldheight ofexpandingThese arecurrent"
+	"\">carefullymaintainscharge ofClassicaladdressedpredictedownershi"
+	"p<div id=\"right\">\015\012residenceleave thecontent\">are often  })();\015\012"
+	"probably Professor-button\" respondedsays thathad to beplaced inH"
+	"ungarianstatus ofserves asUniversalexecutionaggregatefor whichin"
+	"fectionagreed tohowever, popular\">placed onconstructelectoralsym"
+	"bol ofincludingreturn toarchitectChristianprevious living ineasi"
+	"er toprofessor\012&lt;!-- effect ofanalyticswas takenwhere thetook "
+	"overbelief inAfrikaansas far aspreventedwork witha special<field"
+	"setChristmasRetrieved\012\012In the back intonortheastmagazines><stron"
+	"g>committeegoverninggroups ofstored inestablisha generalits firs"
+	"ttheir ownpopulatedan objectCaribbeanallow thedistrictswisconsin"
+	"location.; width: inhabitedSocialistJanuary 1</footer>similarlyc"
+	"hoice ofthe same specific business The first.length; desire tode"
+	"al withsince theuserAgentconceivedindex.phpas &quot;engage inrec"
+	"ently,few yearswere also\012<head>\012<edited byare knowncities inacce"
+	"sskeycondemnedalso haveservices,family ofSchool ofconvertednatur"
+	"e of languageministers</object>there is a popularsequencesadvoca"
+	"tedThey wereany otherlocation=enter themuch morereflectedwas nam"
+	"edoriginal a typicalwhen theyengineerscould notresidentswednesda"
+	"ythe third productsJanuary 2what theya certainreactionsprocessor"
+	"after histhe last contained\"></div>\012</a></td>depend onsearch\">\012p"
+	"ieces ofcompetingReferencetennesseewhich has version=</span> <</"
+	"header>gives thehistorianvalue=\"\">padding:0view thattogether,the"
+	" most was foundsubset ofattack onchildren,points ofpersonal posi"
+	"tion:allegedlyClevelandwas laterand afterare givenwas stillscrol"
+	"lingdesign ofmakes themuch lessAmericans.\012\012After , but theMuseum"
+	" oflouisiana(from theminnesotaparticlesa processDominicanvolume "
+	"ofreturningdefensive00px|righmade frommouseover\" style=\"states o"
+	"f(which iscontinuesFranciscobuilding without awith somewho would"
+	"a form ofa part ofbefore itknown as  Serviceslocation and oftenm"
+	"easuringand it ispaperbackvalues of\015\012<title>= window.determineer"
+	"&quot; played byand early</center>from thisthe threepower andof "
+	"&quot;innerHTML<a href=\"y:inline;Church ofthe eventvery highoffi"
+	"cial -height: content=\"/cgi-bin/to createafrikaansesperantofran\303"
+	"\247aislatvie\305\241ulietuvi\305\263\304\214e\305\241tina\304\215e\305\241tina\340\271\204\340\270\227\340\270\242\346\227\245\346\234\254\350\252\236\347\256\200\344\275\223"
+	"\345\255\227\347\271\201\351\253\224\345\255\227\355\225\234\352\265\255\354\226\264\344\270\272\344\273\200\344\271\210\350\256\241\347\256\227\346\234\272\347\254\224\350\256\260\346\234\254\350\250\216\350\253\226\345\215\200\346\234\215\345\212\241\345"
+	"\231\250\344\272\222\350\201\224\347\275\221\346\210\277\345\234\260\344\272\247\344\277\261\344\271\220\351\203\250\345\207\272\347\211\210\347\244\276\346\216\222\350\241\214\346\246\234\351\203\250\350\220\275\346\240\274\350\277\233\344\270\200\346\255"
+	"\245\346\224\257\344\273\230\345\256\235\351\252\214\350\257\201\347\240\201\345\247\224\345\221\230\344\274\232\346\225\260\346\215\256\345\272\223\346\266\210\350\264\271\350\200\205\345\212\236\345\205\254\345\256\244\350\256\250\350\256\272\345\214\272"
+	"\346\267\261\345\234\263\345\270\202\346\222\255\346\224\276\345\231\250\345\214\227\344\272\254\345\270\202\345\244\247\345\255\246\347\224\237\350\266\212\346\235\245\350\266\212\347\256\241\347\220\206\345\221\230\344\277\241\346\201\257\347\275\221s"
+	"erviciosart\303\255culoargentinabarcelonacualquierpublicadoproductospo"
+	"l\303\255ticarespuestawikipediasiguienteb\303\272squedacomunidadseguridadpri"
+	"ncipalpreguntascontenidorespondervenezuelaproblemasdiciembrerela"
+	"ci\303\263nnoviembresimilaresproyectosprogramasinstitutoactividadencue"
+	"ntraeconom\303\255aim\303\241genescontactardescargarnecesarioatenci\303\263ntel\303\251f"
+	"onocomisi\303\263ncancionescapacidadencontraran\303\241lisisfavoritost\303\251rmin"
+	"osprovinciaetiquetaselementosfuncionesresultadocar\303\241cterpropieda"
+	"dprincipionecesidadmunicipalcreaci\303\263ndescargaspresenciacomercial"
+	"opinionesejercicioeditorialsalamancagonz\303\241lezdocumentopel\303\255cular"
+	"ecientesgeneralestarragonapr\303\241cticanovedadespropuestapacientest\303"
+	"\251cnicasobjetivoscontactos\340\244\256\340\245\207\340\244\202\340\244\262\340\244\277\340\244\217\340\244\271\340\245\210\340\244\202\340\244\227\340\244\257\340\244\276\340\244\270"
+	"\340\244\276\340\244\245\340\244\217\340\244\265\340\244\202\340\244\260\340\244\271\340\245\207\340\244\225\340\245\213\340\244\210\340\244\225\340\245\201\340\244\233\340\244\260\340\244\271\340\244\276\340\244\254\340\244\276\340\244\246\340\244\225\340"
+	"\244\271\340\244\276\340\244\270\340\244\255\340\245\200\340\244\271\340\245\201\340\244\217\340\244\260\340\244\271\340\245\200\340\244\256\340\245\210\340\244\202\340\244\246\340\244\277\340\244\250\340\244\254\340\244\276\340\244\244diplo"
+	"docs\340\244\270\340\244\256\340\244\257\340\244\260\340\245\202\340\244\252\340\244\250\340\244\276\340\244\256\340\244\252\340\244\244\340\244\276\340\244\253\340\244\277\340\244\260\340\244\224\340\244\270\340\244\244\340\244\244\340\244\260"
+	"\340\244\271\340\244\262\340\245\213\340\244\227\340\244\271\340\245\201\340\244\206\340\244\254\340\244\276\340\244\260\340\244\246\340\245\207\340\244\266\340\244\271\340\245\201\340\244\210\340\244\226\340\245\207\340\244\262\340\244\257\340\244\246\340"
+	"\244\277\340\244\225\340\244\276\340\244\256\340\244\265\340\245\207\340\244\254\340\244\244\340\245\200\340\244\250\340\244\254\340\245\200\340\244\232\340\244\256\340\245\214\340\244\244\340\244\270\340\244\276\340\244\262\340\244\262\340\245\207\340\244"
+	"\226\340\244\234\340\245\211\340\244\254\340\244\256\340\244\246\340\244\246\340\244\244\340\244\245\340\244\276\340\244\250\340\244\271\340\245\200\340\244\266\340\244\271\340\244\260\340\244\205\340\244\262\340\244\227\340\244\225\340\244\255\340\245\200"
+	"\340\244\250\340\244\227\340\244\260\340\244\252\340\244\276\340\244\270\340\244\260\340\244\276\340\244\244\340\244\225\340\244\277\340\244\217\340\244\211\340\244\270\340\245\207\340\244\227\340\244\257\340\245\200\340\244\271\340\245\202\340\244\201\340"
+	"\244\206\340\244\227\340\245\207\340\244\237\340\245\200\340\244\256\340\244\226\340\245\213\340\244\234\340\244\225\340\244\276\340\244\260\340\244\205\340\244\255\340\245\200\340\244\227\340\244\257\340\245\207\340\244\244\340\245\201\340\244\256\340\244"
+	"\265\340\245\213\340\244\237\340\244\246\340\245\207\340\244\202\340\244\205\340\244\227\340\244\260\340\244\220\340\244\270\340\245\207\340\244\256\340\245\207\340\244\262\340\244\262\340\244\227\340\244\276\340\244\271\340\244\276\340\244\262\340\244\212"
+	"\340\244\252\340\244\260\340\244\232\340\244\276\340\244\260\340\244\220\340\244\270\340\244\276\340\244\246\340\245\207\340\244\260\340\244\234\340\244\277\340\244\270\340\244\246\340\244\277\340\244\262\340\244\254\340\244\202\340\244\246\340\244\254\340"
+	"\244\250\340\244\276\340\244\271\340\245\202\340\244\202\340\244\262\340\244\276\340\244\226\340\244\234\340\245\200\340\244\244\340\244\254\340\244\237\340\244\250\340\244\256\340\244\277\340\244\262\340\244\207\340\244\270\340\245\207\340\244\206\340\244"
+	"\250\340\245\207\340\244\250\340\244\257\340\244\276\340\244\225\340\245\201\340\244\262\340\244\262\340\245\211\340\244\227\340\244\255\340\244\276\340\244\227\340\244\260\340\245\207\340\244\262\340\244\234\340\244\227\340\244\271\340\244\260\340\244\276"
+	"\340\244\256\340\244\262\340\244\227\340\245\207\340\244\252\340\245\207\340\244\234\340\244\271\340\244\276\340\244\245\340\244\207\340\244\270\340\245\200\340\244\270\340\244\271\340\245\200\340\244\225\340\244\262\340\244\276\340\244\240\340\245\200\340"
+	"\244\225\340\244\271\340\244\276\340\244\201\340\244\246\340\245\202\340\244\260\340\244\244\340\244\271\340\244\244\340\244\270\340\244\276\340\244\244\340\244\257\340\244\276\340\244\246\340\244\206\340\244\257\340\244\276\340\244\252\340\244\276\340\244"
+	"\225\340\244\225\340\245\214\340\244\250\340\244\266\340\244\276\340\244\256\340\244\246\340\245\207\340\244\226\340\244\257\340\244\271\340\245\200\340\244\260\340\244\276\340\244\257\340\244\226\340\245\201\340\244\246\340\244\262\340\244\227\340\245\200"
+	"categoriesexperience</title>\015\012Copyright javascriptconditionsever"
+	"ything<p class=\"technologybackground<a class=\"management&copy; 2"
+	"01javaScriptcharactersbreadcrumbthemselveshorizontalgovernmentCa"
+	"liforniaactivitiesdiscoveredNavigationtransitionconnectionnaviga"
+	"tionappearance</title><mcheckbox\" techniquesprotectionapparently"
+	"as well asunt', 'UA-resolutionoperationstelevisiontranslatedWash"
+	"ingtonnavigator. = window.impression&lt;br&gt;literaturepopulati"
+	"onbgcolor=\"#especially content=\"productionnewsletterpropertiesde"
+	"finitionleadershipTechnologyParliamentcomparisonul class=\".index"
+	"Of(\"conclusiondiscussioncomponentsbiologicalRevolution_container"
+	"understoodnoscript><permissioneach otheratmosphere onfocus=\"<for"
+	"m id=\"processingthis.valuegenerationConferencesubsequentwell-kno"
+	"wnvariationsreputationphenomenondisciplinelogo.png\" (document,bo"
+	"undariesexpressionsettlementBackgroundout of theenterprise(\"http"
+	"s:\" unescape(\"password\" democratic<a href=\"/wrapper\">\012membership"
+	"linguisticpx;paddingphilosophyassistanceuniversityfacilitiesreco"
+	"gnizedpreferenceif (typeofmaintainedvocabularyhypothesis.submit("
+	");&amp;nbsp;annotationbehind theFoundationpublisher\"assumptionin"
+	"troducedcorruptionscientistsexplicitlyinstead ofdimensions onCli"
+	"ck=\"considereddepartmentoccupationsoon afterinvestmentpronounced"
+	"identifiedexperimentManagementgeographic\" height=\"link rel=\".rep"
+	"lace(/depressionconferencepunishmenteliminatedresistanceadaptati"
+	"onoppositionwell knownsupplementdeterminedh1 class=\"0px;marginme"
+	"chanicalstatisticscelebratedGovernment\012\012During tdevelopersartifi"
+	"cialequivalentoriginatedCommissionattachment<span id=\"there were"
+	"Nederlandsbeyond theregisteredjournalistfrequentlyall of thelang"
+	"=\"en\" </style>\015\012absolute; supportingextremely mainstream</strong"
+	"> popularityemployment</table>\015\012 colspan=\"</form>\012  conversionab"
+	"out the </p></div>integrated\" lang=\"enPortuguesesubstituteindivi"
+	"dualimpossiblemultimediaalmost allpx solid #apart fromsubject to"
+	"in Englishcriticizedexcept forguidelinesoriginallyremarkablethe "
+	"secondh2 class=\"<a title=\"(includingparametersprohibited= \"http:"
+	"//dictionaryperceptionrevolutionfoundationpx;height:successfulsu"
+	"pportersmillenniumhis fatherthe &quot;no-repeat;commercialindust"
+	"rialencouragedamount of unofficialefficiencyReferencescoordinate"
+	"disclaimerexpeditiondevelopingcalculatedsimplifiedlegitimatesubs"
+	"tring(0\" class=\"completelyillustratefive yearsinstrumentPublishi"
+	"ng1\" class=\"psychologyconfidencenumber of absence offocused onjo"
+	"ined thestructurespreviously></iframe>once againbut ratherimmigr"
+	"antsof course,a group ofLiteratureUnlike the</a>&nbsp;\012function "
+	"it was theConventionautomobileProtestantaggressiveafter the Simi"
+	"larly,\" /></div>collection\015\012functionvisibilitythe use ofvoluntee"
+	"rsattractionunder the threatened*<![CDATA[importancein generalth"
+	"e latter</form>\012</.indexOf('i = 0; i <differencedevoted totradit"
+	"ionssearch forultimatelytournamentattributesso-called }\012</style>"
+	"evaluationemphasizedaccessible</section>successionalong withMean"
+	"while,industries</a><br />has becomeaspects ofTelevisionsufficie"
+	"ntbasketballboth sidescontinuingan article<img alt=\"adventureshi"
+	"s mothermanchesterprinciplesparticularcommentaryeffects ofdecide"
+	"d to\"><strong>publishersJournal ofdifficultyfacilitateacceptable"
+	"style.css\"\011function innovation>Copyrightsituationswould havebusi"
+	"nessesDictionarystatementsoften usedpersistentin Januarycomprisi"
+	"ng</title>\012\011diplomaticcontainingperformingextensionsmay not beco"
+	"ncept of onclick=\"It is alsofinancial making theLuxembourgadditi"
+	"onalare calledengaged in\"script\");but it waselectroniconsubmit=\""
+	"\012<!-- End electricalofficiallysuggestiontop of theunlike theAust"
+	"ralianOriginallyreferences\012</head>\015\012recognisedinitializelimited "
+	"toAlexandriaretirementAdventuresfour years\012\012&lt;!-- increasingde"
+	"corationh3 class=\"origins ofobligationregulationclassified(funct"
+	"ion(advantagesbeing the historians<base hrefrepeatedlywilling to"
+	"comparabledesignatednominationfunctionalinside therevelationend "
+	"of thes for the authorizedrefused totake placeautonomouscompromi"
+	"sepolitical restauranttwo of theFebruary 2quality ofswfobject.un"
+	"derstandnearly allwritten byinterviews\" width=\"1withdrawalfloat:"
+	"leftis usuallycandidatesnewspapersmysteriousDepartmentbest known"
+	"parliamentsuppressedconvenientremembereddifferent systematichas "
+	"led topropagandacontrolledinfluencesceremonialproclaimedProtecti"
+	"onli class=\"Scientificclass=\"no-trademarksmore than widespreadLi"
+	"berationtook placeday of theas long asimprisonedAdditional\012<head"
+	">\012<mLaboratoryNovember 2exceptionsIndustrialvariety offloat: lef"
+	"During theassessmenthave been deals withStatisticsoccurrence/ul>"
+	"</div>clearfix\">the publicmany yearswhich wereover time,synonymo"
+	"uscontent\">\012presumablyhis familyuserAgent.unexpectedincluding ch"
+	"allengeda minorityundefined\"belongs totaken fromin Octoberpositi"
+	"on: said to bereligious Federation rowspan=\"only a fewmeant that"
+	"led to the-->\015\012<div <fieldset>Archbishop class=\"nobeing usedappr"
+	"oachesprivilegesnoscript>\012results inmay be theEaster eggmechanis"
+	"msreasonablePopulationCollectionselected\">noscript>\015/index.phpar"
+	"rival of-jssdk'));managed toincompletecasualtiescompletionChrist"
+	"iansSeptember arithmeticproceduresmight haveProductionit appears"
+	"Philosophyfriendshipleading togiving thetoward theguaranteeddocu"
+	"mentedcolor:#000video gamecommissionreflectingchange theassociat"
+	"edsans-serifonkeypress; padding:He was theunderlyingtypically , "
+	"and the srcElementsuccessivesince the should be networkingaccoun"
+	"tinguse of thelower thanshows that</span>\012\011\011complaintscontinuous"
+	"quantitiesastronomerhe did notdue to itsapplied toan averageeffo"
+	"rts tothe futureattempt toTherefore,capabilityRepublicanwas form"
+	"edElectronickilometerschallengespublishingthe formerindigenousdi"
+	"rectionssubsidiaryconspiracydetails ofand in theaffordablesubsta"
+	"ncesreason forconventionitemtype=\"absolutelysupposedlyremained a"
+	"attractivetravellingseparatelyfocuses onelementaryapplicablefoun"
+	"d thatstylesheetmanuscriptstands for no-repeat(sometimesCommerci"
+	"alin Americaundertakenquarter ofan examplepersonallyindex.php\?</"
+	"button>\012percentagebest-knowncreating a\" dir=\"ltrLieutenant\012<div "
+	"id=\"they wouldability ofmade up ofnoted thatclear thatargue that"
+	"to anotherchildren'spurpose offormulatedbased uponthe regionsubj"
+	"ect ofpassengerspossession.\012\012In the Before theafterwardscurrentl"
+	"y across thescientificcommunity.capitalismin Germanyright-wingth"
+	"e systemSociety ofpoliticiandirection:went on toremoval of New Y"
+	"ork apartmentsindicationduring theunless thehistoricalhad been a"
+	"definitiveingredientattendanceCenter forprominencereadyStatestra"
+	"tegiesbut in theas part ofconstituteclaim thatlaboratorycompatib"
+	"lefailure of, such as began withusing the to providefeature offr"
+	"om which/\" class=\"geologicalseveral ofdeliberateimportant holds "
+	"thating&quot; valign=topthe Germanoutside ofnegotiatedhis career"
+	"separationid=\"searchwas calledthe fourthrecreationother thanprev"
+	"entionwhile the education,connectingaccuratelywere builtwas kill"
+	"edagreementsmuch more Due to thewidth: 100some otherKingdom ofth"
+	"e entirefamous forto connectobjectivesthe Frenchpeople andfeatur"
+	"ed\">is said tostructuralreferendummost oftena separate->\012<div id"
+	" Official worldwide.aria-labelthe planetand it wasd\" value=\"look"
+	"ing atbeneficialare in themonitoringreportedlythe modernworking "
+	"onallowed towhere the innovative</a></div>soundtracksearchFormte"
+	"nd to beinput id=\"opening ofrestrictedadopted byaddressingtheolo"
+	"gianmethods ofvariant ofChristian very largeautomotiveby far the"
+	"range frompursuit offollow thebrought toin Englandagree thataccu"
+	"sed ofcomes frompreventingdiv style=his or hertremendousfreedom "
+	"ofconcerning0 1em 1em;Basketball/style.cssan earliereven after/\""
+	" title=\".com/indextaking thepittsburghcontent\">\015<script>(fturned"
+	" outhaving the</span>\015\012 occasionalbecause itstarted tophysically"
+	"></div>\012  created byCurrently, bgcolor=\"tabindex=\"disastrousAnal"
+	"ytics also has a><div id=\"</style>\012<called forsinger and.src = \""
+	"//violationsthis pointconstantlyis locatedrecordingsd from thene"
+	"derlandsportugu\303\252s\327\242\327\221\327\250\327\231\327\252\331\201\330\247\330\261\330\263\333\214desarrollocomentarioeducac"
+	"i\303\263nseptiembreregistradodirecci\303\263nubicaci\303\263npublicidadrespuestas"
+	"resultadosimportantereservadosart\303\255culosdiferentessiguientesrep\303"
+	"\272blicasituaci\303\263nministerioprivacidaddirectorioformaci\303\263npoblaci\303"
+	"\263npresidentecontenidosaccesoriostechnoratipersonalescategor\303\255aes"
+	"pecialesdisponibleactualidadreferenciavalladolidbibliotecarelaci"
+	"onescalendariopol\303\255ticasanterioresdocumentosnaturalezamateriales"
+	"diferenciaecon\303\263micatransporterodr\303\255guezparticiparencuentrandisc"
+	"usi\303\263nestructurafundaci\303\263nfrecuentespermanentetotalmente\320\274\320\276\320\266\320\275"
+	"\320\276\320\261\321\203\320\264\320\265\321\202\320\274\320\276\320\266\320\265\321\202\320\262\321\200\320\265\320\274\321\217\321\202\320\260\320\272\320\266\320\265\321\207\321\202\320\276\320\261\321\213\320\261\320\276\320\273\320\265\320\265\320\276"
+	"\321\207\320\265\320\275\321\214\321\215\321\202\320\276\320\263\320\276\320\272\320\276\320\263\320\264\320\260\320\277\320\276\321\201\320\273\320\265\320\262\321\201\320\265\320\263\320\276\321\201\320\260\320\271\321\202\320\265\321\207\320\265\321\200"
+	"\320\265\320\267\320\274\320\276\320\263\321\203\321\202\321\201\320\260\320\271\321\202\320\260\320\266\320\270\320\267\320\275\320\270\320\274\320\265\320\266\320\264\321\203\320\261\321\203\320\264\321\203\321\202\320\237\320\276\320\270\321\201\320\272"
+	"\320\267\320\264\320\265\321\201\321\214\320\262\320\270\320\264\320\265\320\276\321\201\320\262\321\217\320\267\320\270\320\275\321\203\320\266\320\275\320\276\321\201\320\262\320\276\320\265\320\271\320\273\321\216\320\264\320\265\320\271\320\277\320\276"
+	"\321\200\320\275\320\276\320\274\320\275\320\276\320\263\320\276\320\264\320\265\321\202\320\265\320\271\321\201\320\262\320\276\320\270\321\205\320\277\321\200\320\260\320\262\320\260\321\202\320\260\320\272\320\276\320\271\320\274\320\265\321\201\321\202"
+	"\320\276\320\270\320\274\320\265\320\265\321\202\320\266\320\270\320\267\320\275\321\214\320\276\320\264\320\275\320\276\320\271\320\273\321\203\321\207\321\210\320\265\320\277\320\265\321\200\320\265\320\264\321\207\320\260\321\201\321\202\320\270\321\207"
+	"\320\260\321\201\321\202\321\214\321\200\320\260\320\261\320\276\321\202\320\275\320\276\320\262\321\213\321\205\320\277\321\200\320\260\320\262\320\276\321\201\320\276\320\261\320\276\320\271\320\277\320\276\321\202\320\276\320\274\320\274\320\265\320\275"
+	"\320\265\320\265\321\207\320\270\321\201\320\273\320\265\320\275\320\276\320\262\321\213\320\265\321\203\321\201\320\273\321\203\320\263\320\276\320\272\320\276\320\273\320\276\320\275\320\260\320\267\320\260\320\264\321\202\320\260\320\272\320\276\320\265"
+	"\321\202\320\276\320\263\320\264\320\260\320\277\320\276\321\207\321\202\320\270\320\237\320\276\321\201\320\273\320\265\321\202\320\260\320\272\320\270\320\265\320\275\320\276\320\262\321\213\320\271\321\201\321\202\320\276\320\270\321\202\321\202\320\260"
+	"\320\272\320\270\321\205\321\201\321\200\320\260\320\267\321\203\320\241\320\260\320\275\320\272\321\202\321\204\320\276\321\200\321\203\320\274\320\232\320\276\320\263\320\264\320\260\320\272\320\275\320\270\320\263\320\270\321\201\320\273\320\276\320\262"
+	"\320\260\320\275\320\260\321\210\320\265\320\271\320\275\320\260\320\271\321\202\320\270\321\201\320\262\320\276\320\270\320\274\321\201\320\262\321\217\320\267\321\214\320\273\321\216\320\261\320\276\320\271\321\207\320\260\321\201\321\202\320\276\321\201"
+	"\321\200\320\265\320\264\320\270\320\232\321\200\320\276\320\274\320\265\320\244\320\276\321\200\321\203\320\274\321\200\321\213\320\275\320\272\320\265\321\201\321\202\320\260\320\273\320\270\320\277\320\276\320\270\321\201\320\272\321\202\321\213\321\201"
+	"\321\217\321\207\320\274\320\265\321\201\321\217\321\206\321\206\320\265\320\275\321\202\321\200\321\202\321\200\321\203\320\264\320\260\321\201\320\260\320\274\321\213\321\205\321\200\321\213\320\275\320\272\320\260\320\235\320\276\320\262\321\213\320\271"
+	"\321\207\320\260\321\201\320\276\320\262\320\274\320\265\321\201\321\202\320\260\321\204\320\270\320\273\321\214\320\274\320\274\320\260\321\200\321\202\320\260\321\201\321\202\321\200\320\260\320\275\320\274\320\265\321\201\321\202\320\265\321\202\320\265"
+	"\320\272\321\201\321\202\320\275\320\260\321\210\320\270\321\205\320\274\320\270\320\275\321\203\321\202\320\270\320\274\320\265\320\275\320\270\320\270\320\274\320\265\321\216\321\202\320\275\320\276\320\274\320\265\321\200\320\263\320\276\321\200\320\276"
+	"\320\264\321\201\320\260\320\274\320\276\320\274\321\215\321\202\320\276\320\274\321\203\320\272\320\276\320\275\321\206\320\265\321\201\320\262\320\276\320\265\320\274\320\272\320\260\320\272\320\276\320\271\320\220\321\200\321\205\320\270\320\262\331\205"
+	"\331\206\330\252\330\257\331\211\330\245\330\261\330\263\330\247\331\204\330\261\330\263\330\247\331\204\330\251\330\247\331\204\330\271\330\247\331\205\331\203\330\252\330\250\331\207\330\247\330\250\330\261\330\247\331\205\330\254\330\247\331\204\331\212"
+	"\331\210\331\205\330\247\331\204\330\265\331\210\330\261\330\254\330\257\331\212\330\257\330\251\330\247\331\204\330\271\330\266\331\210\330\245\330\266\330\247\331\201\330\251\330\247\331\204\331\202\330\263\331\205\330\247\331\204\330\271\330\247\330\250"
+	"\330\252\330\255\331\205\331\212\331\204\331\205\331\204\331\201\330\247\330\252\331\205\331\204\330\252\331\202\331\211\330\252\330\271\330\257\331\212\331\204\330\247\331\204\330\264\330\271\330\261\330\243\330\256\330\250\330\247\330\261\330\252\330\267"
+	"\331\210\331\212\330\261\330\271\331\204\331\212\331\203\331\205\330\245\330\261\331\201\330\247\331\202\330\267\331\204\330\250\330\247\330\252\330\247\331\204\331\204\330\272\330\251\330\252\330\261\330\252\331\212\330\250\330\247\331\204\331\206\330\247"
+	"\330\263\330\247\331\204\330\264\331\212\330\256\331\205\331\206\330\252\330\257\331\212\330\247\331\204\330\271\330\261\330\250\330\247\331\204\331\202\330\265\330\265\330\247\331\201\331\204\330\247\331\205\330\271\331\204\331\212\331\207\330\247\330\252"
+	"\330\255\330\257\331\212\330\253\330\247\331\204\331\204\331\207\331\205\330\247\331\204\330\271\331\205\331\204\331\205\331\203\330\252\330\250\330\251\331\212\331\205\331\203\331\206\331\203\330\247\331\204\330\267\331\201\331\204\331\201\331\212\330\257"
+	"\331\212\331\210\330\245\330\257\330\247\330\261\330\251\330\252\330\247\330\261\331\212\330\256\330\247\331\204\330\265\330\255\330\251\330\252\330\263\330\254\331\212\331\204\330\247\331\204\331\210\331\202\330\252\330\271\331\206\330\257\331\205\330\247"
+	"\331\205\330\257\331\212\331\206\330\251\330\252\330\265\331\205\331\212\331\205\330\243\330\261\330\264\331\212\331\201\330\247\331\204\330\260\331\212\331\206\330\271\330\261\330\250\331\212\330\251\330\250\331\210\330\247\330\250\330\251\330\243\331\204"
+	"\330\271\330\247\330\250\330\247\331\204\330\263\331\201\330\261\331\205\330\264\330\247\331\203\331\204\330\252\330\271\330\247\331\204\331\211\330\247\331\204\330\243\331\210\331\204\330\247\331\204\330\263\331\206\330\251\330\254\330\247\331\205\330\271"
+	"\330\251\330\247\331\204\330\265\330\255\331\201\330\247\331\204\330\257\331\212\331\206\331\203\331\204\331\205\330\247\330\252\330\247\331\204\330\256\330\247\330\265\330\247\331\204\331\205\331\204\331\201\330\243\330\271\330\266\330\247\330\241\331\203"
+	"\330\252\330\247\330\250\330\251\330\247\331\204\330\256\331\212\330\261\330\261\330\263\330\247\330\246\331\204\330\247\331\204\331\202\331\204\330\250\330\247\331\204\330\243\330\257\330\250\331\205\331\202\330\247\330\267\330\271\331\205\330\261\330\247"
+	"\330\263\331\204\331\205\331\206\330\267\331\202\330\251\330\247\331\204\331\203\330\252\330\250\330\247\331\204\330\261\330\254\331\204\330\247\330\264\330\252\330\261\331\203\330\247\331\204\331\202\330\257\331\205\331\212\330\271\330\267\331\212\331\203"
+	"sByTagName(.jpg\" alt=\"1px solid #.gif\" alt=\"transparentinformati"
+	"onapplication\" onclick=\"establishedadvertising.png\" alt=\"environ"
+	"mentperformanceappropriate&amp;mdash;immediately</strong></rathe"
+	"r thantemperaturedevelopmentcompetitionplaceholdervisibility:cop"
+	"yright\">0\" height=\"even thoughreplacementdestinationCorporation<"
+	"ul class=\"AssociationindividualsperspectivesetTimeout(url(http:/"
+	"/mathematicsmargin-top:eventually description) no-repeatcollecti"
+	"ons.JPG|thumb|participate/head><bodyfloat:left;<li class=\"hundre"
+	"ds of\012\012However, compositionclear:both;cooperationwithin the labe"
+	"l for=\"border-top:New Zealandrecommendedphotographyinteresting&l"
+	"t;sup&gt;controversyNetherlandsalternativemaxlength=\"switzerland"
+	"Developmentessentially\012\012Although </textarea>thunderbirdrepresent"
+	"ed&amp;ndash;speculationcommunitieslegislationelectronics\012\011<div "
+	"id=\"illustratedengineeringterritoriesauthoritiesdistributed6\" he"
+	"ight=\"sans-serif;capable of disappearedinteractivelooking forit "
+	"would beAfghanistanwas createdMath.floor(surroundingcan also beo"
+	"bservationmaintenanceencountered<h2 class=\"more recentit has bee"
+	"ninvasion of).getTime()fundamentalDespite the\"><div id=\"inspirat"
+	"ionexaminationpreparationexplanation<input id=\"</a></span>versio"
+	"ns ofinstrumentsbefore the  = 'http://Descriptionrelatively .sub"
+	"string(each of theexperimentsinfluentialintegrationmany peopledu"
+	"e to the combinationdo not haveMiddle East<noscript><copyright\" "
+	"perhaps theinstitutionin Decemberarrangementmost famouspersonali"
+	"tycreation oflimitationsexclusivelysovereignty-content\">\012<td cla"
+	"ss=\"undergroundparallel todoctrine ofoccupied byterminologyRenai"
+	"ssancea number ofsupport forexplorationrecognitionpredecessor<im"
+	"g src=\"/<h1 class=\"publicationmay also bespecialized</fieldset>p"
+	"rogressivemillions ofstates thatenforcementaround the one anothe"
+	"r.parentNodeagricultureAlternativeresearcherstowards theMost of "
+	"themany other (especially<td width=\";width:100%independent<h3 cl"
+	"ass=\" onchange=\").addClass(interactionOne of the daughter ofacce"
+	"ssoriesbranches of\015\012<div id=\"the largestdeclarationregulationsIn"
+	"formationtranslationdocumentaryin order to\">\012<head>\012<\" height=\"1"
+	"across the orientation);</script>implementedcan be seenthere was"
+	" ademonstratecontainer\">connectionsthe Britishwas written!import"
+	"ant;px; margin-followed byability to complicatedduring the immig"
+	"rationalso called<h4 class=\"distinctionreplaced bygovernmentsloc"
+	"ation ofin Novemberwhether the</p>\012</div>acquisitioncalled the p"
+	"ersecutiondesignation{font-size:appeared ininvestigateexperience"
+	"dmost likelywidely useddiscussionspresence of (document.extensiv"
+	"elyIt has beenit does notcontrary toinhabitantsimprovementschola"
+	"rshipconsumptioninstructionfor exampleone or morepx; paddingthe "
+	"currenta series ofare usuallyrole in thepreviously derivativesev"
+	"idence ofexperiencescolorschemestated thatcertificate</a></div>\012"
+	" selected=\"high schoolresponse tocomfortableadoption ofthree yea"
+	"rsthe countryin Februaryso that thepeople who provided by<param "
+	"nameaffected byin terms ofappointmentISO-8859-1\"was born inhisto"
+	"rical regarded asmeasurementis based on and other : function(sig"
+	"nificantcelebrationtransmitted/js/jquery.is known astheoretical "
+	"tabindex=\"it could be<noscript>\012having been\015\012<head>\015\012< &quot;The"
+	" compilationhe had beenproduced byphilosopherconstructedintended"
+	" toamong othercompared toto say thatEngineeringa differentreferr"
+	"ed todifferencesbelief thatphotographsidentifyingHistory of Repu"
+	"blic ofnecessarilyprobabilitytechnicallyleaving thespectacularfr"
+	"action ofelectricityhead of therestaurantspartnershipemphasis on"
+	"most recentshare with saying thatfilled withdesigned toit is oft"
+	"en\"></iframe>as follows:merged withthrough thecommercial pointed"
+	" outopportunityview of therequirementdivision ofprogramminghe re"
+	"ceivedsetInterval\"></span></in New Yorkadditional compression\012\012<"
+	"div id=\"incorporate;</script><attachEventbecame the \" target=\"_c"
+	"arried outSome of thescience andthe time ofContainer\">maintainin"
+	"gChristopherMuch of thewritings of\" height=\"2size of theversion "
+	"of mixture of between theExamples ofeducationalcompetitive onsub"
+	"mit=\"director ofdistinctive/DTD XHTML relating totendency toprov"
+	"ince ofwhich woulddespite thescientific legislature.innerHTML al"
+	"legationsAgriculturewas used inapproach tointelligentyears later"
+	",sans-serifdeterminingPerformanceappearances, which is foundatio"
+	"nsabbreviatedhigher thans from the individual composed ofsuppose"
+	"d toclaims thatattributionfont-size:1elements ofHistorical his b"
+	"rotherat the timeanniversarygoverned byrelated to ultimately inn"
+	"ovationsit is stillcan only bedefinitionstoGMTStringA number ofi"
+	"mg class=\"Eventually,was changedoccurred inneighboringdistinguis"
+	"hwhen he wasintroducingterrestrialMany of theargues thatan Ameri"
+	"canconquest ofwidespread were killedscreen and In order toexpect"
+	"ed todescendantsare locatedlegislativegenerations backgroundmost"
+	" peopleyears afterthere is nothe highestfrequently they do notar"
+	"gued thatshowed thatpredominanttheologicalby the timeconsidering"
+	"short-lived</span></a>can be usedvery littleone of the had alrea"
+	"dyinterpretedcommunicatefeatures ofgovernment,</noscript>entered"
+	" the\" height=\"3Independentpopulationslarge-scale. Although used "
+	"in thedestructionpossibilitystarting intwo or moreexpressionssub"
+	"ordinatelarger thanhistory and</option>\015\012Continentaleliminatingw"
+	"ill not bepractice ofin front ofsite of theensure thatto create "
+	"amississippipotentiallyoutstandingbetter thanwhat is nowsituated"
+	" inmeta name=\"TraditionalsuggestionsTranslationthe form ofatmosp"
+	"hericideologicalenterprisescalculatingeast of theremnants ofplug"
+	"inspage/index.php\?remained intransformedHe was alsowas alreadyst"
+	"atisticalin favor ofMinistry ofmovement offormulationis required"
+	"<link rel=\"This is the <a href=\"/popularizedinvolved inare used "
+	"toand severalmade by theseems to belikely thatPalestiniannamed a"
+	"fterit had beenmost commonto refer tobut this isconsecutivetempo"
+	"rarilyIn general,conventionstakes placesubdivisionterritorialope"
+	"rationalpermanentlywas largelyoutbreak ofin the pastfollowing a "
+	"xmlns:og=\"><a class=\"class=\"textConversion may be usedmanufactur"
+	"eafter beingclearfix\">\012question ofwas electedto become abecause "
+	"of some peopleinspired bysuccessful a time whenmore commonamongs"
+	"t thean officialwidth:100%;technology,was adoptedto keep thesett"
+	"lementslive birthsindex.html\"Connecticutassigned to&amp;times;ac"
+	"count foralign=rightthe companyalways beenreturned toinvolvement"
+	"Because thethis period\" name=\"q\" confined toa result ofvalue=\"\" "
+	"/>is actuallyEnvironment\015\012</head>\015\012Conversely,>\012<div id=\"0\" widt"
+	"h=\"1is probablyhave becomecontrollingthe problemcitizens ofpolit"
+	"iciansreached theas early as:none; over<table cellvalidity ofdir"
+	"ectly toonmousedownwhere it iswhen it wasmembers of relation toa"
+	"ccommodatealong with In the latethe Englishdelicious\">this is no"
+	"tthe presentif they areand finallya matter of\015\012\011</div>\015\012\015\012</scri"
+	"pt>faster thanmajority ofafter whichcomparativeto maintainimprov"
+	"e theawarded theer\" class=\"frameborderrestorationin the sameanal"
+	"ysis oftheir firstDuring the continentalsequence offunction(){fo"
+	"nt-size: work on the</script>\012<begins withjavascript:constituent"
+	"was foundedequilibriumassume thatis given byneeds to becoordinat"
+	"esthe variousare part ofonly in thesections ofis a commontheorie"
+	"s ofdiscoveriesassociationedge of thestrength ofposition inprese"
+	"nt-dayuniversallyto form thebut insteadcorporationattached tois "
+	"commonlyreasons for &quot;the can be madewas able towhich meansb"
+	"ut did notonMouseOveras possibleoperated bycoming fromthe primar"
+	"yaddition offor severaltransferreda period ofare able tohowever,"
+	" itshould havemuch larger\012\011</script>adopted theproperty ofdirect"
+	"ed byeffectivelywas broughtchildren ofProgramminglonger thanmanu"
+	"scriptswar againstby means ofand most ofsimilar to proprietaryor"
+	"iginatingprestigiousgrammaticalexperience.to make theIt was also"
+	"is found incompetitorsin the U.S.replace thebrought thecalculati"
+	"onfall of thethe generalpracticallyin honor ofreleased inresiden"
+	"tialand some ofking of thereaction to1st Earl ofculture andprinc"
+	"ipally</title>\012  they can beback to thesome of hisexposure toare"
+	" similarform of theaddFavoritecitizenshippart in thepeople withi"
+	"n practiceto continue&amp;minus;approved by the first allowed th"
+	"eand for thefunctioningplaying thesolution toheight=\"0\" in his b"
+	"ookmore than afollows thecreated thepresence in&nbsp;</td>nation"
+	"alistthe idea ofa characterwere forced class=\"btndays of thefeat"
+	"ured inshowing theinterest inin place ofturn of thethe head ofLo"
+	"rd of thepoliticallyhas its ownEducationalapproval ofsome of the"
+	"each other,behavior ofand becauseand anotherappeared onrecorded "
+	"inblack&quot;may includethe world'scan lead torefers to aborder="
+	"\"0\" government winning theresulted in while the Washington,the s"
+	"ubjectcity in the></div>\015\012\011\011reflect theto completebecame morerad"
+	"ioactiverejected bywithout anyhis father,which couldcopy of thet"
+	"o indicatea politicalaccounts ofconstitutesworked wither</a></li"
+	">of his lifeaccompaniedclientWidthprevent theLegislativedifferen"
+	"tlytogether inhas severalfor anothertext of thefounded thee with"
+	" the is used forchanged theusually theplace wherewhereas the> <a"
+	" href=\"\"><a href=\"themselves,although hethat can betraditionalro"
+	"le of theas a resultremoveChilddesigned bywest of theSome people"
+	"production,side of thenewslettersused by thedown to theaccepted "
+	"bylive in theattempts tooutside thefrequenciesHowever, inprogram"
+	"mersat least inapproximatealthough itwas part ofand variousGover"
+	"nor ofthe articleturned into><a href=\"/the economyis the mostmos"
+	"t widelywould laterand perhapsrise to theoccurs whenunder whichc"
+	"onditions.the westerntheory thatis producedthe city ofin which h"
+	"eseen in thethe centralbuilding ofmany of hisarea of theis the o"
+	"nlymost of themany of thethe WesternThere is noextended toStatis"
+	"ticalcolspan=2 |short storypossible totopologicalcritical ofrepo"
+	"rted toa Christiandecision tois equal toproblems ofThis can beme"
+	"rchandisefor most ofno evidenceeditions ofelements in&quot;. The"
+	"com/images/which makesthe processremains theliterature,is a memb"
+	"erthe popularthe ancientproblems intime of thedefeated bybody of"
+	" thea few yearsmuch of thethe work ofCalifornia,served as agover"
+	"nment.concepts ofmovement in\011\011<div id=\"it\" value=\"language ofas "
+	"they areproduced inis that theexplain thediv></div>\012However thel"
+	"ead to the\011<a href=\"/was grantedpeople havecontinuallywas seen a"
+	"sand relatedthe role ofproposed byof the besteach other.Constant"
+	"inepeople fromdialects ofto revisionwas renameda source ofthe in"
+	"itiallaunched inprovide theto the westwhere thereand similarbetw"
+	"een twois also theEnglish andconditions,that it wasentitled toth"
+	"emselves.quantity ofransparencythe same asto join thecountry and"
+	"this is theThis led toa statementcontrast tolastIndexOfthrough h"
+	"isis designedthe term isis providedprotect theng</a></li>The cur"
+	"rentthe site ofsubstantialexperience,in the Westthey shouldslove"
+	"n\304\215inacomentariosuniversidadcondicionesactividadesexperienciatec"
+	"nolog\303\255aproducci\303\263npuntuaci\303\263naplicaci\303\263ncontrase\303\261acategor\303\255asr"
+	"egistrarseprofesionaltratamientoreg\303\255stratesecretar\303\255aprincipale"
+	"sprotecci\303\263nimportantesimportanciaposibilidadinteresantecrecimie"
+	"ntonecesidadessuscribirseasociaci\303\263ndisponiblesevaluaci\303\263nestudi"
+	"antesresponsableresoluci\303\263nguadalajararegistradosoportunidadcome"
+	"rcialesfotograf\303\255aautoridadesingenier\303\255atelevisi\303\263ncompetenciaop"
+	"eracionesestablecidosimplementeactualmentenavegaci\303\263nconformidad"
+	"line-height:font-family:\" : \"http://applicationslink\" href=\"spec"
+	"ifically//<![CDATA[\012Organizationdistribution0px; height:relation"
+	"shipdevice-width<div class=\"<label for=\"registration</noscript>\012"
+	"/index.html\"window.open( !important;application/independence//ww"
+	"w.googleorganizationautocompleterequirementsconservative<form na"
+	"me=\"intellectualmargin-left:18th centuryan importantinstitutions"
+	"abbreviation<img class=\"organisationcivilization19th centuryarch"
+	"itectureincorporated20th century-container\">most notably/></a></"
+	"div>notification'undefined')Furthermore,believe thatinnerHTML = "
+	"prior to thedramaticallyreferring tonegotiationsheadquartersSout"
+	"h AfricaunsuccessfulPennsylvaniaAs a result,<html lang=\"&lt;/sup"
+	"&gt;dealing withphiladelphiahistorically);</script>\012padding-top:"
+	"experimentalgetAttributeinstructionstechnologiespart of the =fun"
+	"ction(){subscriptionl.dtd\">\015\012<htgeographicalConstitution', funct"
+	"ion(supported byagriculturalconstructionpublicationsfont-size: 1"
+	"a variety of<div style=\"Encyclopediaiframe src=\"demonstratedacco"
+	"mplisheduniversitiesDemographics);</script><dedicated toknowledg"
+	"e ofsatisfactionparticularly</div></div>English (US)appendChild("
+	"transmissions. However, intelligence\" tabindex=\"float:right;Comm"
+	"onwealthranging fromin which theat least onereproductionencyclop"
+	"edia;font-size:1jurisdictionat that time\"><a class=\"In addition,"
+	"description+conversationcontact withis generallyr\" content=\"repr"
+	"esenting&lt;math&gt;presentationoccasionally<img width=\"navigati"
+	"on\">compensationchampionshipmedia=\"all\" violation ofreference to"
+	"return true;Strict//EN\" transactionsinterventionverificationInfo"
+	"rmation difficultiesChampionshipcapabilities<![endif]-->}\012</scri"
+	"pt>\012Christianityfor example,Professionalrestrictionssuggest that"
+	"was released(such as theremoveClass(unemploymentthe Americanstru"
+	"cture of/index.html published inspan class=\"\"><a href=\"/introduc"
+	"tionbelonging toclaimed thatconsequences<meta name=\"Guide to the"
+	"overwhelmingagainst the concentrated,\012.nontouch observations</a>"
+	"\012</div>\012f (document.border: 1px {font-size:1treatment of0\" heigh"
+	"t=\"1modificationIndependencedivided intogreater thanachievements"
+	"establishingJavaScript\" neverthelesssignificanceBroadcasting>&nb"
+	"sp;</td>container\">\012such as the influence ofa particularsrc='htt"
+	"p://navigation\" half of the substantial &nbsp;</div>advantage of"
+	"discovery offundamental metropolitanthe opposite\" xml:lang=\"deli"
+	"beratelyalign=centerevolution ofpreservationimprovementsbeginnin"
+	"g inJesus ChristPublicationsdisagreementtext-align:r, function()"
+	"similaritiesbody></html>is currentlyalphabeticalis sometimestype"
+	"=\"image/many of the flow:hidden;available indescribe theexistenc"
+	"e ofall over thethe Internet\011<ul class=\"installationneighborhood"
+	"armed forcesreducing thecontinues toNonetheless,temperatures\012\011\011<"
+	"a href=\"close to theexamples of is about the(see below).\" id=\"se"
+	"archprofessionalis availablethe official\011\011</script>\012\012\011\011<div id=\""
+	"accelerationthrough the Hall of Famedescriptionstranslationsinte"
+	"rference type='text/recent yearsin the worldvery popular{backgro"
+	"und:traditional some of the connected toexploitationemergence of"
+	"constitutionA History ofsignificant manufacturedexpectations><no"
+	"script><can be foundbecause the has not beenneighbouringwithout "
+	"the added to the\011<li class=\"instrumentalSoviet Unionacknowledged"
+	"which can bename for theattention toattempts to developmentsIn f"
+	"act, the<li class=\"aimplicationssuitable formuch of the coloniza"
+	"tionpresidentialcancelBubble Informationmost of the is described"
+	"rest of the more or lessin SeptemberIntelligencesrc=\"http://px; "
+	"height: available tomanufacturerhuman rightslink href=\"/availabi"
+	"lityproportionaloutside the astronomicalhuman beingsname of the "
+	"are found inare based onsmaller thana person whoexpansion ofargu"
+	"ing thatnow known asIn the earlyintermediatederived fromScandina"
+	"vian</a></div>\015\012consider thean estimatedthe National<div id=\"pag"
+	"resulting incommissionedanalogous toare required/ul>\012</div>\012was "
+	"based onand became a&nbsp;&nbsp;t\" value=\"\" was capturedno more "
+	"thanrespectivelycontinue to >\015\012<head>\015\012<were createdmore general"
+	"information used for theindependent the Imperialcomponent ofto t"
+	"he northinclude the Constructionside of the would not befor inst"
+	"anceinvention ofmore complexcollectivelybackground: text-align: "
+	"its originalinto accountthis processan extensivehowever, thethey"
+	" are notrejected thecriticism ofduring whichprobably thethis art"
+	"icle(function(){It should bean agreementaccidentallydiffers from"
+	"Architecturebetter knownarrangementsinfluence onattended theiden"
+	"tical tosouth of thepass throughxml\" title=\"weight:bold;creating"
+	" thedisplay:nonereplaced the<img src=\"/ihttps://www.World War II"
+	"testimonialsfound in therequired to and that thebetween the was "
+	"designedconsists of considerablypublished bythe languageConserva"
+	"tionconsisted ofrefer to theback to the css\" media=\"People from "
+	"available onproved to besuggestions\"was known asvarieties oflike"
+	"ly to becomprised ofsupport the hands of thecoupled withconnect "
+	"and border:none;performancesbefore beinglater becamecalculations"
+	"often calledresidents ofmeaning that><li class=\"evidence forexpl"
+	"anationsenvironments\"></a></div>which allowsIntroductiondevelope"
+	"d bya wide rangeon behalf ofvalign=\"top\"principle ofat the time,"
+	"</noscript>\015said to havein the firstwhile othershypotheticalphil"
+	"osopherspower of thecontained inperformed byinability towere wri"
+	"ttenspan style=\"input name=\"the questionintended forrejection of"
+	"implies thatinvented thethe standardwas probablylink betweenprof"
+	"essor ofinteractionschanging theIndian Ocean class=\"lastworking "
+	"with'http://www.years beforeThis was therecreationalentering the"
+	"measurementsan extremelyvalue of thestart of the\012</script>\012\012an e"
+	"ffort toincrease theto the southspacing=\"0\">sufficientlythe Euro"
+	"peanconverted toclearTimeoutdid not haveconsequentlyfor the next"
+	"extension ofeconomic andalthough theare producedand with theinsu"
+	"fficientgiven by thestating thatexpenditures</span></a>\012thought "
+	"thaton the basiscellpadding=image of thereturning toinformation,"
+	"separated byassassinateds\" content=\"authority ofnorthwestern</di"
+	"v>\012<div \"></div>\015\012  consultationcommunity ofthe nationalit shoul"
+	"d beparticipants align=\"leftthe greatestselection ofsupernatural"
+	"dependent onis mentionedallowing thewas inventedaccompanyinghis "
+	"personalavailable atstudy of theon the otherexecution ofHuman Ri"
+	"ghtsterms of theassociationsresearch andsucceeded bydefeated the"
+	"and from thebut they arecommander ofstate of theyears of agethe "
+	"study of<ul class=\"splace in thewhere he was<li class=\"fthere ar"
+	"e nowhich becamehe publishedexpressed into which thecommissioner"
+	"font-weight:territory ofextensions\">Roman Empireequal to theIn c"
+	"ontrast,however, andis typicallyand his wife(also called><ul cla"
+	"ss=\"effectively evolved intoseem to havewhich is thethere was no"
+	"an excellentall of thesedescribed byIn practice,broadcastingchar"
+	"ged withreflected insubjected tomilitary andto the pointeconomic"
+	"allysetTargetingare actuallyvictory over();</script>continuously"
+	"required forevolutionaryan effectivenorth of the, which was fron"
+	"t of theor otherwisesome form ofhad not beengenerated byinformat"
+	"ion.permitted toincludes thedevelopment,entered intothe previous"
+	"consistentlyare known asthe field ofthis type ofgiven to thethe "
+	"title ofcontains theinstances ofin the northdue to theirare desi"
+	"gnedcorporationswas that theone of thesemore popularsucceeded in"
+	"support fromin differentdominated bydesigned forownership ofand "
+	"possiblystandardizedresponseTextwas intendedreceived theassumed "
+	"thatareas of theprimarily inthe basis ofin the senseaccounts for"
+	"destroyed byat least twowas declaredcould not beSecretary ofappe"
+	"ar to bemargin-top:1/^\\s+|\\s+$/ge){throw e};the start oftwo sepa"
+	"ratelanguage andwho had beenoperation ofdeath of thereal numbers"
+	"\011<link rel=\"provided thethe story ofcompetitionsenglish (UK)engl"
+	"ish (US)\320\234\320\276\320\275\320\263\320\276\320\273\320\241\321\200\320\277\321\201\320\272\320\270\321\201\321\200\320\277\321\201\320\272\320\270\321\201\321\200\320\277\321\201\320\272\320\276\331\204\330\271\330\261\330\250"
+	"\331\212\330\251\346\255\243\351\253\224\344\270\255\346\226\207\347\256\200\344\275\223\344\270\255\346\226\207\347\271\201\344\275\223\344\270\255\346\226\207\346\234\211\351\231\220\345\205\254\345\217\270\344\272\272\346\260\221\346\224\277\345\272\234"
+	"\351\230\277\351\207\214\345\267\264\345\267\264\347\244\276\344\274\232\344\270\273\344\271\211\346\223\215\344\275\234\347\263\273\347\273\237\346\224\277\347\255\226\346\263\225\350\247\204informaci\303\263nherr"
+	"amientaselectr\303\263nicodescripci\303\263nclasificadosconocimientopublicac"
+	"i\303\263nrelacionadasinform\303\241ticarelacionadosdepartamentotrabajadores"
+	"directamenteayuntamientomercadoLibrecont\303\241ctenoshabitacionescump"
+	"limientorestaurantesdisposici\303\263nconsecuenciaelectr\303\263nicaaplicaci"
+	"onesdesconectadoinstalaci\303\263nrealizaci\303\263nutilizaci\303\263nenciclopedia"
+	"enfermedadesinstrumentosexperienciasinstituci\303\263nparticularessubc"
+	"ategoria\321\202\320\276\320\273\321\214\320\272\320\276\320\240\320\276\321\201\321\201\320\270\320\270\321\200\320\260\320\261\320\276\321\202\321\213\320\261\320\276\320\273\321\214\321\210\320\265\320\277\321\200\320\276\321\201"
+	"\321\202\320\276\320\274\320\276\320\266\320\265\321\202\320\265\320\264\321\200\321\203\320\263\320\270\321\205\321\201\320\273\321\203\321\207\320\260\320\265\321\201\320\265\320\271\321\207\320\260\321\201\320\262\321\201\320\265\320\263\320\264\320\260"
+	"\320\240\320\276\321\201\321\201\320\270\321\217\320\234\320\276\321\201\320\272\320\262\320\265\320\264\321\200\321\203\320\263\320\270\320\265\320\263\320\276\321\200\320\276\320\264\320\260\320\262\320\276\320\277\321\200\320\276\321\201\320\264\320\260"
+	"\320\275\320\275\321\213\321\205\320\264\320\276\320\273\320\266\320\275\321\213\320\270\320\274\320\265\320\275\320\275\320\276\320\234\320\276\321\201\320\272\320\262\321\213\321\200\321\203\320\261\320\273\320\265\320\271\320\234\320\276\321\201\320\272"
+	"\320\262\320\260\321\201\321\202\321\200\320\260\320\275\321\213\320\275\320\270\321\207\320\265\320\263\320\276\321\200\320\260\320\261\320\276\321\202\320\265\320\264\320\276\320\273\320\266\320\265\320\275\321\203\321\201\320\273\321\203\320\263\320\270"
+	"\321\202\320\265\320\277\320\265\321\200\321\214\320\236\320\264\320\275\320\260\320\272\320\276\320\277\320\276\321\202\320\276\320\274\321\203\321\200\320\260\320\261\320\276\321\202\321\203\320\260\320\277\321\200\320\265\320\273\321\217\320\262\320\276"
+	"\320\276\320\261\321\211\320\265\320\276\320\264\320\275\320\276\320\263\320\276\321\201\320\262\320\276\320\265\320\263\320\276\321\201\321\202\320\260\321\202\321\214\320\270\320\264\321\200\321\203\320\263\320\276\320\271\321\204\320\276\321\200\321\203"
+	"\320\274\320\265\321\205\320\276\321\200\320\276\321\210\320\276\320\277\321\200\320\276\321\202\320\270\320\262\321\201\321\201\321\213\320\273\320\272\320\260\320\272\320\260\320\266\320\264\321\213\320\271\320\262\320\273\320\260\321\201\321\202\320\270"
+	"\320\263\321\200\321\203\320\277\320\277\321\213\320\262\320\274\320\265\321\201\321\202\320\265\321\200\320\260\320\261\320\276\321\202\320\260\321\201\320\272\320\260\320\267\320\260\320\273\320\277\320\265\321\200\320\262\321\213\320\271\320\264\320\265"
+	"\320\273\320\260\321\202\321\214\320\264\320\265\320\275\321\214\320\263\320\270\320\277\320\265\321\200\320\270\320\276\320\264\320\261\320\270\320\267\320\275\320\265\321\201\320\276\321\201\320\275\320\276\320\262\320\265\320\274\320\276\320\274\320\265"
+	"\320\275\321\202\320\272\321\203\320\277\320\270\321\202\321\214\320\264\320\276\320\273\320\266\320\275\320\260\321\200\320\260\320\274\320\272\320\260\321\205\320\275\320\260\321\207\320\260\320\273\320\276\320\240\320\260\320\261\320\276\321\202\320\260"
+	"\320\242\320\276\320\273\321\214\320\272\320\276\321\201\320\276\320\262\321\201\320\265\320\274\320\262\321\202\320\276\321\200\320\276\320\271\320\275\320\260\321\207\320\260\320\273\320\260\321\201\320\277\320\270\321\201\320\276\320\272\321\201\320\273"
+	"\321\203\320\266\320\261\321\213\321\201\320\270\321\201\321\202\320\265\320\274\320\277\320\265\321\207\320\260\321\202\320\270\320\275\320\276\320\262\320\276\320\263\320\276\320\277\320\276\320\274\320\276\321\211\320\270\321\201\320\260\320\271\321\202"
+	"\320\276\320\262\320\277\320\276\321\207\320\265\320\274\321\203\320\277\320\276\320\274\320\276\321\211\321\214\320\264\320\276\320\273\320\266\320\275\320\276\321\201\321\201\321\213\320\273\320\272\320\270\320\261\321\213\321\201\321\202\321\200\320\276"
+	"\320\264\320\260\320\275\320\275\321\213\320\265\320\274\320\275\320\276\320\263\320\270\320\265\320\277\321\200\320\276\320\265\320\272\321\202\320\241\320\265\320\271\321\207\320\260\321\201\320\274\320\276\320\264\320\265\320\273\320\270\321\202\320\260"
+	"\320\272\320\276\320\263\320\276\320\276\320\275\320\273\320\260\320\271\320\275\320\263\320\276\321\200\320\276\320\264\320\265\320\262\320\265\321\200\321\201\320\270\321\217\321\201\321\202\321\200\320\260\320\275\320\265\321\204\320\270\320\273\321\214"
+	"\320\274\321\213\321\203\321\200\320\276\320\262\320\275\321\217\321\200\320\260\320\267\320\275\321\213\321\205\320\270\321\201\320\272\320\260\321\202\321\214\320\275\320\265\320\264\320\265\320\273\321\216\321\217\320\275\320\262\320\260\321\200\321\217"
+	"\320\274\320\265\320\275\321\214\321\210\320\265\320\274\320\275\320\276\320\263\320\270\321\205\320\264\320\260\320\275\320\275\320\276\320\271\320\267\320\275\320\260\321\207\320\270\321\202\320\275\320\265\320\273\321\214\320\267\321\217\321\204\320\276"
+	"\321\200\321\203\320\274\320\260\320\242\320\265\320\277\320\265\321\200\321\214\320\274\320\265\321\201\321\217\321\206\320\260\320\267\320\260\321\211\320\270\321\202\321\213\320\233\321\203\321\207\321\210\320\270\320\265\340\244\250\340\244\271\340\245"
+	"\200\340\244\202\340\244\225\340\244\260\340\244\250\340\245\207\340\244\205\340\244\252\340\244\250\340\245\207\340\244\225\340\244\277\340\244\257\340\244\276\340\244\225\340\244\260\340\245\207\340\244\202\340\244\205\340\244\250\340\245\215\340\244\257"
+	"\340\244\225\340\245\215\340\244\257\340\244\276\340\244\227\340\244\276\340\244\207\340\244\241\340\244\254\340\244\276\340\244\260\340\245\207\340\244\225\340\244\277\340\244\270\340\245\200\340\244\246\340\244\277\340\244\257\340\244\276\340\244\252\340"
+	"\244\271\340\244\262\340\245\207\340\244\270\340\244\277\340\244\202\340\244\271\340\244\255\340\244\276\340\244\260\340\244\244\340\244\205\340\244\252\340\244\250\340\245\200\340\244\265\340\244\276\340\244\262\340\245\207\340\244\270\340\245\207\340\244"
+	"\265\340\244\276\340\244\225\340\244\260\340\244\244\340\245\207\340\244\256\340\245\207\340\244\260\340\245\207\340\244\271\340\245\213\340\244\250\340\245\207\340\244\270\340\244\225\340\244\244\340\245\207\340\244\254\340\244\271\340\245\201\340\244\244"
+	"\340\244\270\340\244\276\340\244\207\340\244\237\340\244\271\340\245\213\340\244\227\340\244\276\340\244\234\340\244\276\340\244\250\340\245\207\340\244\256\340\244\277\340\244\250\340\244\237\340\244\225\340\244\260\340\244\244\340\244\276\340\244\225\340"
+	"\244\260\340\244\250\340\244\276\340\244\211\340\244\250\340\244\225\340\245\207\340\244\257\340\244\271\340\244\276\340\244\201\340\244\270\340\244\254\340\244\270\340\245\207\340\244\255\340\244\276\340\244\267\340\244\276\340\244\206\340\244\252\340\244"
+	"\225\340\245\207\340\244\262\340\244\277\340\244\257\340\245\207\340\244\266\340\245\201\340\244\260\340\245\202\340\244\207\340\244\270\340\244\225\340\245\207\340\244\230\340\244\202\340\244\237\340\245\207\340\244\256\340\245\207\340\244\260\340\245\200"
+	"\340\244\270\340\244\225\340\244\244\340\244\276\340\244\256\340\245\207\340\244\260\340\244\276\340\244\262\340\245\207\340\244\225\340\244\260\340\244\205\340\244\247\340\244\277\340\244\225\340\244\205\340\244\252\340\244\250\340\244\276\340\244\270\340"
+	"\244\256\340\244\276\340\244\234\340\244\256\340\245\201\340\244\235\340\245\207\340\244\225\340\244\276\340\244\260\340\244\243\340\244\271\340\245\213\340\244\244\340\244\276\340\244\225\340\244\241\340\244\274\340\245\200\340\244\257\340\244\271\340\244"
+	"\276\340\244\202\340\244\271\340\245\213\340\244\237\340\244\262\340\244\266\340\244\254\340\245\215\340\244\246\340\244\262\340\244\277\340\244\257\340\244\276\340\244\234\340\245\200\340\244\265\340\244\250\340\244\234\340\244\276\340\244\244\340\244\276"
+	"\340\244\225\340\245\210\340\244\270\340\245\207\340\244\206\340\244\252\340\244\225\340\244\276\340\244\265\340\244\276\340\244\262\340\245\200\340\244\246\340\245\207\340\244\250\340\245\207\340\244\252\340\245\202\340\244\260\340\245\200\340\244\252\340"
+	"\244\276\340\244\250\340\245\200\340\244\211\340\244\270\340\244\225\340\245\207\340\244\271\340\245\213\340\244\227\340\245\200\340\244\254\340\245\210\340\244\240\340\244\225\340\244\206\340\244\252\340\244\225\340\245\200\340\244\265\340\244\260\340\245"
+	"\215\340\244\267\340\244\227\340\244\276\340\244\202\340\244\265\340\244\206\340\244\252\340\244\225\340\245\213\340\244\234\340\244\277\340\244\262\340\244\276\340\244\234\340\244\276\340\244\250\340\244\276\340\244\270\340\244\271\340\244\256\340\244\244"
+	"\340\244\271\340\244\256\340\245\207\340\244\202\340\244\211\340\244\250\340\244\225\340\245\200\340\244\257\340\244\276\340\244\271\340\245\202\340\244\246\340\244\260\340\245\215\340\244\234\340\244\270\340\245\202\340\244\232\340\245\200\340\244\252\340"
+	"\244\270\340\244\202\340\244\246\340\244\270\340\244\265\340\244\276\340\244\262\340\244\271\340\245\213\340\244\250\340\244\276\340\244\271\340\245\213\340\244\244\340\245\200\340\244\234\340\245\210\340\244\270\340\245\207\340\244\265\340\244\276\340\244"
+	"\252\340\244\270\340\244\234\340\244\250\340\244\244\340\244\276\340\244\250\340\245\207\340\244\244\340\244\276\340\244\234\340\244\276\340\244\260\340\245\200\340\244\230\340\244\276\340\244\257\340\244\262\340\244\234\340\244\277\340\244\262\340\245\207"
+	"\340\244\250\340\245\200\340\244\232\340\245\207\340\244\234\340\244\276\340\244\202\340\244\232\340\244\252\340\244\244\340\245\215\340\244\260\340\244\227\340\245\202\340\244\227\340\244\262\340\244\234\340\244\276\340\244\244\340\245\207\340\244\254\340"
+	"\244\276\340\244\271\340\244\260\340\244\206\340\244\252\340\244\250\340\245\207\340\244\265\340\244\276\340\244\271\340\244\250\340\244\207\340\244\270\340\244\225\340\244\276\340\244\270\340\245\201\340\244\254\340\244\271\340\244\260\340\244\271\340\244"
+	"\250\340\245\207\340\244\207\340\244\270\340\244\270\340\245\207\340\244\270\340\244\271\340\244\277\340\244\244\340\244\254\340\244\241\340\244\274\340\245\207\340\244\230\340\244\237\340\244\250\340\244\276\340\244\244\340\244\262\340\244\276\340\244\266"
+	"\340\244\252\340\244\276\340\244\202\340\244\232\340\244\266\340\245\215\340\244\260\340\245\200\340\244\254\340\244\241\340\244\274\340\245\200\340\244\271\340\245\213\340\244\244\340\245\207\340\244\270\340\244\276\340\244\210\340\244\237\340\244\266\340"
+	"\244\276\340\244\257\340\244\246\340\244\270\340\244\225\340\244\244\340\245\200\340\244\234\340\244\276\340\244\244\340\245\200\340\244\265\340\244\276\340\244\262\340\244\276\340\244\271\340\244\234\340\244\276\340\244\260\340\244\252\340\244\237\340\244"
+	"\250\340\244\276\340\244\260\340\244\226\340\244\250\340\245\207\340\244\270\340\244\241\340\244\274\340\244\225\340\244\256\340\244\277\340\244\262\340\244\276\340\244\211\340\244\270\340\244\225\340\245\200\340\244\225\340\245\207\340\244\265\340\244\262"
+	"\340\244\262\340\244\227\340\244\244\340\244\276\340\244\226\340\244\276\340\244\250\340\244\276\340\244\205\340\244\260\340\245\215\340\244\245\340\244\234\340\244\271\340\244\276\340\244\202\340\244\246\340\245\207\340\244\226\340\244\276\340\244\252\340"
+	"\244\271\340\244\262\340\245\200\340\244\250\340\244\277\340\244\257\340\244\256\340\244\254\340\244\277\340\244\250\340\244\276\340\244\254\340\245\210\340\244\202\340\244\225\340\244\225\340\244\271\340\245\200\340\244\202\340\244\225\340\244\271\340\244"
+	"\250\340\244\276\340\244\246\340\245\207\340\244\244\340\244\276\340\244\271\340\244\256\340\244\262\340\245\207\340\244\225\340\244\276\340\244\253\340\245\200\340\244\234\340\244\254\340\244\225\340\244\277\340\244\244\340\245\201\340\244\260\340\244\244"
+	"\340\244\256\340\244\276\340\244\202\340\244\227\340\244\265\340\244\271\340\245\200\340\244\202\340\244\260\340\245\213\340\244\234\340\244\274\340\244\256\340\244\277\340\244\262\340\245\200\340\244\206\340\244\260\340\245\213\340\244\252\340\244\270\340"
+	"\245\207\340\244\250\340\244\276\340\244\257\340\244\276\340\244\246\340\244\265\340\244\262\340\245\207\340\244\250\340\245\207\340\244\226\340\244\276\340\244\244\340\244\276\340\244\225\340\244\260\340\245\200\340\244\254\340\244\211\340\244\250\340\244"
+	"\225\340\244\276\340\244\234\340\244\265\340\244\276\340\244\254\340\244\252\340\245\202\340\244\260\340\244\276\340\244\254\340\244\241\340\244\274\340\244\276\340\244\270\340\245\214\340\244\246\340\244\276\340\244\266\340\245\207\340\244\257\340\244\260"
+	"\340\244\225\340\244\277\340\244\257\340\245\207\340\244\225\340\244\271\340\244\276\340\244\202\340\244\205\340\244\225\340\244\270\340\244\260\340\244\254\340\244\250\340\244\276\340\244\217\340\244\265\340\244\271\340\244\276\340\244\202\340\244\270\340"
+	"\245\215\340\244\245\340\244\262\340\244\256\340\244\277\340\244\262\340\245\207\340\244\262\340\245\207\340\244\226\340\244\225\340\244\265\340\244\277\340\244\267\340\244\257\340\244\225\340\245\215\340\244\260\340\244\202\340\244\270\340\244\256\340\245"
+	"\202\340\244\271\340\244\245\340\244\276\340\244\250\340\244\276\330\252\330\263\330\252\330\267\331\212\330\271\331\205\330\264\330\247\330\261\331\203\330\251\330\250\331\210\330\247\330\263\330\267\330\251\330\247\331\204\330\265\331\201\330\255\330\251"
+	"\331\205\331\210\330\247\330\266\331\212\330\271\330\247\331\204\330\256\330\247\330\265\330\251\330\247\331\204\331\205\330\262\331\212\330\257\330\247\331\204\330\271\330\247\331\205\330\251\330\247\331\204\331\203\330\247\330\252\330\250\330\247\331\204"
+	"\330\261\330\257\331\210\330\257\330\250\330\261\331\206\330\247\331\205\330\254\330\247\331\204\330\257\331\210\331\204\330\251\330\247\331\204\330\271\330\247\331\204\331\205\330\247\331\204\331\205\331\210\331\202\330\271\330\247\331\204\330\271\330\261"
+	"\330\250\331\212\330\247\331\204\330\263\330\261\331\212\330\271\330\247\331\204\330\254\331\210\330\247\331\204\330\247\331\204\330\260\331\207\330\247\330\250\330\247\331\204\330\255\331\212\330\247\330\251\330\247\331\204\330\255\331\202\331\210\331\202"
+	"\330\247\331\204\331\203\330\261\331\212\331\205\330\247\331\204\330\271\330\261\330\247\331\202\331\205\330\255\331\201\331\210\330\270\330\251\330\247\331\204\330\253\330\247\331\206\331\212\331\205\330\264\330\247\331\207\330\257\330\251\330\247\331\204"
+	"\331\205\330\261\330\243\330\251\330\247\331\204\331\202\330\261\330\242\331\206\330\247\331\204\330\264\330\250\330\247\330\250\330\247\331\204\330\255\331\210\330\247\330\261\330\247\331\204\330\254\330\257\331\212\330\257\330\247\331\204\330\243\330\263"
+	"\330\261\330\251\330\247\331\204\330\271\331\204\331\210\331\205\331\205\330\254\331\205\331\210\330\271\330\251\330\247\331\204\330\261\330\255\331\205\331\206\330\247\331\204\331\206\331\202\330\247\330\267\331\201\331\204\330\263\330\267\331\212\331\206"
+	"\330\247\331\204\331\203\331\210\331\212\330\252\330\247\331\204\330\257\331\206\331\212\330\247\330\250\330\261\331\203\330\247\330\252\331\207\330\247\331\204\330\261\331\212\330\247\330\266\330\252\330\255\331\212\330\247\330\252\331\212\330\250\330\252"
+	"\331\210\331\202\331\212\330\252\330\247\331\204\330\243\331\210\331\204\331\211\330\247\331\204\330\250\330\261\331\212\330\257\330\247\331\204\331\203\331\204\330\247\331\205\330\247\331\204\330\261\330\247\330\250\330\267\330\247\331\204\330\264\330\256"
+	"\330\265\331\212\330\263\331\212\330\247\330\261\330\247\330\252\330\247\331\204\330\253\330\247\331\204\330\253\330\247\331\204\330\265\331\204\330\247\330\251\330\247\331\204\330\255\330\257\331\212\330\253\330\247\331\204\330\262\331\210\330\247\330\261"
+	"\330\247\331\204\330\256\331\204\331\212\330\254\330\247\331\204\330\254\331\205\331\212\330\271\330\247\331\204\330\271\330\247\331\205\331\207\330\247\331\204\330\254\331\205\330\247\331\204\330\247\331\204\330\263\330\247\330\271\330\251\331\205\330\264"
+	"\330\247\331\207\330\257\331\207\330\247\331\204\330\261\330\246\331\212\330\263\330\247\331\204\330\257\330\256\331\210\331\204\330\247\331\204\331\201\331\206\331\212\330\251\330\247\331\204\331\203\330\252\330\247\330\250\330\247\331\204\330\257\331\210"
+	"\330\261\331\212\330\247\331\204\330\257\330\261\331\210\330\263\330\247\330\263\330\252\330\272\330\261\331\202\330\252\330\265\330\247\331\205\331\212\331\205\330\247\331\204\330\250\331\206\330\247\330\252\330\247\331\204\330\271\330\270\331\212\331\205"
+	"entertainmentunderstanding = function().jpg\" width=\"configuratio"
+	"n.png\" width=\"<body class=\"Math.random()contemporary United Stat"
+	"escircumstances.appendChild(organizations<span class=\"\"><img src"
+	"=\"/distinguishedthousands of communicationclear\"></div>investiga"
+	"tionfavicon.ico\" margin-right:based on the Massachusettstable bo"
+	"rder=internationalalso known aspronunciationbackground:#fpadding"
+	"-left:For example, miscellaneous&lt;/math&gt;psychologicalin par"
+	"ticularearch\" type=\"form method=\"as opposed toSupreme Courtoccas"
+	"ionally Additionally,North Americapx;backgroundopportunitiesEnte"
+	"rtainment.toLowerCase(manufacturingprofessional combined withFor"
+	" instance,consisting of\" maxlength=\"return false;consciousnessMe"
+	"diterraneanextraordinaryassassinationsubsequently button type=\"t"
+	"he number ofthe original comprehensiverefers to the</ul>\012</div>\012"
+	"philosophicallocation.hrefwas publishedSan Francisco(function(){"
+	"\012<div id=\"mainsophisticatedmathematical /head>\015\012<bodysuggests th"
+	"atdocumentationconcentrationrelationshipsmay have been(for examp"
+	"le,This article in some casesparts of the definition ofGreat Bri"
+	"tain cellpadding=equivalent toplaceholder=\"; font-size: justific"
+	"ationbelieved thatsuffered fromattempted to leader of thecript\" "
+	"src=\"/(function() {are available\012\011<link rel=\" src='http://intere"
+	"sted inconventional \" alt=\"\" /></are generallyhas also beenmost "
+	"popular correspondingcredited withtyle=\"border:</a></span></.gif"
+	"\" width=\"<iframe src=\"table class=\"inline-block;according to tog"
+	"ether withapproximatelyparliamentarymore and moredisplay:none;tr"
+	"aditionallypredominantly&nbsp;|&nbsp;&nbsp;</span> cellspacing=<"
+	"input name=\"or\" content=\"controversialproperty=\"og:/x-shockwave-"
+	"demonstrationsurrounded byNevertheless,was the firstconsiderable"
+	" Although the collaborationshould not beproportion of<span style"
+	"=\"known as the shortly afterfor instance,described as /head>\012<bo"
+	"dy starting withincreasingly the fact thatdiscussion ofmiddle of"
+	" thean individualdifficult to point of viewhomosexualityacceptan"
+	"ce of</span></div>manufacturersorigin of thecommonly usedimporta"
+	"nce ofdenominationsbackground: #length of thedeterminationa sign"
+	"ificant\" border=\"0\">revolutionaryprinciples ofis consideredwas d"
+	"evelopedIndo-Europeanvulnerable toproponents ofare sometimesclos"
+	"er to theNew York City name=\"searchattributed tocourse of themat"
+	"hematicianby the end ofat the end of\" border=\"0\" technological.r"
+	"emoveClass(branch of theevidence that![endif]-->\015\012Institute of i"
+	"nto a singlerespectively.and thereforeproperties ofis located in"
+	"some of whichThere is alsocontinued to appearance of &amp;ndash;"
+	" describes theconsiderationauthor of theindependentlyequipped wi"
+	"thdoes not have</a><a href=\"confused with<link href=\"/at the age"
+	" ofappear in theThese includeregardless ofcould be used style=&q"
+	"uot;several timesrepresent thebody>\012</html>thought to bepopulati"
+	"on ofpossibilitiespercentage ofaccess to thean attempt toproduct"
+	"ion ofjquery/jquerytwo differentbelong to theestablishmentreplac"
+	"ing thedescription\" determine theavailable forAccording to wide "
+	"range of\011<div class=\"more commonlyorganisationsfunctionalitywas "
+	"completed &amp;mdash; participationthe characteran additionalapp"
+	"ears to befact that thean example ofsignificantlyonmouseover=\"be"
+	"cause they async = true;problems withseems to havethe result of "
+	"src=\"http://familiar withpossession offunction () {took place in"
+	"and sometimessubstantially<span></span>is often usedin an attemp"
+	"tgreat deal ofEnvironmentalsuccessfully virtually all20th centur"
+	"y,professionalsnecessary to determined bycompatibilitybecause it"
+	" isDictionary ofmodificationsThe followingmay refer to:Consequen"
+	"tly,Internationalalthough somethat would beworld's firstclassifi"
+	"ed asbottom of the(particularlyalign=\"left\" most commonlybasis f"
+	"or thefoundation ofcontributionspopularity ofcenter of theto red"
+	"uce thejurisdictionsapproximation onmouseout=\"New Testamentcolle"
+	"ction of</span></a></in the Unitedfilm director-strict.dtd\">has "
+	"been usedreturn to thealthough thischange in theseveral otherbut"
+	" there areunprecedentedis similar toespecially inweight: bold;is"
+	" called thecomputationalindicate thatrestricted to\011<meta name=\"a"
+	"re typicallyconflict withHowever, the An example ofcompared with"
+	"quantities ofrather than aconstellationnecessary forreported tha"
+	"tspecificationpolitical and&nbsp;&nbsp;<references tothe same ye"
+	"arGovernment ofgeneration ofhave not beenseveral yearscommitment"
+	" to\011\011<ul class=\"visualization19th century,practitionersthat he w"
+	"ouldand continuedoccupation ofis defined ascentre of thethe amou"
+	"nt of><div style=\"equivalent ofdifferentiatebrought aboutmargin-"
+	"left: automaticallythought of asSome of these\012<div class=\"input "
+	"class=\"replaced withis one of theeducation andinfluenced byreput"
+	"ation as\012<meta name=\"accommodation</div>\012</div>large part ofInst"
+	"itute forthe so-called against the In this case,was appointedcla"
+	"imed to beHowever, thisDepartment ofthe remainingeffect on thepa"
+	"rticularly deal with the\012<div style=\"almost alwaysare currentlye"
+	"xpression ofphilosophy offor more thancivilizationson the island"
+	"selectedIndexcan result in\" value=\"\" />the structure /></a></div"
+	">Many of thesecaused by theof the Unitedspan class=\"mcan be trac"
+	"edis related tobecame one ofis frequentlyliving in thetheoretica"
+	"llyFollowing theRevolutionarygovernment inis determinedthe polit"
+	"icalintroduced insufficient todescription\">short storiesseparati"
+	"on ofas to whetherknown for itswas initiallydisplay:blockis an e"
+	"xamplethe principalconsists of arecognized as/body></html>a subs"
+	"tantialreconstructedhead of stateresistance toundergraduateThere"
+	" are twogravitationalare describedintentionallyserved as theclas"
+	"s=\"headeropposition tofundamentallydominated theand the otherall"
+	"iance withwas forced torespectively,and politicalin support ofpe"
+	"ople in the20th century.and publishedloadChartbeatto understandm"
+	"ember statesenvironmentalfirst half ofcountries andarchitectural"
+	"be consideredcharacterizedclearIntervalauthoritativeFederation o"
+	"fwas succeededand there area consequencethe Presidentalso includ"
+	"edfree softwaresuccession ofdeveloped thewas destroyedaway from "
+	"the;\012</script>\012<although theyfollowed by amore powerfulresulted "
+	"in aUniversity ofHowever, manythe presidentHowever, someis thoug"
+	"ht tountil the endwas announcedare importantalso includes><input"
+	" type=the center of DO NOT ALTERused to referthemes/\?sort=that h"
+	"ad beenthe basis forhas developedin the summercomparativelydescr"
+	"ibed thesuch as thosethe resultingis impossiblevarious otherSout"
+	"h Africanhave the sameeffectivenessin which case; text-align:str"
+	"ucture and; background:regarding thesupported theis also knownst"
+	"yle=\"marginincluding thebahasa Melayunorsk bokm\303\245lnorsk nynorsks"
+	"loven\305\241\304\215inainternacionalcalificaci\303\263ncomunicaci\303\263nconstrucci\303\263n"
+	"\"><div class=\"disambiguationDomainName', 'administrationsimultan"
+	"eouslytransportationInternational margin-bottom:responsibility<!"
+	"[endif]-->\012</><meta name=\"implementationinfrastructurerepresenta"
+	"tionborder-bottom:</head>\012<body>=http%3A%2F%2F<form method=\"meth"
+	"od=\"post\" /favicon.ico\" });\012</script>\012.setAttribute(Administrati"
+	"on= new Array();<![endif]-->\015\012display:block;Unfortunately,\">&nbs"
+	"p;</div>/favicon.ico\">='stylesheet' identification, for example,"
+	"<li><a href=\"/an alternativeas a result ofpt\"></script>\012type=\"su"
+	"bmit\" \012(function() {recommendationform action=\"/transformationre"
+	"construction.style.display According to hidden\" name=\"along with"
+	" thedocument.body.approximately Communicationspost\" action=\"mean"
+	"ing &quot;--<![endif]-->Prime Ministercharacteristic</a> <a clas"
+	"s=the history of onmouseover=\"the governmenthref=\"https://was or"
+	"iginallywas introducedclassificationrepresentativeare considered"
+	"<![endif]-->\012\012depends on theUniversity of in contrast to placeho"
+	"lder=\"in the case ofinternational constitutionalstyle=\"border-: "
+	"function() {Because of the-strict.dtd\">\012<table class=\"accompanie"
+	"d byaccount of the<script src=\"/nature of the the people in in a"
+	"ddition tos); js.id = id\" width=\"100%\"regarding the Roman Cathol"
+	"ican independentfollowing the .gif\" width=\"1the following discri"
+	"minationarchaeologicalprime minister.js\"></script>combination of"
+	" marginwidth=\"createElement(w.attachEvent(</a></td></tr>src=\"htt"
+	"ps://aIn particular, align=\"left\" Czech RepublicUnited Kingdomco"
+	"rrespondenceconcluded that.html\" title=\"(function () {comes from"
+	" theapplication of<span class=\"sbelieved to beement('script'</a>"
+	"\012</li>\012<livery different><span class=\"option value=\"(also known "
+	"as\011<li><a href=\"><input name=\"separated fromreferred to as valig"
+	"n=\"top\">founder of theattempting to carbon dioxide\012\012<div class=\""
+	"class=\"search-/body>\012</html>opportunity tocommunications</head>\015"
+	"\012<body style=\"width:Ti\341\272\277ng Vi\341\273\207tchanges in theborder-color:#0\""
+	" border=\"0\" </span></div><was discovered\" type=\"text\" );\012</scrip"
+	"t>\012\012Department of ecclesiasticalthere has beenresulting from</bo"
+	"dy></html>has never beenthe first timein response toautomaticall"
+	"y </div>\012\012<div iwas consideredpercent of the\" /></a></div>collec"
+	"tion of descended fromsection of theaccept-charsetto be confused"
+	"member of the padding-right:translation ofinterpretation href='h"
+	"ttp://whether or notThere are alsothere are manya small numberot"
+	"her parts ofimpossible to  class=\"buttonlocated in the. However,"
+	" theand eventuallyAt the end of because of itsrepresents the<for"
+	"m action=\" method=\"post\"it is possiblemore likely toan increase "
+	"inhave also beencorresponds toannounced thatalign=\"right\">many c"
+	"ountriesfor many yearsearliest knownbecause it waspt\"></script>\015"
+	" valign=\"top\" inhabitants offollowing year\015\012<div class=\"million "
+	"peoplecontroversial concerning theargue that thegovernment anda "
+	"reference totransferred todescribing the style=\"color:although t"
+	"herebest known forsubmit\" name=\"multiplicationmore than one reco"
+	"gnition ofCouncil of theedition of the  <meta name=\"Entertainmen"
+	"t away from the ;margin-right:at the time ofinvestigationsconnec"
+	"ted withand many otheralthough it isbeginning with <span class=\""
+	"descendants of<span class=\"i align=\"right\"</head>\012<body aspects "
+	"of thehas since beenEuropean Unionreminiscent ofmore difficultVi"
+	"ce Presidentcomposition ofpassed throughmore importantfont-size:"
+	"11pxexplanation ofthe concept ofwritten in the\011<span class=\"is o"
+	"ne of the resemblance toon the groundswhich containsincluding th"
+	"e defined by thepublication ofmeans that theoutside of thesuppor"
+	"t of the<input class=\"<span class=\"t(Math.random()most prominent"
+	"description ofConstantinoplewere published<div class=\"seappears "
+	"in the1\" height=\"1\" most importantwhich includeswhich had beende"
+	"struction ofthe population\012\011<div class=\"possibility ofsometimes "
+	"usedappear to havesuccess of theintended to bepresent in thestyl"
+	"e=\"clear:b\015\012</script>\015\012<was founded ininterview with_id\" content"
+	"=\"capital of the\015\012<link rel=\"srelease of thepoint out thatxMLHtt"
+	"pRequestand subsequentsecond largestvery importantspecifications"
+	"surface of theapplied to theforeign policy_setDomainNameestablis"
+	"hed inis believed toIn addition tomeaning of theis named afterto"
+	" protect theis representedDeclaration ofmore efficientClassifica"
+	"tionother forms ofhe returned to<span class=\"cperformance of(fun"
+	"ction() {\015if and only ifregions of theleading to therelations wi"
+	"thUnited Nationsstyle=\"height:other than theype\" content=\"Associ"
+	"ation of\012</head>\012<bodylocated on theis referred to(including the"
+	"concentrationsthe individualamong the mostthan any other/>\012<link"
+	" rel=\" return false;the purpose ofthe ability to;color:#fff}\012.\012<"
+	"span class=\"the subject ofdefinitions of>\015\012<link rel=\"claim that"
+	" thehave developed<table width=\"celebration ofFollowing the to d"
+	"istinguish<span class=\"btakes place inunder the namenoted that t"
+	"he><![endif]-->\012style=\"margin-instead of theintroduced thethe pr"
+	"ocess ofincreasing thedifferences inestimated thatespecially the"
+	"/div><div id=\"was eventuallythroughout histhe differencesomethin"
+	"g thatspan></span></significantly ></script>\015\012\015\012environmental to"
+	" prevent thehave been usedespecially forunderstand theis essenti"
+	"allywere the firstis the largesthave been made\" src=\"http://inte"
+	"rpreted assecond half ofcrolling=\"no\" is composed ofII, Holy Rom"
+	"anis expected tohave their owndefined as thetraditionally have d"
+	"ifferentare often usedto ensure thatagreement withcontaining the"
+	"are frequentlyinformation onexample is theresulting in a</a></li"
+	"></ul> class=\"footerand especiallytype=\"button\" </span></span>wh"
+	"ich included>\012<meta name=\"considered thecarried out byHowever, i"
+	"t isbecame part ofin relation topopular in thethe capital ofwas "
+	"officiallywhich has beenthe History ofalternative todifferent fr"
+	"omto support thesuggested thatin the process  <div class=\"the fo"
+	"undationbecause of hisconcerned withthe universityopposed to the"
+	"the context of<span class=\"ptext\" name=\"q\"\011\011<div class=\"the scie"
+	"ntificrepresented bymathematicianselected by thethat have been><"
+	"div class=\"cdiv id=\"headerin particular,converted into);\012</scrip"
+	"t>\012<philosophical srpskohrvatskiti\341\272\277ng Vi\341\273\207t\320\240\321\203\321\201\321\201\320\272\320\270\320\271\321\200\321\203"
+	"\321\201\321\201\320\272\320\270\320\271investigaci\303\263nparticipaci\303\263n\320\272\320\276\321\202\320\276\321\200\321\213\320\265\320\276\320\261\320\273\320\260\321\201\321\202"
+	"\320\270\320\272\320\276\321\202\320\276\321\200\321\213\320\271\321\207\320\265\320\273\320\276\320\262\320\265\320\272\321\201\320\270\321\201\321\202\320\265\320\274\321\213\320\235\320\276\320\262\320\276\321\201\321\202\320\270\320\272\320\276\321\202"
+	"\320\276\321\200\321\213\321\205\320\276\320\261\320\273\320\260\321\201\321\202\321\214\320\262\321\200\320\265\320\274\320\265\320\275\320\270\320\272\320\276\321\202\320\276\321\200\320\260\321\217\321\201\320\265\320\263\320\276\320\264\320\275\321\217"
+	"\321\201\320\272\320\260\321\207\320\260\321\202\321\214\320\275\320\276\320\262\320\276\321\201\321\202\320\270\320\243\320\272\321\200\320\260\320\270\320\275\321\213\320\262\320\276\320\277\321\200\320\276\321\201\321\213\320\272\320\276\321\202\320\276"
+	"\321\200\320\276\320\271\321\201\320\264\320\265\320\273\320\260\321\202\321\214\320\277\320\276\320\274\320\276\321\211\321\214\321\216\321\201\321\200\320\265\320\264\321\201\321\202\320\262\320\276\320\261\321\200\320\260\320\267\320\276\320\274\321\201"
+	"\321\202\320\276\321\200\320\276\320\275\321\213\321\203\321\207\320\260\321\201\321\202\320\270\320\265\321\202\320\265\321\207\320\265\320\275\320\270\320\265\320\223\320\273\320\260\320\262\320\275\320\260\321\217\320\270\321\201\321\202\320\276\321\200"
+	"\320\270\320\270\321\201\320\270\321\201\321\202\320\265\320\274\320\260\321\200\320\265\321\210\320\265\320\275\320\270\321\217\320\241\320\272\320\260\321\207\320\260\321\202\321\214\320\277\320\276\321\215\321\202\320\276\320\274\321\203\321\201\320\273"
+	"\320\265\320\264\321\203\320\265\321\202\321\201\320\272\320\260\320\267\320\260\321\202\321\214\321\202\320\276\320\262\320\260\321\200\320\276\320\262\320\272\320\276\320\275\320\265\321\207\320\275\320\276\321\200\320\265\321\210\320\265\320\275\320\270"
+	"\320\265\320\272\320\276\321\202\320\276\321\200\320\276\320\265\320\276\321\200\320\263\320\260\320\275\320\276\320\262\320\272\320\276\321\202\320\276\321\200\320\276\320\274\320\240\320\265\320\272\320\273\320\260\320\274\320\260\330\247\331\204\331\205"
+	"\331\206\330\252\330\257\331\211\331\205\331\206\330\252\330\257\331\212\330\247\330\252\330\247\331\204\331\205\331\210\330\266\331\210\330\271\330\247\331\204\330\250\330\261\330\247\331\205\330\254\330\247\331\204\331\205\331\210\330\247\331\202\330\271"
+	"\330\247\331\204\330\261\330\263\330\247\330\246\331\204\331\205\330\264\330\247\330\261\331\203\330\247\330\252\330\247\331\204\330\243\330\271\330\266\330\247\330\241\330\247\331\204\330\261\331\212\330\247\330\266\330\251\330\247\331\204\330\252\330\265"
+	"\331\205\331\212\331\205\330\247\331\204\330\247\330\271\330\266\330\247\330\241\330\247\331\204\331\206\330\252\330\247\330\246\330\254\330\247\331\204\330\243\331\204\330\271\330\247\330\250\330\247\331\204\330\252\330\263\330\254\331\212\331\204\330\247"
+	"\331\204\330\243\331\202\330\263\330\247\331\205\330\247\331\204\330\266\330\272\330\267\330\247\330\252\330\247\331\204\331\201\331\212\330\257\331\212\331\210\330\247\331\204\330\252\330\261\330\255\331\212\330\250\330\247\331\204\330\254\330\257\331\212"
+	"\330\257\330\251\330\247\331\204\330\252\330\271\331\204\331\212\331\205\330\247\331\204\330\243\330\256\330\250\330\247\330\261\330\247\331\204\330\247\331\201\331\204\330\247\331\205\330\247\331\204\330\243\331\201\331\204\330\247\331\205\330\247\331\204"
+	"\330\252\330\247\330\261\331\212\330\256\330\247\331\204\330\252\331\202\331\206\331\212\330\251\330\247\331\204\330\247\331\204\330\271\330\247\330\250\330\247\331\204\330\256\331\210\330\247\330\267\330\261\330\247\331\204\331\205\330\254\330\252\331\205"
+	"\330\271\330\247\331\204\330\257\331\212\331\203\331\210\330\261\330\247\331\204\330\263\331\212\330\247\330\255\330\251\330\271\330\250\330\257\330\247\331\204\331\204\331\207\330\247\331\204\330\252\330\261\330\250\331\212\330\251\330\247\331\204\330\261"
+	"\331\210\330\247\330\250\330\267\330\247\331\204\330\243\330\257\330\250\331\212\330\251\330\247\331\204\330\247\330\256\330\250\330\247\330\261\330\247\331\204\331\205\330\252\330\255\330\257\330\251\330\247\331\204\330\247\330\272\330\247\331\206\331\212"
+	"cursor:pointer;</title>\012<meta \" href=\"http://\"><span class=\"memb"
+	"ers of the window.locationvertical-align:/a> | <a href=\"<!doctyp"
+	"e html>media=\"screen\" <option value=\"favicon.ico\" />\012\011\011<div clas"
+	"s=\"characteristics\" method=\"get\" /body>\012</html>\012shortcut icon\" d"
+	"ocument.write(padding-bottom:representativessubmit\" value=\"align"
+	"=\"center\" throughout the science fiction\012  <div class=\"submit\" c"
+	"lass=\"one of the most valign=\"top\"><was established);\015\012</script>"
+	"\015\012return false;\">).style.displaybecause of the document.cookie<f"
+	"orm action=\"/}body{margin:0;Encyclopedia ofversion of the .creat"
+	"eElement(name\" content=\"</div>\012</div>\012\012administrative </body>\012</"
+	"html>history of the \"><input type=\"portion of the as part of the"
+	" &nbsp;<a href=\"other countries\">\012<div class=\"</span></span><In "
+	"other words,display: block;control of the introduction of/>\012<met"
+	"a name=\"as well as the in recent years\015\012\011<div class=\"</div>\012\011</d"
+	"iv>\012inspired by thethe end of the compatible withbecame known as"
+	" style=\"margin:.js\"></script>< International there have beenGerm"
+	"an language style=\"color:#Communist Partyconsistent withborder=\""
+	"0\" cell marginheight=\"the majority of\" align=\"centerrelated to t"
+	"he many different Orthodox Churchsimilar to the />\012<link rel=\"sw"
+	"as one of the until his death})();\012</script>other languagescompa"
+	"red to theportions of thethe Netherlandsthe most commonbackgroun"
+	"d:url(argued that thescrolling=\"no\" included in theNorth America"
+	"n the name of theinterpretationsthe traditionaldevelopment of fr"
+	"equently useda collection ofvery similar tosurrounding theexampl"
+	"e of thisalign=\"center\">would have beenimage_caption =attached t"
+	"o thesuggesting thatin the form of involved in theis derived fro"
+	"mnamed after theIntroduction torestrictions on style=\"width: can"
+	" be used to the creation ofmost important information andresulte"
+	"d in thecollapse of theThis means thatelements of thewas replace"
+	"d byanalysis of theinspiration forregarded as themost successful"
+	"known as &quot;a comprehensiveHistory of the were consideredretu"
+	"rned to theare referred toUnsourced image>\012\011<div class=\"consists"
+	" of thestopPropagationinterest in theavailability ofappears to h"
+	"aveelectromagneticenableServices(function of theIt is important<"
+	"/script></div>function(){var relative to theas a result of the p"
+	"osition ofFor example, in method=\"post\" was followed by&amp;mdas"
+	"h; thethe applicationjs\"></script>\015\012ul></div></div>after the dea"
+	"thwith respect tostyle=\"padding:is particularlydisplay:inline; t"
+	"ype=\"submit\" is divided into\344\270\255\346\226\207 (\347\256\200\344\275\223)responsabilidadadmini"
+	"straci\303\263ninternacionalescorrespondiente\340\244\211\340\244\252\340\244\257\340\245\213\340\244\227\340\244\252\340\245\202\340\244\260\340"
+	"\245\215\340\244\265\340\244\271\340\244\256\340\244\276\340\244\260\340\245\207\340\244\262\340\245\213\340\244\227\340\245\213\340\244\202\340\244\232\340\245\201\340\244\250\340\244\276\340\244\265\340\244\262\340\245\207\340\244\225\340\244\277\340\244"
+	"\250\340\244\270\340\244\260\340\244\225\340\244\276\340\244\260\340\244\252\340\245\201\340\244\262\340\244\277\340\244\270\340\244\226\340\245\213\340\244\234\340\245\207\340\244\202\340\244\232\340\244\276\340\244\271\340\244\277\340\244\217\340\244\255"
+	"\340\245\207\340\244\234\340\245\207\340\244\202\340\244\266\340\244\276\340\244\256\340\244\277\340\244\262\340\244\271\340\244\256\340\244\276\340\244\260\340\245\200\340\244\234\340\244\276\340\244\227\340\244\260\340\244\243\340\244\254\340\244\250\340"
+	"\244\276\340\244\250\340\245\207\340\244\225\340\245\201\340\244\256\340\244\276\340\244\260\340\244\254\340\245\215\340\244\262\340\245\211\340\244\227\340\244\256\340\244\276\340\244\262\340\244\277\340\244\225\340\244\256\340\244\271\340\244\277\340\244"
+	"\262\340\244\276\340\244\252\340\245\203\340\244\267\340\245\215\340\244\240\340\244\254\340\244\242\340\244\274\340\244\244\340\245\207\340\244\255\340\244\276\340\244\234\340\244\252\340\244\276\340\244\225\340\245\215\340\244\262\340\244\277\340\244\225"
+	"\340\244\237\340\245\215\340\244\260\340\245\207\340\244\250\340\244\226\340\244\277\340\244\262\340\244\276\340\244\253\340\244\246\340\245\214\340\244\260\340\244\276\340\244\250\340\244\256\340\244\276\340\244\256\340\244\262\340\245\207\340\244\256\340"
+	"\244\244\340\244\246\340\244\276\340\244\250\340\244\254\340\244\276\340\244\234\340\244\276\340\244\260\340\244\265\340\244\277\340\244\225\340\244\276\340\244\270\340\244\225\340\245\215\340\244\257\340\245\213\340\244\202\340\244\232\340\244\276\340\244"
+	"\271\340\244\244\340\245\207\340\244\252\340\244\271\340\245\201\340\244\201\340\244\232\340\244\254\340\244\244\340\244\276\340\244\257\340\244\276\340\244\270\340\244\202\340\244\265\340\244\276\340\244\246\340\244\246\340\245\207\340\244\226\340\244\250"
+	"\340\245\207\340\244\252\340\244\277\340\244\233\340\244\262\340\245\207\340\244\265\340\244\277\340\244\266\340\245\207\340\244\267\340\244\260\340\244\276\340\244\234\340\245\215\340\244\257\340\244\211\340\244\244\340\245\215\340\244\244\340\244\260\340"
+	"\244\256\340\245\201\340\244\202\340\244\254\340\244\210\340\244\246\340\245\213\340\244\250\340\245\213\340\244\202\340\244\211\340\244\252\340\244\225\340\244\260\340\244\243\340\244\252\340\244\242\340\244\274\340\245\207\340\244\202\340\244\270\340\245"
+	"\215\340\244\245\340\244\277\340\244\244\340\244\253\340\244\277\340\244\262\340\245\215\340\244\256\340\244\256\340\245\201\340\244\226\340\245\215\340\244\257\340\244\205\340\244\232\340\245\215\340\244\233\340\244\276\340\244\233\340\245\202\340\244\237"
+	"\340\244\244\340\245\200\340\244\270\340\244\202\340\244\227\340\245\200\340\244\244\340\244\234\340\244\276\340\244\217\340\244\227\340\244\276\340\244\265\340\244\277\340\244\255\340\244\276\340\244\227\340\244\230\340\244\243\340\245\215\340\244\237\340"
+	"\245\207\340\244\246\340\245\202\340\244\270\340\244\260\340\245\207\340\244\246\340\244\277\340\244\250\340\245\213\340\244\202\340\244\271\340\244\244\340\245\215\340\244\257\340\244\276\340\244\270\340\245\207\340\244\225\340\245\215\340\244\270\340\244"
+	"\227\340\244\276\340\244\202\340\244\247\340\245\200\340\244\265\340\244\277\340\244\266\340\245\215\340\244\265\340\244\260\340\244\276\340\244\244\340\245\207\340\244\202\340\244\246\340\245\210\340\244\237\340\245\215\340\244\270\340\244\250\340\244\225"
+	"\340\245\215\340\244\266\340\244\276\340\244\270\340\244\276\340\244\256\340\244\250\340\245\207\340\244\205\340\244\246\340\244\276\340\244\262\340\244\244\340\244\254\340\244\277\340\244\234\340\244\262\340\245\200\340\244\252\340\245\201\340\244\260\340"
+	"\245\202\340\244\267\340\244\271\340\244\277\340\244\202\340\244\246\340\245\200\340\244\256\340\244\277\340\244\244\340\245\215\340\244\260\340\244\225\340\244\265\340\244\277\340\244\244\340\244\276\340\244\260\340\245\201\340\244\252\340\244\257\340\245"
+	"\207\340\244\270\340\245\215\340\244\245\340\244\276\340\244\250\340\244\225\340\244\260\340\245\213\340\244\241\340\244\274\340\244\256\340\245\201\340\244\225\340\245\215\340\244\244\340\244\257\340\245\213\340\244\234\340\244\250\340\244\276\340\244\225"
+	"\340\245\203\340\244\252\340\244\257\340\244\276\340\244\252\340\245\213\340\244\270\340\245\215\340\244\237\340\244\230\340\244\260\340\245\207\340\244\262\340\245\202\340\244\225\340\244\276\340\244\260\340\245\215\340\244\257\340\244\265\340\244\277\340"
+	"\244\232\340\244\276\340\244\260\340\244\270\340\245\202\340\244\232\340\244\250\340\244\276\340\244\256\340\245\202\340\244\262\340\245\215\340\244\257\340\244\246\340\245\207\340\244\226\340\245\207\340\244\202\340\244\271\340\244\256\340\245\207\340\244"
+	"\266\340\244\276\340\244\270\340\245\215\340\244\225\340\245\202\340\244\262\340\244\256\340\245\210\340\244\202\340\244\250\340\245\207\340\244\244\340\245\210\340\244\257\340\244\276\340\244\260\340\244\234\340\244\277\340\244\270\340\244\225\340\245\207"
+	"rss+xml\" title=\"-type\" content=\"title\" content=\"at the same time"
+	".js\"></script>\012<\" method=\"post\" </span></a></li>vertical-align:t"
+	"/jquery.min.js\">.click(function( style=\"padding-})();\012</script>\012"
+	"</span><a href=\"<a href=\"http://); return false;text-decoration:"
+	" scrolling=\"no\" border-collapse:associated with Bahasa Indonesia"
+	"English language<text xml:space=.gif\" border=\"0\"</body>\012</html>\012"
+	"overflow:hidden;img src=\"http://addEventListenerresponsible for "
+	"s.js\"></script>\012/favicon.ico\" />operating system\" style=\"width:1"
+	"target=\"_blank\">State Universitytext-align:left;\012document.write("
+	", including the around the world);\015\012</script>\015\012<\" style=\"height:"
+	";overflow:hiddenmore informationan internationala member of the "
+	"one of the firstcan be found in </div>\012\011\011</div>\012display: none;\">"
+	"\" />\012<link rel=\"\012  (function() {the 15th century.preventDefault("
+	"large number of Byzantine Empire.jpg|thumb|left|vast majority of"
+	"majority of the  align=\"center\">University Pressdominated by the"
+	"Second World Wardistribution of style=\"position:the rest of the "
+	"characterized by rel=\"nofollow\">derives from therather than the "
+	"a combination ofstyle=\"width:100English-speakingcomputer science"
+	"border=\"0\" alt=\"the existence ofDemocratic Party\" style=\"margin-"
+	"For this reason,.js\"></script>\012\011sByTagName(s)[0]js\"></script>\015\012<"
+	".js\"></script>\015\012link rel=\"icon\" ' alt='' class='formation of the"
+	"versions of the </a></div></div>/page>\012  <page>\012<div class=\"cont"
+	"became the firstbahasa Indonesiaenglish (simple)\316\225\316\273\316\273\316\267\316\275\316\271\316\272\316\254"
+	"\321\205\321\200\320\262\320\260\321\202\321\201\320\272\320\270\320\272\320\276\320\274\320\277\320\260\320\275\320\270\320\270\321\217\320\262\320\273\321\217\320\265\321\202\321\201\321\217\320\224\320\276\320\261\320\260\320\262\320\270\321\202\321\214"
+	"\321\207\320\265\320\273\320\276\320\262\320\265\320\272\320\260\321\200\320\260\320\267\320\262\320\270\321\202\320\270\321\217\320\230\320\275\321\202\320\265\321\200\320\275\320\265\321\202\320\236\321\202\320\262\320\265\321\202\320\270\321\202\321\214"
+	"\320\275\320\260\320\277\321\200\320\270\320\274\320\265\321\200\320\270\320\275\321\202\320\265\321\200\320\275\320\265\321\202\320\272\320\276\321\202\320\276\321\200\320\276\320\263\320\276\321\201\321\202\321\200\320\260\320\275\320\270\321\206\321\213"
+	"\320\272\320\260\321\207\320\265\321\201\321\202\320\262\320\265\321\203\321\201\320\273\320\276\320\262\320\270\321\217\321\205\320\277\321\200\320\276\320\261\320\273\320\265\320\274\321\213\320\277\320\276\320\273\321\203\321\207\320\270\321\202\321\214"
+	"\321\217\320\262\320\273\321\217\321\216\321\202\321\201\321\217\320\275\320\260\320\270\320\261\320\276\320\273\320\265\320\265\320\272\320\276\320\274\320\277\320\260\320\275\320\270\321\217\320\262\320\275\320\270\320\274\320\260\320\275\320\270\320\265"
+	"\321\201\321\200\320\265\320\264\321\201\321\202\320\262\320\260\330\247\331\204\331\205\331\210\330\247\330\266\331\212\330\271\330\247\331\204\330\261\330\246\331\212\330\263\331\212\330\251\330\247\331\204\330\247\331\206\330\252\331\202\330\247\331\204"
+	"\331\205\330\264\330\247\330\261\331\203\330\247\330\252\331\203\330\247\331\204\330\263\331\212\330\247\330\261\330\247\330\252\330\247\331\204\331\205\331\203\330\252\331\210\330\250\330\251\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251"
+	"\330\247\330\255\330\265\330\247\330\246\331\212\330\247\330\252\330\247\331\204\330\271\330\247\331\204\331\205\331\212\330\251\330\247\331\204\330\265\331\210\330\252\331\212\330\247\330\252\330\247\331\204\330\247\331\206\330\252\330\261\331\206\330\252"
+	"\330\247\331\204\330\252\330\265\330\247\331\205\331\212\331\205\330\247\331\204\330\245\330\263\331\204\330\247\331\205\331\212\330\247\331\204\331\205\330\264\330\247\330\261\331\203\330\251\330\247\331\204\331\205\330\261\330\246\331\212\330\247\330\252"
+	"robots\" content=\"<div id=\"footer\">the United States<img src=\"htt"
+	"p://.jpg|right|thumb|.js\"></script>\015\012<location.protocolframebord"
+	"er=\"0\" s\" />\012<meta name=\"</a></div></div><font-weight:bold;&quot"
+	"; and &quot;depending on the margin:0;padding:\" rel=\"nofollow\" P"
+	"resident of the twentieth centuryevision>\012  </pageInternet Explo"
+	"rera.async = true;\015\012information about<div id=\"header\">\" action=\""
+	"http://<a href=\"https://<div id=\"content\"</div>\015\012</div>\015\012<derive"
+	"d from the <img src='http://according to the \012</body>\012</html>\012st"
+	"yle=\"font-size:script language=\"Arial, Helvetica,</a><span class"
+	"=\"</script><script political partiestd></tr></table><href=\"http:"
+	"//www.interpretation ofrel=\"stylesheet\" document.write('<charset"
+	"=\"utf-8\">\012beginning of the revealed that thetelevision series\" r"
+	"el=\"nofollow\"> target=\"_blank\">claiming that thehttp%3A%2F%2Fwww"
+	".manifestations ofPrime Minister ofinfluenced by theclass=\"clear"
+	"fix\">/div>\015\012</div>\015\012\015\012three-dimensionalChurch of Englandof North"
+	" Carolinasquare kilometres.addEventListenerdistinct from thecomm"
+	"only known asPhonetic Alphabetdeclared that thecontrolled by the"
+	"Benjamin Franklinrole-playing gamethe University ofin Western Eu"
+	"ropepersonal computerProject Gutenbergregardless of thehas been "
+	"proposedtogether with the></li><li class=\"in some countriesmin.j"
+	"s\"></script>of the populationofficial language<img src=\"images/i"
+	"dentified by thenatural resourcesclassification ofcan be conside"
+	"redquantum mechanicsNevertheless, themillion years ago</body>\015\012<"
+	"/html>\015\316\225\316\273\316\273\316\267\316\275\316\271\316\272\316\254\012take advantage ofand, according toattrib"
+	"uted to theMicrosoft Windowsthe first centuryunder the controldi"
+	"v class=\"headershortly after thenotable exceptiontens of thousan"
+	"dsseveral differentaround the world.reaching militaryisolated fr"
+	"om theopposition to thethe Old TestamentAfrican Americansinserte"
+	"d into theseparate from themetropolitan areamakes it possibleack"
+	"nowledged thatarguably the mosttype=\"text/css\">\012the Internationa"
+	"lAccording to the pe=\"text/css\" />\012coincide with thetwo-thirds o"
+	"f theDuring this time,during the periodannounced that hethe inte"
+	"rnationaland more recentlybelieved that theconsciousness andform"
+	"erly known assurrounded by thefirst appeared inoccasionally used"
+	"position:absolute;\" target=\"_blank\" position:relative;text-align"
+	":center;jax/libs/jquery/1.background-color:#type=\"application/an"
+	"guage\" content=\"<meta http-equiv=\"Privacy Policy</a>e(\"%3Cscript"
+	" src='\" target=\"_blank\">On the other hand,.jpg|thumb|right|2</di"
+	"v><div class=\"<div style=\"float:nineteenth century</body>\015\012</htm"
+	"l>\015\012<img src=\"http://s;text-align:centerfont-weight: bold; Accor"
+	"ding to the difference between\" frameborder=\"0\" \" style=\"positio"
+	"n:link href=\"http://html4/loose.dtd\">\012during this period</td></t"
+	"r></table>closely related tofor the first time;font-weight:bold;"
+	"input type=\"text\" <span style=\"font-onreadystatechange\011<div clas"
+	"s=\"cleardocument.location. For example, the a wide variety of <!"
+	"DOCTYPE html>\015\012<&nbsp;&nbsp;&nbsp;\"><a href=\"http://style=\"float"
+	":left;concerned with the=http%3A%2F%2Fwww.in popular culturetype"
+	"=\"text/css\" />it is possible to Harvard Universitytylesheet\" hre"
+	"f=\"/the main characterOxford University  name=\"keywords\" cstyle="
+	"\"text-align:the United Kingdomfederal government<div style=\"marg"
+	"in depending on the description of the<div class=\"header.min.js\""
+	"></script>destruction of theslightly differentin accordance with"
+	"telecommunicationsindicates that theshortly thereafterespecially"
+	" in the European countriesHowever, there aresrc=\"http://staticsu"
+	"ggested that the\" src=\"http://www.a large number of Telecommunic"
+	"ations\" rel=\"nofollow\" tHoly Roman Emperoralmost exclusively\" bo"
+	"rder=\"0\" alt=\"Secretary of Stateculminating in theCIA World Fact"
+	"bookthe most importantanniversary of thestyle=\"background-<li><e"
+	"m><a href=\"/the Atlantic Oceanstrictly speaking,shortly before t"
+	"hedifferent types ofthe Ottoman Empire><img src=\"http://An Intro"
+	"duction toconsequence of thedeparture from theConfederate States"
+	"indigenous peoplesProceedings of theinformation on thetheories h"
+	"ave beeninvolvement in thedivided into threeadjacent countriesis"
+	" responsible fordissolution of thecollaboration withwidely regar"
+	"ded ashis contemporariesfounding member ofDominican Republicgene"
+	"rally acceptedthe possibility ofare also availableunder construc"
+	"tionrestoration of thethe general publicis almost entirelypasses"
+	" through thehas been suggestedcomputer and videoGermanic languag"
+	"es according to the different from theshortly afterwardshref=\"ht"
+	"tps://www.recent developmentBoard of Directors<div class=\"search"
+	"| <a href=\"http://In particular, theMultiple footnotesor other s"
+	"ubstancethousands of yearstranslation of the</div>\015\012</div>\015\012\015\012<a"
+	" href=\"index.phpwas established inmin.js\"></script>\012participate "
+	"in thea strong influencestyle=\"margin-top:represented by thegrad"
+	"uated from theTraditionally, theElement(\"script\");However, since"
+	" the/div>\012</div>\012<div left; margin-left:protection against0; ver"
+	"tical-align:Unfortunately, thetype=\"image/x-icon/div>\012<div class"
+	"=\" class=\"clearfix\"><div class=\"footer\011\011</div>\012\011\011</div>\012the moti"
+	"on picture\320\221\321\212\320\273\320\263\320\260\321\200\321\201\320\272\320\270\320\261\321\212\320\273\320\263\320\260\321\200\321\201\320\272\320\270\320\244\320\265\320\264\320\265\321\200\320\260\321\206\320\270\320\270"
+	"\320\275\320\265\321\201\320\272\320\276\320\273\321\214\320\272\320\276\321\201\320\276\320\276\320\261\321\211\320\265\320\275\320\270\320\265\321\201\320\276\320\276\320\261\321\211\320\265\320\275\320\270\321\217\320\277\321\200\320\276\320\263\321\200"
+	"\320\260\320\274\320\274\321\213\320\236\321\202\320\277\321\200\320\260\320\262\320\270\321\202\321\214\320\261\320\265\321\201\320\277\320\273\320\260\321\202\320\275\320\276\320\274\320\260\321\202\320\265\321\200\320\270\320\260\320\273\321\213\320\277"
+	"\320\276\320\267\320\262\320\276\320\273\321\217\320\265\321\202\320\277\320\276\321\201\320\273\320\265\320\264\320\275\320\270\320\265\321\200\320\260\320\267\320\273\320\270\321\207\320\275\321\213\321\205\320\277\321\200\320\276\320\264\321\203\320\272"
+	"\321\206\320\270\320\270\320\277\321\200\320\276\320\263\321\200\320\260\320\274\320\274\320\260\320\277\320\276\320\273\320\275\320\276\321\201\321\202\321\214\321\216\320\275\320\260\321\205\320\276\320\264\320\270\321\202\321\201\321\217\320\270\320\267"
+	"\320\261\321\200\320\260\320\275\320\275\320\276\320\265\320\275\320\260\321\201\320\265\320\273\320\265\320\275\320\270\321\217\320\270\320\267\320\274\320\265\320\275\320\265\320\275\320\270\321\217\320\272\320\260\321\202\320\265\320\263\320\276\321\200"
+	"\320\270\320\270\320\220\320\273\320\265\320\272\321\201\320\260\320\275\320\264\321\200\340\244\246\340\245\215\340\244\265\340\244\276\340\244\260\340\244\276\340\244\256\340\245\210\340\244\250\340\245\201\340\244\205\340\244\262\340\244\252\340\245\215"
+	"\340\244\260\340\244\246\340\244\276\340\244\250\340\244\255\340\244\276\340\244\260\340\244\244\340\245\200\340\244\257\340\244\205\340\244\250\340\245\201\340\244\246\340\245\207\340\244\266\340\244\271\340\244\277\340\244\250\340\245\215\340\244\246\340"
+	"\245\200\340\244\207\340\244\202\340\244\241\340\244\277\340\244\257\340\244\276\340\244\246\340\244\277\340\244\262\340\245\215\340\244\262\340\245\200\340\244\205\340\244\247\340\244\277\340\244\225\340\244\276\340\244\260\340\244\265\340\245\200\340\244"
+	"\241\340\244\277\340\244\257\340\245\213\340\244\232\340\244\277\340\244\237\340\245\215\340\244\240\340\245\207\340\244\270\340\244\256\340\244\276\340\244\232\340\244\276\340\244\260\340\244\234\340\244\202\340\244\225\340\245\215\340\244\266\340\244\250"
+	"\340\244\246\340\245\201\340\244\250\340\244\277\340\244\257\340\244\276\340\244\252\340\245\215\340\244\260\340\244\257\340\245\213\340\244\227\340\244\205\340\244\250\340\245\201\340\244\270\340\244\276\340\244\260\340\244\221\340\244\250\340\244\262\340"
+	"\244\276\340\244\207\340\244\250\340\244\252\340\244\276\340\244\260\340\245\215\340\244\237\340\245\200\340\244\266\340\244\260\340\245\215\340\244\244\340\245\213\340\244\202\340\244\262\340\245\213\340\244\225\340\244\270\340\244\255\340\244\276\340\244"
+	"\253\340\244\274\340\245\215\340\244\262\340\245\210\340\244\266\340\244\266\340\244\260\340\245\215\340\244\244\340\245\207\340\244\202\340\244\252\340\245\215\340\244\260\340\244\246\340\245\207\340\244\266\340\244\252\340\245\215\340\244\262\340\245\207"
+	"\340\244\257\340\244\260\340\244\225\340\245\207\340\244\202\340\244\246\340\245\215\340\244\260\340\244\270\340\245\215\340\244\245\340\244\277\340\244\244\340\244\277\340\244\211\340\244\244\340\245\215\340\244\252\340\244\276\340\244\246\340\244\211\340"
+	"\244\250\340\245\215\340\244\271\340\245\207\340\244\202\340\244\232\340\244\277\340\244\237\340\245\215\340\244\240\340\244\276\340\244\257\340\244\276\340\244\244\340\245\215\340\244\260\340\244\276\340\244\234\340\245\215\340\244\257\340\244\276\340\244"
+	"\246\340\244\276\340\244\252\340\245\201\340\244\260\340\244\276\340\244\250\340\245\207\340\244\234\340\245\213\340\244\241\340\244\274\340\245\207\340\244\202\340\244\205\340\244\250\340\245\201\340\244\265\340\244\276\340\244\246\340\244\266\340\245\215"
+	"\340\244\260\340\245\207\340\244\243\340\245\200\340\244\266\340\244\277\340\244\225\340\245\215\340\244\267\340\244\276\340\244\270\340\244\260\340\244\225\340\244\276\340\244\260\340\245\200\340\244\270\340\244\202\340\244\227\340\245\215\340\244\260\340"
+	"\244\271\340\244\252\340\244\260\340\244\277\340\244\243\340\244\276\340\244\256\340\244\254\340\245\215\340\244\260\340\244\276\340\244\202\340\244\241\340\244\254\340\244\232\340\245\215\340\244\232\340\245\213\340\244\202\340\244\211\340\244\252\340\244"
+	"\262\340\244\254\340\245\215\340\244\247\340\244\256\340\244\202\340\244\244\340\245\215\340\244\260\340\245\200\340\244\270\340\244\202\340\244\252\340\244\260\340\245\215\340\244\225\340\244\211\340\244\256\340\245\215\340\244\256\340\245\200\340\244\246"
+	"\340\244\256\340\244\276\340\244\247\340\245\215\340\244\257\340\244\256\340\244\270\340\244\271\340\244\276\340\244\257\340\244\244\340\244\276\340\244\266\340\244\254\340\245\215\340\244\246\340\245\213\340\244\202\340\244\256\340\245\200\340\244\241\340"
+	"\244\277\340\244\257\340\244\276\340\244\206\340\244\210\340\244\252\340\245\200\340\244\217\340\244\262\340\244\256\340\245\213\340\244\254\340\244\276\340\244\207\340\244\262\340\244\270\340\244\202\340\244\226\340\245\215\340\244\257\340\244\276\340\244"
+	"\206\340\244\252\340\244\260\340\245\207\340\244\266\340\244\250\340\244\205\340\244\250\340\245\201\340\244\254\340\244\202\340\244\247\340\244\254\340\244\276\340\244\234\340\244\274\340\244\276\340\244\260\340\244\250\340\244\265\340\245\200\340\244\250"
+	"\340\244\244\340\244\256\340\244\252\340\245\215\340\244\260\340\244\256\340\245\201\340\244\226\340\244\252\340\245\215\340\244\260\340\244\266\340\245\215\340\244\250\340\244\252\340\244\260\340\244\277\340\244\265\340\244\276\340\244\260\340\244\250\340"
+	"\245\201\340\244\225\340\244\270\340\244\276\340\244\250\340\244\270\340\244\256\340\244\260\340\245\215\340\244\245\340\244\250\340\244\206\340\244\257\340\245\213\340\244\234\340\244\277\340\244\244\340\244\270\340\245\213\340\244\256\340\244\265\340\244"
+	"\276\340\244\260\330\247\331\204\331\205\330\264\330\247\330\261\331\203\330\247\330\252\330\247\331\204\331\205\331\206\330\252\330\257\331\212\330\247\330\252\330\247\331\204\331\203\331\205\330\250\331\212\331\210\330\252\330\261\330\247\331\204\331\205"
+	"\330\264\330\247\331\207\330\257\330\247\330\252\330\271\330\257\330\257\330\247\331\204\330\262\331\210\330\247\330\261\330\271\330\257\330\257\330\247\331\204\330\261\330\257\331\210\330\257\330\247\331\204\330\245\330\263\331\204\330\247\331\205\331\212"
+	"\330\251\330\247\331\204\331\201\331\210\330\252\331\210\330\264\331\210\330\250\330\247\331\204\331\205\330\263\330\247\330\250\331\202\330\247\330\252\330\247\331\204\331\205\330\271\331\204\331\210\331\205\330\247\330\252\330\247\331\204\331\205\330\263"
+	"\331\204\330\263\331\204\330\247\330\252\330\247\331\204\330\254\330\261\330\247\331\201\331\212\331\203\330\263\330\247\331\204\330\247\330\263\331\204\330\247\331\205\331\212\330\251\330\247\331\204\330\247\330\252\330\265\330\247\331\204\330\247\330\252"
+	"keywords\" content=\"w3.org/1999/xhtml\"><a target=\"_blank\" text/ht"
+	"ml; charset=\" target=\"_blank\"><table cellpadding=\"autocomplete=\""
+	"off\" text-align: center;to last version by background-color: #\" "
+	"href=\"http://www./div></div><div id=<a href=\"#\" class=\"\"><img sr"
+	"c=\"http://cript\" src=\"http://\012<script language=\"//EN\" \"http://ww"
+	"w.wencodeURIComponent(\" href=\"javascript:<div class=\"contentdocu"
+	"ment.write('<scposition: absolute;script src=\"http:// style=\"mar"
+	"gin-top:.min.js\"></script>\012</div>\012<div class=\"w3.org/1999/xhtml\""
+	" \012\015\012</body>\015\012</html>distinction between/\" target=\"_blank\"><link "
+	"href=\"http://encoding=\"utf-8\"\?>\012w.addEventListener\?action=\"http:"
+	"//www.icon\" href=\"http:// style=\"background:type=\"text/css\" />\012m"
+	"eta property=\"og:t<input type=\"text\"  style=\"text-align:the deve"
+	"lopment of tylesheet\" type=\"tehtml; charset=utf-8is considered t"
+	"o betable width=\"100%\" In addition to the contributed to the dif"
+	"ferences betweendevelopment of the It is important to </script>\012"
+	"\012<script  style=\"font-size:1></span><span id=gbLibrary of Congre"
+	"ss<img src=\"http://imEnglish translationAcademy of Sciencesdiv s"
+	"tyle=\"display:construction of the.getElementById(id)in conjuncti"
+	"on withElement('script'); <meta property=\"og:\320\221\321\212\320\273\320\263\320\260\321\200\321\201\320\272\320\270\012"
+	" type=\"text\" name=\">Privacy Policy</a>administered by theenableS"
+	"ingleRequeststyle=&quot;margin:</div></div></div><><img src=\"htt"
+	"p://i style=&quot;float:referred to as the total population ofin"
+	" Washington, D.C. style=\"background-among other things,organizat"
+	"ion of theparticipated in thethe introduction ofidentified with "
+	"thefictional character Oxford University misunderstanding ofTher"
+	"e are, however,stylesheet\" href=\"/Columbia Universityexpanded to"
+	" includeusually referred toindicating that thehave suggested tha"
+	"taffiliated with thecorrelation betweennumber of different></td>"
+	"</tr></table>Republic of Ireland\012</script>\012<script under the inf"
+	"luencecontribution to theOfficial website ofheadquarters of thec"
+	"entered around theimplications of thehave been developedFederal "
+	"Republic ofbecame increasinglycontinuation of theNote, however, "
+	"thatsimilar to that of capabilities of theaccordance with thepar"
+	"ticipants in thefurther developmentunder the directionis often c"
+	"onsideredhis younger brother</td></tr></table><a http-equiv=\"X-U"
+	"A-physical propertiesof British Columbiahas been criticized(with"
+	" the exceptionquestions about thepassing through the0\" cellpaddi"
+	"ng=\"0\" thousands of peopleredirects here. Forhave children under"
+	"%3E%3C/script%3E\"));<a href=\"http://www.<li><a href=\"http://site"
+	"_name\" content=\"text-decoration:nonestyle=\"display: none<meta ht"
+	"tp-equiv=\"X-new Date().getTime() type=\"image/x-icon\"</span><span"
+	" class=\"language=\"javascriptwindow.location.href<a href=\"javascr"
+	"ipt:-->\015\012<script type=\"t<a href='http://www.hortcut icon\" href=\""
+	"</div>\015\012<div class=\"<script src=\"http://\" rel=\"stylesheet\" t</di"
+	"v>\012<script type=/a> <a href=\"http:// allowTransparency=\"X-UA-Com"
+	"patible\" conrelationship between\012</script>\015\012<script </a></li></u"
+	"l></div>associated with the programming language</a><a href=\"htt"
+	"p://</a></li><li class=\"form action=\"http://<div style=\"display:"
+	"type=\"text\" name=\"q\"<table width=\"100%\" background-position:\" bo"
+	"rder=\"0\" width=\"rel=\"shortcut icon\" h6><ul><li><a href=\"  <meta "
+	"http-equiv=\"css\" media=\"screen\" responsible for the \" type=\"appl"
+	"ication/\" style=\"background-html; charset=utf-8\" allowtransparen"
+	"cy=\"stylesheet\" type=\"te\015\012<meta http-equiv=\"></span><span class="
+	"\"0\" cellspacing=\"0\">;\012</script>\012<script sometimes called thedoes"
+	" not necessarilyFor more informationat the beginning of <!DOCTYP"
+	"E html><htmlparticularly in the type=\"hidden\" name=\"javascript:v"
+	"oid(0);\"effectiveness of the autocomplete=\"off\" generally consid"
+	"ered><input type=\"text\" \"></script>\015\012<scriptthroughout the world"
+	"common misconceptionassociation with the</div>\012</div>\012<div cduri"
+	"ng his lifetime,corresponding to thetype=\"image/x-icon\" an incre"
+	"asing numberdiplomatic relationsare often consideredmeta charset"
+	"=\"utf-8\" <input type=\"text\" examples include the\"><img src=\"http"
+	"://iparticipation in thethe establishment of\012</div>\012<div class=\""
+	"&amp;nbsp;&amp;nbsp;to determine whetherquite different frommark"
+	"ed the beginningdistance between thecontributions to theconflict"
+	" between thewidely considered towas one of the firstwith varying"
+	" degreeshave speculated that(document.getElementparticipating in"
+	" theoriginally developedeta charset=\"utf-8\"> type=\"text/css\" />\012"
+	"interchangeably withmore closely relatedsocial and politicalthat"
+	" would otherwiseperpendicular to thestyle type=\"text/csstype=\"su"
+	"bmit\" name=\"families residing indeveloping countriescomputer pro"
+	"grammingeconomic developmentdetermination of thefor more informa"
+	"tionon several occasionsportugu\303\252s (Europeu)\320\243\320\272\321\200\320\260\321\227\320\275\321\201\321\214\320\272\320\260"
+	"\321\203\320\272\321\200\320\260\321\227\320\275\321\201\321\214\320\272\320\260\320\240\320\276\321\201\321\201\320\270\320\271\321\201\320\272\320\276\320\271\320\274\320\260\321\202\320\265\321\200\320\270\320\260\320\273\320\276\320\262\320\270\320\275"
+	"\321\204\320\276\321\200\320\274\320\260\321\206\320\270\320\270\321\203\320\277\321\200\320\260\320\262\320\273\320\265\320\275\320\270\321\217\320\275\320\265\320\276\320\261\321\205\320\276\320\264\320\270\320\274\320\276\320\270\320\275\321\204\320\276"
+	"\321\200\320\274\320\260\321\206\320\270\321\217\320\230\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\321\217\320\240\320\265\321\201\320\277\321\203\320\261\320\273\320\270\320\272\320\270\320\272\320\276\320\273\320\270\321\207\320\265"
+	"\321\201\321\202\320\262\320\276\320\270\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\321\216\321\202\320\265\321\200\321\200\320\270\321\202\320\276\321\200\320\270\320\270\320\264\320\276\321\201\321\202\320\260\321\202\320\276\321\207"
+	"\320\275\320\276\330\247\331\204\331\205\330\252\331\210\330\247\330\254\330\257\331\210\331\206\330\247\331\204\330\247\330\264\330\252\330\261\330\247\331\203\330\247\330\252\330\247\331\204\330\247\331\202\330\252\330\261\330\247\330\255\330\247\330\252"
+	"html; charset=UTF-8\" setTimeout(function()display:inline-block;<"
+	"input type=\"submit\" type = 'text/javascri<img src=\"http://www.\" "
+	"\"http://www.w3.org/shortcut icon\" href=\"\" autocomplete=\"off\" </a"
+	"></div><div class=</a></li>\012<li class=\"css\" type=\"text/css\" <for"
+	"m action=\"http://xt/css\" href=\"http://link rel=\"alternate\" \015\012<sc"
+	"ript type=\"text/ onclick=\"javascript:(new Date).getTime()}height"
+	"=\"1\" width=\"1\" People's Republic of  <a href=\"http://www.text-de"
+	"coration:underthe beginning of the </div>\012</div>\012</div>\012establis"
+	"hment of the </div></div></div></d#viewport{min-height:\012<script "
+	"src=\"http://option><option value=often referred to as /option>\012<"
+	"option valu<!DOCTYPE html>\012<!--[International Airport>\012<a href=\""
+	"http://www</a><a href=\"http://w\340\270\240\340\270\262\340\270\251\340\270\262\340\271\204\340\270\227\340\270\242\341\203\245\341\203\220\341\203\240\341\203\227"
+	"\341\203\243\341\203\232\341\203\230\346\255\243\351\253\224\344\270\255\346\226\207 (\347\271\201\351\253\224)\340\244\250\340\244\277\340\244\260\340\245\215\340\244\246\340\245\207\340\244\266\340\244\241\340\244\276\340\244\211\340\244\250\340"
+	"\244\262\340\245\213\340\244\241\340\244\225\340\245\215\340\244\267\340\245\207\340\244\244\340\245\215\340\244\260\340\244\234\340\244\276\340\244\250\340\244\225\340\244\276\340\244\260\340\245\200\340\244\270\340\244\202\340\244\254\340\244\202\340\244"
+	"\247\340\244\277\340\244\244\340\244\270\340\245\215\340\244\245\340\244\276\340\244\252\340\244\250\340\244\276\340\244\270\340\245\215\340\244\265\340\245\200\340\244\225\340\244\276\340\244\260\340\244\270\340\244\202\340\244\270\340\245\215\340\244\225"
+	"\340\244\260\340\244\243\340\244\270\340\244\276\340\244\256\340\244\227\340\245\215\340\244\260\340\245\200\340\244\232\340\244\277\340\244\237\340\245\215\340\244\240\340\245\213\340\244\202\340\244\265\340\244\277\340\244\234\340\245\215\340\244\236\340"
+	"\244\276\340\244\250\340\244\205\340\244\256\340\245\207\340\244\260\340\244\277\340\244\225\340\244\276\340\244\265\340\244\277\340\244\255\340\244\277\340\244\250\340\245\215\340\244\250\340\244\227\340\244\276\340\244\241\340\244\277\340\244\257\340\244"
+	"\276\340\244\201\340\244\225\340\245\215\340\244\257\340\245\213\340\244\202\340\244\225\340\244\277\340\244\270\340\245\201\340\244\260\340\244\225\340\245\215\340\244\267\340\244\276\340\244\252\340\244\271\340\245\201\340\244\201\340\244\232\340\244\244"
+	"\340\245\200\340\244\252\340\245\215\340\244\260\340\244\254\340\244\202\340\244\247\340\244\250\340\244\237\340\244\277\340\244\252\340\245\215\340\244\252\340\244\243\340\245\200\340\244\225\340\245\215\340\244\260\340\244\277\340\244\225\340\245\207\340"
+	"\244\237\340\244\252\340\245\215\340\244\260\340\244\276\340\244\260\340\244\202\340\244\255\340\244\252\340\245\215\340\244\260\340\244\276\340\244\252\340\245\215\340\244\244\340\244\256\340\244\276\340\244\262\340\244\277\340\244\225\340\245\213\340\244"
+	"\202\340\244\260\340\244\253\340\244\274\340\245\215\340\244\244\340\244\276\340\244\260\340\244\250\340\244\277\340\244\260\340\245\215\340\244\256\340\244\276\340\244\243\340\244\262\340\244\277\340\244\256\340\244\277\340\244\237\340\245\207\340\244\241"
+	"description\" content=\"document.location.prot.getElementsByTagNam"
+	"e(<!DOCTYPE html>\012<html <meta charset=\"utf-8\">:url\" content=\"htt"
+	"p://.css\" rel=\"stylesheet\"style type=\"text/css\">type=\"text/css\" "
+	"href=\"w3.org/1999/xhtml\" xmltype=\"text/javascript\" method=\"get\" "
+	"action=\"link rel=\"stylesheet\"  = document.getElementtype=\"image/"
+	"x-icon\" />cellpadding=\"0\" cellsp.css\" type=\"text/css\" </a></li><"
+	"li><a href=\"\" width=\"1\" height=\"1\"\"><a href=\"http://www.style=\"d"
+	"isplay:none;\">alternate\" type=\"appli-//W3C//DTD XHTML 1.0 ellspa"
+	"cing=\"0\" cellpad type=\"hidden\" value=\"/a>&nbsp;<span role=\"s\012<in"
+	"put type=\"hidden\" language=\"JavaScript\"  document.getElementsBg="
+	"\"0\" cellspacing=\"0\" ype=\"text/css\" media=\"type='text/javascript'"
+	"with the exception of ype=\"text/css\" rel=\"st height=\"1\" width=\"1"
+	"\" ='+encodeURIComponent(<link rel=\"alternate\" \012body, tr, input, "
+	"textmeta name=\"robots\" conmethod=\"post\" action=\">\012<a href=\"http:"
+	"//www.css\" rel=\"stylesheet\" </div></div><div classlanguage=\"java"
+	"script\">aria-hidden=\"true\">\302\267<ript\" type=\"text/javasl=0;})();\012(f"
+	"unction(){background-image: url(/a></li><li><a href=\"h\011\011<li><a h"
+	"ref=\"http://ator\" aria-hidden=\"tru> <a href=\"http://www.language"
+	"=\"javascript\" /option>\012<option value/div></div><div class=rator\""
+	" aria-hidden=\"tre=(new Date).getTime()portugu\303\252s (do Brasil)\320\276\321\200"
+	"\320\263\320\260\320\275\320\270\320\267\320\260\321\206\320\270\320\270\320\262\320\276\320\267\320\274\320\276\320\266\320\275\320\276\321\201\321\202\321\214\320\276\320\261\321\200\320\260\320\267\320\276\320\262\320\260\320\275\320\270\321\217\321\200"
+	"\320\265\320\263\320\270\321\201\321\202\321\200\320\260\321\206\320\270\320\270\320\262\320\276\320\267\320\274\320\276\320\266\320\275\320\276\321\201\321\202\320\270\320\276\320\261\321\217\320\267\320\260\321\202\320\265\320\273\321\214\320\275\320\260"
+	"<!DOCTYPE html PUBLIC \"nt-Type\" content=\"text/<meta http-equiv=\""
+	"Conteransitional//EN\" \"http:<html xmlns=\"http://www-//W3C//DTD X"
+	"HTML 1.0 TDTD/xhtml1-transitional//www.w3.org/TR/xhtml1/pe = 'te"
+	"xt/javascript';<meta name=\"descriptionparentNode.insertBefore<in"
+	"put type=\"hidden\" najs\" type=\"text/javascri(document).ready(func"
+	"tiscript type=\"text/javasimage\" content=\"http://UA-Compatible\" c"
+	"ontent=tml; charset=utf-8\" />\012link rel=\"shortcut icon<link rel=\""
+	"stylesheet\" </script>\012<script type== document.createElemen<a tar"
+	"get=\"_blank\" href= document.getElementsBinput type=\"text\" name=a"
+	".type = 'text/javascrinput type=\"hidden\" namehtml; charset=utf-8"
+	"\" />dtd\">\012<html xmlns=\"http-//W3C//DTD HTML 4.01 TentsByTagName("
+	"'script')input type=\"hidden\" nam<script type=\"text/javas\" style="
+	"\"display:none;\">document.getElementById(=document.createElement("
+	"' type='text/javascript'input type=\"text\" name=\"d.getElementsByT"
+	"agName(snical\" href=\"http://www.C//DTD HTML 4.01 Transit<style t"
+	"ype=\"text/css\">\012\012<style type=\"text/css\">ional.dtd\">\012<html xmlns="
+	"http-equiv=\"Content-Typeding=\"0\" cellspacing=\"0\"html; charset=ut"
+	"f-8\" />\012 style=\"display:none;\"><<li><a href=\"http://www. type='t"
+	"ext/javascript'>\320\264\320\265\321\217\321\202\320\265\320\273\321\214\320\275\320\276\321\201\321\202\320\270\321\201\320\276\320\276\321\202\320\262\320\265\321\202\321\201\321\202\320\262\320\270\320\270"
+	"\320\277\321\200\320\276\320\270\320\267\320\262\320\276\320\264\321\201\321\202\320\262\320\260\320\261\320\265\320\267\320\276\320\277\320\260\321\201\320\275\320\276\321\201\321\202\320\270\340\244\252\340\245\201\340\244\270\340\245\215\340\244\244\340"
+	"\244\277\340\244\225\340\244\276\340\244\225\340\244\276\340\244\202\340\244\227\340\245\215\340\244\260\340\245\207\340\244\270\340\244\211\340\244\250\340\245\215\340\244\271\340\245\213\340\244\202\340\244\250\340\245\207\340\244\265\340\244\277\340\244"
+	"\247\340\244\276\340\244\250\340\244\270\340\244\255\340\244\276\340\244\253\340\244\277\340\244\225\340\245\215\340\244\270\340\244\277\340\244\202\340\244\227\340\244\270\340\245\201\340\244\260\340\244\225\340\245\215\340\244\267\340\244\277\340\244\244"
+	"\340\244\225\340\245\211\340\244\252\340\245\200\340\244\260\340\244\276\340\244\207\340\244\237\340\244\265\340\244\277\340\244\234\340\245\215\340\244\236\340\244\276\340\244\252\340\244\250\340\244\225\340\244\276\340\244\260\340\245\215\340\244\260\340"
+	"\244\265\340\244\276\340\244\210\340\244\270\340\244\225\340\245\215\340\244\260\340\244\277\340\244\257\340\244\244\340\244\276";
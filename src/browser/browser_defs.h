@@ -4,6 +4,7 @@
 
 #define FB_W 1920u
 #define FB_H 1080u
+#define FB_BUFFERS 3u
 
 #define UI_TOPBAR_H 24u
 #define UI_CONTENT_PAD_Y 2u
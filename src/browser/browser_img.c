@@ -7,6 +7,7 @@
 #include "http_parse.h"
 
 #include "tls13_client.h"
+#include "tls13_pool.h"
 
 #include "image/jpeg.h"
 #include "image/jpeg_decode.h"
@@ -14,8 +15,10 @@
 #include "image/png_decode.h"
 #include "image/gif.h"
 #include "image/gif_decode.h"
+#include "image/img_scale.h"
 
 #include "../core/text.h"
+#include "../core/cfb.h"
 #include "../core/log.h"
 
 static int split_host_path_from_key(const char *key, char *host_out, size_t host_out_len, char *path_out, size_t path_out_len);
@@ -639,6 +642,21 @@ int browser_html_img_dim_lookup(void *ctx, const char *url, uint32_t *out_w, uin
 	return 0;
 }
 
+/* Resolves AAAA+A together and races the connects (see tcp_connect_race()).
+ * *out_dns_ok tells a DNS failure apart from a connect failure.
+ */
+static int img__connect_host(const char *host, int *out_dns_ok)
+{
+	uint8_t ip6[16];
+	uint8_t ip4[4];
+	int ok6 = 0;
+	int ok4 = 0;
+	dns_resolve_both(host, ip6, &ok6, ip4, &ok4);
+	*out_dns_ok = ok6 || ok4;
+	if (!*out_dns_ok) return -1;
+	return tcp_connect_race(ok6 ? ip6 : 0, ok4 ? ip4 : 0, 443, 0, 0, 0);
+}
+
 static int https_get_prefix_follow_redirects(const char *host_in,
 					const char *path_in,
 					char *content_type_out,
@@ -659,15 +677,14 @@ static int https_get_prefix_follow_redirects(const char *host_in,
 	(void)c_strlcpy_s(path, sizeof(path), path_in ? path_in : "/");
 
 	for (int step = 0; step < 4; step++) {
-		uint8_t ip6[16];
-		c_memset(ip6, 0, sizeof(ip6));
-		if (dns_resolve_aaaa_google(host, ip6) != 0) {
+		int dns_ok = 0;
+		int sock = img__connect_host(host, &dns_ok);
+		if (!dns_ok) {
 			char url[768];
 			img__format_https_from_host_path(url, sizeof(url), host, path);
-			img__log_url(LOG_LVL_WARN, "dns AAAA failed", url);
+			img__log_url(LOG_LVL_WARN, "dns AAAA/A failed", url);
 			return -1;
 		}
-		int sock = tcp6_connect(ip6, 443);
 		if (sock < 0) {
 			char url[768];
 			img__format_https_from_host_path(url, sizeof(url), host, path);
@@ -739,7 +756,8 @@ static int https_get_prefix_follow_redirects(const char *host_in,
 	return -1;
 }
 
-static int https_conn_open_host(struct tls13_https_conn *c, const char *host)
+/* path is the GET that follows; a resumed handshake sends it as 0-RTT data. */
+static int https_conn_open_host(struct tls13_https_conn *c, const char *host, const char *path)
 {
 	if (!c || !host || !host[0]) return -1;
 	tls13_https_conn_close(c);
@@ -747,22 +765,11 @@ static int https_conn_open_host(struct tls13_https_conn *c, const char *host)
 	int sock = -1;
 
 	/* Prefer IPv6, but fall back to IPv4 (many networks are IPv4-only). */
-	{
-		uint8_t ip6[16];
-		c_memset(ip6, 0, sizeof(ip6));
-		if (dns_resolve_aaaa_google(host, ip6) == 0) {
-			sock = tcp6_connect(ip6, 443);
-		}
-	}
-	if (sock < 0) {
-		uint8_t ip4[4];
-		c_memset(ip4, 0, sizeof(ip4));
-		if (dns_resolve_a_google4(host, ip4) != 0) return -1;
-		sock = tcp4_connect(ip4, 443);
-		if (sock < 0) return -1;
-	}
+	int dns_ok = 0;
+	sock = img__connect_host(host, &dns_ok);
+	if (sock < 0) return -1;
 
-	if (tls13_https_conn_open(c, sock, host) != 0) {
+	if (tls13_https_conn_open_get(c, sock, host, path) != 0) {
 		sys_close(sock);
 		c->sock = -1;
 		c->alive = 0;
@@ -794,7 +801,7 @@ static int https_get_prefix_follow_redirects_keepalive(struct tls13_https_conn *
 
 	for (int step = 0; step < 4; step++) {
 		if (!c->alive || c->sock < 0 || !streq(c->host, host)) {
-			if (https_conn_open_host(c, host) != 0) {
+			if (https_conn_open_host(c, host, path) != 0) {
 				char url[768];
 				img__format_https_from_host_path(url, sizeof(url), host, path);
 				img__log_url(LOG_LVL_WARN, "conn open failed", url);
@@ -835,7 +842,7 @@ static int https_get_prefix_follow_redirects_keepalive(struct tls13_https_conn *
 			if (rc == 0) break;
 			/* Retry once with a fresh connection. */
 			tls13_https_conn_close(c);
-			if (https_conn_open_host(c, host) != 0) return -1;
+			if (https_conn_open_host(c, host, path) != 0) return -1;
 		}
 
 		if (peer_close) tls13_https_conn_close(c);
@@ -903,18 +910,21 @@ static int split_host_path_from_key(const char *key, char *host_out, size_t host
 	return 0;
 }
 
-enum img_fmt img_cache_get_or_mark_pending(const char *active_host, const char *url)
+/* Finds the entry for `url`, creating a pending one if there is none.
+ * Returns NULL for URLs that are never fetched or if the cache is full.
+ */
+static struct img_sniff_cache_entry *img_cache_mark(const char *active_host, const char *url)
 {
-	if (!active_host || !active_host[0] || !url || !url[0]) return IMG_FMT_UNKNOWN;
+	if (!active_host || !active_host[0] || !url || !url[0]) return 0;
 
 	/* We only sniff HTTPS via our TLS stack. */
-	if (url[0] == 'd' && url[1] == 'a' && url[2] == 't' && url[3] == 'a' && url[4] == ':') return IMG_FMT_UNKNOWN;
-	if (url[0] == 'h' && url[1] == 't' && url[2] == 't' && url[3] == 'p' && url[4] == ':' && url[5] == '/' && url[6] == '/') return IMG_FMT_UNKNOWN;
+	if (url[0] == 'd' && url[1] == 'a' && url[2] == 't' && url[3] == 'a' && url[4] == ':') return 0;
+	if (url[0] == 'h' && url[1] == 't' && url[2] == 't' && url[3] == 'p' && url[4] == ':' && url[5] == '/' && url[6] == '/') return 0;
 
 	char host[HOST_BUF_LEN];
 	char path[PATH_BUF_LEN];
 	if (url_apply_location(active_host, url, host, sizeof(host), path, sizeof(path)) != 0) {
-		return IMG_FMT_UNKNOWN;
+		return 0;
 	}
 
 	char key[512];
@@ -936,7 +946,7 @@ enum img_fmt img_cache_get_or_mark_pending(const char *active_host, const char *
 			e->last_use = ++g_img_use_tick;
 			e->want_pixels = 1;
 			e->gen = g_img_generation;
-			return (e->state == 2) ? e->fmt : IMG_FMT_UNKNOWN;
+			return e;
 		}
 	}
 
@@ -982,7 +992,41 @@ enum img_fmt img_cache_get_or_mark_pending(const char *active_host, const char *
 		slot->last_use = ++g_img_use_tick;
 		(void)c_strlcpy_s(slot->key, sizeof(slot->key), key);
 	}
-	return IMG_FMT_UNKNOWN;
+	return slot;
+}
+
+enum img_fmt img_cache_get_or_mark_pending(const char *active_host, const char *url)
+{
+	struct img_sniff_cache_entry *e = img_cache_mark(active_host, url);
+	return (e && e->state == 2) ? e->fmt : IMG_FMT_UNKNOWN;
+}
+
+struct img_sniff_cache_entry *img_cache_ref_lookup(struct img_ref *ref, const char *active_host, const char *url, size_t url_len)
+{
+	if (!ref || !url) return 0;
+	struct img_sniff_cache_entry *e = ref->entry;
+	if (e && e->used && e->hash == ref->hash) {
+		e->last_use = ++g_img_use_tick;
+		e->want_pixels = 1;
+		e->gen = g_img_generation;
+	} else {
+		char u[1024];
+		size_t n = url_len;
+		if (n + 1u > sizeof(u)) n = sizeof(u) - 1u;
+		for (size_t i = 0; i < n; i++) u[i] = url[i];
+		u[n] = 0;
+		e = img_cache_mark(active_host, u);
+		ref->entry = e;
+		ref->hash = e ? e->hash : 0;
+	}
+	return (e && e->state == 2) ? e : 0;
+}
+
+struct img_sniff_cache_entry *img_cache_ref_peek(const struct img_ref *ref)
+{
+	struct img_sniff_cache_entry *e = ref ? ref->entry : 0;
+	if (!e || !e->used || e->hash != ref->hash || e->state != 2) return 0;
+	return e;
 }
 
 enum {
@@ -1010,6 +1054,19 @@ struct img_worker_shm {
 
 static struct img_worker_shm *g_img_workers;
 static int32_t g_img_worker_pids[IMG_WORKERS];
+static struct cfb_header *g_img_wake_hdr;
+
+void img_workers_set_wake(struct cfb_header *hdr)
+{
+	g_img_wake_hdr = hdr;
+}
+
+/* Worker side: publishes the result and wakes the browser's event loop. */
+static void img_worker_finish(struct img_worker_shm *w)
+{
+	__atomic_store_n(&w->state, 2u, __ATOMIC_RELEASE);
+	cfb_wake(g_img_wake_hdr);
+}
 
 static struct img_sniff_cache_entry *img_cache_find_by_key(const char *key)
 {
@@ -1030,13 +1087,12 @@ static void img_worker_loop(uint32_t wi)
 	struct tls13_https_conn conn;
 	c_memset(&conn, 0, sizeof(conn));
 	conn.sock = -1;
-	struct timespec req;
-	req.tv_sec = 0;
-	req.tv_nsec = 1 * 1000 * 1000;
 
 	for (;;) {
-		if (w->state != 1u) {
-			sys_nanosleep(&req, 0);
+		/* The region is MAP_SHARED across fork(), so this is a shared futex. */
+		uint32_t st = __atomic_load_n(&w->state, __ATOMIC_ACQUIRE);
+		if (st != 1u) {
+			(void)sys_futex((uint32_t *)&w->state, FUTEX_WAIT, st, 0);
 			continue;
 		}
 		w->rc = -1;
@@ -1054,7 +1110,7 @@ static void img_worker_loop(uint32_t wi)
 		if (split_host_path_from_key(w->key, host, sizeof(host), path, sizeof(path)) != 0) {
 			img__log_key(LOG_LVL_ERROR, "bad key", w->key);
 			w->rc = -1;
-			w->state = 2u;
+			img_worker_finish(w);
 			continue;
 		}
 		char fetch_path[PATH_BUF_LEN];
@@ -1081,7 +1137,7 @@ static void img_worker_loop(uint32_t wi)
 								  &got) != 0 || got == 0) {
 			img__log_key(LOG_LVL_WARN, "sniff fetch failed", w->key);
 			w->rc = -1;
-			w->state = 2u;
+			img_worker_finish(w);
 			continue;
 		}
 		/* Sniff succeeded. */
@@ -1191,7 +1247,7 @@ static void img_worker_loop(uint32_t wi)
 				}
 			}
 		}
-		w->state = 2u;
+		img_worker_finish(w);
 	}
 }
 
@@ -1215,6 +1271,7 @@ void img_workers_init(void)
 	for (uint32_t i = 0; i < IMG_WORKERS; i++) {
 		int pid = sys_fork();
 		if (pid == 0) {
+			tls13_pool_close_all();
 			img_worker_loop(i);
 			sys_exit(0);
 		}
@@ -1430,27 +1487,42 @@ int img_workers_pump(int *out_any_dims_changed, int *out_any_pixels_changed)
 		pick->inflight = 1;
 		(void)c_strlcpy_s(w->key, sizeof(w->key), pick->key);
 		w->gen = pick->gen;
-		w->state = 1u;
 		w->rc = 0;
+		__atomic_store_n(&w->state, 1u, __ATOMIC_RELEASE);
+		(void)sys_futex((uint32_t *)&w->state, FUTEX_WAKE, 1u, 0);
 	}
 
 	return did_relevant_change;
 }
 
+/* Too big for a worker slot, but small enough to decode in-process. */
+static int img_is_large_candidate(const struct img_sniff_cache_entry *e)
+{
+	if (!e->used) return 0;
+	if (e->state != 2) return 0;
+	if (!e->want_pixels) return 0;
+	if (e->gen != g_img_generation) return 0;
+	if (e->inflight) return 0;
+	if (e->has_pixels) return 0;
+	if (!e->has_dims) return 0;
+	if (e->w <= IMG_WORKER_MAX_W && e->h <= IMG_WORKER_MAX_H) return 0;
+	if (e->w > 512u || e->h > 512u) return 0;
+	return e->fmt == IMG_FMT_JPG || e->fmt == IMG_FMT_PNG || e->fmt == IMG_FMT_GIF;
+}
+
+int img_decode_large_pending(void)
+{
+	for (size_t i = 0; i < sizeof(g_img_sniff_cache) / sizeof(g_img_sniff_cache[0]); i++) {
+		if (img_is_large_candidate(&g_img_sniff_cache[i])) return 1;
+	}
+	return 0;
+}
+
 int img_decode_large_pump_one(void)
 {
 	for (size_t i = 0; i < sizeof(g_img_sniff_cache) / sizeof(g_img_sniff_cache[0]); i++) {
 		struct img_sniff_cache_entry *e = &g_img_sniff_cache[i];
-		if (!e->used) continue;
-		if (e->state != 2) continue;
-		if (!e->want_pixels) continue;
-		if (e->gen != g_img_generation) continue;
-		if (e->inflight) continue;
-		if (e->has_pixels) continue;
-		if (!e->has_dims) continue;
-		if (e->w <= IMG_WORKER_MAX_W && e->h <= IMG_WORKER_MAX_H) continue;
-		if (e->w > 512u || e->h > 512u) continue;
-		if (!(e->fmt == IMG_FMT_JPG || e->fmt == IMG_FMT_PNG || e->fmt == IMG_FMT_GIF)) continue;
+		if (!img_is_large_candidate(e)) continue;
 
 		char host[HOST_BUF_LEN];
 		char path[PATH_BUF_LEN];
@@ -1558,6 +1630,75 @@ const uint32_t *img_entry_pixels(const struct img_sniff_cache_entry *e)
 	return &g_img_pixel_pool[e->pix_off];
 }
 
+/* Scaled copies of decoded images, keyed by (entry, target size).
+ * Bump-allocated; when the pool or the slot table is full every variant is
+ * dropped and the pool starts over.
+ */
+enum {
+	IMG_SCALED_SLOTS = 128,
+	IMG_SCALED_POOL_PX = 256 * 1024,
+};
+
+struct img_scaled_variant {
+	const struct img_sniff_cache_entry *entry;
+	uint32_t hash;
+	uint32_t src_off;
+	uint16_t src_w;
+	uint16_t src_h;
+	uint16_t w;
+	uint16_t h;
+	uint32_t off;
+};
+
+static struct img_scaled_variant g_img_scaled[IMG_SCALED_SLOTS];
+static uint32_t g_img_scaled_n;
+static uint32_t g_img_scaled_pool[IMG_SCALED_POOL_PX];
+static uint32_t g_img_scaled_pool_used;
+
+const uint32_t *img_entry_scaled_peek(const struct img_sniff_cache_entry *e, uint32_t w, uint32_t h)
+{
+	if (!img_entry_pixels(e)) return 0;
+	for (uint32_t i = 0; i < g_img_scaled_n; i++) {
+		const struct img_scaled_variant *v = &g_img_scaled[i];
+		if (v->entry != e || v->w != w || v->h != h) continue;
+		/* The entry may have been evicted and reused, or re-decoded. */
+		if (v->hash != e->hash || v->src_off != e->pix_off || v->src_w != e->pix_w || v->src_h != e->pix_h) continue;
+		return &g_img_scaled_pool[v->off];
+	}
+	return 0;
+}
+
+const uint32_t *img_entry_scaled(const struct img_sniff_cache_entry *e, uint32_t w, uint32_t h)
+{
+	const uint32_t *src = img_entry_pixels(e);
+	if (!src || w == 0 || h == 0 || w > 0xffffu || h > 0xffffu) return 0;
+	if (e->pix_w == 0 || e->pix_h == 0) return 0;
+	const uint32_t *have = img_entry_scaled_peek(e, w, h);
+	if (have) return have;
+
+	uint32_t n = w * h;
+	if (w > (uint32_t)IMG_SCALE_MAX_DIM || n > (uint32_t)IMG_SCALED_POOL_PX) return 0;
+	if (g_img_scaled_n >= (uint32_t)IMG_SCALED_SLOTS || g_img_scaled_pool_used + n > (uint32_t)IMG_SCALED_POOL_PX) {
+		g_img_scaled_n = 0;
+		g_img_scaled_pool_used = 0;
+	}
+	uint32_t *dst = &g_img_scaled_pool[g_img_scaled_pool_used];
+	enum img_scale_filter filter = img_scale_pick_filter(e->pix_w, e->pix_h, w, h);
+	if (img_scale_xrgb(dst, w, w, h, w, h, src, e->pix_w, e->pix_h, filter) != 0) return 0;
+
+	struct img_scaled_variant *v = &g_img_scaled[g_img_scaled_n++];
+	v->entry = e;
+	v->hash = e->hash;
+	v->src_off = e->pix_off;
+	v->src_w = e->pix_w;
+	v->src_h = e->pix_h;
+	v->w = (uint16_t)w;
+	v->h = (uint16_t)h;
+	v->off = g_img_scaled_pool_used;
+	g_img_scaled_pool_used += n;
+	return dst;
+}
+
 void img_cache_clear_want_pixels(void)
 {
 	for (size_t i = 0; i < sizeof(g_img_sniff_cache) / sizeof(g_img_sniff_cache[0]); i++) {
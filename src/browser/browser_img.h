@@ -36,6 +36,15 @@ struct img_sniff_cache_entry {
 	char key[512]; /* usually "host|/path" (truncated) */
 };
 
+/* Remembers which cache entry a URL matched, so repeated lookups of the same
+ * image (e.g. on every repaint) skip URL resolution and the cache scan.
+ * Zero-initialize before first use.
+ */
+struct img_ref {
+	struct img_sniff_cache_entry *entry;
+	uint32_t hash;
+};
+
 struct img_dim_ctx {
 	const char *active_host;
 };
@@ -46,12 +55,36 @@ struct img_sniff_cache_entry *img_cache_find_done(const char *active_host, const
 
 enum img_fmt img_cache_get_or_mark_pending(const char *active_host, const char *url);
 
+/* img_cache_get_or_mark_pending() followed by img_cache_find_done(), through
+ * `ref`: returns the entry if it is done, NULL otherwise. `url` need not be
+ * NUL-terminated.
+ */
+struct img_sniff_cache_entry *img_cache_ref_lookup(struct img_ref *ref, const char *active_host, const char *url, size_t url_len);
+
+/* Read-only variant for render threads: the entry `ref` resolved to on its
+ * last img_cache_ref_lookup(), if it is still that image and done.
+ */
+struct img_sniff_cache_entry *img_cache_ref_peek(const struct img_ref *ref);
+
 /* Callback for html_visible_text_extract_* to provide best-effort dimensions. */
 int browser_html_img_dim_lookup(void *ctx, const char *url, uint32_t *out_w, uint32_t *out_h);
 
 /* Returns a pointer into the internal pixel pool for an entry, or NULL. */
 const uint32_t *img_entry_pixels(const struct img_sniff_cache_entry *e);
 
+/* Returns the entry's pixels resampled to w x h (tightly packed), or NULL.
+ * Results are cached per (entry, size), so redrawing a scaled image is a copy.
+ */
+const uint32_t *img_entry_scaled(const struct img_sniff_cache_entry *e, uint32_t w, uint32_t h);
+
+/* Like img_entry_scaled(), but only returns an existing variant (read-only). */
+const uint32_t *img_entry_scaled_peek(const struct img_sniff_cache_entry *e, uint32_t w, uint32_t h);
+
+struct cfb_header;
+/* Header whose wake word workers bump when a result is ready (see cfb_wake()).
+ * Set it before img_workers_init(): workers inherit it across fork().
+ */
+void img_workers_set_wake(struct cfb_header *hdr);
 void img_workers_init(void);
 /* Cancels any in-flight worker fetches by killing and respawning workers. */
 void img_workers_cancel_all(void);
@@ -61,6 +94,8 @@ void img_workers_cancel_all(void);
  */
 int img_workers_pump(int *out_any_dims_changed, int *out_any_pixels_changed);
 int img_decode_large_pump_one(void);
+/* 1 if img_decode_large_pump_one() has something to do. */
+int img_decode_large_pending(void);
 
 /* Keeps cached entries, but stops background pixel work for old pages. */
 void img_cache_clear_want_pixels(void);
@@ -2,10 +2,12 @@
 
 #include "browser_img.h"
 #include "browser_ui.h"
+#include "frame_sched.h"
 
 #include "net_dns.h"
 #include "net_tcp.h"
 #include "tls13_client.h"
+#include "tls13_pool.h"
 
 #include "http_parse.h"
 #include "url.h"
@@ -104,6 +106,256 @@ void browser_compose_url_bar(char *out, size_t out_len, const char *host, const
 	out[o] = 0;
 }
 
+/* Fresh DNS + TCP + TLS handshake to host, into pc->conn. Returns 0; -1 when
+ * DNS or every connect failed (page status and text explain why); -2 when
+ * the TLS handshake failed.
+ */
+static int nav_connect(struct shm_fb *fb,
+		       const char *host,
+		       const char *path,
+		       char url_bar[URL_BUF_LEN],
+		       const struct browser_page *page,
+		       struct tls13_pool_conn *pc,
+		       char *line1,
+		       size_t line1_cap)
+{
+	browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
+	browser_draw_ui(fb, host, url_bar, "", "Resolving (AAAA/A) via /etc/hosts, resolv.conf, Google DNS ...", host, path);
+	shm_fb_present(fb);
+
+	uint8_t ip6[16];
+	uint8_t ip4[4];
+	c_memset(ip6, 0, sizeof(ip6));
+	c_memset(ip4, 0, sizeof(ip4));
+	/* AAAA and A go out together; neither waits for the other to fail. */
+	int dns6_ok = 0;
+	int dns4_ok = 0;
+	dns_resolve_both(host, ip6, &dns6_ok, ip4, &dns4_ok);
+	if (dns6_ok) {
+		nav_log_dns6_ok(ip6);
+	} else {
+		LOGW("nav", "DNS AAAA failed (hosts, resolv.conf, Google DNS)");
+	}
+	if (dns4_ok) {
+		nav_log_dns4_ok(ip4);
+	} else {
+		LOGW("nav", "DNS A failed (hosts, resolv.conf, Google DNS)");
+	}
+
+	c_memset(line1, 0, line1_cap);
+	size_t o = 0;
+	const char *pfx = dns6_ok ? (dns4_ok ? "DNS AAAA/A = " : "DNS AAAA = ") : (dns4_ok ? "DNS A = " : "DNS AAAA/A failed");
+	for (size_t i = 0; pfx[i] && o + 1 < line1_cap; i++) line1[o++] = pfx[i];
+	if (dns6_ok) {
+		char ip_str6[48];
+		ip6_to_str(ip_str6, ip6);
+		for (size_t i = 0; ip_str6[i] && o + 1 < line1_cap; i++) line1[o++] = ip_str6[i];
+		if (dns4_ok && o + 3 < line1_cap) { line1[o++] = ' '; line1[o++] = '/'; line1[o++] = ' '; }
+	}
+	if (dns4_ok) {
+		char ip_str4[16];
+		ip4_to_str(ip_str4, ip4);
+		for (size_t i = 0; ip_str4[i] && o + 1 < line1_cap; i++) line1[o++] = ip_str4[i];
+	}
+	line1[o] = 0;
+
+	browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
+	browser_draw_ui(fb, host, url_bar, "", line1, "Connecting ...", path);
+	shm_fb_present(fb);
+
+	/* Race IPv6 against IPv4 (IPv6 gets a head start); first connect wins. */
+	int sock = -1;
+	int family = 0;
+	int err6 = 0;
+	int err4 = 0;
+	if (dns6_ok || dns4_ok) {
+		sock = tcp_connect_race(dns6_ok ? ip6 : 0, dns4_ok ? ip4 : 0, 443, &family, &err6, &err4);
+	}
+	if (err6) nav_log_connect_failed("(IPv6)", err6);
+	if (err4) nav_log_connect_failed("(IPv4)", err4);
+	int use_v4 = (family == AF_INET);
+
+	const char *line2 = (sock >= 0) ? (use_v4 ? "TCP connect OK (IPv4)" : "TCP connect OK (IPv6)") : "TCP connect FAILED";
+	browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
+	browser_draw_ui(fb, host, url_bar, "", line1, line2, "TLS 1.3 handshake + HTTP/1.1 GET");
+	shm_fb_present(fb);
+
+	if (sock < 0) {
+		if (page->status_bar && page->status_bar_cap) {
+			(void)c_strlcpy_s(page->status_bar, page->status_bar_cap, "CONNECT FAILED (IPv6+IPv4)");
+		}
+		if (page->visible && page->visible_cap) {
+			const char *m = 0;
+			if (!dns6_ok && !dns4_ok) {
+				m = "DNS failed (nameservers unreachable/blocked?)";
+			} else if (dns6_ok && !dns4_ok) {
+				m = "IPv6 connect failed; DNS A failed too.";
+			} else if (!dns6_ok && dns4_ok) {
+				m = "DNS A ok but connect failed (IPv4).";
+			} else {
+				m = "IPv6 connect failed; IPv4 connect failed too.";
+			}
+			(void)c_strlcpy_s(page->visible, page->visible_cap, m);
+		}
+		LOGW("nav", "CONNECT FAILED (IPv6+IPv4)");
+		return -1;
+	}
+
+	pc->family = family;
+	if (tls13_https_conn_open(&pc->conn, sock, host) != 0) {
+		sys_close(sock);
+		tls13_https_conn_close(&pc->conn);
+		return -2;
+	}
+	return 0;
+}
+
+enum {
+	/* Paints of a page that is still loading are at least this far apart. */
+	NAV_PAINT_BUDGET_NS = 100000000,
+	/* The first one waits for a screenful of text, or this long at most. */
+	NAV_FIRST_PAINT_NS = 300000000,
+};
+
+/* Progressive rendering state for one GET. */
+struct nav_progress {
+	struct shm_fb *fb;
+	const char *host;
+	const char *url_bar;
+	const struct browser_page *page;
+	const char *status;
+	struct frame_sched sched;
+	uint64_t first_ns; /* first body bytes */
+	int painted;
+	int full; /* the extracted text fills the screen; stop extracting */
+};
+
+/* Whether the extracted text fills the content area. Lays it out into
+ * page->lines at the renderer's width, so the paint that follows reuses it.
+ */
+static int nav_text_fills_screen(const struct shm_fb *fb, const struct browser_page *page)
+{
+	uint32_t cols = browser_ui_body_cols(fb->width);
+	if (cols == 0) return 1;
+	line_index_ensure(page->lines, page->visible, cols);
+	return page->lines->n_rows >= browser_ui_body_rows(fb->height);
+}
+
+/* tls13_https_conn on_body hook, at most once per NAV_PAINT_BUDGET_NS.
+ *
+ * Until the text fills the screen it extracts the partial body again on
+ * every call. Nothing can scroll during the fetch, so after that later calls
+ * only update the byte count in the status bar instead of extracting the
+ * growing body again. The caller does the final extract and render.
+ */
+static void nav_on_body(void *arg, const uint8_t *body, size_t body_len)
+{
+	struct nav_progress *np = (struct nav_progress *)arg;
+	const struct browser_page *page = np->page;
+
+	uint64_t now = c_mono_ns();
+	if (!np->first_ns) np->first_ns = now;
+	frame_sched_request(&np->sched);
+	if (!frame_sched_begin(&np->sched, now, 0)) return;
+
+	if (!np->full) {
+		struct img_dim_ctx ctx = { .active_host = np->host };
+		(void)html_visible_text_extract_links_spans_and_inline_imgs_ex(body,
+							      body_len,
+							      page->visible,
+							      page->visible_cap,
+							      page->links,
+							      page->spans,
+							      page->inline_imgs,
+							      browser_html_img_dim_lookup,
+							      &ctx);
+		line_index_reset(page->lines);
+		np->full = nav_text_fills_screen(np->fb, page);
+		if (np->full || np->painted || now - np->first_ns >= (uint64_t)NAV_FIRST_PAINT_NS) {
+			html_style_runs_build(page->links, page->spans, page->runs);
+			np->painted = 1;
+		}
+	}
+	if (np->painted) {
+		if (page->status_bar && page->status_bar_cap) {
+			char kib[11];
+			u32_to_dec(kib, (uint32_t)(body_len >> 10));
+			size_t so = 0;
+			for (size_t i = 0; np->status[i] && np->status[i] != '\n' && so + 1 < page->status_bar_cap; i++) {
+				page->status_bar[so++] = np->status[i];
+			}
+			const char *parts[3] = { " | loading ", kib, " KiB ..." };
+			for (size_t p = 0; p < 3; p++) {
+				for (size_t i = 0; parts[p][i] && so + 1 < page->status_bar_cap; i++) page->status_bar[so++] = parts[p][i];
+			}
+			page->status_bar[so] = 0;
+		}
+		/* Once the screen is full the text and layout stay as they were:
+		 * the cached tiles stay on screen and only the top bar is redrawn.
+		 */
+		browser_render_page(np->fb,
+				      np->host,
+				      np->url_bar,
+				      (page->status_bar ? page->status_bar : ""),
+				      page->visible,
+				      page->runs,
+				      page->inline_imgs,
+				      page->lines,
+				      0);
+	}
+	frame_sched_end(&np->sched, now, c_mono_ns());
+}
+
+/* One keep-alive GET on a pooled connection, into page->body. np, if set,
+ * paints the page while the body streams in.
+ */
+static int nav_get(struct tls13_pool_conn *pc,
+		   const char *path,
+		   char *status,
+		   size_t status_cap,
+		   int *status_code,
+		   char *location,
+		   size_t location_cap,
+		   char *content_type,
+		   size_t content_type_cap,
+		   char *content_enc,
+		   size_t content_enc_cap,
+		   const struct browser_page *page,
+		   uint64_t *content_len,
+		   int *peer_close,
+		   struct nav_progress *np)
+{
+	if (np) {
+		np->status = status;
+		frame_sched_init(&np->sched, NAV_PAINT_BUDGET_NS);
+		np->first_ns = 0;
+		np->painted = 0;
+		np->full = 0;
+		pc->conn.on_body = nav_on_body;
+		pc->conn.on_body_arg = np;
+	}
+	int rc = tls13_https_conn_get_status_location_and_body(&pc->conn,
+							 path,
+							 status,
+							 status_cap,
+							 status_code,
+							 location,
+							 location_cap,
+							 content_type,
+							 content_type_cap,
+							 content_enc,
+							 content_enc_cap,
+							 page->body,
+							 page->body_cap,
+							 page->body_len,
+							 content_len,
+							 1,
+							 peer_close);
+	pc->conn.on_body = 0;
+	pc->conn.on_body_arg = 0;
+	return rc;
+}
+
 void browser_do_https_status(struct shm_fb *fb,
 				 char host[HOST_BUF_LEN],
 				 char path[PATH_BUF_LEN],
@@ -113,9 +365,13 @@ void browser_do_https_status(struct shm_fb *fb,
 	if (!fb) return;
 	if (!page.body || !page.body_len || page.body_cap == 0) return;
 	if (!page.visible || page.visible_cap == 0) return;
-	if (!page.links || !page.spans || !page.inline_imgs) return;
+	if (!page.links || !page.spans || !page.runs || !page.inline_imgs || !page.lines) return;
 	if (!page.scroll_rows || !page.have_page) return;
 
+	/* The previous page's text and tables go away; only touched pages of
+	 * the new one will be resident.
+	 */
+	if (page.arena) arena_discard(page.arena);
 	*page.body_len = 0;
 	uint64_t content_len = 0;
 	char final_status[128];
@@ -125,7 +381,9 @@ void browser_do_https_status(struct shm_fb *fb,
 	if (page.status_bar && page.status_bar_cap) page.status_bar[0] = 0;
 	page.links->n = 0;
 	page.spans->n = 0;
+	page.runs->n = 0;
 	page.inline_imgs->n = 0;
+	line_index_reset(page.lines);
 	*page.scroll_rows = 0;
 	*page.have_page = 0;
 
@@ -138,160 +396,71 @@ void browser_do_https_status(struct shm_fb *fb,
 
 	for (int step = 0; step < 6; step++) {
 		nav_log_resolve(host, path);
-		browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
-		browser_draw_ui(fb, host, url_bar, "", "Resolving (AAAA/A) via Google DNS (IPv6 preferred; IPv4 fallback) ...", host, path);
-		fb->hdr->frame_counter++;
-
-		uint8_t ip6[16];
-		uint8_t ip4[4];
-		c_memset(ip6, 0, sizeof(ip6));
-		c_memset(ip4, 0, sizeof(ip4));
-		int dns6_ok = (dns_resolve_aaaa_google(host, ip6) == 0);
-		if (dns6_ok) {
-			nav_log_dns6_ok(ip6);
-		} else {
-			LOGW("nav", "DNS AAAA failed (Google DNS over IPv6+IPv4)");
-		}
-		int dns4_ok = 0;
-		int use_v4 = 0;
-		int sock = -1;
 
-		char line1[192];
-		c_memset(line1, 0, sizeof(line1));
-		size_t o = 0;
-		if (dns6_ok) {
-			char ip_str6[48];
-			ip6_to_str(ip_str6, ip6);
-			const char *pfx = "DNS AAAA = ";
-			for (size_t i = 0; pfx[i] && o + 1 < sizeof(line1); i++) line1[o++] = pfx[i];
-			for (size_t i = 0; ip_str6[i] && o + 1 < sizeof(line1); i++) line1[o++] = ip_str6[i];
-			line1[o] = 0;
-		} else {
-			const char *pfx = "DNS AAAA failed; trying A ...";
-			for (size_t i = 0; pfx[i] && o + 1 < sizeof(line1); i++) line1[o++] = pfx[i];
-			line1[o] = 0;
-		}
-
-		browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
-		browser_draw_ui(fb, host, url_bar, "", line1, "Connecting ...", path);
-		fb->hdr->frame_counter++;
-
-		if (dns6_ok) {
-			int s6 = tcp6_connect(ip6, 443);
-			if (s6 >= 0) {
-				sock = s6;
-				use_v4 = 0;
-			} else {
-				nav_log_connect_failed("(IPv6)", s6);
-			}
-		}
-		if (sock < 0) {
-			dns4_ok = (dns_resolve_a_google4(host, ip4) == 0);
-			if (dns4_ok) {
-				nav_log_dns4_ok(ip4);
-			} else {
-				LOGW("nav", "DNS A failed (Google DNS over IPv6+IPv4)");
-			}
-			if (dns4_ok) {
-				int s4 = tcp4_connect(ip4, 443);
-				if (s4 >= 0) {
-					sock = s4;
-					use_v4 = 1;
-				} else {
-					nav_log_connect_failed("(IPv4)", s4);
-				}
-			}
-		}
-		/* If we ended up using IPv4, adjust the DNS line to avoid confusion.
-		 * (Otherwise it may still say “trying A...” even when A succeeded.)
+		/* Same host as an earlier request (a redirect, or the next click):
+		 * reuse its idle connection and skip DNS, TCP and TLS entirely.
 		 */
-		if (dns4_ok) {
-			char ip_str4[16];
-			ip4_to_str(ip_str4, ip4);
-			c_memset(line1, 0, sizeof(line1));
-			o = 0;
-			if (dns6_ok) {
-				char ip_str6[48];
-				ip6_to_str(ip_str6, ip6);
-				const char *pfx = "DNS AAAA/A = ";
-				for (size_t i = 0; pfx[i] && o + 1 < sizeof(line1); i++) line1[o++] = pfx[i];
-				for (size_t i = 0; ip_str6[i] && o + 1 < sizeof(line1); i++) line1[o++] = ip_str6[i];
-				if (o + 3 < sizeof(line1)) { line1[o++] = ' '; line1[o++] = '/'; line1[o++] = ' '; }
-				for (size_t i = 0; ip_str4[i] && o + 1 < sizeof(line1); i++) line1[o++] = ip_str4[i];
-				line1[o] = 0;
-			} else {
-				const char *pfx = "DNS A = ";
-				for (size_t i = 0; pfx[i] && o + 1 < sizeof(line1); i++) line1[o++] = pfx[i];
-				for (size_t i = 0; ip_str4[i] && o + 1 < sizeof(line1); i++) line1[o++] = ip_str4[i];
-				line1[o] = 0;
-			}
-		}
-
-		const char *line2 = (sock >= 0) ? (use_v4 ? "TCP connect OK (IPv4)" : "TCP connect OK (IPv6)") : "TCP connect FAILED";
-		browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
-		browser_draw_ui(fb, host, url_bar, "", line1, line2, "TLS 1.3 handshake + HTTP/1.1 GET");
-		fb->hdr->frame_counter++;
-
-		if (sock < 0) {
-			if (page.status_bar && page.status_bar_cap) {
-				(void)c_strlcpy_s(page.status_bar, page.status_bar_cap, "CONNECT FAILED (IPv6+IPv4)");
-			}
-			if (page.visible && page.visible_cap) {
-				const char *m = 0;
-				if (!dns6_ok && !dns4_ok) {
-					m = "DNS failed (Google DNS unreachable/blocked?)";
-				} else if (dns6_ok && !dns4_ok) {
-					m = "IPv6 connect failed; DNS A failed too.";
-				} else if (!dns6_ok && dns4_ok) {
-					m = "DNS A ok but connect failed (IPv4).";
-				} else {
-					m = "IPv6 connect failed; IPv4 connect failed too.";
-				}
-				(void)c_strlcpy_s(page.visible, page.visible_cap, m);
-			}
-			LOGW("nav", "CONNECT FAILED (IPv6+IPv4)");
-			*page.have_page = 1;
-			browser_render_page(fb,
-					  host,
-					  url_bar,
-					  (page.status_bar ? page.status_bar : ""),
-					  page.visible,
-					  page.links,
-					  page.spans,
-					  page.inline_imgs,
-					  *page.scroll_rows);
-			return;
-		}
+		int reused = 0;
+		struct tls13_pool_conn *pc = tls13_pool_get(host, c_mono_ms(), &reused);
+		if (!pc) break;
 
+		char line1[192];
 		char status[128];
 		char location[512];
 		int status_code = -1;
 		char content_type[128];
 		char content_enc[64];
-		content_type[0] = 0;
-		content_enc[0] = 0;
-		int rc = tls13_https_get_status_location_and_body(sock,
-							 host,
-							 path,
-							 status,
-							 sizeof(status),
-							 &status_code,
-							 location,
-							 sizeof(location),
-						 content_type,
-						 sizeof(content_type),
-						 content_enc,
-						 sizeof(content_enc),
-							 page.body,
-							 page.body_cap,
-							 page.body_len,
-							 &content_len);
-		sys_close(sock);
+		int peer_close = 0;
+		int rc = -1;
+		struct nav_progress np = { .fb = fb, .host = host, .url_bar = url_bar, .page = &page };
+		if (reused) {
+			LOGI("nav", "reusing pooled connection");
+			(void)c_strlcpy_s(line1, sizeof(line1), "Reusing connection");
+			browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
+			browser_draw_ui(fb, host, url_bar, "", line1, "", "HTTP/1.1 GET (keep-alive)");
+			shm_fb_present(fb);
+			rc = nav_get(pc, path, status, sizeof(status), &status_code, location, sizeof(location),
+				     content_type, sizeof(content_type), content_enc, sizeof(content_enc), &page, &content_len, &peer_close, &np);
+			/* A clean close before any response byte still returns 0, just
+			 * without a status line.
+			 */
+			if (rc == 0 && status_code < 0) rc = -1;
+			if (rc != 0) {
+				/* The server dropped it while it sat idle: start over. */
+				LOGW("nav", "pooled connection failed; reconnecting");
+				tls13_https_conn_close(&pc->conn);
+				reused = 0;
+			}
+		}
+		if (!reused) {
+			int cr = nav_connect(fb, host, path, url_bar, &page, pc, line1, sizeof(line1));
+			if (cr == -1) {
+				tls13_pool_put(pc, c_mono_ms());
+				*page.have_page = 1;
+				browser_render_page(fb,
+						  host,
+						  url_bar,
+						  (page.status_bar ? page.status_bar : ""),
+						  page.visible,
+						  page.runs,
+						  page.inline_imgs,
+						  page.lines,
+						  *page.scroll_rows);
+				return;
+			}
+			if (cr == 0) {
+				rc = nav_get(pc, path, status, sizeof(status), &status_code, location, sizeof(location),
+					     content_type, sizeof(content_type), content_enc, sizeof(content_enc), &page, &content_len, &peer_close, &np);
+			}
+		}
+		if (rc != 0 || peer_close) tls13_https_conn_close(&pc->conn);
+		int use_v4 = (pc->family == AF_INET);
+		tls13_pool_put(pc, c_mono_ms());
 
 		if (rc != 0) {
 			browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
 			browser_draw_ui(fb, host, url_bar, "", line1, "TLS+HTTP FAILED", "(no cert validation yet; handshake bring-up)");
-			fb->hdr->frame_counter++;
+			shm_fb_present(fb);
 			break;
 		}
 
@@ -373,7 +542,7 @@ void browser_do_https_status(struct shm_fb *fb,
 		int is_redirect = (status_code == 301 || status_code == 302 || status_code == 303 || status_code == 307 || status_code == 308);
 		browser_compose_url_bar(url_bar, URL_BUF_LEN, host, path);
 		browser_draw_ui(fb, host, url_bar, status, line1, (location[0] ? "Redirecting..." : ""), (location[0] ? location : path));
-		fb->hdr->frame_counter++;
+		shm_fb_present(fb);
 
 		if (!is_redirect || location[0] == 0) {
 			(void)c_strlcpy_s(final_status, sizeof(final_status), status);
@@ -402,6 +571,8 @@ void browser_do_https_status(struct shm_fb *fb,
 							      page.inline_imgs,
 							      browser_html_img_dim_lookup,
 							      &ctx);
+		html_style_runs_build(page.links, page.spans, page.runs);
+		line_index_reset(page.lines);
 	}
 
 	if (page.url_bar && page.url_bar_cap) {
@@ -420,8 +591,8 @@ void browser_do_https_status(struct shm_fb *fb,
 			      url_bar,
 			      (page.status_bar ? page.status_bar : ""),
 			      page.visible,
-			      page.links,
-			      page.spans,
+			      page.runs,
 			      page.inline_imgs,
+			      page.lines,
 			      *page.scroll_rows);
 }
@@ -3,6 +3,8 @@
 #include "browser_defs.h"
 #include "fb_shm.h"
 #include "html_text.h"
+#include "line_index.h"
+#include "../core/arena.h"
 
 struct browser_page {
 	uint8_t *body;
@@ -23,10 +25,17 @@ struct browser_page {
 
 	struct html_links *links;
 	struct html_spans *spans;
+	struct html_style_runs *runs;
 	struct html_inline_imgs *inline_imgs;
+	struct line_index *lines;
 
 	uint32_t *scroll_rows;
 	int *have_page;
+
+	/* Backs body, visible and the tables (may be NULL); its pages are
+	 * handed back to the kernel when a navigation starts.
+	 */
+	struct arena *arena;
 };
 
 void browser_compose_url_bar(char *out, size_t out_len, const char *host, const char *path);
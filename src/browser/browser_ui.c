@@ -1,11 +1,17 @@
 #include "browser_ui.h"
 
 #include "browser_img.h"
+#include "display_list.h"
+#include "line_index.h"
+#include "page_tiles.h"
 #include "text_layout.h"
 #include "url.h"
 
+#include "image/img_scale.h"
+
 #include "../core/text.h"
 #include "../core/log.h"
+#include "../core/thread_pool.h"
 
 static uint32_t ui_hash32_fnv1a(const char *s)
 {
@@ -105,14 +111,48 @@ static void draw_text_clipped_u32(void *base, uint32_t stride_bytes, uint32_t x,
 	draw_text_u32(base, stride_bytes, x, y, tmp, color);
 }
 
-void browser_draw_ui(struct shm_fb *fb, const char *active_host, const char *url_bar, const char *status_bar, const char *line1, const char *line2, const char *line3)
+/* Inputs of the top bar currently on screen, so unchanged bars are not redrawn. */
+static struct {
+	uint8_t valid;
+	uint32_t width;
+	char key[1024];
+} g_topbar;
+
+static int topbar_key_append(char *key, size_t cap, size_t *io, const char *s)
 {
-	/* Background */
-	fill_rect_u32(fb->pixels, fb->stride, 0, 0, fb->width, fb->height, 0xff101014u);
+	if (s) {
+		for (size_t i = 0; s[i]; i++) {
+			if (*io + 2u > cap) return -1;
+			key[(*io)++] = s[i];
+		}
+	}
+	if (*io + 2u > cap) return -1;
+	key[(*io)++] = 0x1f;
+	key[*io] = 0;
+	return 0;
+}
+
+static void draw_topbar(struct shm_fb *fb, const char *active_host, const char *url_bar, const char *status_bar)
+{
+	char key[sizeof(g_topbar.key)];
+	size_t ko = 0;
+	int cacheable = topbar_key_append(key, sizeof(key), &ko, active_host) == 0 &&
+			topbar_key_append(key, sizeof(key), &ko, url_bar) == 0 &&
+			topbar_key_append(key, sizeof(key), &ko, status_bar) == 0;
+	if (cacheable && g_topbar.valid && g_topbar.width == fb->width) {
+		size_t i = 0;
+		while (i < ko && g_topbar.key[i] == key[i]) i++;
+		if (i == ko && g_topbar.key[i] == 0) return;
+	}
+	g_topbar.valid = 0;
+	if (cacheable) {
+		c_memcpy(g_topbar.key, key, ko + 1u);
+		g_topbar.width = fb->width;
+		g_topbar.valid = 1;
+	}
 
 	/* Title bar */
 	fill_rect_u32(fb->pixels, fb->stride, 0, 0, fb->width, UI_TOPBAR_H, 0xff202028u);
-	struct text_color tc = { .fg = 0xffffffffu, .bg = 0, .opaque_bg = 0 };
 	struct text_color dim = { .fg = 0xffb0b0b0u, .bg = 0, .opaque_bg = 0 };
 
 	/* Clickable buttons in the top bar */
@@ -155,100 +195,38 @@ void browser_draw_ui(struct shm_fb *fb, const char *active_host, const char *url
 		top[o] = 0;
 	}
 	draw_text_clipped_u32(fb->pixels, fb->stride, url_x, 8, url_w, top, dim);
-
-	/* Body */
-	fill_rect_u32(fb->pixels, fb->stride, 0, UI_TOPBAR_H, fb->width, fb->height - UI_TOPBAR_H, 0xff101014u);
-
-	draw_text_u32(fb->pixels, fb->stride, 8, 40, line1, tc);
-	draw_text_u32(fb->pixels, fb->stride, 8, 56, line2, tc);
-	draw_text_u32(fb->pixels, fb->stride, 8, 72, line3, dim);
+	cfb_push_damage(fb->hdr, 0, 0, fb->width, UI_TOPBAR_H);
 }
 
-static int links_contains_index(const struct html_links *links, uint32_t idx)
-{
-	if (!links) return 0;
-	if (links->n == 0) return 0;
-	if (idx < links->links[0].start) return 0;
-	if (idx >= links->links[links->n - 1].end) return 0;
-	/* Find the last link whose start <= idx, then check containment.
-	 * This assumes links are emitted in non-decreasing start order.
-	 */
-	uint32_t lo = 0;
-	uint32_t hi = links->n;
-	while (lo < hi) {
-		uint32_t mid = lo + (hi - lo) / 2u;
-		if (links->links[mid].start <= idx) lo = mid + 1u;
-		else hi = mid;
-	}
-	if (lo == 0) return 0;
-	const struct html_link *ln = &links->links[lo - 1u];
-	return (idx >= ln->start && idx < ln->end) ? 1 : 0;
-}
+/* What the content area of the framebuffer currently shows, per pixel row:
+ * the serial of the tile it was copied from and the row inside that tile.
+ * Recomposition skips rows that are already on screen and reports the rest
+ * as damage.
+ */
+static struct {
+	uint8_t valid;
+	uint32_t y0;
+	uint32_t rows_px;
+	uint32_t width;
+	uint32_t serial[FB_H];
+	uint16_t row[FB_H];
+} g_screen;
 
-static struct run_style spans_style_at_index(const struct html_spans *spans, uint32_t idx, uint32_t default_fg_xrgb)
+void browser_draw_ui(struct shm_fb *fb, const char *active_host, const char *url_bar, const char *status_bar, const char *line1, const char *line2, const char *line3)
 {
-	struct run_style st;
-	st.has_fg = 0;
-	st.fg_xrgb = default_fg_xrgb;
-	st.has_bg = 0;
-	st.bg_xrgb = 0;
-	st.bold = 0;
-	st.underline = 0;
-
-	if (!spans || spans->n == 0) return st;
-	if (idx < spans->spans[0].start) return st;
-	if (idx >= spans->spans[spans->n - 1].end) return st;
+	struct text_color tc = { .fg = 0xffffffffu, .bg = 0, .opaque_bg = 0 };
+	struct text_color dim = { .fg = 0xffb0b0b0u, .bg = 0, .opaque_bg = 0 };
 
-	uint32_t lo = 0;
-	uint32_t hi = spans->n;
-	while (lo < hi) {
-		uint32_t mid = lo + (hi - lo) / 2u;
-		if (spans->spans[mid].start <= idx) lo = mid + 1u;
-		else hi = mid;
-	}
-	if (lo == 0) return st;
-	const struct html_span *sp = &spans->spans[lo - 1u];
-	if (idx < sp->start || idx >= sp->end) return st;
-	st.has_fg = sp->has_fg;
-	st.fg_xrgb = sp->has_fg ? sp->fg_xrgb : default_fg_xrgb;
-	st.has_bg = sp->has_bg;
-	st.bg_xrgb = sp->bg_xrgb;
-	st.bold = sp->bold;
-	st.underline = sp->underline;
-	return st;
-}
+	draw_topbar(fb, active_host, url_bar, status_bar);
 
-static struct run_style links_style_at_index(const struct html_links *links, uint32_t idx, uint32_t default_fg_xrgb)
-{
-	struct run_style st;
-	st.has_fg = 1;
-	st.fg_xrgb = default_fg_xrgb;
-	st.has_bg = 0;
-	st.bg_xrgb = 0;
-	st.bold = 0;
-	st.underline = 1;
-
-	if (!links || links->n == 0) return st;
-	if (idx < links->links[0].start) return st;
-	if (idx >= links->links[links->n - 1].end) return st;
+	/* Body */
+	fill_rect_u32(fb->pixels, fb->stride, 0, UI_TOPBAR_H, fb->width, fb->height - UI_TOPBAR_H, 0xff101014u);
 
-	uint32_t lo = 0;
-	uint32_t hi = links->n;
-	while (lo < hi) {
-		uint32_t mid = lo + (hi - lo) / 2u;
-		if (links->links[mid].start <= idx) lo = mid + 1u;
-		else hi = mid;
-	}
-	if (lo == 0) return st;
-	const struct html_link *ln = &links->links[lo - 1u];
-	if (idx < ln->start || idx >= ln->end) return st;
-	st.has_fg = ln->has_fg;
-	st.fg_xrgb = ln->has_fg ? ln->fg_xrgb : default_fg_xrgb;
-	st.has_bg = ln->has_bg;
-	st.bg_xrgb = ln->bg_xrgb;
-	st.bold = ln->bold;
-	st.underline = 1;
-	return st;
+	draw_text_u32(fb->pixels, fb->stride, 8, 40, line1, tc);
+	draw_text_u32(fb->pixels, fb->stride, 8, 56, line2, tc);
+	draw_text_u32(fb->pixels, fb->stride, 8, 72, line3, dim);
+	cfb_push_damage(fb->hdr, 0, UI_TOPBAR_H, fb->width, fb->height - UI_TOPBAR_H);
+	g_screen.valid = 0;
 }
 
 static const char *links_href_at_index(const struct html_links *links, uint32_t idx)
@@ -269,87 +247,6 @@ static const char *links_href_at_index(const struct html_links *links, uint32_t
 	return ln->href;
 }
 
-static void draw_line_with_links(struct shm_fb *fb,
-				uint32_t x,
-				uint32_t y,
-				const char *line,
-				size_t line_start_index,
-				const struct html_links *links,
-				const struct html_spans *spans,
-				struct text_color normal,
-				struct text_color linkc)
-{
-	if (!fb || !line) return;
-	char seg[256];
-	uint32_t seg_x = x;
-	uint32_t si = 0;
-	int seg_is_link = 0;
-	struct run_style seg_st;
-	seg_st.has_fg = 0;
-	seg_st.fg_xrgb = normal.fg;
-	seg_st.has_bg = 0;
-	seg_st.bg_xrgb = 0;
-	seg_st.bold = 0;
-	seg_st.underline = 0;
-
-	for (uint32_t i = 0; line[i] && i + 1 < sizeof(seg); i++) {
-		size_t idx = line_start_index + (size_t)i;
-		int is_link = links_contains_index(links, (uint32_t)idx);
-		struct run_style st = spans_style_at_index(spans, (uint32_t)idx, normal.fg);
-		if (is_link) {
-			/* Links override spans. */
-			st = links_style_at_index(links, (uint32_t)idx, linkc.fg);
-		}
-		if (i == 0) { seg_is_link = is_link; seg_st = st; }
-		if (is_link != seg_is_link ||
-		    (is_link && (st.fg_xrgb != seg_st.fg_xrgb || st.has_bg != seg_st.has_bg || st.bg_xrgb != seg_st.bg_xrgb || st.bold != seg_st.bold || st.underline != seg_st.underline)) ||
-		    (!is_link && (st.fg_xrgb != seg_st.fg_xrgb || st.has_bg != seg_st.has_bg || st.bg_xrgb != seg_st.bg_xrgb || st.bold != seg_st.bold || st.underline != seg_st.underline)) ||
-		    si + 2 >= sizeof(seg)) {
-			seg[si] = 0;
-			struct text_color c = seg_is_link ? linkc : normal;
-			c.fg = seg_st.fg_xrgb;
-			if (seg_st.bold && !seg_is_link && !seg_st.has_fg) {
-				/* Make bold stand out even when the default text color is dim. */
-				c.fg = 0xffffffffu;
-			}
-			if (seg_st.has_bg) {
-				fill_rect_u32(fb->pixels, fb->stride, seg_x, y, (uint32_t)si * 8u, 16u, seg_st.bg_xrgb);
-			}
-			draw_text_u32(fb->pixels, fb->stride, seg_x, y, seg, c);
-			if (seg_st.bold) {
-				draw_text_u32(fb->pixels, fb->stride, seg_x + 1, y, seg, c);
-			}
-			if (seg_st.underline) {
-				fill_rect_u32(fb->pixels, fb->stride, seg_x, y + 10u, (uint32_t)si * 8u, 1u, c.fg);
-			}
-			seg_x += (uint32_t)si * 8u;
-			si = 0;
-			seg_is_link = is_link;
-			seg_st = st;
-		}
-		seg[si++] = line[i];
-	}
-	if (si > 0) {
-		seg[si] = 0;
-		struct text_color c = seg_is_link ? linkc : normal;
-		c.fg = seg_st.fg_xrgb;
-		if (seg_st.bold && !seg_is_link && !seg_st.has_fg) {
-			/* Make bold stand out even when the default text color is dim. */
-			c.fg = 0xffffffffu;
-		}
-		if (seg_st.has_bg) {
-			fill_rect_u32(fb->pixels, fb->stride, seg_x, y, (uint32_t)si * 8u, 16u, seg_st.bg_xrgb);
-		}
-		draw_text_u32(fb->pixels, fb->stride, seg_x, y, seg, c);
-		if (seg_st.bold) {
-			draw_text_u32(fb->pixels, fb->stride, seg_x + 1, y, seg, c);
-		}
-		if (seg_st.underline) {
-			fill_rect_u32(fb->pixels, fb->stride, seg_x, y + 10u, (uint32_t)si * 8u, 1u, c.fg);
-		}
-	}
-}
-
 static void blit_xrgb_clipped(struct shm_fb *fb,
 				     uint32_t dst_x,
 				     uint32_t dst_y,
@@ -381,52 +278,442 @@ static void blit_xrgb_clipped(struct shm_fb *fb,
 	}
 }
 
-static void blit_xrgb_scaled_nn_clipped(struct shm_fb *fb,
-					uint32_t dst_x,
-					uint32_t dst_y,
-					uint32_t dst_w,
-					uint32_t dst_h,
-					const uint32_t *src,
-					uint32_t src_w,
-					uint32_t src_h)
+/* Draws `e` scaled to dst_w x dst_h. The scaled pixels come from the image
+ * cache's per-size variants; if those cannot hold it, scales straight into
+ * the framebuffer. With `shared` (render threads) only an existing variant is
+ * used.
+ */
+static void blit_img_scaled_clipped(struct shm_fb *fb,
+				    uint32_t dst_x,
+				    uint32_t dst_y,
+				    uint32_t dst_w,
+				    uint32_t dst_h,
+				    const struct img_sniff_cache_entry *e,
+				    int shared)
 {
-	if (!fb || !src) return;
-	if (dst_w == 0 || dst_h == 0 || src_w == 0 || src_h == 0) return;
+	if (!fb || !e) return;
+	if (dst_w == 0 || dst_h == 0) return;
 	if (dst_x >= fb->width || dst_y >= fb->height) return;
 
+	const uint32_t *scaled = shared ? img_entry_scaled_peek(e, dst_w, dst_h) : img_entry_scaled(e, dst_w, dst_h);
+	if (scaled) {
+		blit_xrgb_clipped(fb, dst_x, dst_y, dst_w, dst_h, scaled, dst_w, dst_h);
+		return;
+	}
+	if (shared) return;
+	const uint32_t *src = img_entry_pixels(e);
+	if (!src) return;
 	uint32_t max_w = fb->width - dst_x;
 	uint32_t max_h = fb->height - dst_y;
-	uint32_t w = dst_w;
-	uint32_t h = dst_h;
-	if (w > max_w) w = max_w;
-	if (h > max_h) h = max_h;
+	(void)img_scale_xrgb(pixel_ptr(fb->pixels, fb->stride, dst_x, dst_y), fb->stride / 4u, dst_w, dst_h,
+			     (dst_w < max_w) ? dst_w : max_w, (dst_h < max_h) ? dst_h : max_h,
+			     src, e->pix_w, e->pix_h, IMG_SCALE_NEAREST);
+}
 
-	for (uint32_t y = 0; y < h; y++) {
-		uint32_t sy = (uint32_t)(((uint64_t)y * (uint64_t)src_h) / (uint64_t)dst_h);
-		if (sy >= src_h) sy = src_h - 1u;
-		uint32_t *row = pixel_ptr(fb->pixels, fb->stride, dst_x, dst_y + y);
-		const uint32_t *srow = src + (size_t)sy * (size_t)src_w;
-		for (uint32_t x = 0; x < w; x++) {
-			uint32_t sx = (uint32_t)(((uint64_t)x * (uint64_t)src_w) / (uint64_t)dst_w);
-			if (sx >= src_w) sx = src_w - 1u;
-			row[x] = srow[sx];
+static struct display_list g_dl;
+static struct dl_block g_dl_scratch;
+
+/* Geometry shared by the items of one visual row. */
+struct dl_replay_row {
+	uint32_t x;          /* content left edge */
+	uint32_t y;          /* row top */
+	uint32_t row_h;      /* visible height of the row (<= 16) */
+	uint32_t w_px;
+	uint32_t max_cols;
+	struct text_color tc;
+	const char *active_host;
+	struct page_tile *rec;
+	struct page_tile_row_hits *hits;
+	uint8_t shared;      /* render thread: rows went through dl_prepare_rows(), caches are read-only */
+};
+
+/* Resolves a display-list image through its cached reference, recording the
+ * lookup in the tile being rendered (if any).
+ */
+static struct img_sniff_cache_entry *ui_dl_image(const struct dl_replay_row *rr, struct dl_pool *pool, uint16_t img)
+{
+	if (img == DL_NO_IMAGE || img >= pool->n_images) return 0;
+	struct dl_image *im = &pool->images[img];
+	if (rr->shared) return img_cache_ref_peek(&im->ref);
+	struct img_sniff_cache_entry *e = img_cache_ref_lookup(&im->ref, rr->active_host, im->url, im->url_len);
+	page_tiles_note_image(rr->rec, e);
+	return e;
+}
+
+/* Size of an inline icon: fit into a 16x16 cell (keep aspect). */
+static int dl_icon_size(const struct img_sniff_cache_entry *e, uint32_t *out_w, uint32_t *out_h)
+{
+	uint32_t w = (uint32_t)e->pix_w;
+	uint32_t h = (uint32_t)e->pix_h;
+	if (w == 0 || h == 0) return 0;
+	if (w > 16u || h > 16u) {
+		if (w >= h) {
+			h = (uint32_t)(((uint64_t)h * 16u) / (uint64_t)w);
+			w = 16u;
+		} else {
+			w = (uint32_t)(((uint64_t)w * 16u) / (uint64_t)h);
+			h = 16u;
+		}
+		if (w == 0) w = 1u;
+		if (h == 0) h = 1u;
+	}
+	*out_w = w;
+	*out_h = h;
+	return 1;
+}
+
+/* Console diagnostics for the common “big hero image placeholder” case.
+ * This helps identify unsupported formats (AVIF/WEBP/SVG) or size limits.
+ */
+static void ui_log_big_placeholder(const struct dl_image *im, uint32_t rows, const struct img_sniff_cache_entry *entry)
+{
+	static uint32_t last_big_img_hash = 0;
+	static uint32_t big_img_logs_left = 6;
+	if (!big_img_logs_left || !im || im->url_len == 0 || rows < 18u) return;
+	char url[512];
+	size_t n = im->url_len;
+	if (n + 1u > sizeof(url)) n = sizeof(url) - 1u;
+	for (size_t i = 0; i < n; i++) url[i] = im->url[i];
+	url[n] = 0;
+	uint32_t h = ui_hash32_fnv1a(url);
+	if (h == last_big_img_hash) return;
+	last_big_img_hash = h;
+	big_img_logs_left--;
+	char msg[768];
+	size_t o = 0;
+	/* Message prefix */
+	const char *pfx = "large placeholder";
+	for (size_t i = 0; pfx[i] && o + 1 < sizeof(msg); i++) msg[o++] = pfx[i];
+	if (o + 2 < sizeof(msg)) { msg[o++] = ':'; msg[o++] = ' '; }
+	/* fmt */
+	const char *f = img_fmt_token(entry ? entry->fmt : IMG_FMT_UNKNOWN);
+	for (size_t i = 0; f[i] && o + 1 < sizeof(msg); i++) msg[o++] = f[i];
+	if (entry && entry->has_dims) {
+		char wdec[11];
+		char hdec[11];
+		u32_to_dec(wdec, (uint32_t)entry->w);
+		u32_to_dec(hdec, (uint32_t)entry->h);
+		if (o + 3 < sizeof(msg)) { msg[o++] = ' '; msg[o++] = '('; }
+		for (size_t i = 0; wdec[i] && o + 1 < sizeof(msg); i++) msg[o++] = wdec[i];
+		if (o + 1 < sizeof(msg)) msg[o++] = 'x';
+		for (size_t i = 0; hdec[i] && o + 1 < sizeof(msg); i++) msg[o++] = hdec[i];
+		if (o + 2 < sizeof(msg)) { msg[o++] = ')'; msg[o++] = ' '; }
+	}
+	/* url */
+	for (size_t i = 0; url[i] && o + 1 < sizeof(msg); i++) msg[o++] = url[i];
+	msg[o] = 0;
+	LOGW("img", msg);
+}
+
+static void dl_draw_text(struct shm_fb *fb, const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_item *it)
+{
+	uint32_t x0 = rr->x + (uint32_t)it->u.text.col * 8u;
+	uint32_t w = (uint32_t)it->u.text.len * 8u;
+	const char *s = pool->chars + it->u.text.off;
+	struct text_color c = { .fg = it->u.text.fg, .bg = 0, .opaque_bg = 0 };
+	if (it->flags & DL_TEXT_BG) fill_rect_u32(fb->pixels, fb->stride, x0, rr->y, w, 16u, it->u.text.bg);
+
+	const struct img_sniff_cache_entry *icon = 0;
+	if (it->flags & DL_TEXT_IMG_TOKEN) {
+		icon = ui_dl_image(rr, pool, it->img);
+		if (icon && !icon->has_pixels) icon = 0;
+	}
+	if (!icon) {
+		draw_text_u32(fb->pixels, fb->stride, x0, rr->y, s, c);
+		if (it->flags & DL_TEXT_BOLD) draw_text_u32(fb->pixels, fb->stride, x0 + 1, rr->y, s, c);
+	}
+	if (it->flags & DL_TEXT_UNDERLINE) fill_rect_u32(fb->pixels, fb->stride, x0, rr->y + 10u, w, 1u, c.fg);
+	if (it->flags & DL_TEXT_LINK) page_tiles_note_link(rr->hits, x0, x0 + w, it->u.text.link);
+	if (!icon) return;
+
+	/* Inline image centered on the token. */
+	uint32_t src_w = (uint32_t)icon->pix_w;
+	uint32_t src_h = (uint32_t)icon->pix_h;
+	uint32_t iw = 0;
+	uint32_t ih = 0;
+	if (!dl_icon_size(icon, &iw, &ih)) return;
+	uint32_t token_w = 5u * 8u;
+	uint32_t dx = x0 + ((token_w > iw) ? ((token_w - iw) / 2u) : 0u);
+	uint32_t dy = rr->y + ((16u > ih) ? ((16u - ih) / 2u) : 0u);
+	if (src_w > 16u || src_h > 16u) {
+		blit_img_scaled_clipped(fb, dx, dy, iw, ih, icon, rr->shared);
+	} else {
+		const uint32_t *src = img_entry_pixels(icon);
+		if (src) blit_xrgb_clipped(fb, dx, dy, iw, ih, src, src_w, src_h);
+	}
+}
+
+/* One 16px row of a block image box. Placeholder frame while loading; once
+ * pixels exist, the image itself.
+ */
+static void dl_draw_img_slice(struct shm_fb *fb, const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_item *it)
+{
+	struct img_sniff_cache_entry *entry = ui_dl_image(rr, pool, it->img);
+	uint32_t rows_total = it->u.box.rows_total;
+	uint32_t rbox = it->u.box.row_in_box;
+	int marker = (it->flags & DL_BOX_MARKER) != 0;
+	if (marker && !rr->shared && it->img != DL_NO_IMAGE) ui_log_big_placeholder(&pool->images[it->img], rows_total, entry);
+
+	uint32_t row_h = rr->row_h;
+	uint32_t max_w = (fb->width > rr->x) ? (fb->width - rr->x) : 0u;
+	if (row_h == 0u || max_w == 0u) return;
+	uint32_t box_w = rr->w_px;
+	if (box_w > max_w) box_w = max_w;
+	/* Optional width shrink based on known dimensions. */
+	if (entry && entry->has_dims) {
+		uint32_t want_w = (uint32_t)entry->w + 2u;
+		if (want_w < 32u) want_w = 32u;
+		if (want_w < box_w) box_w = want_w;
+	}
+	if (box_w == 0u) return;
+	uint32_t x = rr->x;
+	uint32_t y = rr->y;
+	if (entry && entry->has_pixels) {
+		/* Once the image is rendered, drop the placeholder borders and draw
+		 * the image directly in its reserved area.
+		 */
+		fill_rect_u32(fb->pixels, fb->stride, x, y, box_w, row_h, 0xff101014u);
+		uint32_t src_y0 = rbox * 16u;
+		if (src_y0 < (uint32_t)entry->pix_h) {
+			const uint32_t *pool_px = img_entry_pixels(entry);
+			const uint32_t *src = pool_px ? (pool_px + (size_t)src_y0 * (size_t)entry->pix_w) : 0;
+			uint32_t src_h = (uint32_t)entry->pix_h - src_y0;
+			if (src) {
+				uint32_t draw_w = box_w;
+				if (draw_w > entry->pix_w) draw_w = entry->pix_w;
+				uint32_t draw_x = x + ((box_w > draw_w) ? ((box_w - draw_w) / 2u) : 0u);
+				blit_xrgb_clipped(fb, draw_x, y, draw_w, row_h, src, entry->pix_w, src_h);
+			}
+		}
+		return;
+	}
+	if (box_w < 2u) return;
+	uint32_t col = 0xff505058u;
+	if (marker) {
+		fill_rect_u32(fb->pixels, fb->stride, x, y, box_w, 1u, col);
+		if (row_h > 1u && box_w > 2u) {
+			fill_rect_u32(fb->pixels, fb->stride, x + 1u, y + 1u, box_w - 2u, row_h - 1u, 0xff101014u);
+		}
+	}
+	/* Left + right border for this row */
+	fill_rect_u32(fb->pixels, fb->stride, x, y, 1u, row_h, col);
+	fill_rect_u32(fb->pixels, fb->stride, x + box_w - 1u, y, 1u, row_h, col);
+	/* Bottom border on last row */
+	if (!marker && rbox + 1u == rows_total) {
+		fill_rect_u32(fb->pixels, fb->stride, x, y + row_h - 1u, box_w, 1u, col);
+	}
+}
+
+/* Width of a float-right box whose marker asked for `fcols` columns. */
+static uint32_t dl_float_box_w(const struct shm_fb *fb, const struct dl_replay_row *rr, uint32_t fcols, const struct img_sniff_cache_entry *entry)
+{
+	uint32_t max_w = (fb->width > rr->x) ? (fb->width - rr->x) : 0u;
+	uint32_t box_w = fcols * 8u;
+	if (box_w > rr->w_px) box_w = rr->w_px;
+	if (box_w > max_w) box_w = max_w;
+	/* Optional width shrink based on known dimensions. */
+	if (entry && entry->has_dims) {
+		uint32_t want_w = (uint32_t)entry->w + 2u;
+		if (want_w < 32u) want_w = 32u;
+		if (want_w < box_w) box_w = want_w;
+	}
+	/* Cap floats to at most half the content width. */
+	if (box_w > rr->w_px / 2u) box_w = rr->w_px / 2u;
+	return box_w;
+}
+
+/* One 16px row of a float-right box below its label row. */
+static void dl_draw_float_slice(struct shm_fb *fb, const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_item *it)
+{
+	struct img_sniff_cache_entry *entry = ui_dl_image(rr, pool, it->img);
+	uint32_t rows_total = it->u.box.rows_total;
+	uint32_t rbox = it->u.box.row_in_box;
+	uint32_t row_h = rr->row_h;
+	if (row_h == 0u || fb->width <= rr->x || rows_total < 2u || rbox < 1u) return;
+
+	uint32_t fcols = it->u.box.cols;
+	uint32_t max_cols = rr->max_cols;
+	if (max_cols > 12u) {
+		if (fcols > max_cols - 10u) fcols = max_cols - 10u;
+	} else if (fcols > max_cols - 1u) {
+		fcols = max_cols - 1u;
+	}
+	uint32_t box_w = dl_float_box_w(fb, rr, fcols, entry);
+	if (box_w < 2u) return;
+	uint32_t fx = rr->x + ((rr->w_px > box_w) ? (rr->w_px - box_w) : 0u);
+	uint32_t y = rr->y;
+	uint32_t col = 0xff505058u;
+	fill_rect_u32(fb->pixels, fb->stride, fx, y, 1u, row_h, col);
+	fill_rect_u32(fb->pixels, fb->stride, fx + box_w - 1u, y, 1u, row_h, col);
+	if (rbox + 1u == rows_total) {
+		fill_rect_u32(fb->pixels, fb->stride, fx, y + row_h - 1u, box_w, 1u, col);
+	}
+	if (!entry || !entry->has_pixels) return;
+	uint32_t inner_x = fx + 1u;
+	uint32_t inner_w = (box_w > 2u) ? (box_w - 2u) : 0u;
+	uint32_t dst_h = row_h;
+	if (rbox + 1u == rows_total) dst_h = (dst_h > 1u) ? (dst_h - 1u) : 0u;
+	if (inner_w != 0u && dst_h != 0u) {
+		fill_rect_u32(fb->pixels, fb->stride, inner_x, y, inner_w, dst_h, 0xff101014u);
+	}
+	uint32_t src_y0 = (rbox - 1u) * 16u;
+	if (dst_h == 0u || src_y0 >= (uint32_t)entry->pix_h) return;
+	const uint32_t *pool_px = img_entry_pixels(entry);
+	const uint32_t *src = pool_px ? (pool_px + (size_t)src_y0 * (size_t)entry->pix_w) : 0;
+	if (!src) return;
+	uint32_t src_h = (uint32_t)entry->pix_h - src_y0;
+	uint32_t draw_w = inner_w;
+	if (draw_w > entry->pix_w) draw_w = entry->pix_w;
+	uint32_t draw_x = inner_x + ((inner_w > draw_w) ? ((inner_w - draw_w) / 2u) : 0u);
+	blit_xrgb_clipped(fb, draw_x, y, draw_w, dst_h, src, entry->pix_w, src_h);
+}
+
+/* Marker row of a float-right box: frame top plus a "FMT WxH label" line. */
+static void dl_draw_float_label(struct shm_fb *fb, const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_item *it)
+{
+	struct img_sniff_cache_entry *entry = ui_dl_image(rr, pool, it->img);
+	if (!rr->shared && it->img != DL_NO_IMAGE) ui_log_big_placeholder(&pool->images[it->img], it->u.box.rows_total, entry);
+	const char *fmt = img_fmt_token(entry ? entry->fmt : IMG_FMT_UNKNOWN);
+	uint32_t row_h = rr->row_h;
+	uint32_t box_w = dl_float_box_w(fb, rr, it->u.box.cols, entry);
+	uint32_t fx = rr->x + ((rr->w_px > box_w) ? (rr->w_px - box_w) : 0u);
+	uint32_t y = rr->y;
+	uint32_t col = 0xff505058u;
+	if (row_h != 0u && box_w != 0u) {
+		/* Clear interior so a new float marker row doesn't leave pixels from a
+		 * previous float behind (common when pages have many thumbnails).
+		 */
+		if (row_h > 1u && box_w > 2u) {
+			fill_rect_u32(fb->pixels, fb->stride, fx + 1u, y + 1u, box_w - 2u, row_h - 1u, 0xff101014u);
+		}
+		fill_rect_u32(fb->pixels, fb->stride, fx, y, box_w, 1u, col);
+		if (box_w >= 2u) {
+			fill_rect_u32(fb->pixels, fb->stride, fx, y, 1u, row_h, col);
+			fill_rect_u32(fb->pixels, fb->stride, fx + box_w - 1u, y, 1u, row_h, col);
 		}
 	}
+	struct text_color fmtc = rr->tc;
+	fmtc.fg = 0xffffa000u;
+	uint32_t label_x = fx + 8u;
+	uint32_t label_w = (box_w > 16u) ? (box_w - 16u) : 0u;
+	if (fmt[0] != 0 && label_w >= 8u * 4u) {
+		draw_text_u32(fb->pixels, fb->stride, label_x, y + 6u, fmt, fmtc);
+		label_x += 8u * 5u;
+		label_w = (label_w > 8u * 5u) ? (label_w - 8u * 5u) : 0u;
+	}
+	if (entry && entry->has_dims && label_w >= 8u * 6u) {
+		char wdec[11];
+		char hdec[11];
+		u32_to_dec(wdec, (uint32_t)entry->w);
+		u32_to_dec(hdec, (uint32_t)entry->h);
+		char dims[32];
+		size_t di = 0;
+		for (size_t ii = 0; wdec[ii] && di + 1 < sizeof(dims); ii++) dims[di++] = wdec[ii];
+		if (di + 1 < sizeof(dims)) dims[di++] = 'x';
+		for (size_t ii = 0; hdec[ii] && di + 1 < sizeof(dims); ii++) dims[di++] = hdec[ii];
+		if (di + 1 < sizeof(dims)) dims[di++] = ' ';
+		dims[di] = 0;
+		draw_text_u32(fb->pixels, fb->stride, label_x, y + 6u, dims, fmtc);
+		uint32_t adv = (uint32_t)di * 8u;
+		label_x += adv;
+		label_w = (label_w > adv) ? (label_w - adv) : 0u;
+	}
+	draw_text_clipped_u32(fb->pixels, fb->stride, label_x, y + 6u, label_w, pool->chars + it->u.box.label_off, rr->tc);
+}
+
+static void dl_draw_row(struct shm_fb *fb, const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_row *row)
+{
+	for (uint32_t i = 0; i < row->n; i++) {
+		const struct dl_item *it = &pool->items[row->first + i];
+		switch (it->op) {
+			case DL_TEXT: dl_draw_text(fb, rr, pool, it); break;
+			case DL_IMG_SLICE: dl_draw_img_slice(fb, rr, pool, it); break;
+			case DL_FLOAT_SLICE: dl_draw_float_slice(fb, rr, pool, it); break;
+			case DL_FLOAT_LABEL: dl_draw_float_label(fb, rr, pool, it); break;
+			default: break;
+		}
+	}
+}
+
+/* Replays rows[k0, k1) at y, y + 16, ...; `hits` (may be NULL) receives the
+ * link spans of row k0 onwards.
+ */
+static void dl_replay_rows(struct shm_fb *fb,
+			   struct dl_replay_row *rr,
+			   struct dl_pool *pool,
+			   const struct dl_row *rows,
+			   uint32_t k0,
+			   uint32_t k1,
+			   uint32_t y,
+			   uint32_t bottom,
+			   struct page_tile_row_hits *hits)
+{
+	for (uint32_t k = k0; k < k1; k++, y += 16u) {
+		uint32_t remaining_h = (bottom > y) ? (bottom - y) : 0u;
+		rr->y = y;
+		rr->row_h = (remaining_h > 16u) ? 16u : remaining_h;
+		rr->hits = hits ? &hits[k - k0] : 0;
+		dl_draw_row(fb, rr, pool, &rows[k]);
+	}
+}
+
+/* Single-threaded pass before rows are replayed on render threads: resolves
+ * every image the rows use (marking new ones pending and recording them in
+ * rr->rec), writes the placeholder logs and builds the scaled icons.
+ */
+static void dl_prepare_rows(const struct dl_replay_row *rr, struct dl_pool *pool, const struct dl_row *rows, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		for (uint32_t i = 0; i < rows[k].n; i++) {
+			const struct dl_item *it = &pool->items[rows[k].first + i];
+			if (it->img == DL_NO_IMAGE) continue;
+			struct img_sniff_cache_entry *e = ui_dl_image(rr, pool, it->img);
+			if (it->op == DL_FLOAT_LABEL || (it->op == DL_IMG_SLICE && (it->flags & DL_BOX_MARKER))) {
+				ui_log_big_placeholder(&pool->images[it->img], it->u.box.rows_total, e);
+			}
+			uint32_t iw = 0;
+			uint32_t ih = 0;
+			if (it->op == DL_TEXT && e && e->has_pixels && (e->pix_w > 16u || e->pix_h > 16u) && dl_icon_size(e, &iw, &ih)) {
+				(void)img_entry_scaled(e, iw, ih);
+			}
+		}
+	}
+}
+
+/* After dl_prepare_rows(): 1 if every scaled icon the rows need is cached. */
+static int dl_rows_icons_ready(struct dl_pool *pool, const struct dl_row *rows, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		for (uint32_t i = 0; i < rows[k].n; i++) {
+			const struct dl_item *it = &pool->items[rows[k].first + i];
+			if (it->op != DL_TEXT || it->img == DL_NO_IMAGE) continue;
+			const struct img_sniff_cache_entry *e = img_cache_ref_peek(&pool->images[it->img].ref);
+			uint32_t iw = 0;
+			uint32_t ih = 0;
+			if (!e || !e->has_pixels || (e->pix_w <= 16u && e->pix_h <= 16u) || !dl_icon_size(e, &iw, &ih)) continue;
+			if (!img_entry_scaled_peek(e, iw, ih)) return 0;
+		}
+	}
+	return 1;
 }
 
+/* Replays the display list for the rows visible in [y, y + h_px), starting at
+ * document row `scroll_rows`. `rec` is the tile being rendered (or NULL).
+ */
 static void draw_body_wrapped(struct shm_fb *fb,
 			     uint32_t x,
 			     uint32_t y,
 			     uint32_t w_px,
 			     uint32_t h_px,
 			     const char *text,
-			     const struct html_links *links,
-			     const struct html_spans *spans,
+			     const struct html_style_runs *runs,
 			     const struct html_inline_imgs *inline_imgs,
+			     struct line_index *lines,
 			     struct text_color tc,
 			     struct text_color linkc,
 			     uint32_t scroll_rows,
-			     const char *active_host)
+			     const char *active_host,
+			     struct page_tile *rec)
 {
 	if (!fb || !text) return;
 	uint32_t max_cols = (w_px / 8u);
@@ -434,555 +721,320 @@ static void draw_body_wrapped(struct shm_fb *fb,
 	if (max_cols == 0 || max_rows == 0) return;
 	if (max_cols > 255) max_cols = 255;
 
-	struct {
-		uint8_t active;
-		uint32_t rows_total;
-		uint32_t row_in_box; /* 0=label row, 1..=pixel rows */
-		struct img_sniff_cache_entry *entry;
-	} img_box = {0};
-
-	struct {
-		uint8_t active;
-		uint32_t rows_total;
-		uint32_t row_in_box; /* 1..=pixel rows (label row is rendered on marker row) */
-		uint32_t cols_total; /* total box width in text columns */
-		struct img_sniff_cache_entry *entry;
-	} float_box = {0};
-
-	/* Skip scroll_rows lines by running the layout forward.
-	 * Track whether we are currently inside an image placeholder so that
-	 * scrolling into the middle of an image still renders the correct slice.
-	 */
-	size_t pos = 0;
-	char line[1024];
-	for (uint32_t s = 0; s < scroll_rows; s++) {
-		uint32_t use_cols = max_cols;
-		if (float_box.active) {
-			uint32_t fcols = float_box.cols_total;
-			if (max_cols > 12u) {
-				if (fcols > max_cols - 10u) fcols = max_cols - 10u;
-			} else {
-				if (fcols > max_cols - 1u) fcols = max_cols - 1u;
-			}
-			use_cols = (max_cols > (fcols + 1u)) ? (max_cols - fcols - 1u) : 1u;
-			if (use_cols < 1u) use_cols = 1u;
-		}
-		int r = text_layout_next_line(text, &pos, use_cols, line, sizeof(line));
-		if (r != 0) break;
-		if (img_box.active) {
-			img_box.row_in_box++;
-			if (img_box.row_in_box >= img_box.rows_total) {
-				img_box.active = 0;
-			}
-			continue;
-		}
-		if (line[0] == (char)0x1e && line[1] == 'I' && line[2] == 'M' && line[3] == 'G' && line[4] == ' ') {
-			uint32_t rows = 0;
-			size_t p = 5;
-			while (line[p] >= '0' && line[p] <= '9') {
-				rows = rows * 10u + (uint32_t)(line[p] - '0');
-				p++;
-			}
-			while (line[p] == ' ') p++;
-			char *tok = &line[p];
-			while (line[p] && line[p] != ' ' && (uint8_t)line[p] != 0x1f) p++;
-			char tok_end = line[p];
-			line[p] = 0;
-			int is_float = (tok[0] == 'F' && tok[1] == 'R');
-			uint32_t fcols = 0;
-			if (is_float) {
-				for (size_t k = 2; tok[k] >= '0' && tok[k] <= '9'; k++) {
-					fcols = fcols * 10u + (uint32_t)(tok[k] - '0');
-				}
-			}
-			line[p] = tok_end;
-			if (rows < 2u) rows = 2u;
-			if (rows > 200u) rows = 200u;
-			/* Find URL payload to get cache entry (best-effort). */
-			char *url = 0;
-			for (size_t k = p; line[k] != 0; k++) {
-				if ((uint8_t)line[k] == 0x1f) {
-					url = &line[k + 1];
-					break;
-				}
-			}
-			if (is_float && fcols > 0) {
-				float_box.entry = img_cache_find_done(active_host, url ? url : "");
-				float_box.active = 1;
-				float_box.rows_total = rows;
-				if (fcols < 6u) fcols = 6u;
-				if (fcols > 80u) fcols = 80u;
-				float_box.cols_total = fcols;
-				float_box.row_in_box = 0;
-
-				/* The renderer draws the float label row and also consumes the next
-				 * wrapped text line in the *same* visual row. Mirror that here so
-				 * scrolling keeps pos aligned with what is actually displayed.
-				 */
-				uint32_t use_cols2 = max_cols;
-				{
-					uint32_t f2 = float_box.cols_total;
-					if (max_cols > 12u) {
-						if (f2 > max_cols - 10u) f2 = max_cols - 10u;
-					} else {
-						if (f2 > max_cols - 1u) f2 = max_cols - 1u;
-					}
-					use_cols2 = (max_cols > (f2 + 1u)) ? (max_cols - f2 - 1u) : 1u;
-					if (use_cols2 < 1u) use_cols2 = 1u;
-				}
-				(void)text_layout_next_line(text, &pos, use_cols2, line, sizeof(line));
-			} else {
-				img_box.entry = img_cache_find_done(active_host, url ? url : "");
-				img_box.active = 1;
-				img_box.rows_total = rows;
-				img_box.row_in_box = 1; /* marker row was skipped */
-			}
-		}
-		if (float_box.active) {
-			float_box.row_in_box++;
-			if (float_box.row_in_box >= float_box.rows_total) {
-				float_box.active = 0;
-			}
+	struct dl_source src;
+	src.text = text;
+	src.max_cols = max_cols;
+	src.runs = runs;
+	src.inline_imgs = inline_imgs;
+	src.colors.normal_fg = tc.fg;
+	src.colors.link_fg = linkc.fg;
+
+	struct dl_replay_row rr;
+	rr.x = x;
+	rr.w_px = w_px;
+	rr.max_cols = max_cols;
+	rr.tc = tc;
+	rr.active_host = active_host;
+	rr.rec = rec;
+	rr.shared = 0;
+	uint32_t content_bottom = y + h_px;
+	if (fb->height < content_bottom) content_bottom = fb->height;
+
+	for (uint32_t row = 0; row < max_rows;) {
+		uint32_t doc_row = scroll_rows + row;
+		uint32_t block_first = doc_row - doc_row % (uint32_t)DL_BLOCK_ROWS;
+		uint32_t n = 0;
+		struct dl_pool *pool = &g_dl.pool;
+		const struct dl_row *rows = lines ? dl_ensure_block(&g_dl, lines, &src, doc_row, &n) : 0;
+		if (!rows) {
+			n = dl_build_block(&g_dl_scratch, lines, &src, block_first);
+			rows = g_dl_scratch.rows;
+			pool = &g_dl_scratch.pool;
 		}
+		uint32_t k0 = doc_row - block_first;
+		if (k0 >= n) return;
+		uint32_t k1 = n;
+		if (k1 - k0 > max_rows - row) k1 = k0 + (max_rows - row);
+		struct page_tile_row_hits *hits = (rec && row < (uint32_t)PAGE_TILE_ROWS) ? &rec->hits[row] : 0;
+		dl_replay_rows(fb, &rr, pool, rows, k0, k1, y + row * 16u, content_bottom, hits);
+		if (k1 == n && n < (uint32_t)DL_BLOCK_ROWS) return;
+		row += k1 - k0;
 	}
+}
 
-	for (uint32_t row = 0; row < max_rows; row++) {
-		size_t start = 0;
-		uint32_t use_cols = max_cols;
-		if (float_box.active) {
-			uint32_t fcols = float_box.cols_total;
-			if (max_cols > 12u) {
-				if (fcols > max_cols - 10u) fcols = max_cols - 10u;
-			} else {
-				if (fcols > max_cols - 1u) fcols = max_cols - 1u;
-			}
-			use_cols = (max_cols > (fcols + 1u)) ? (max_cols - fcols - 1u) : 1u;
-			if (use_cols < 1u) use_cols = 1u;
-		}
-		int r = text_layout_next_line_ex(text, &pos, use_cols, line, sizeof(line), &start);
-		if (r != 0) return;
-		uint32_t row_y = y + row * 16u;
-
-		/* If we are inside an image placeholder (but not on the marker row), draw
-		 * the corresponding 16px slice for this row.
-		 */
-		if (img_box.active) {
-			uint32_t rows_total = img_box.rows_total;
-			uint32_t rbox = img_box.row_in_box;
-			int has_pixels = (img_box.entry && img_box.entry->has_pixels);
-			/* Geometry */
-			uint32_t content_bottom = y + h_px;
-			if (fb->height < content_bottom) content_bottom = fb->height;
-			uint32_t remaining_h = (content_bottom > row_y) ? (content_bottom - row_y) : 0u;
-			uint32_t row_h = (remaining_h > 16u) ? 16u : remaining_h;
-			uint32_t max_w = (fb->width > x) ? (fb->width - x) : 0u;
-			if (row_h == 0u || max_w == 0u) {
-				img_box.row_in_box++;
-				if (img_box.row_in_box >= rows_total) img_box.active = 0;
-				continue;
-			}
-			uint32_t box_w = w_px;
-			if (box_w > max_w) box_w = max_w;
-			/* Optional width shrink based on known dimensions. */
-			if (img_box.entry && img_box.entry->has_dims) {
-				uint32_t want_w = (uint32_t)img_box.entry->w + 2u;
-				if (want_w < 32u) want_w = 32u;
-				if (want_w < box_w) box_w = want_w;
-			}
-			if (box_w != 0u) {
-				if (has_pixels) {
-					/* Once the image is rendered, drop the placeholder borders/header and
-					 * draw the image directly in its reserved area.
-					 */
-					fill_rect_u32(fb->pixels, fb->stride, x, row_y, box_w, row_h, 0xff101014u);
-					uint32_t src_y0 = rbox * 16u;
-					if (src_y0 < (uint32_t)img_box.entry->pix_h) {
-						const uint32_t *pool = img_entry_pixels(img_box.entry);
-						const uint32_t *src = pool ? (pool + (size_t)src_y0 * (size_t)img_box.entry->pix_w) : 0;
-						uint32_t src_h = (uint32_t)img_box.entry->pix_h - src_y0;
-						if (src) {
-							uint32_t draw_w = box_w;
-							if (draw_w > img_box.entry->pix_w) draw_w = img_box.entry->pix_w;
-							uint32_t draw_x = x + ((box_w > draw_w) ? ((box_w - draw_w) / 2u) : 0u);
-							blit_xrgb_clipped(fb, draw_x, row_y, draw_w, row_h, src, img_box.entry->pix_w, src_h);
-						}
-					}
-				} else if (box_w >= 2u) {
-					uint32_t col = 0xff505058u;
-					/* Left + right border for this row */
-					fill_rect_u32(fb->pixels, fb->stride, x, row_y, 1u, row_h, col);
-					fill_rect_u32(fb->pixels, fb->stride, x + box_w - 1u, row_y, 1u, row_h, col);
-					/* Bottom border on last row */
-					if (rbox + 1u == rows_total && row_h > 0u) {
-						fill_rect_u32(fb->pixels, fb->stride, x, row_y + row_h - 1u, box_w, 1u, col);
-					}
-				}
-			}
-			img_box.row_in_box++;
-			if (img_box.row_in_box >= rows_total) {
-				img_box.active = 0;
-			}
-			continue;
-		}
+/* A framebuffer view of tile `t`'s pixels. */
+static void tile_fb(struct shm_fb *tfb, const struct shm_fb *fb, struct page_tile *t)
+{
+	tfb->hdr = 0;
+	tfb->base = 0;
+	tfb->map_len = 0;
+	tfb->width = fb->width;
+	tfb->height = PAGE_TILE_H;
+	tfb->stride = fb->width * 4u;
+	tfb->pixels = t->pixels;
+	tfb->fd = -1;
+}
 
-		/* If a float is active for this row, draw its pixel slice on the right.
-		 * (The label row is drawn when we encounter the marker line.)
-		 */
-		if (float_box.active) {
-			uint32_t rows_total = float_box.rows_total;
-			uint32_t rbox = float_box.row_in_box;
-			uint32_t content_bottom = y + h_px;
-			if (fb->height < content_bottom) content_bottom = fb->height;
-			uint32_t remaining_h = (content_bottom > row_y) ? (content_bottom - row_y) : 0u;
-			uint32_t row_h = (remaining_h > 16u) ? 16u : remaining_h;
-			uint32_t max_w = (fb->width > x) ? (fb->width - x) : 0u;
-			if (row_h != 0u && max_w != 0u && rows_total >= 2u && rbox >= 1u) {
-				uint32_t fcols = float_box.cols_total;
-				if (max_cols > 12u) {
-					if (fcols > max_cols - 10u) fcols = max_cols - 10u;
-				} else if (fcols > max_cols - 1u) {
-					fcols = max_cols - 1u;
-				}
-				uint32_t box_w = fcols * 8u;
-				if (box_w > w_px) box_w = w_px;
-				if (box_w > max_w) box_w = max_w;
-				/* Optional width shrink based on known dimensions. */
-				if (float_box.entry && float_box.entry->has_dims) {
-					uint32_t want_w = (uint32_t)float_box.entry->w + 2u;
-					if (want_w < 32u) want_w = 32u;
-					if (want_w < box_w) box_w = want_w;
-				}
-				/* Cap floats to at most half the content width. */
-				if (box_w > w_px / 2u) box_w = w_px / 2u;
-				if (box_w >= 2u) {
-					uint32_t fx = x + ((w_px > box_w) ? (w_px - box_w) : 0u);
-					uint32_t col = 0xff505058u;
-					fill_rect_u32(fb->pixels, fb->stride, fx, row_y, 1u, row_h, col);
-					fill_rect_u32(fb->pixels, fb->stride, fx + box_w - 1u, row_y, 1u, row_h, col);
-					if (rbox + 1u == rows_total && row_h > 0u) {
-						fill_rect_u32(fb->pixels, fb->stride, fx, row_y + row_h - 1u, box_w, 1u, col);
-					}
-					if (float_box.entry && float_box.entry->has_pixels) {
-						uint32_t inner_x = fx + 1u;
-						uint32_t inner_w = (box_w > 2u) ? (box_w - 2u) : 0u;
-						uint32_t dst_h = row_h;
-						if (rbox + 1u == rows_total && dst_h > 0u) {
-							dst_h = (dst_h > 1u) ? (dst_h - 1u) : 0u;
-						}
-						if (inner_w != 0u && dst_h != 0u) {
-							fill_rect_u32(fb->pixels, fb->stride, inner_x, row_y, inner_w, dst_h, 0xff101014u);
-						}
-						uint32_t src_y0 = (rbox - 1u) * 16u;
-						if (dst_h != 0u && src_y0 < (uint32_t)float_box.entry->pix_h) {
-							const uint32_t *pool = img_entry_pixels(float_box.entry);
-							const uint32_t *src = pool ? (pool + (size_t)src_y0 * (size_t)float_box.entry->pix_w) : 0;
-							uint32_t src_h = (uint32_t)float_box.entry->pix_h - src_y0;
-							if (src) {
-								uint32_t draw_w = inner_w;
-								if (draw_w > float_box.entry->pix_w) draw_w = float_box.entry->pix_w;
-								uint32_t draw_x = inner_x + ((inner_w > draw_w) ? ((inner_w - draw_w) / 2u) : 0u);
-								blit_xrgb_clipped(fb, draw_x, row_y, draw_w, dst_h, src, float_box.entry->pix_w, src_h);
-							}
-						}
-					}
-				}
-			}
-		}
+static void render_tile(const struct shm_fb *fb,
+			uint32_t w_px,
+			const char *text,
+			const struct html_style_runs *runs,
+			const struct html_inline_imgs *inline_imgs,
+			struct line_index *lines,
+			struct text_color tc,
+			struct text_color linkc,
+			const char *active_host,
+			struct page_tile *t)
+{
+	struct shm_fb tfb;
+	tile_fb(&tfb, fb, t);
+	fill_rect_u32(tfb.pixels, tfb.stride, 0, 0, tfb.width, tfb.height, 0xff101014u);
+	draw_body_wrapped(&tfb, 8, 0, w_px, PAGE_TILE_H, text, runs, inline_imgs, lines, tc, linkc,
+			  t->index * (uint32_t)PAGE_TILE_ROWS, active_host, t);
+}
 
-		/* Image placeholder marker row: draw real lines in framebuffer.
-		 * Marker format: 0x1e "IMG <rows> <token> <label>" 0x1f "<url>".
-		 * Token is either "?" (block placeholder) or "FR<cols>" (float-right).
-		 * Format is sniffed from the first bytes of the URL.
-		 */
-		if (line[0] == (char)0x1e && line[1] == 'I' && line[2] == 'M' && line[3] == 'G' && line[4] == ' ') {
-			static uint32_t last_big_img_hash = 0;
-			static uint32_t big_img_logs_left = 6;
+enum {
+	/* Horizontal bands per tile handed to the render threads. */
+	RENDER_BANDS = 4,
+	RENDER_BAND_ROWS = PAGE_TILE_ROWS / RENDER_BANDS,
+};
 
-			/* Parse rows */
-			uint32_t rows = 0;
-			size_t p = 5;
-			while (line[p] >= '0' && line[p] <= '9') {
-				uint32_t d = (uint32_t)(line[p] - '0');
-				rows = rows * 10u + d;
-				p++;
-			}
-			while (line[p] == ' ') p++;
-			/* Parse placeholder token (renderer still sniffs actual image format). */
-			char *tok = &line[p];
-			while (line[p] && line[p] != ' ' && (uint8_t)line[p] != 0x1f) p++;
-			char tok_end = line[p];
-			line[p] = 0;
-			int is_float = (tok[0] == 'F' && tok[1] == 'R');
-			uint32_t fcols = 0;
-			if (is_float) {
-				for (size_t k = 2; tok[k] >= '0' && tok[k] <= '9'; k++) {
-					fcols = fcols * 10u + (uint32_t)(tok[k] - '0');
-				}
-			}
-			line[p] = tok_end;
-			while (line[p] == ' ') p++;
-			char *label = &line[p];
-			char *url = 0;
-			for (size_t k = p; line[k] != 0; k++) {
-				if ((uint8_t)line[k] == 0x1f) {
-					line[k] = 0;
-					url = &line[k + 1];
-					break;
-				}
-			}
-			enum img_fmt sniffed = img_cache_get_or_mark_pending(active_host, url ? url : "");
-			struct img_sniff_cache_entry *entry = img_cache_find_done(active_host, url ? url : "");
-			const char *fmt = img_fmt_token(sniffed);
-
-			/* Console diagnostics for the common “big hero image placeholder” case.
-			 * This helps identify unsupported formats (AVIF/WEBP/SVG) or size limits.
-			 */
-			if (big_img_logs_left && url && url[0] && rows >= 18u) {
-				uint32_t h = ui_hash32_fnv1a(url);
-				if (h != last_big_img_hash) {
-					last_big_img_hash = h;
-					big_img_logs_left--;
-					char msg[768];
-					size_t o = 0;
-					/* Message prefix */
-					const char *pfx = "large placeholder";
-					for (size_t i = 0; pfx[i] && o + 1 < sizeof(msg); i++) msg[o++] = pfx[i];
-					if (o + 2 < sizeof(msg)) { msg[o++] = ':'; msg[o++] = ' '; }
-					/* fmt */
-					const char *f = fmt ? fmt : "?";
-					for (size_t i = 0; f[i] && o + 1 < sizeof(msg); i++) msg[o++] = f[i];
-					if (entry && entry->has_dims) {
-						char wdec[11];
-						char hdec[11];
-						u32_to_dec(wdec, (uint32_t)entry->w);
-						u32_to_dec(hdec, (uint32_t)entry->h);
-						if (o + 3 < sizeof(msg)) { msg[o++] = ' '; msg[o++] = '('; }
-						for (size_t i = 0; wdec[i] && o + 1 < sizeof(msg); i++) msg[o++] = wdec[i];
-						if (o + 1 < sizeof(msg)) msg[o++] = 'x';
-						for (size_t i = 0; hdec[i] && o + 1 < sizeof(msg); i++) msg[o++] = hdec[i];
-						if (o + 2 < sizeof(msg)) { msg[o++] = ')'; msg[o++] = ' '; }
-					}
-					/* url */
-					for (size_t i = 0; url[i] && o + 1 < sizeof(msg); i++) msg[o++] = url[i];
-					msg[o] = 0;
-					LOGW("img", msg);
-				}
-			}
-			if (rows < 2u) rows = 2u;
-			if (rows > 200u) rows = 200u;
-			if (is_float && fcols > 0) {
-				/* Float-right marker row: draw only the label row on the right,
-				 * and render the next text line alongside it in the same visual row.
-				 */
-				uint32_t content_bottom = y + h_px;
-				if (fb->height < content_bottom) content_bottom = fb->height;
-				uint32_t remaining_h = (content_bottom > row_y) ? (content_bottom - row_y) : 0u;
-				uint32_t row_h = (remaining_h > 16u) ? 16u : remaining_h;
-				uint32_t max_w = (fb->width > x) ? (fb->width - x) : 0u;
-				if (fcols < 6u) fcols = 6u;
-				if (fcols > 80u) fcols = 80u;
-				uint32_t box_w = fcols * 8u;
-				if (box_w > w_px) box_w = w_px;
-				if (box_w > max_w) box_w = max_w;
-				if (entry && entry->has_dims) {
-					uint32_t want_w = (uint32_t)entry->w + 2u;
-					if (want_w < 32u) want_w = 32u;
-					if (want_w < box_w) box_w = want_w;
-				}
-				if (box_w > w_px / 2u) box_w = w_px / 2u;
-				uint32_t fx = x + ((w_px > box_w) ? (w_px - box_w) : 0u);
-				uint32_t col = 0xff505058u;
-				if (row_h != 0u && box_w != 0u) {
-					/* Clear interior so a new float marker row doesn't leave pixels from a
-					 * previous float behind (common when pages have many thumbnails).
-					 */
-					if (row_h > 1u && box_w > 2u) {
-						fill_rect_u32(fb->pixels, fb->stride, fx + 1u, row_y + 1u, box_w - 2u, row_h - 1u, 0xff101014u);
-					}
-					fill_rect_u32(fb->pixels, fb->stride, fx, row_y, box_w, 1u, col);
-					if (box_w >= 2u) {
-						fill_rect_u32(fb->pixels, fb->stride, fx, row_y, 1u, row_h, col);
-						fill_rect_u32(fb->pixels, fb->stride, fx + box_w - 1u, row_y, 1u, row_h, col);
-					}
-				}
-				struct text_color fmtc = tc;
-				fmtc.fg = 0xffffa000u;
-				uint32_t label_x = fx + 8u;
-				uint32_t label_w = (box_w > 16u) ? (box_w - 16u) : 0u;
-				if (fmt[0] != 0 && label_w >= 8u * 4u) {
-					draw_text_u32(fb->pixels, fb->stride, label_x, row_y + 6u, fmt, fmtc);
-					label_x += 8u * 5u;
-					label_w = (label_w > 8u * 5u) ? (label_w - 8u * 5u) : 0u;
-				}
-				if (entry && entry->has_dims && label_w >= 8u * 6u) {
-					char wdec[11];
-					char hdec[11];
-					u32_to_dec(wdec, (uint32_t)entry->w);
-					u32_to_dec(hdec, (uint32_t)entry->h);
-					char dims[32];
-					size_t di = 0;
-					for (size_t ii = 0; wdec[ii] && di + 1 < sizeof(dims); ii++) dims[di++] = wdec[ii];
-					if (di + 1 < sizeof(dims)) dims[di++] = 'x';
-					for (size_t ii = 0; hdec[ii] && di + 1 < sizeof(dims); ii++) dims[di++] = hdec[ii];
-					if (di + 1 < sizeof(dims)) dims[di++] = ' ';
-					dims[di] = 0;
-					draw_text_u32(fb->pixels, fb->stride, label_x, row_y + 6u, dims, fmtc);
-					uint32_t adv = (uint32_t)di * 8u;
-					label_x += adv;
-					label_w = (label_w > adv) ? (label_w - adv) : 0u;
-				}
-				draw_text_clipped_u32(fb->pixels, fb->stride, label_x, row_y + 6u, label_w, label, tc);
+/* Tiles whose display-list rows are built and prepared, for render_band(). */
+struct render_batch {
+	const struct shm_fb *fb;
+	struct dl_replay_row rr;
+	uint32_t n_tiles;
+	struct page_tile *tiles[PAGE_TILE_POOL];
+	const struct dl_row *rows[PAGE_TILE_POOL];
+	uint32_t n_rows[PAGE_TILE_POOL];
+};
 
-				/* Activate per-row rendering for the reserved blank lines that follow. */
-				float_box.entry = entry;
-				float_box.active = 1;
-				float_box.rows_total = rows;
-				float_box.cols_total = fcols;
-				/* Label row is this row; first pixel slice draws on the next visual row.
-				 * Keep row_in_box semantics aligned with the scroll + click logic.
-				 */
-				float_box.row_in_box = 0;
+static struct tpool g_render_pool;
+static uint8_t g_render_pool_started;
 
-				/* Draw the next text line on the same row (mirrors old behavior). */
-				uint32_t use_cols2 = max_cols;
-				{
-					uint32_t f2 = float_box.cols_total;
-					if (max_cols > 12u) {
-						if (f2 > max_cols - 10u) f2 = max_cols - 10u;
-					} else {
-						if (f2 > max_cols - 1u) f2 = max_cols - 1u;
-					}
-					use_cols2 = (max_cols > (f2 + 1u)) ? (max_cols - f2 - 1u) : 1u;
-					if (use_cols2 < 1u) use_cols2 = 1u;
-				}
-				size_t start2 = 0;
-				char line2[1024];
-				line2[0] = 0;
-				(void)text_layout_next_line_ex(text, &pos, use_cols2, line2, sizeof(line2), &start2);
-				draw_line_with_links(fb, x, row_y, line2, start2, links, spans, tc, linkc);
-				continue;
-			}
+/* Job `job` of a render_batch: one band of one tile. Runs on any thread. */
+static void render_band(void *ctx, uint32_t job)
+{
+	struct render_batch *b = (struct render_batch *)ctx;
+	uint32_t ti = job / (uint32_t)RENDER_BANDS;
+	uint32_t k0 = (job % (uint32_t)RENDER_BANDS) * (uint32_t)RENDER_BAND_ROWS;
+	uint32_t k1 = k0 + (uint32_t)RENDER_BAND_ROWS;
+	struct page_tile *t = b->tiles[ti];
+	struct shm_fb tfb;
+	tile_fb(&tfb, b->fb, t);
+	fill_rect_u32(tfb.pixels, tfb.stride, 0, k0 * 16u, tfb.width, (uint32_t)RENDER_BAND_ROWS * 16u, 0xff101014u);
+	if (k1 > b->n_rows[ti]) k1 = b->n_rows[ti];
+	if (k0 >= k1) return;
+	struct dl_replay_row rr = b->rr;
+	rr.rec = t;
+	dl_replay_rows(&tfb, &rr, &g_dl.pool, b->rows[ti], k0, k1, k0 * 16u, PAGE_TILE_H, &t->hits[k0]);
+}
 
-			/* Block placeholder: no header bar. While loading, draw only the box; once
-			 * pixels exist, draw the image starting at this marker row.
-			 */
-			uint32_t content_bottom = y + h_px;
-			if (fb->height < content_bottom) content_bottom = fb->height;
-			uint32_t remaining_h = (content_bottom > row_y) ? (content_bottom - row_y) : 0u;
-			uint32_t row_h = (remaining_h > 16u) ? 16u : remaining_h;
-			uint32_t max_w = (fb->width > x) ? (fb->width - x) : 0u;
-			uint32_t box_w = w_px;
-			if (box_w > max_w) box_w = max_w;
-			if (entry && entry->has_dims) {
-				uint32_t want_w = (uint32_t)entry->w + 2u;
-				if (want_w < 32u) want_w = 32u;
-				if (want_w < box_w) box_w = want_w;
-			}
-			int has_pixels = (entry && entry->has_pixels);
-			if (row_h != 0u && box_w != 0u) {
-				if (has_pixels) {
-					fill_rect_u32(fb->pixels, fb->stride, x, row_y, box_w, row_h, 0xff101014u);
-					const uint32_t *pool = img_entry_pixels(entry);
-					const uint32_t *src = pool;
-					uint32_t src_h = (uint32_t)entry->pix_h;
-					if (src) {
-						uint32_t draw_w = box_w;
-						if (draw_w > entry->pix_w) draw_w = entry->pix_w;
-						uint32_t draw_x = x + ((box_w > draw_w) ? ((box_w - draw_w) / 2u) : 0u);
-						blit_xrgb_clipped(fb, draw_x, row_y, draw_w, row_h, src, entry->pix_w, src_h);
-					}
-				} else if (box_w >= 2u) {
-					uint32_t col = 0xff505058u;
-					fill_rect_u32(fb->pixels, fb->stride, x, row_y, box_w, 1u, col);
-					fill_rect_u32(fb->pixels, fb->stride, x, row_y, 1u, row_h, col);
-					fill_rect_u32(fb->pixels, fb->stride, x + box_w - 1u, row_y, 1u, row_h, col);
-					if (row_h > 1u && box_w > 2u) {
-						fill_rect_u32(fb->pixels, fb->stride, x + 1u, row_y + 1u, box_w - 2u, row_h - 1u, 0xff101014u);
-					}
-				}
-			}
+/* Renders freshly allocated tiles. Display-list blocks and image lookups are
+ * resolved here, single-threaded; the pixels are then drawn in bands on the
+ * render pool. Tiles the prepared path cannot serve (rows past the display
+ * list, pool overflow, evicted icons) are rendered the serial way.
+ */
+static void render_tiles(const struct shm_fb *fb,
+			 uint32_t w_px,
+			 const char *text,
+			 const struct html_style_runs *runs,
+			 const struct html_inline_imgs *inline_imgs,
+			 struct line_index *lines,
+			 struct text_color tc,
+			 struct text_color linkc,
+			 const char *active_host,
+			 struct page_tile **tiles,
+			 uint32_t n_tiles)
+{
+	if (!g_render_pool_started) {
+		g_render_pool_started = 1;
+		/* Pick the glyph blitter before threads can race on the lazy choice. */
+		(void)font_blit_select(FONT_BLIT_AUTO);
+		uint32_t cpus = tpool_cpu_count();
+		(void)tpool_start(&g_render_pool, (cpus > 1u) ? (cpus - 1u) : 0u);
+	}
 
-			img_box.active = 1;
-			img_box.entry = entry;
-			img_box.rows_total = rows;
-			/* Marker row drew the first 16px slice (or the top border); start at the
-			 * next 16px slice on the next visual row.
-			 */
-			img_box.row_in_box = 1;
+	uint32_t max_cols = w_px / 8u;
+	if (max_cols > 255) max_cols = 255;
+	struct dl_source src;
+	src.text = text;
+	src.max_cols = max_cols;
+	src.runs = runs;
+	src.inline_imgs = inline_imgs;
+	src.colors.normal_fg = tc.fg;
+	src.colors.link_fg = linkc.fg;
+
+	struct render_batch b;
+	b.fb = fb;
+	b.rr.x = 8;
+	b.rr.y = 0;
+	b.rr.row_h = 0;
+	b.rr.w_px = w_px;
+	b.rr.max_cols = max_cols;
+	b.rr.tc = tc;
+	b.rr.active_host = active_host;
+	b.rr.rec = 0;
+	b.rr.hits = 0;
+	b.rr.shared = 1;
+	b.n_tiles = 0;
+	struct page_tile *serial[PAGE_TILE_POOL];
+	uint32_t n_serial = 0;
+
+	/* Build every block first: building can drop blocks built earlier. */
+	uint32_t epoch = 0;
+	for (uint32_t i = 0; i < n_tiles && i < (uint32_t)PAGE_TILE_POOL; i++) {
+		struct page_tile *t = tiles[i];
+		uint32_t n = 0;
+		const struct dl_row *rows = dl_ensure_block(&g_dl, lines, &src, t->index * (uint32_t)PAGE_TILE_ROWS, &n);
+		if (!rows) {
+			serial[n_serial++] = t;
 			continue;
 		}
+		if (b.n_tiles == 0) epoch = g_dl.epoch;
+		b.tiles[b.n_tiles] = t;
+		b.rows[b.n_tiles] = rows;
+		b.n_rows[b.n_tiles] = n;
+		b.n_tiles++;
+	}
+	if (b.n_tiles && g_dl.epoch != epoch) {
+		for (uint32_t i = 0; i < b.n_tiles; i++) serial[n_serial++] = b.tiles[i];
+		b.n_tiles = 0;
+	}
 
-		char drawline[1024];
-		(void)c_strlcpy_s(drawline, sizeof(drawline), line);
-		struct {
-			uint32_t col;
-			struct img_sniff_cache_entry *entry;
-		} to_draw[32];
-		uint32_t n_to_draw = 0;
-		if (inline_imgs && inline_imgs->n > 0) {
-			size_t line_len = c_strlen(line);
-			for (uint32_t ii = 0; ii < inline_imgs->n; ii++) {
-				const struct html_inline_img *im = &inline_imgs->imgs[ii];
-				if (im->url[0] == 0) continue;
-				if (im->start < start) continue;
-				size_t rel = (size_t)(im->start - (uint32_t)start);
-				if (rel + 5u > line_len) continue;
-				if (!(line[rel + 0] == '[' && line[rel + 1] == 'i' && line[rel + 2] == 'm' && line[rel + 3] == 'g' && line[rel + 4] == ']')) continue;
-				(void)img_cache_get_or_mark_pending(active_host, im->url);
-				struct img_sniff_cache_entry *e = img_cache_find_done(active_host, im->url);
-				if (!e || !e->has_pixels) continue;
-				for (size_t k = 0; k < 5u; k++) drawline[rel + k] = ' ';
-				if (n_to_draw < (uint32_t)(sizeof(to_draw) / sizeof(to_draw[0]))) {
-					to_draw[n_to_draw].col = (uint32_t)rel;
-					to_draw[n_to_draw].entry = e;
-					n_to_draw++;
-				}
-			}
+	for (uint32_t i = 0; i < b.n_tiles; i++) {
+		struct dl_replay_row rr = b.rr;
+		rr.shared = 0;
+		rr.rec = b.tiles[i];
+		dl_prepare_rows(&rr, &g_dl.pool, b.rows[i], b.n_rows[i]);
+	}
+	/* Later tiles' icons may have pushed out earlier ones. */
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < b.n_tiles; i++) {
+		if (!dl_rows_icons_ready(&g_dl.pool, b.rows[i], b.n_rows[i])) {
+			serial[n_serial++] = b.tiles[i];
+			continue;
 		}
+		b.tiles[kept] = b.tiles[i];
+		b.rows[kept] = b.rows[i];
+		b.n_rows[kept] = b.n_rows[i];
+		kept++;
+	}
+	b.n_tiles = kept;
 
-		draw_line_with_links(fb, x, row_y, drawline, start, links, spans, tc, linkc);
-
-		for (uint32_t di = 0; di < n_to_draw; di++) {
-			struct img_sniff_cache_entry *e = to_draw[di].entry;
-			if (!e || !e->has_pixels) continue;
-			uint32_t token_x = x + to_draw[di].col * 8u;
-			uint32_t token_w = 5u * 8u;
-			uint32_t src_w = (uint32_t)e->pix_w;
-			uint32_t src_h = (uint32_t)e->pix_h;
-			uint32_t w = src_w;
-			uint32_t h = src_h;
-			if (w == 0 || h == 0) continue;
-			/* Fit into a 16x16 cell (keep aspect). */
-			if (w > 16u || h > 16u) {
-				if (w >= h) {
-					h = (uint32_t)(((uint64_t)h * 16u) / (uint64_t)w);
-					w = 16u;
-				} else {
-					w = (uint32_t)(((uint64_t)w * 16u) / (uint64_t)h);
-					h = 16u;
-				}
-				if (w == 0) w = 1u;
-				if (h == 0) h = 1u;
-			}
-			uint32_t dx = token_x + ((token_w > w) ? ((token_w - w) / 2u) : 0u);
-			uint32_t dy = row_y + ((16u > h) ? ((16u - h) / 2u) : 0u);
-			const uint32_t *src = img_entry_pixels(e);
-			if (src) {
-				if (src_w > 16u || src_h > 16u) {
-					blit_xrgb_scaled_nn_clipped(fb, dx, dy, w, h, src, src_w, src_h);
-				} else {
-					blit_xrgb_clipped(fb, dx, dy, w, h, src, src_w, src_h);
-				}
-			}
+	if (b.n_tiles) tpool_run(&g_render_pool, render_band, &b, b.n_tiles * (uint32_t)RENDER_BANDS);
+	for (uint32_t i = 0; i < n_serial; i++) {
+		render_tile(fb, w_px, text, runs, inline_imgs, lines, tc, linkc, active_host, serial[i]);
+	}
+}
+
+/* Composes the content area from cached tiles, rendering only missing or stale
+ * ones. Falls back to drawing straight into the framebuffer if the surface is
+ * wider than a tile.
+ */
+static void draw_body_tiled(struct shm_fb *fb,
+			    uint32_t y0,
+			    uint32_t h_px,
+			    const char *text,
+			    const struct html_style_runs *runs,
+			    const struct html_inline_imgs *inline_imgs,
+			    struct line_index *lines,
+			    struct text_color tc,
+			    struct text_color linkc,
+			    uint32_t scroll_rows,
+			    const char *active_host)
+{
+	uint32_t w_px = (fb->width > 16) ? (fb->width - 16) : 0;
+	uint32_t max_cols = browser_ui_body_cols(fb->width);
+	uint32_t rows_px = (h_px / 16u) * 16u;
+
+	if (!lines || max_cols == 0 || fb->width > FB_W || rows_px > FB_H) {
+		fill_rect_u32(fb->pixels, fb->stride, 0, UI_TOPBAR_H, fb->width, fb->height - UI_TOPBAR_H, 0xff101014u);
+		draw_body_wrapped(fb, 8, y0, w_px, h_px, text, runs, inline_imgs, lines, tc, linkc, scroll_rows, active_host, 0);
+		cfb_push_damage(fb->hdr, 0, UI_TOPBAR_H, fb->width, fb->height - UI_TOPBAR_H);
+		g_screen.valid = 0;
+		return;
+	}
+	line_index_ensure(lines, text, max_cols);
+
+	if (!g_screen.valid || g_screen.y0 != y0 || g_screen.rows_px != rows_px || g_screen.width != fb->width) {
+		/* Padding below the top bar and the partial row at the bottom. */
+		if (y0 > UI_TOPBAR_H) {
+			fill_rect_u32(fb->pixels, fb->stride, 0, UI_TOPBAR_H, fb->width, y0 - UI_TOPBAR_H, 0xff101014u);
+			cfb_push_damage(fb->hdr, 0, UI_TOPBAR_H, fb->width, y0 - UI_TOPBAR_H);
+		}
+		if (fb->height > y0 + rows_px) {
+			fill_rect_u32(fb->pixels, fb->stride, 0, y0 + rows_px, fb->width, fb->height - y0 - rows_px, 0xff101014u);
+			cfb_push_damage(fb->hdr, 0, y0 + rows_px, fb->width, fb->height - y0 - rows_px);
 		}
+		for (uint32_t r = 0; r < rows_px; r++) g_screen.serial[r] = 0;
+		g_screen.y0 = y0;
+		g_screen.rows_px = rows_px;
+		g_screen.width = fb->width;
+		g_screen.valid = 1;
+	}
 
-		if (float_box.active) {
-			float_box.row_in_box++;
-			if (float_box.row_in_box >= float_box.rows_total) {
-				float_box.active = 0;
+	/* Look up the visible tiles, then render the missing ones in one batch. */
+	uint64_t doc_y = (uint64_t)scroll_rows * 16u;
+	uint32_t first_ti = (uint32_t)(doc_y / PAGE_TILE_H);
+	struct page_tile *vis[PAGE_TILE_POOL];
+	struct page_tile *todo[PAGE_TILE_POOL];
+	uint32_t n_vis = 0;
+	uint32_t n_todo = 0;
+	for (uint32_t dy = 0; dy < rows_px && n_vis < (uint32_t)PAGE_TILE_POOL;) {
+		uint64_t ty = doc_y + dy;
+		uint32_t ti = (uint32_t)(ty / PAGE_TILE_H);
+		struct page_tile *t = page_tiles_lookup(ti, lines->gen);
+		if (!t) {
+			t = page_tiles_alloc(ti, lines->gen);
+			todo[n_todo++] = t;
+		}
+		vis[n_vis++] = t;
+		dy += PAGE_TILE_H - (uint32_t)(ty % PAGE_TILE_H);
+	}
+	if (n_todo) render_tiles(fb, w_px, text, runs, inline_imgs, lines, tc, linkc, active_host, todo, n_todo);
+
+	uint32_t run_y = 0;
+	uint32_t run_n = 0;
+	for (uint32_t dy = 0; dy < rows_px;) {
+		uint64_t ty = doc_y + dy;
+		uint32_t ti = (uint32_t)(ty / PAGE_TILE_H);
+		uint32_t off = (uint32_t)(ty % PAGE_TILE_H);
+		uint32_t n = PAGE_TILE_H - off;
+		if (n > rows_px - dy) n = rows_px - dy;
+
+		struct page_tile *t = vis[ti - first_ti];
+		for (uint32_t r = 0; r < n; r++) {
+			uint32_t sy = dy + r;
+			if (g_screen.serial[sy] == t->serial && g_screen.row[sy] == (uint16_t)(off + r)) {
+				if (run_n) cfb_push_damage(fb->hdr, 0, y0 + run_y, fb->width, run_n);
+				run_n = 0;
+				continue;
 			}
+			uint32_t *dst = pixel_ptr(fb->pixels, fb->stride, 0, y0 + sy);
+			const uint32_t *src = t->pixels + (size_t)(off + r) * (size_t)fb->width;
+			for (uint32_t xx = 0; xx < fb->width; xx++) dst[xx] = src[xx];
+			g_screen.serial[sy] = t->serial;
+			g_screen.row[sy] = (uint16_t)(off + r);
+			if (run_n == 0) run_y = sy;
+			run_n++;
 		}
+		dy += n;
 	}
+	if (run_n) cfb_push_damage(fb->hdr, 0, y0 + run_y, fb->width, run_n);
+}
+
+uint32_t browser_ui_body_cols(uint32_t width)
+{
+	uint32_t w_px = (width > 16) ? (width - 16) : 0;
+	uint32_t max_cols = w_px / 8u;
+	if (max_cols > 255) max_cols = 255;
+	return max_cols;
+}
+
+uint32_t browser_ui_body_rows(uint32_t height)
+{
+	return (height > UI_CONTENT_Y0) ? (height - UI_CONTENT_Y0) / 16u : 0;
 }
 
 void browser_render_page(struct shm_fb *fb,
@@ -990,27 +1042,19 @@ void browser_render_page(struct shm_fb *fb,
 				const char *url_bar,
 				const char *status_bar,
 				const char *visible_text,
-				const struct html_links *links,
-				const struct html_spans *spans,
+				const struct html_style_runs *runs,
 				const struct html_inline_imgs *inline_imgs,
+				struct line_index *lines,
 				uint32_t scroll_rows)
 {
 	struct text_color dim = { .fg = 0xffb0b0b0u, .bg = 0, .opaque_bg = 0 };
 	struct text_color linkc = { .fg = 0xff6aa8ffu, .bg = 0, .opaque_bg = 0 };
-	browser_draw_ui(fb, active_host, url_bar, status_bar, "", "", "");
-	fill_rect_u32(fb->pixels,
-		      fb->stride,
-		      0,
-		      UI_TOPBAR_H,
-		      fb->width,
-		      (fb->height > UI_TOPBAR_H) ? (fb->height - UI_TOPBAR_H) : 0,
-		      0xff101014u);
-	uint32_t w_px = (fb->width > 16) ? (fb->width - 16) : 0;
+	draw_topbar(fb, active_host, url_bar, status_bar);
 	uint32_t y0 = UI_CONTENT_Y0;
 	uint32_t h_px = (fb->height > y0) ? (fb->height - y0) : 0;
 	if (!visible_text) visible_text = "";
-	draw_body_wrapped(fb, 8, y0, w_px, h_px, visible_text, links, spans, inline_imgs, dim, linkc, scroll_rows, active_host);
-	fb->hdr->frame_counter++;
+	draw_body_tiled(fb, y0, h_px, visible_text, runs, inline_imgs, lines, dim, linkc, scroll_rows, active_host);
+	shm_fb_present(fb);
 }
 
 static int text_layout_index_for_row_col_with_float_right(const char *text,
@@ -1129,6 +1173,7 @@ int browser_ui_try_link_click(uint32_t x,
 			     uint32_t width,
 			     const char *visible_text,
 			     const struct html_links *links,
+			     const struct line_index *lines,
 			     uint32_t scroll_rows,
 			     char *out_href,
 			     size_t out_href_len)
@@ -1136,17 +1181,29 @@ int browser_ui_try_link_click(uint32_t x,
 	if (!visible_text || !links || !out_href || out_href_len == 0) return 0;
 	if (y < UI_CONTENT_Y0) return 0;
 	if (x < 8) return 0;
-	uint32_t w_px = (width > 16) ? (width - 16) : 0;
-	uint32_t max_cols = (w_px / 8u);
+	uint32_t max_cols = browser_ui_body_cols(width);
 	if (max_cols == 0) max_cols = 1;
-	if (max_cols > 255) max_cols = 255;
 	uint32_t row = (y - UI_CONTENT_Y0) / 16u;
 	uint32_t col = (x - 8) / 8u;
 	row += scroll_rows;
-	size_t idx = 0;
-	if (text_layout_index_for_row_col_with_float_right(visible_text, max_cols, row, col, &idx) != 0) return 0;
-	if (idx > 0xffffffffu) return 0;
-	const char *href = links_href_at_index(links, (uint32_t)idx);
+	const char *href = 0;
+	int hit = -1;
+	if (lines && lines->valid && lines->text == visible_text && lines->max_cols == max_cols) {
+		/* Fast path: the tile showing this row recorded where its links were drawn. */
+		uint16_t li = 0;
+		hit = page_tiles_link_at(row, x, lines->gen, &li);
+		if (hit == 0) return 0;
+		if (hit == 1) {
+			if (li >= links->n) return 0;
+			href = links->links[li].href;
+		}
+	}
+	if (hit < 0) {
+		size_t idx = 0;
+		if (text_layout_index_for_row_col_with_float_right(visible_text, max_cols, row, col, &idx) != 0) return 0;
+		if (idx > 0xffffffffu) return 0;
+		href = links_href_at_index(links, (uint32_t)idx);
+	}
 	if (!href || href[0] == 0) return 0;
 	/* copy */
 	size_t o = 0;
@@ -3,6 +3,7 @@
 #include "browser_defs.h"
 #include "fb_shm.h"
 #include "html_text.h"
+#include "line_index.h"
 
 enum ui_action {
 	UI_NONE = 0,
@@ -21,23 +22,38 @@ void browser_draw_ui(struct shm_fb *fb,
 			    const char *line2,
 			    const char *line3);
 
+/* `runs` is the style-run table built with html_style_runs_build() after
+ * extraction. `lines` caches the row layout of `visible_text`; it is (re)built
+ * lazily when the content width changes or after line_index_reset().
+ */
 void browser_render_page(struct shm_fb *fb,
 				const char *active_host,
 				const char *url_bar,
 				const char *status_bar,
 				const char *visible_text,
-				const struct html_links *links,
-				const struct html_spans *spans,
+				const struct html_style_runs *runs,
 				const struct html_inline_imgs *inline_imgs,
+				struct line_index *lines,
 				uint32_t scroll_rows);
 
+/* Text columns and rows of the content area for a framebuffer of this size,
+ * as browser_render_page() lays the body out.
+ */
+uint32_t browser_ui_body_cols(uint32_t width);
+uint32_t browser_ui_body_rows(uint32_t height);
+
 enum ui_action browser_ui_action_from_click(const struct shm_fb *fb, uint32_t x, uint32_t y);
 
+/* Resolves a click in the content area to a link href. Uses the hit map the
+ * page tiles recorded while rendering when `lines` matches the drawn layout,
+ * otherwise lays the text out again to find the clicked character.
+ */
 int browser_ui_try_link_click(uint32_t x,
 			     uint32_t y,
 			     uint32_t width,
 			     const char *visible_text,
 			     const struct html_links *links,
+			     const struct line_index *lines,
 			     uint32_t scroll_rows,
 			     char *out_href,
 			     size_t out_href_len);
@@ -0,0 +1,380 @@
+#include "display_list.h"
+
+static void dl_pool_bind(struct dl_pool *p, struct dl_item *items, uint32_t cap_items, char *chars, uint32_t cap_chars,
+			 struct dl_image *images, uint32_t cap_images)
+{
+	p->items = items;
+	p->chars = chars;
+	p->images = images;
+	p->n_items = 0;
+	p->n_chars = 0;
+	p->n_images = 0;
+	p->cap_items = cap_items;
+	p->cap_chars = cap_chars;
+	p->cap_images = cap_images;
+}
+
+/* Copies `n` bytes plus a NUL into the char pool; returns the offset or -1. */
+static int64_t dl_put_chars(struct dl_pool *p, const char *s, size_t n)
+{
+	if (n + 1u > (size_t)(p->cap_chars - p->n_chars)) return -1;
+	uint32_t off = p->n_chars;
+	for (size_t i = 0; i < n; i++) p->chars[off + i] = s[i];
+	p->chars[off + n] = 0;
+	p->n_chars += (uint32_t)n + 1u;
+	return off;
+}
+
+static struct dl_item *dl_put_item(struct dl_pool *p, uint8_t op)
+{
+	if (p->n_items >= p->cap_items) return 0;
+	struct dl_item *it = &p->items[p->n_items++];
+	it->op = op;
+	it->flags = 0;
+	it->img = DL_NO_IMAGE;
+	return it;
+}
+
+/* Returns the image index, DL_NO_IMAGE for an empty URL, or -1 if full. */
+static int32_t dl_put_image(struct dl_pool *p, const char *url, size_t n)
+{
+	if (!url || n == 0) return DL_NO_IMAGE;
+	if (p->n_images >= p->cap_images) return -1;
+	struct dl_image *im = &p->images[p->n_images];
+	im->url = url;
+	im->url_len = (uint32_t)n;
+	im->ref.entry = 0;
+	im->ref.hash = 0;
+	return (int32_t)p->n_images++;
+}
+
+static int32_t dl_put_marker_image(struct dl_pool *p, const char *text, uint32_t marker)
+{
+	if (!text || marker == LINE_INDEX_NO_MARKER) return DL_NO_IMAGE;
+	struct img_marker m;
+	if (!line_index_parse_img_marker(text + marker, &m)) return DL_NO_IMAGE;
+	return dl_put_image(p, m.url, m.url_len);
+}
+
+struct dl_token {
+	uint32_t col;
+	uint16_t img;
+};
+
+/* Splits one laid-out line into text runs: a run ends where the style, the
+ * link or an inline "[img]" token boundary changes.
+ */
+static int dl_put_line(struct dl_pool *p, const struct dl_source *src, const char *line, size_t line_start,
+		       const struct dl_token *tokens, uint32_t n_tokens)
+{
+	const struct html_style_runs *runs = src->runs;
+	uint32_t n_runs = runs ? runs->n : 0;
+	uint32_t ri = html_style_runs_find(runs, (uint32_t)line_start);
+	uint32_t ti = 0;
+
+	struct dl_item *cur = 0;
+	uint32_t cur_key_fg = 0;
+	uint32_t seg_start = 0;
+	for (uint32_t i = 0; line[i]; i++) {
+		uint32_t idx = (uint32_t)(line_start + (size_t)i);
+		while (ri < n_runs && runs->runs[ri].end <= idx) ri++;
+		const struct html_style_run *run = (ri < n_runs && runs->runs[ri].start <= idx) ? &runs->runs[ri] : 0;
+		uint16_t link = run ? run->link : HTML_STYLE_RUN_NO_LINK;
+		int is_link = (link != HTML_STYLE_RUN_NO_LINK);
+		uint8_t flags = 0;
+		if (is_link) flags |= DL_TEXT_LINK;
+		if (run && run->bold) flags |= DL_TEXT_BOLD;
+		if (run && run->underline) flags |= DL_TEXT_UNDERLINE;
+		if (run && run->has_bg) flags |= DL_TEXT_BG;
+		uint32_t fg = (run && run->has_fg) ? run->fg_xrgb : (is_link ? src->colors.link_fg : src->colors.normal_fg);
+		uint32_t bg = run ? run->bg_xrgb : 0;
+
+		/* Inline image tokens are runs of their own. */
+		while (ti < n_tokens && tokens[ti].col + 5u <= i) ti++;
+		uint16_t img = DL_NO_IMAGE;
+		if (ti < n_tokens && tokens[ti].col <= i) {
+			flags |= DL_TEXT_IMG_TOKEN;
+			img = tokens[ti].img;
+		}
+		int token_start = (ti < n_tokens && tokens[ti].col == i);
+
+		if (!cur || token_start || cur->flags != flags || cur->img != img || cur->u.text.link != link ||
+		    cur_key_fg != fg || cur->u.text.bg != bg) {
+			if (cur) {
+				int64_t off = dl_put_chars(p, line + seg_start, i - seg_start);
+				if (off < 0) return -1;
+				cur->u.text.off = (uint32_t)off;
+				cur->u.text.len = (uint16_t)(i - seg_start);
+			}
+			cur = dl_put_item(p, DL_TEXT);
+			if (!cur) return -1;
+			cur->flags = flags;
+			cur->img = img;
+			cur->u.text.col = (uint16_t)i;
+			cur->u.text.link = link;
+			cur->u.text.bg = bg;
+			cur_key_fg = fg;
+			/* Bold plain text is drawn white so it stands out from the dim default. */
+			cur->u.text.fg = ((flags & DL_TEXT_BOLD) && !is_link && !(run && run->has_fg)) ? 0xffffffffu : fg;
+			seg_start = i;
+		}
+	}
+	if (cur) {
+		uint32_t end = seg_start;
+		while (line[end]) end++;
+		int64_t off = dl_put_chars(p, line + seg_start, end - seg_start);
+		if (off < 0) return -1;
+		cur->u.text.off = (uint32_t)off;
+		cur->u.text.len = (uint16_t)(end - seg_start);
+	}
+	return 0;
+}
+
+/* Collects the "[img]" tokens of a line that have an inline image URL. */
+static int dl_line_tokens(struct dl_pool *p, const struct dl_source *src, const char *line, size_t start,
+			  struct dl_token *out, uint32_t *out_n)
+{
+	uint32_t n = 0;
+	const struct html_inline_imgs *inl = src->inline_imgs;
+	if (inl && inl->n > 0) {
+		size_t line_len = 0;
+		while (line[line_len]) line_len++;
+		for (uint32_t ii = 0; ii < inl->n && n < (uint32_t)DL_MAX_INLINE_PER_ROW; ii++) {
+			const struct html_inline_img *im = &inl->imgs[ii];
+			if (im->url[0] == 0) continue;
+			if (im->start < start) continue;
+			size_t rel = (size_t)(im->start - (uint32_t)start);
+			if (rel + 5u > line_len) continue;
+			if (!(line[rel + 0] == '[' && line[rel + 1] == 'i' && line[rel + 2] == 'm' && line[rel + 3] == 'g' && line[rel + 4] == ']')) continue;
+			size_t ul = 0;
+			while (im->url[ul]) ul++;
+			int32_t img = dl_put_image(p, im->url, ul);
+			if (img < 0) return -1;
+			/* Keep tokens sorted by column (the image table is in source order). */
+			uint32_t k = n;
+			while (k > 0 && out[k - 1u].col > (uint32_t)rel) {
+				out[k] = out[k - 1u];
+				k--;
+			}
+			out[k].col = (uint32_t)rel;
+			out[k].img = (uint16_t)img;
+			n++;
+		}
+	}
+	*out_n = n;
+	return 0;
+}
+
+static struct dl_item *dl_put_box(struct dl_pool *p, uint8_t op, int32_t img, uint32_t rows_total, uint32_t row_in_box, uint32_t cols)
+{
+	struct dl_item *it = dl_put_item(p, op);
+	if (!it) return 0;
+	it->img = (uint16_t)img;
+	it->u.box.rows_total = (uint16_t)rows_total;
+	it->u.box.row_in_box = (uint16_t)row_in_box;
+	it->u.box.cols = (uint16_t)cols;
+	it->u.box.label_off = 0;
+	return it;
+}
+
+/* Lays out rows [first_row, first_row + n_rows) the same way the renderer
+ * used to while drawing. Returns the rows that exist, or -1 if `p` is full.
+ */
+static int32_t dl_build_rows(struct dl_pool *p,
+			     struct dl_row *rows,
+			     struct line_index *lines,
+			     const struct dl_source *src,
+			     uint32_t first_row,
+			     uint32_t n_rows)
+{
+	const char *text = src->text;
+	uint32_t max_cols = src->max_cols;
+	struct {
+		uint8_t active;
+		uint32_t rows_total;
+		uint32_t row_in_box;
+		int32_t img;
+	} img_box = {0};
+	struct {
+		uint8_t active;
+		uint32_t rows_total;
+		uint32_t row_in_box;
+		uint32_t cols_total;
+		int32_t img;
+	} float_box = {0};
+
+	struct line_state ls;
+	if (line_index_seek(lines, text, max_cols, first_row, &ls) != 0) return 0;
+	size_t pos = ls.pos;
+	if (ls.img_active) {
+		img_box.active = 1;
+		img_box.rows_total = ls.img_rows_total;
+		img_box.row_in_box = ls.img_row_in_box;
+		img_box.img = dl_put_marker_image(p, text, ls.img_marker);
+		if (img_box.img < 0) return -1;
+	}
+	if (ls.float_active) {
+		float_box.active = 1;
+		float_box.rows_total = ls.float_rows_total;
+		float_box.row_in_box = ls.float_row_in_box;
+		float_box.cols_total = ls.float_cols;
+		float_box.img = dl_put_marker_image(p, text, ls.float_marker);
+		if (float_box.img < 0) return -1;
+	}
+
+	char line[1024];
+	uint32_t row = 0;
+	for (; row < n_rows; row++) {
+		struct dl_row *out = &rows[row];
+		out->first = p->n_items;
+		out->n = 0;
+
+		size_t start = 0;
+		uint32_t use_cols = max_cols;
+		if (float_box.active) use_cols = line_index_float_text_cols(max_cols, float_box.cols_total);
+		if (text_layout_next_line_ex(text, &pos, use_cols, line, sizeof(line), &start) != 0) break;
+
+		/* Inside a block image (below its marker row): one slice, no text. */
+		if (img_box.active) {
+			if (!dl_put_box(p, DL_IMG_SLICE, img_box.img, img_box.rows_total, img_box.row_in_box, 0)) return -1;
+			img_box.row_in_box++;
+			if (img_box.row_in_box >= img_box.rows_total) img_box.active = 0;
+			out->n = p->n_items - out->first;
+			continue;
+		}
+
+		if (float_box.active) {
+			if (!dl_put_box(p, DL_FLOAT_SLICE, float_box.img, float_box.rows_total, float_box.row_in_box, float_box.cols_total)) return -1;
+		}
+
+		/* Marker rows are never wrapped, so parse them in place: image URLs
+		 * must point into the text, not into `line`.
+		 */
+		struct img_marker m;
+		if (line[0] == (char)0x1e && line_index_parse_img_marker(text + start, &m)) {
+			uint32_t rows_total = m.rows;
+			if (rows_total < 2u) rows_total = 2u;
+			if (rows_total > 200u) rows_total = 200u;
+			int32_t img = dl_put_image(p, m.url, m.url_len);
+			if (img < 0) return -1;
+			if (m.float_cols > 0) {
+				uint32_t fcols = m.float_cols;
+				if (fcols < 6u) fcols = 6u;
+				if (fcols > 80u) fcols = 80u;
+				struct dl_item *it = dl_put_box(p, DL_FLOAT_LABEL, img, rows_total, 0, fcols);
+				if (!it) return -1;
+				int64_t loff = dl_put_chars(p, m.label, m.label_len);
+				if (loff < 0) return -1;
+				it->u.box.label_off = (uint32_t)loff;
+
+				/* Label row is this row; the first pixel slice is on the next one.
+				 * The marker row counts as row 0 of the box, matching line_index_step().
+				 */
+				float_box.active = 1;
+				float_box.rows_total = rows_total;
+				float_box.cols_total = fcols;
+				float_box.row_in_box = 1;
+				float_box.img = img;
+
+				/* The next text line is drawn alongside the label, unstyled by
+				 * inline images.
+				 */
+				uint32_t use_cols2 = line_index_float_text_cols(max_cols, fcols);
+				size_t start2 = 0;
+				line[0] = 0;
+				(void)text_layout_next_line_ex(text, &pos, use_cols2, line, sizeof(line), &start2);
+				if (dl_put_line(p, src, line, start2, 0, 0) != 0) return -1;
+				out->n = p->n_items - out->first;
+				continue;
+			}
+
+			/* Block placeholder: the marker row draws the top slice. */
+			if (!dl_put_box(p, DL_IMG_SLICE, img, rows_total, 0, 0)) return -1;
+			p->items[p->n_items - 1u].flags = DL_BOX_MARKER;
+			img_box.active = 1;
+			img_box.rows_total = rows_total;
+			img_box.row_in_box = 1;
+			img_box.img = img;
+			out->n = p->n_items - out->first;
+			continue;
+		}
+
+		struct dl_token tokens[DL_MAX_INLINE_PER_ROW];
+		uint32_t n_tokens = 0;
+		if (dl_line_tokens(p, src, line, start, tokens, &n_tokens) != 0) return -1;
+		if (dl_put_line(p, src, line, start, tokens, n_tokens) != 0) return -1;
+
+		if (float_box.active) {
+			float_box.row_in_box++;
+			if (float_box.row_in_box >= float_box.rows_total) float_box.active = 0;
+		}
+		out->n = p->n_items - out->first;
+	}
+	return (int32_t)row;
+}
+
+static void dl_drop_blocks(struct display_list *dl)
+{
+	if (++dl->epoch == 0) {
+		for (uint32_t i = 0; i < (uint32_t)DL_MAX_BLOCKS; i++) dl->block_epoch[i] = 0;
+		dl->epoch = 1;
+	}
+	dl_pool_bind(&dl->pool, dl->items, DL_MAX_ITEMS, dl->chars, DL_MAX_CHARS, dl->images, DL_MAX_IMAGES);
+}
+
+void dl_reset(struct display_list *dl)
+{
+	if (!dl) return;
+	dl->valid = 0;
+}
+
+const struct dl_row *dl_ensure_block(struct display_list *dl,
+				     struct line_index *lines,
+				     const struct dl_source *src,
+				     uint32_t row,
+				     uint32_t *out_n)
+{
+	if (!dl || !lines || !src || !src->text || !out_n) return 0;
+	uint32_t b = row / (uint32_t)DL_BLOCK_ROWS;
+	if (b >= (uint32_t)DL_MAX_BLOCKS) return 0;
+
+	line_index_ensure(lines, src->text, src->max_cols);
+	if (!dl->valid || dl->layout_gen != lines->gen || dl->text != src->text || dl->max_cols != src->max_cols ||
+	    dl->runs != src->runs || dl->inline_imgs != src->inline_imgs ||
+	    dl->colors.normal_fg != src->colors.normal_fg || dl->colors.link_fg != src->colors.link_fg) {
+		dl->valid = 1;
+		dl->layout_gen = lines->gen;
+		dl->text = src->text;
+		dl->max_cols = src->max_cols;
+		dl->runs = src->runs;
+		dl->inline_imgs = src->inline_imgs;
+		dl->colors = src->colors;
+		dl_drop_blocks(dl);
+	}
+
+	struct dl_row *rows = &dl->rows[b * (uint32_t)DL_BLOCK_ROWS];
+	if (dl->block_epoch[b] != dl->epoch) {
+		int32_t n = dl_build_rows(&dl->pool, rows, lines, src, b * (uint32_t)DL_BLOCK_ROWS, DL_BLOCK_ROWS);
+		if (n < 0) {
+			/* Pools full: drop every block and build this one alone. */
+			dl_drop_blocks(dl);
+			n = dl_build_rows(&dl->pool, rows, lines, src, b * (uint32_t)DL_BLOCK_ROWS, DL_BLOCK_ROWS);
+			if (n < 0) return 0;
+		}
+		dl->block_rows[b] = (uint8_t)n;
+		dl->block_epoch[b] = dl->epoch;
+	}
+	*out_n = dl->block_rows[b];
+	return rows;
+}
+
+uint32_t dl_build_block(struct dl_block *out,
+			struct line_index *lines,
+			const struct dl_source *src,
+			uint32_t first_row)
+{
+	if (!out || !src || !src->text) return 0;
+	dl_pool_bind(&out->pool, out->items, DL_BLOCK_MAX_ITEMS, out->chars, DL_BLOCK_MAX_CHARS, out->images, DL_BLOCK_MAX_IMAGES);
+	int32_t n = dl_build_rows(&out->pool, out->rows, lines, src, first_row, DL_BLOCK_ROWS);
+	return (n < 0) ? 0 : (uint32_t)n;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "browser_img.h"
+#include "html_text.h"
+#include "line_index.h"
+
+/*
+ * Display list for the wrapped page body.
+ *
+ * Turning the visible-text stream into pixels used to mean, for every tile:
+ * re-running the line layout, re-parsing the image marker rows
+ * (0x1e "IMG <rows> <token> <label>" 0x1f "<url>"), recomputing float columns
+ * and splitting each line into style segments. The display list records the
+ * outcome once per layout: per visual row, a short list of text runs (with
+ * resolved colors, bold/underline/background flags and link index) and image
+ * boxes. The renderer only replays it.
+ *
+ * Anything that depends on image state (format, dimensions, pixels) is
+ * resolved at replay time through dl_image references, so image loads do not
+ * invalidate the list.
+ *
+ * Rows are built on demand in blocks of DL_BLOCK_ROWS, starting from the line
+ * index checkpoint of the block's first row. The pools are bounded; when one
+ * fills up every block is dropped and rebuilt lazily.
+ */
+
+enum {
+	DL_BLOCK_ROWS = 16,
+	DL_MAX_BLOCKS = LINE_INDEX_MAX_ROWS / DL_BLOCK_ROWS,
+	DL_MAX_ITEMS = 128 * 1024,
+	DL_MAX_CHARS = 1024 * 1024,
+	DL_MAX_IMAGES = 4096,
+	/* Enough for any single block: every column its own run, plus boxes. */
+	DL_BLOCK_MAX_ITEMS = DL_BLOCK_ROWS * 260,
+	DL_BLOCK_MAX_CHARS = DL_BLOCK_ROWS * 1600,
+	DL_BLOCK_MAX_IMAGES = DL_BLOCK_ROWS * 36,
+	DL_NO_IMAGE = 0xffff,
+	DL_MAX_INLINE_PER_ROW = 32,
+};
+
+enum dl_op {
+	DL_TEXT = 1,     /* styled text run */
+	DL_IMG_SLICE,    /* one 16px row of a block image box */
+	DL_FLOAT_SLICE,  /* one 16px row of a float-right image box */
+	DL_FLOAT_LABEL,  /* marker row of a float-right box: frame + label */
+};
+
+enum {
+	DL_TEXT_LINK = 1u << 0,
+	DL_TEXT_BOLD = 1u << 1,
+	DL_TEXT_UNDERLINE = 1u << 2,
+	DL_TEXT_BG = 1u << 3,
+	DL_TEXT_IMG_TOKEN = 1u << 4, /* "[img]": replaced by the icon once it has pixels */
+	DL_BOX_MARKER = 1u << 0,     /* DL_IMG_SLICE on the marker row (top of the box) */
+};
+
+/* Image referenced by the list. `url` points into the page text or the
+ * inline image table (not NUL-terminated); `ref` caches the image cache entry
+ * between replays.
+ */
+struct dl_image {
+	const char *url;
+	uint32_t url_len;
+	struct img_ref ref;
+};
+
+struct dl_item {
+	uint8_t op;
+	uint8_t flags;
+	uint16_t img; /* index into the image pool, or DL_NO_IMAGE */
+	union {
+		struct {
+			uint16_t col;  /* first column */
+			uint16_t len;  /* characters */
+			uint16_t link; /* html_links index or HTML_STYLE_RUN_NO_LINK */
+			uint32_t off;  /* NUL-terminated characters in the char pool */
+			uint32_t fg;
+			uint32_t bg;
+		} text;
+		struct {
+			uint16_t rows_total;
+			uint16_t row_in_box;
+			uint16_t cols;      /* float width in columns (6..80) */
+			uint32_t label_off; /* DL_FLOAT_LABEL: NUL-terminated label */
+		} box;
+	} u;
+};
+
+struct dl_row {
+	uint32_t first;
+	uint32_t n;
+};
+
+/* Item, character and image storage shared by a set of rows. */
+struct dl_pool {
+	struct dl_item *items;
+	char *chars;
+	struct dl_image *images;
+	uint32_t n_items;
+	uint32_t n_chars;
+	uint32_t n_images;
+	uint32_t cap_items;
+	uint32_t cap_chars;
+	uint32_t cap_images;
+};
+
+/* Text colors runs are resolved against. */
+struct dl_colors {
+	uint32_t normal_fg;
+	uint32_t link_fg;
+};
+
+struct dl_source {
+	const char *text;
+	uint32_t max_cols;
+	const struct html_style_runs *runs;          /* may be NULL */
+	const struct html_inline_imgs *inline_imgs;  /* may be NULL */
+	struct dl_colors colors;
+};
+
+/* Cached list for one layout (see dl_ensure_block()). */
+struct display_list {
+	const char *text;
+	uint32_t max_cols;
+	uint32_t layout_gen;
+	const struct html_style_runs *runs;
+	const struct html_inline_imgs *inline_imgs;
+	struct dl_colors colors;
+	uint8_t valid;
+	uint32_t epoch;                      /* block b is built iff block_epoch[b] == epoch */
+	uint32_t block_epoch[DL_MAX_BLOCKS];
+	uint8_t block_rows[DL_MAX_BLOCKS];   /* rows of the block that exist */
+	struct dl_pool pool;
+	struct dl_row rows[LINE_INDEX_MAX_ROWS];
+	struct dl_item items[DL_MAX_ITEMS];
+	struct dl_image images[DL_MAX_IMAGES];
+	char chars[DL_MAX_CHARS];
+};
+
+/* Uncached single block, for rows the cached list cannot hold. */
+struct dl_block {
+	struct dl_pool pool;
+	struct dl_row rows[DL_BLOCK_ROWS];
+	struct dl_item items[DL_BLOCK_MAX_ITEMS];
+	struct dl_image images[DL_BLOCK_MAX_IMAGES];
+	char chars[DL_BLOCK_MAX_CHARS];
+};
+
+/* Drops every block; the next dl_ensure_block() rebuilds on demand. */
+void dl_reset(struct display_list *dl);
+
+/* Builds (if needed) the block holding document row `row` for the current
+ * layout of `lines` and returns its rows, or NULL if `row` is past
+ * LINE_INDEX_MAX_ROWS or the pools cannot hold the block. *out_n receives the
+ * number of rows of the block that exist (fewer at the end of the text).
+ */
+const struct dl_row *dl_ensure_block(struct display_list *dl,
+				     struct line_index *lines,
+				     const struct dl_source *src,
+				     uint32_t row,
+				     uint32_t *out_n);
+
+/* Builds rows [first_row, first_row + DL_BLOCK_ROWS) into `out` without
+ * caching. `lines` may be NULL. Returns the rows built.
+ */
+uint32_t dl_build_block(struct dl_block *out,
+			struct line_index *lines,
+			const struct dl_source *src,
+			uint32_t first_row);
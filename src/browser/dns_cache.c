@@ -0,0 +1,127 @@
+#include "dns_cache.h"
+
+struct dns_cache_entry {
+	uint32_t seq; /* even: stable, odd: being written */
+	uint32_t hash;
+	uint64_t expires_ms; /* CLOCK_MONOTONIC; 0 = empty */
+	uint16_t qtype;
+	uint8_t negative;
+	uint8_t addr_len;
+	uint8_t addr[16];
+	char name[DNS_CACHE_NAME_MAX];
+};
+
+static struct dns_cache_entry *g_dns_cache;
+
+static uint8_t dns_cache_lower(uint8_t c)
+{
+	return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + 32u) : c;
+}
+
+/* FNV-1a over the lowercased name; returns 0 if the name does not fit. */
+static uint32_t dns_cache_hash(const char *name, size_t *out_len)
+{
+	uint32_t h = 2166136261u;
+	size_t n = 0;
+	while (name[n]) {
+		if (n + 1 >= DNS_CACHE_NAME_MAX) return 0;
+		h ^= dns_cache_lower((uint8_t)name[n]);
+		h *= 16777619u;
+		n++;
+	}
+	*out_len = n;
+	return h ? h : 1u;
+}
+
+static int dns_cache_name_eq(const char *stored, const char *name, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (dns_cache_lower((uint8_t)stored[i]) != dns_cache_lower((uint8_t)name[i])) return 0;
+	}
+	return stored[len] == 0;
+}
+
+int dns_cache_init(void)
+{
+	if (g_dns_cache) return 0;
+	void *p = sys_mmap(0, sizeof(struct dns_cache_entry) * (size_t)DNS_CACHE_ENTRIES, PROT_READ | PROT_WRITE,
+			   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED) return -1;
+	/* Fresh anonymous pages are zero: every entry starts empty. */
+	g_dns_cache = (struct dns_cache_entry *)p;
+	return 0;
+}
+
+enum dns_cache_result dns_cache_lookup(const char *name, uint16_t qtype, uint64_t now_ms, uint8_t *out, size_t out_len)
+{
+	if (!g_dns_cache || !name) return DNS_CACHE_MISS;
+	size_t len = 0;
+	uint32_t h = dns_cache_hash(name, &len);
+	if (!h) return DNS_CACHE_MISS;
+	for (uint32_t i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		struct dns_cache_entry *e = &g_dns_cache[i];
+		uint32_t seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1u) continue;
+		if (e->hash != h || e->qtype != qtype) continue;
+		if (!dns_cache_name_eq(e->name, name, len)) continue;
+		uint64_t expires = e->expires_ms;
+		uint8_t negative = e->negative;
+		uint8_t alen = e->addr_len;
+		uint8_t addr[16];
+		c_memcpy(addr, e->addr, sizeof(addr));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&e->seq, __ATOMIC_RELAXED) != seq) continue;
+		if (now_ms >= expires) return DNS_CACHE_MISS;
+		if (negative) return DNS_CACHE_NEGATIVE;
+		if (alen != out_len) return DNS_CACHE_MISS;
+		c_memcpy(out, addr, out_len);
+		return DNS_CACHE_HIT;
+	}
+	return DNS_CACHE_MISS;
+}
+
+void dns_cache_store(const char *name, uint16_t qtype, uint64_t now_ms, uint32_t ttl_s, const uint8_t *addr, size_t addr_len)
+{
+	if (!g_dns_cache || !name || ttl_s == 0 || addr_len > 16u) return;
+	uint32_t cap = addr ? (uint32_t)DNS_CACHE_MAX_TTL_S : (uint32_t)DNS_CACHE_MAX_NEG_TTL_S;
+	if (ttl_s > cap) ttl_s = cap;
+	size_t len = 0;
+	uint32_t h = dns_cache_hash(name, &len);
+	if (!h) return;
+
+	/* Same key first, then an expired slot, then the one expiring soonest. */
+	struct dns_cache_entry *pick = 0;
+	uint32_t pick_seq = 0;
+	int pick_rank = 0;
+	for (uint32_t i = 0; i < DNS_CACHE_ENTRIES; i++) {
+		struct dns_cache_entry *e = &g_dns_cache[i];
+		uint32_t seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1u) continue;
+		int rank;
+		if (e->hash == h && e->qtype == qtype && dns_cache_name_eq(e->name, name, len)) {
+			rank = 3;
+		} else if (e->expires_ms <= now_ms) {
+			rank = 2;
+		} else {
+			rank = 1;
+		}
+		if (!pick || rank > pick_rank || (rank == 1 && pick_rank == 1 && e->expires_ms < pick->expires_ms)) {
+			pick = e;
+			pick_seq = seq;
+			pick_rank = rank;
+			if (rank == 3) break;
+		}
+	}
+	if (!pick) return;
+	/* Another process may be writing the same slot; then it is simply not cached. */
+	if (!__atomic_compare_exchange_n(&pick->seq, &pick_seq, pick_seq + 1u, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) return;
+	pick->hash = h;
+	pick->qtype = qtype;
+	pick->negative = addr ? 0 : 1;
+	pick->addr_len = (uint8_t)addr_len;
+	c_memset(pick->addr, 0, sizeof(pick->addr));
+	if (addr) c_memcpy(pick->addr, addr, addr_len);
+	c_memcpy(pick->name, name, len + 1u);
+	pick->expires_ms = now_ms + (uint64_t)ttl_s * 1000u;
+	__atomic_store_n(&pick->seq, pick_seq + 2u, __ATOMIC_RELEASE);
+}
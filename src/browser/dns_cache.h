@@ -0,0 +1,42 @@
+#pragma once
+
+#include "util.h"
+
+/*
+ * Bounded DNS answer cache in a MAP_SHARED segment.
+ *
+ * dns_cache_init() must run before the image workers are forked; the
+ * browser and every worker then see the same entries, so a host resolved
+ * once (by navigation, a redirect or any worker) is not queried again until
+ * its TTL runs out. Failed lookups (NXDOMAIN, or no record of that type) are
+ * cached too, for the SOA minimum TTL of the answer.
+ *
+ * Any process may be SIGKILLed at any time (img_workers_cancel_all()), so
+ * there are no locks: each entry is a seqlock that a writer claims with a
+ * CAS. A writer killed mid-update leaves its slot odd, which only costs one
+ * slot. Without dns_cache_init() every call is a miss and stores are dropped.
+ */
+
+enum {
+	DNS_CACHE_ENTRIES = 64,
+	DNS_CACHE_NAME_MAX = 128,
+	DNS_CACHE_MAX_TTL_S = 3600,
+	DNS_CACHE_NEG_TTL_S = 30,      /* negative answers without an SOA */
+	DNS_CACHE_MAX_NEG_TTL_S = 300,
+};
+
+enum dns_cache_result {
+	DNS_CACHE_MISS = 0,
+	DNS_CACHE_HIT,      /* address copied out */
+	DNS_CACHE_NEGATIVE, /* name/type known not to resolve */
+};
+
+int dns_cache_init(void);
+
+/* Looks up (name, qtype). On DNS_CACHE_HIT copies out_len address bytes. */
+enum dns_cache_result dns_cache_lookup(const char *name, uint16_t qtype, uint64_t now_ms, uint8_t *out, size_t out_len);
+
+/* Remembers an answer for ttl_s seconds (clamped). addr == NULL stores a
+ * negative answer. A TTL of 0 means "do not cache".
+ */
+void dns_cache_store(const char *name, uint16_t qtype, uint64_t now_ms, uint32_t ttl_s, const uint8_t *addr, size_t addr_len);
@@ -2,6 +2,16 @@
 
 #include "../core/cfb.h"
 
+/*
+ * Producer side of /dev/shm/cfb0.
+ *
+ * `pixels` always points at the buffer being drawn. With more than one
+ * buffer it is a back buffer the viewer never reads; shm_fb_present()
+ * publishes it and moves drawing to the next buffer. Incremental drawing
+ * relies on every pixel write being reported with cfb_push_damage(): the
+ * next back buffer is brought up to date by copying the rects it missed
+ * from the new front buffer.
+ */
 struct shm_fb {
 	struct cfb_header *hdr;
 	void *base;
@@ -11,41 +21,27 @@ struct shm_fb {
 	uint32_t stride;
 	uint32_t *pixels;
 	int fd;
+	uint32_t nbuf;
+	uint32_t back;
+	uint32_t *bufs[CFB_MAX_BUFFERS];
+	uint32_t buf_wpos[CFB_MAX_BUFFERS]; /* damage_wpos each buffer is complete up to */
 };
 
-static inline int shm_fb_open(struct shm_fb *out, uint32_t width, uint32_t height)
+/* Initializes the header and buffer pointers over an already mapped region
+ * of sizeof(struct cfb_header) + nbuf * cfb_pixel_bytes(width, height) bytes.
+ */
+static inline void shm_fb_init(struct shm_fb *out, void *mapped, size_t total_size, int fd, uint32_t width, uint32_t height, uint32_t nbuf)
 {
-	const char *path = "/dev/shm/cfb0";
 	uint32_t stride = width * 4u;
-	size_t total_size = sizeof(struct cfb_header) + cfb_pixel_bytes(width, height);
-
-	int fd = sys_openat(AT_FDCWD, path, O_CREAT | O_RDWR, 0666);
-	if (fd < 0) {
-		dbg_write("openat /dev/shm/cfb0 failed\n");
-		return -1;
-	}
-	if (sys_ftruncate(fd, (off_t)total_size) < 0) {
-		dbg_write("ftruncate failed\n");
-		sys_close(fd);
-		return -1;
-	}
-
-	void *mapped = sys_mmap(0, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-	if (mapped == MAP_FAILED) {
-		dbg_write("mmap failed\n");
-		sys_close(fd);
-		return -1;
-	}
-
 	struct cfb_header *hdr = (struct cfb_header *)mapped;
 	hdr->magic = CFB_MAGIC;
-	hdr->version = 3;
+	hdr->version = 7;
 	hdr->width = width;
 	hdr->height = height;
 	hdr->stride_bytes = stride;
 	hdr->format = CFB_FORMAT_XRGB8888;
 	hdr->reserved0 = 0;
-	hdr->reserved1 = 0;
+	hdr->wake_seq = 0;
 	/* Initialize optional input fields to 0. */
 	hdr->input_counter = 0;
 	hdr->mouse_x = 0;
@@ -64,6 +60,12 @@ static inline int shm_fb_open(struct shm_fb *out, uint32_t width, uint32_t heigh
 	}
 	hdr->reserved2 = 0;
 	hdr->reserved3 = 0;
+	hdr->damage_wpos = 0;
+	hdr->reserved5 = 0;
+	hdr->buffer_count = nbuf;
+	hdr->front_index = 0;
+	hdr->front_damage_wpos = 0;
+	hdr->present_seq = 0;
 
 	out->hdr = hdr;
 	out->base = mapped;
@@ -71,7 +73,97 @@ static inline int shm_fb_open(struct shm_fb *out, uint32_t width, uint32_t heigh
 	out->width = width;
 	out->height = height;
 	out->stride = stride;
-	out->pixels = (uint32_t *)((uint8_t *)mapped + sizeof(struct cfb_header));
 	out->fd = fd;
+	out->nbuf = nbuf;
+	for (uint32_t i = 0; i < nbuf; i++) {
+		out->bufs[i] = (uint32_t *)((uint8_t *)mapped + sizeof(struct cfb_header) + (size_t)i * cfb_pixel_bytes(width, height));
+		out->buf_wpos[i] = 0;
+	}
+	/* The viewer shows buffer 0 until the first present. */
+	out->back = (nbuf > 1u) ? 1u : 0u;
+	out->pixels = out->bufs[out->back];
+}
+
+static inline int shm_fb_open(struct shm_fb *out, uint32_t width, uint32_t height, uint32_t nbuf)
+{
+	const char *path = "/dev/shm/cfb0";
+	if (nbuf < 1u) nbuf = 1u;
+	if (nbuf > CFB_MAX_BUFFERS) nbuf = CFB_MAX_BUFFERS;
+	size_t total_size = sizeof(struct cfb_header) + (size_t)nbuf * cfb_pixel_bytes(width, height);
+
+	int fd = sys_openat(AT_FDCWD, path, O_CREAT | O_RDWR, 0666);
+	if (fd < 0) {
+		dbg_write("openat /dev/shm/cfb0 failed\n");
+		return -1;
+	}
+	if (sys_ftruncate(fd, (off_t)total_size) < 0) {
+		dbg_write("ftruncate failed\n");
+		sys_close(fd);
+		return -1;
+	}
+
+	void *mapped = sys_mmap(0, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (mapped == MAP_FAILED) {
+		dbg_write("mmap failed\n");
+		sys_close(fd);
+		return -1;
+	}
+
+	shm_fb_init(out, mapped, total_size, fd, width, height, nbuf);
 	return 0;
 }
+
+static inline void shm_fb_copy_rect(struct shm_fb *fb, uint32_t *dst, const uint32_t *src, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+	if (x >= fb->width || y >= fb->height) return;
+	if (w > fb->width - x) w = fb->width - x;
+	if (h > fb->height - y) h = fb->height - y;
+	uint32_t pitch = fb->stride / 4u;
+	for (uint32_t yy = 0; yy < h; yy++) {
+		uint32_t *d = dst + (size_t)(y + yy) * pitch + x;
+		const uint32_t *s = src + (size_t)(y + yy) * pitch + x;
+		for (uint32_t xx = 0; xx < w; xx++) d[xx] = s[xx];
+	}
+}
+
+/* Copies into `dst` every rect damaged in `src` between damage positions
+ * `from` and `to`, or the whole frame if the ring no longer holds them.
+ */
+static inline void shm_fb_catch_up(struct shm_fb *fb, uint32_t *dst, const uint32_t *src, uint32_t from, uint32_t to)
+{
+	if (from == to) return;
+	if (to - from > CFB_DAMAGE_RING_SIZE) {
+		shm_fb_copy_rect(fb, dst, src, 0, 0, fb->width, fb->height);
+		return;
+	}
+	for (uint32_t i = from; i != to; i++) {
+		const struct cfb_damage_rect *r = &fb->hdr->damage[i % CFB_DAMAGE_RING_SIZE];
+		shm_fb_copy_rect(fb, dst, src, r->x, r->y, r->w, r->h);
+	}
+}
+
+/* Publishes the frame drawn so far. With multiple buffers the back buffer
+ * becomes the front buffer and drawing moves to the next one. Never waits
+ * for the consumer.
+ */
+static inline void shm_fb_present(struct shm_fb *fb)
+{
+	struct cfb_header *hdr = fb->hdr;
+	uint32_t wpos = hdr->damage_wpos;
+	uint32_t seq = hdr->present_seq;
+
+	__atomic_store_n(&hdr->present_seq, seq + 1u, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&hdr->front_index, fb->back, __ATOMIC_RELAXED);
+	__atomic_store_n(&hdr->front_damage_wpos, wpos, __ATOMIC_RELAXED);
+	__atomic_store_n(&hdr->present_seq, seq + 2u, __ATOMIC_RELEASE);
+	hdr->frame_counter++;
+
+	if (fb->nbuf < 2u) return;
+	const uint32_t *front = fb->bufs[fb->back];
+	fb->buf_wpos[fb->back] = wpos;
+	fb->back = (fb->back + 1u) % fb->nbuf;
+	fb->pixels = fb->bufs[fb->back];
+	shm_fb_catch_up(fb, fb->pixels, front, fb->buf_wpos[fb->back], wpos);
+	fb->buf_wpos[fb->back] = wpos;
+}
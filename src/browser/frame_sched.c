@@ -0,0 +1,36 @@
+#include "frame_sched.h"
+
+void frame_sched_init(struct frame_sched *fs, uint64_t budget_ns)
+{
+	fs->budget_ns = budget_ns ? budget_ns : (uint64_t)FRAME_SCHED_BUDGET_60HZ_NS;
+	fs->next_ns = 0;
+	fs->frames = 0;
+	fs->dropped = 0;
+	fs->pending = 0;
+}
+
+void frame_sched_request(struct frame_sched *fs)
+{
+	fs->pending++;
+}
+
+int frame_sched_begin(struct frame_sched *fs, uint64_t now_ns, uint64_t *wait_ns)
+{
+	if (!fs->pending) return 0;
+	if (now_ns < fs->next_ns) {
+		if (wait_ns) *wait_ns = fs->next_ns - now_ns;
+		return 0;
+	}
+	fs->pending = 0;
+	return 1;
+}
+
+void frame_sched_end(struct frame_sched *fs, uint64_t start_ns, uint64_t end_ns)
+{
+	uint64_t took = (end_ns > start_ns) ? (end_ns - start_ns) : 0;
+	/* Every whole budget the render ran over is a slot we did not make. */
+	uint64_t missed = took ? (took - 1u) / fs->budget_ns : 0;
+	fs->frames++;
+	fs->dropped += missed;
+	fs->next_ns = start_ns + (missed + 1u) * fs->budget_ns;
+}
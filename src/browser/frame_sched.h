@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../core/syscall.h"
+
+/*
+ * Frame pacing for the event loop.
+ *
+ * Input handlers only update state and call frame_sched_request(); the loop
+ * renders once per frame slot when frame_sched_begin() says so. Requests that
+ * arrive while a frame is not yet due are folded into that one frame, so a
+ * wheel spin or a burst of keys costs one render per budget_ns at most.
+ *
+ * A render that runs past its budget skips the slots it overran instead of
+ * rendering back to back to catch up; those skipped slots are counted in
+ * `dropped`. All times are CLOCK_MONOTONIC nanoseconds.
+ */
+
+enum {
+	FRAME_SCHED_BUDGET_60HZ_NS = 16666667,
+};
+
+struct frame_sched {
+	uint64_t budget_ns; /* target frame time */
+	uint64_t next_ns;   /* earliest start of the next frame */
+	uint64_t frames;    /* frames rendered */
+	uint64_t dropped;   /* frame slots lost to overrunning renders */
+	uint32_t pending;   /* requests folded into the next frame */
+};
+
+void frame_sched_init(struct frame_sched *fs, uint64_t budget_ns);
+
+/* Something visible changed; render it with the next frame. */
+void frame_sched_request(struct frame_sched *fs);
+
+/* Returns 1 (and consumes the pending requests) if a frame should be rendered
+ * now. Otherwise returns 0 and, if a frame is pending, sets *wait_ns to the
+ * time until it is due; *wait_ns is left alone when nothing is pending.
+ */
+int frame_sched_begin(struct frame_sched *fs, uint64_t now_ns, uint64_t *wait_ns);
+
+/* Ends the frame started at start_ns and schedules the next slot. */
+void frame_sched_end(struct frame_sched *fs, uint64_t start_ns, uint64_t end_ns);
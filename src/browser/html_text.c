@@ -2068,3 +2068,90 @@ int html_visible_text_extract_links_spans_and_inline_imgs_ex(const uint8_t *html
 				     img_dim_lookup,
 				     img_dim_lookup_ctx);
 }
+
+static int style_run_same(const struct html_style_run *a, const struct html_style_run *b)
+{
+	return a->link == b->link &&
+	       a->has_fg == b->has_fg &&
+	       a->fg_xrgb == b->fg_xrgb &&
+	       a->has_bg == b->has_bg &&
+	       a->bg_xrgb == b->bg_xrgb &&
+	       a->bold == b->bold &&
+	       a->underline == b->underline;
+}
+
+void html_style_runs_build(const struct html_links *links, const struct html_spans *spans, struct html_style_runs *out)
+{
+	if (!out) return;
+	out->n = 0;
+	uint32_t nl = links ? links->n : 0;
+	uint32_t ns = spans ? spans->n : 0;
+	if (nl > HTML_MAX_LINKS) nl = HTML_MAX_LINKS;
+	if (ns > HTML_MAX_SPANS) ns = HTML_MAX_SPANS;
+
+	/* Sweep boundaries in order. Both tables are sorted by start; at each
+	 * position the active entry is the last one starting at or before it,
+	 * if it has not ended yet (same rule the per-index lookups used).
+	 */
+	uint32_t li = 0;
+	uint32_t si = 0;
+	uint32_t pos = 0;
+	for (;;) {
+		while (li < nl && links->links[li].start <= pos) li++;
+		while (si < ns && spans->spans[si].start <= pos) si++;
+		const struct html_link *ln = (li > 0 && pos < links->links[li - 1u].end) ? &links->links[li - 1u] : 0;
+		const struct html_span *sp = (si > 0 && pos < spans->spans[si - 1u].end) ? &spans->spans[si - 1u] : 0;
+
+		uint32_t next = 0xffffffffu;
+		if (li < nl && links->links[li].start < next) next = links->links[li].start;
+		if (ln && ln->end < next) next = ln->end;
+		if (si < ns && spans->spans[si].start < next) next = spans->spans[si].start;
+		if (sp && sp->end < next) next = sp->end;
+		if (next == 0xffffffffu && !ln && !sp) break;
+
+		if (ln || sp) {
+			struct html_style_run r;
+			r.start = pos;
+			r.end = next;
+			if (ln) {
+				r.link = (uint16_t)(ln - links->links);
+				r.has_fg = ln->has_fg;
+				r.fg_xrgb = ln->fg_xrgb;
+				r.has_bg = ln->has_bg;
+				r.bg_xrgb = ln->bg_xrgb;
+				r.bold = ln->bold;
+				r.underline = 1;
+			} else {
+				r.link = HTML_STYLE_RUN_NO_LINK;
+				r.has_fg = sp->has_fg;
+				r.fg_xrgb = sp->fg_xrgb;
+				r.has_bg = sp->has_bg;
+				r.bg_xrgb = sp->bg_xrgb;
+				r.bold = sp->bold;
+				r.underline = sp->underline;
+			}
+			struct html_style_run *prev = out->n ? &out->runs[out->n - 1u] : 0;
+			if (prev && prev->end == r.start && style_run_same(prev, &r)) {
+				prev->end = r.end;
+			} else {
+				if (out->n >= HTML_MAX_STYLE_RUNS) return;
+				out->runs[out->n++] = r;
+			}
+		}
+		if (next == 0xffffffffu) break;
+		pos = next;
+	}
+}
+
+uint32_t html_style_runs_find(const struct html_style_runs *runs, uint32_t idx)
+{
+	if (!runs) return 0;
+	uint32_t lo = 0;
+	uint32_t hi = runs->n;
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2u;
+		if (runs->runs[mid].end <= idx) lo = mid + 1u;
+		else hi = mid;
+	}
+	return lo;
+}
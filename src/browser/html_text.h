@@ -57,6 +57,39 @@ struct html_spans {
 	struct html_span spans[HTML_MAX_SPANS];
 };
 
+/* Links and spans merged into one sorted, non-overlapping list of styled runs
+ * over the visible-text stream (links override spans). Positions not covered
+ * by any run use the default text style. Lets the renderer style a line by
+ * advancing a cursor instead of searching both tables per character.
+ */
+enum {
+	HTML_MAX_STYLE_RUNS = 2 * (HTML_MAX_LINKS + HTML_MAX_SPANS) + 1,
+	HTML_STYLE_RUN_NO_LINK = 0xffff,
+};
+
+struct html_style_run {
+	uint32_t start;
+	uint32_t end;
+	uint32_t fg_xrgb;
+	uint32_t bg_xrgb;
+	uint16_t link; /* index into html_links, or HTML_STYLE_RUN_NO_LINK */
+	uint8_t has_fg;
+	uint8_t has_bg;
+	uint8_t bold;
+	uint8_t underline;
+};
+
+struct html_style_runs {
+	uint32_t n;
+	struct html_style_run runs[HTML_MAX_STYLE_RUNS];
+};
+
+/* Builds `out` from extracted links and spans (either may be NULL). */
+void html_style_runs_build(const struct html_links *links, const struct html_spans *spans, struct html_style_runs *out);
+
+/* Returns the index of the first run that ends after `idx` (out->n if none). */
+uint32_t html_style_runs_find(const struct html_style_runs *runs, uint32_t idx);
+
 enum {
 	HTML_MAX_INLINE_IMGS = 512,
 	HTML_INLINE_IMG_URL_MAX = 512,
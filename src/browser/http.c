@@ -46,6 +46,14 @@ int http_format_get_ex(char *out, size_t out_len, const char *host, const char *
 
 	if (append_cstr(out, out_len, &off, "Accept: */*\r\n") != 0) return -1;
 	if (append_cstr(out, out_len, &off, "Accept-Language: en,de;q=0.9\r\n") != 0) return -1;
+	/* Only the keep-alive reader (tls13_https_conn_*) decodes bodies, and br
+	 * only when the build has the decoder (BROTLI=1).
+	 */
+#if defined(HAVE_BROTLI)
+	if (keep_alive && append_cstr(out, out_len, &off, "Accept-Encoding: gzip, deflate, br\r\n") != 0) return -1;
+#else
+	if (keep_alive && append_cstr(out, out_len, &off, "Accept-Encoding: gzip, deflate\r\n") != 0) return -1;
+#endif
 	if (append_cstr(out, out_len, &off, keep_alive ? "Connection: keep-alive\r\n" : "Connection: close\r\n") != 0) return -1;
 	if (append_cstr(out, out_len, &off, "\r\n") != 0) return -1;
 
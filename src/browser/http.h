@@ -13,6 +13,7 @@
 int http_format_get(char *out, size_t out_len, const char *host, const char *path);
 
 /* Like http_format_get, but allows choosing Connection: keep-alive vs close.
- * keep_alive=1 emits "Connection: keep-alive".
+ * keep_alive=1 emits "Connection: keep-alive" and "Accept-Encoding: gzip,
+ * deflate", since responses on keep-alive connections are inflated on the fly.
  */
 int http_format_get_ex(char *out, size_t out_len, const char *host, const char *path, int keep_alive);
@@ -0,0 +1,272 @@
+#include "img_scale.h"
+
+/* Packed channel pairs: 0x00RR00BB and 0x00XX00GG leave 8 spare bits per
+ * channel, enough for a 0..256 weight or a sum of up to 256 samples.
+ */
+#define SCALE_PAIR_MASK 0x00ff00ffu
+
+typedef uint32_t scale_v4u32 __attribute__((vector_size(16), aligned(4)));
+
+/* Column tables and scratch rows. Not reentrant: only call from the main
+ * thread, i.e. dl_prepare_rows() and the serial tile path in browser_ui.c,
+ * never from render_band() on the render pool.
+ */
+static uint32_t g_scale_x0[IMG_SCALE_MAX_DIM + 1];
+static uint32_t g_scale_x1[IMG_SCALE_MAX_DIM];
+static uint32_t g_scale_xw[IMG_SCALE_MAX_DIM];
+static uint32_t g_scale_row_a[IMG_SCALE_MAX_DIM];
+static uint32_t g_scale_row_b[IMG_SCALE_MAX_DIM];
+static uint32_t g_scale_acc_rb[IMG_SCALE_MAX_DIM];
+static uint32_t g_scale_acc_ag[IMG_SCALE_MAX_DIM];
+
+/* out[i] = floor(i * src / dst) for i in [0, n), stepped without division. */
+static void scale_floor_table(uint32_t *out, uint32_t n, uint32_t src, uint32_t dst)
+{
+	uint32_t s = 0;
+	uint32_t acc = 0;
+	for (uint32_t i = 0; i < n; i++) {
+		out[i] = s;
+		acc += src;
+		while (acc >= dst) {
+			acc -= dst;
+			s++;
+		}
+	}
+}
+
+/* 16.16 source position of the center of output pixel `i`, clamped to the
+ * image; writes the left sample index and the 0..255 weight of the right one.
+ */
+static void scale_center_pos(uint64_t step, uint32_t i, uint32_t src_n, uint32_t *out_i0, uint32_t *out_f)
+{
+	int64_t pos = (int64_t)(step / 2u) - 0x8000 + (int64_t)((uint64_t)i * step);
+	if (pos < 0) pos = 0;
+	uint32_t i0 = (uint32_t)(pos >> 16);
+	uint32_t f = (uint32_t)(pos >> 8) & 0xffu;
+	if (i0 + 1u >= src_n) {
+		i0 = src_n - 1u;
+		f = 0;
+	}
+	*out_i0 = i0;
+	*out_f = f;
+}
+
+static inline uint32_t scale_lerp_px(uint32_t a, uint32_t b, uint32_t f)
+{
+	uint32_t wa = 256u - f;
+	uint32_t rb = (((a & SCALE_PAIR_MASK) * wa + (b & SCALE_PAIR_MASK) * f) >> 8) & SCALE_PAIR_MASK;
+	uint32_t ag = (((a >> 8) & SCALE_PAIR_MASK) * wa + ((b >> 8) & SCALE_PAIR_MASK) * f) & ~SCALE_PAIR_MASK;
+	return rb | ag;
+}
+
+static void scale_lerp_rows(uint32_t *dst, const uint32_t *a, const uint32_t *b, uint32_t n, uint32_t f)
+{
+	uint32_t x = 0;
+	if (f == 0) {
+		for (; x < n; x++) dst[x] = a[x];
+		return;
+	}
+	const scale_v4u32 zero = {0, 0, 0, 0};
+	const scale_v4u32 m = zero + SCALE_PAIR_MASK;
+	const scale_v4u32 wa = zero + (256u - f);
+	const scale_v4u32 wb = zero + f;
+	for (; x + 4u <= n; x += 4u) {
+		scale_v4u32 va = *(const scale_v4u32 *)(a + x);
+		scale_v4u32 vb = *(const scale_v4u32 *)(b + x);
+		scale_v4u32 rb = (((va & m) * wa + (vb & m) * wb) >> 8) & m;
+		scale_v4u32 ag = (((va >> 8) & m) * wa + ((vb >> 8) & m) * wb) & ~m;
+		*(scale_v4u32 *)(dst + x) = rb | ag;
+	}
+	for (; x < n; x++) dst[x] = scale_lerp_px(a[x], b[x], f);
+}
+
+static void scale_nearest(uint32_t *dst, size_t dst_pitch, uint32_t dst_w, uint32_t dst_h, uint32_t vis_w, uint32_t vis_h,
+			  const uint32_t *src, uint32_t src_w, uint32_t src_h)
+{
+	scale_floor_table(g_scale_x0, vis_w, src_w, dst_w);
+	uint32_t sy = 0;
+	uint32_t acc = 0;
+	for (uint32_t y = 0; y < vis_h; y++) {
+		const uint32_t *srow = src + (size_t)sy * src_w;
+		uint32_t *d = dst + (size_t)y * dst_pitch;
+		for (uint32_t x = 0; x < vis_w; x++) d[x] = srow[g_scale_x0[x]];
+		acc += src_h;
+		while (acc >= dst_h) {
+			acc -= dst_h;
+			sy++;
+		}
+	}
+}
+
+static void scale_bilinear_row(uint32_t *out, const uint32_t *srow, uint32_t n)
+{
+	for (uint32_t x = 0; x < n; x++) {
+		out[x] = scale_lerp_px(srow[g_scale_x0[x]], srow[g_scale_x1[x]], g_scale_xw[x]);
+	}
+}
+
+static void scale_bilinear(uint32_t *dst, size_t dst_pitch, uint32_t dst_w, uint32_t dst_h, uint32_t vis_w, uint32_t vis_h,
+			   const uint32_t *src, uint32_t src_w, uint32_t src_h)
+{
+	uint64_t step_x = ((uint64_t)src_w << 16) / dst_w;
+	uint64_t step_y = ((uint64_t)src_h << 16) / dst_h;
+	for (uint32_t x = 0; x < vis_w; x++) {
+		uint32_t i0, f;
+		scale_center_pos(step_x, x, src_w, &i0, &f);
+		g_scale_x0[x] = i0;
+		g_scale_x1[x] = (f != 0) ? i0 + 1u : i0;
+		g_scale_xw[x] = f;
+	}
+
+	/* row_a/row_b hold horizontally scaled source rows a_y and a_y + 1. */
+	uint32_t *row_a = g_scale_row_a;
+	uint32_t *row_b = g_scale_row_b;
+	uint32_t a_y = 0xffffffffu;
+	uint32_t b_y = 0xffffffffu;
+	for (uint32_t y = 0; y < vis_h; y++) {
+		uint32_t y0, fy;
+		scale_center_pos(step_y, y, src_h, &y0, &fy);
+		uint32_t y1 = (fy != 0) ? y0 + 1u : y0;
+		if (a_y != y0) {
+			if (b_y == y0) {
+				uint32_t *t = row_a;
+				row_a = row_b;
+				row_b = t;
+				a_y = b_y;
+				b_y = 0xffffffffu;
+			} else {
+				scale_bilinear_row(row_a, src + (size_t)y0 * src_w, vis_w);
+				a_y = y0;
+			}
+		}
+		if (y1 != y0 && b_y != y1) {
+			scale_bilinear_row(row_b, src + (size_t)y1 * src_w, vis_w);
+			b_y = y1;
+		}
+		scale_lerp_rows(dst + (size_t)y * dst_pitch, row_a, row_b, vis_w, fy);
+	}
+}
+
+/* Sample stride and count for a box footprint of `span` source pixels. */
+static void scale_box_footprint(uint32_t span, uint32_t *out_stride, uint32_t *out_n)
+{
+	if (span == 0) span = 1;
+	uint32_t stride = (span + 255u) / 256u;
+	*out_stride = stride;
+	*out_n = (span + stride - 1u) / stride;
+}
+
+/* Rounded-up 16.16 reciprocal; exact for constant inputs up to n = 256. */
+static inline uint32_t scale_recip(uint32_t n)
+{
+	return (65536u + n - 1u) / n;
+}
+
+static void scale_box(uint32_t *dst, size_t dst_pitch, uint32_t dst_w, uint32_t dst_h, uint32_t vis_w, uint32_t vis_h,
+		      const uint32_t *src, uint32_t src_w, uint32_t src_h)
+{
+	/* Output column x averages xn[x] samples, xs[x] apart, starting at
+	 * source column x0[x]; xw[x] is the reciprocal of xn[x].
+	 */
+	scale_floor_table(g_scale_x0, vis_w + 1u, src_w, dst_w);
+	uint32_t *xs = g_scale_x1;
+	uint32_t *xn = g_scale_row_b;
+	for (uint32_t x = 0; x < vis_w; x++) {
+		scale_box_footprint(g_scale_x0[x + 1u] - g_scale_x0[x], &xs[x], &xn[x]);
+		g_scale_xw[x] = scale_recip(xn[x]);
+	}
+
+	const scale_v4u32 zero = {0, 0, 0, 0};
+	const scale_v4u32 m = zero + SCALE_PAIR_MASK;
+	uint32_t sy = 0;
+	uint32_t acc = 0;
+	for (uint32_t y = 0; y < vis_h; y++) {
+		uint32_t sy0 = sy;
+		acc += src_h;
+		while (acc >= dst_h) {
+			acc -= dst_h;
+			sy++;
+		}
+		uint32_t ystride, yn;
+		scale_box_footprint(sy - sy0, &ystride, &yn);
+
+		for (uint32_t x = 0; x < vis_w; x++) {
+			g_scale_acc_rb[x] = 0;
+			g_scale_acc_ag[x] = 0;
+		}
+		for (uint32_t k = 0; k < yn; k++) {
+			/* Horizontal average of one source row, then accumulate it. */
+			const uint32_t *srow = src + (size_t)(sy0 + k * ystride) * src_w;
+			uint32_t *h = g_scale_row_a;
+			for (uint32_t x = 0; x < vis_w; x++) {
+				const uint32_t *p = srow + g_scale_x0[x];
+				uint32_t rb = 0, ag = 0;
+				for (uint32_t i = 0, o = 0; i < xn[x]; i++, o += xs[x]) {
+					rb += p[o] & SCALE_PAIR_MASK;
+					ag += (p[o] >> 8) & SCALE_PAIR_MASK;
+				}
+				uint32_t r = (uint32_t)(((uint64_t)(rb >> 16) * g_scale_xw[x]) >> 16);
+				uint32_t b = (uint32_t)(((uint64_t)(rb & 0xffffu) * g_scale_xw[x]) >> 16);
+				uint32_t a = (uint32_t)(((uint64_t)(ag >> 16) * g_scale_xw[x]) >> 16);
+				uint32_t g = (uint32_t)(((uint64_t)(ag & 0xffffu) * g_scale_xw[x]) >> 16);
+				h[x] = (a << 24) | (r << 16) | (g << 8) | b;
+			}
+			uint32_t x = 0;
+			for (; x + 4u <= vis_w; x += 4u) {
+				scale_v4u32 v = *(const scale_v4u32 *)(h + x);
+				*(scale_v4u32 *)(g_scale_acc_rb + x) += v & m;
+				*(scale_v4u32 *)(g_scale_acc_ag + x) += (v >> 8) & m;
+			}
+			for (; x < vis_w; x++) {
+				g_scale_acc_rb[x] += h[x] & SCALE_PAIR_MASK;
+				g_scale_acc_ag[x] += (h[x] >> 8) & SCALE_PAIR_MASK;
+			}
+		}
+
+		uint32_t ry = scale_recip(yn);
+		uint32_t *d = dst + (size_t)y * dst_pitch;
+		for (uint32_t x = 0; x < vis_w; x++) {
+			uint32_t rb = g_scale_acc_rb[x];
+			uint32_t ag = g_scale_acc_ag[x];
+			uint32_t r = (uint32_t)(((uint64_t)(rb >> 16) * ry) >> 16);
+			uint32_t b = (uint32_t)(((uint64_t)(rb & 0xffffu) * ry) >> 16);
+			uint32_t a = (uint32_t)(((uint64_t)(ag >> 16) * ry) >> 16);
+			uint32_t g = (uint32_t)(((uint64_t)(ag & 0xffffu) * ry) >> 16);
+			d[x] = (a << 24) | (r << 16) | (g << 8) | b;
+		}
+	}
+}
+
+int img_scale_xrgb(uint32_t *dst,
+		   size_t dst_pitch,
+		   uint32_t dst_w,
+		   uint32_t dst_h,
+		   uint32_t vis_w,
+		   uint32_t vis_h,
+		   const uint32_t *src,
+		   uint32_t src_w,
+		   uint32_t src_h,
+		   enum img_scale_filter filter)
+{
+	if (!dst || !src) return -1;
+	if (dst_w == 0 || dst_h == 0 || src_w == 0 || src_h == 0) return -1;
+	if (dst_w > (uint32_t)IMG_SCALE_MAX_DIM) return -1;
+	if (vis_w > dst_w) vis_w = dst_w;
+	if (vis_h > dst_h) vis_h = dst_h;
+	if (vis_w == 0 || vis_h == 0) return 0;
+
+	if (filter == IMG_SCALE_BOX) {
+		scale_box(dst, dst_pitch, dst_w, dst_h, vis_w, vis_h, src, src_w, src_h);
+	} else if (filter == IMG_SCALE_BILINEAR) {
+		scale_bilinear(dst, dst_pitch, dst_w, dst_h, vis_w, vis_h, src, src_w, src_h);
+	} else {
+		scale_nearest(dst, dst_pitch, dst_w, dst_h, vis_w, vis_h, src, src_w, src_h);
+	}
+	return 0;
+}
+
+enum img_scale_filter img_scale_pick_filter(uint32_t src_w, uint32_t src_h, uint32_t dst_w, uint32_t dst_h)
+{
+	if (dst_w <= src_w && dst_h <= src_h) return IMG_SCALE_BOX;
+	return IMG_SCALE_BILINEAR;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../../core/syscall.h"
+
+/*
+ * XRGB8888 resampler.
+ *
+ * Source positions are stepped with integer DDA / 16.16 fixed point into
+ * per-call column tables, so the inner loops do no divisions. Rows are
+ * blended with GCC vector types on packed 0x00ff00ff channel pairs.
+ *
+ * Filters:
+ * - NEAREST:  same mapping as x * src_w / dst_w (floor).
+ * - BILINEAR: pixel-center sampling; meant for enlarging.
+ * - BOX:      area average over the source pixels covering each output pixel;
+ *             meant for shrinking (at most 256 source pixels per axis are
+ *             averaged, larger footprints are subsampled).
+ */
+
+enum img_scale_filter {
+	IMG_SCALE_NEAREST = 0,
+	IMG_SCALE_BILINEAR,
+	IMG_SCALE_BOX,
+};
+
+enum {
+	IMG_SCALE_MAX_DIM = 2048,
+};
+
+/* Scales `src` (src_w x src_h, tightly packed) to dst_w x dst_h and writes the
+ * top-left vis_w x vis_h of the result to `dst` (dst_pitch pixels per row), so
+ * callers can clip at the right/bottom edge without changing the mapping.
+ * Returns 0 on success, -1 on invalid sizes (dst_w larger than
+ * IMG_SCALE_MAX_DIM, zero dimensions). Uses static scratch buffers: main
+ * thread only.
+ */
+int img_scale_xrgb(uint32_t *dst,
+		   size_t dst_pitch,
+		   uint32_t dst_w,
+		   uint32_t dst_h,
+		   uint32_t vis_w,
+		   uint32_t vis_h,
+		   const uint32_t *src,
+		   uint32_t src_w,
+		   uint32_t src_h,
+		   enum img_scale_filter filter);
+
+/* BOX when shrinking on both axes, BILINEAR otherwise. */
+enum img_scale_filter img_scale_pick_filter(uint32_t src_w, uint32_t src_h, uint32_t dst_w, uint32_t dst_h);
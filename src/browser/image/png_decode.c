@@ -1,5 +1,6 @@
 #include "png_decode.h"
 
+#include "../inflate.h"
 #include "../util.h"
 
 static uint32_t be32(const uint8_t *p)
@@ -35,305 +36,7 @@ static inline uint8_t png_idx_packed(const uint8_t *row, uint32_t x, uint8_t bit
 	return (uint8_t)((row[byte_i] >> shift) & mask);
 }
 
-/* --- zlib/deflate (minimal, no dictionary) --- */
-struct seg_reader {
-	const uint8_t *const *segs;
-	const size_t *lens;
-	size_t nseg;
-	size_t si;
-	size_t off;
-};
-
-static int seg_get_byte(struct seg_reader *r, uint8_t *out)
-{
-	if (!r || !out) return -1;
-	while (r->si < r->nseg) {
-		const uint8_t *p = r->segs[r->si];
-		size_t n = r->lens[r->si];
-		if (r->off < n) {
-			*out = p[r->off++];
-			return 0;
-		}
-		r->si++;
-		r->off = 0;
-	}
-	return -1;
-}
-
-struct bitr {
-	struct seg_reader *r;
-	uint32_t bitbuf;
-	uint32_t bitcount;
-};
-
-static int br_need(struct bitr *b, uint32_t n)
-{
-	while (b->bitcount < n) {
-		uint8_t by = 0;
-		if (seg_get_byte(b->r, &by) != 0) return -1;
-		b->bitbuf |= ((uint32_t)by) << b->bitcount;
-		b->bitcount += 8;
-	}
-	return 0;
-}
-
-static int br_get_bits(struct bitr *b, uint32_t n, uint32_t *out)
-{
-	if (!out) return -1;
-	if (n == 0) { *out = 0; return 0; }
-	if (n > 24) return -1;
-	if (br_need(b, n) != 0) return -1;
-	uint32_t v = b->bitbuf & ((1u << n) - 1u);
-	b->bitbuf >>= n;
-	b->bitcount -= n;
-	*out = v;
-	return 0;
-}
-
-static int br_get_byte(struct bitr *b, uint8_t *out)
-{
-	uint32_t v = 0;
-	if (br_get_bits(b, 8, &v) != 0) return -1;
-	*out = (uint8_t)v;
-	return 0;
-}
-
-static int br_align_byte(struct bitr *b)
-{
-	uint32_t drop = b->bitcount & 7u;
-	if (drop) {
-		b->bitbuf >>= drop;
-		b->bitcount -= drop;
-	}
-	return 0;
-}
-
-struct htab {
-	/* Canonical Huffman decoding via fast table for up to 9 bits + slow fallback */
-	uint16_t sym[1u << 9];
-	uint8_t  len[1u << 9];
-	uint16_t first_code[16 + 1];
-	uint16_t first_sym[16 + 1];
-	uint16_t count[16 + 1];
-	uint16_t syms[288];
-	uint8_t maxbits;
-	uint8_t valid;
-};
-
-static int htab_build(struct htab *h, const uint8_t *lens, uint32_t nsyms)
-{
-	if (!h || !lens || nsyms == 0 || nsyms > 288) return -1;
-	c_memset(h, 0, sizeof(*h));
-	uint16_t cnt[16 + 1];
-	c_memset(cnt, 0, sizeof(cnt));
-	uint8_t maxb = 0;
-	for (uint32_t i = 0; i < nsyms; i++) {
-		uint8_t L = lens[i];
-		if (L > 15) return -1;
-		if (L) { cnt[L]++; if (L > maxb) maxb = L; }
-	}
-	h->maxbits = maxb;
-	for (int i = 0; i <= 15; i++) h->count[i] = cnt[i];
-	uint16_t code = 0;
-	uint16_t sym = 0;
-	for (int bits = 1; bits <= 15; bits++) {
-		code = (uint16_t)((code + cnt[bits - 1]) << 1);
-		h->first_code[bits] = code;
-		h->first_sym[bits] = sym;
-		sym = (uint16_t)(sym + cnt[bits]);
-		if (sym > nsyms) return -1;
-	}
-	/* Build symbol list ordered by (len, code). */
-	uint16_t next[16 + 1];
-	for (int bits = 1; bits <= 15; bits++) next[bits] = h->first_sym[bits];
-	for (uint32_t s = 0; s < nsyms; s++) {
-		uint8_t L = lens[s];
-		if (!L) continue;
-		uint16_t idx = next[L]++;
-		if (idx >= nsyms) return -1;
-		h->syms[idx] = (uint16_t)s;
-	}
-	/* Fast table for first 9 bits */
-	for (uint32_t i = 0; i < (1u << 9); i++) {
-		h->len[i] = 0;
-		h->sym[i] = 0;
-	}
-	for (int bits = 1; bits <= 9; bits++) {
-		uint16_t fc = h->first_code[bits];
-		uint16_t fs = h->first_sym[bits];
-		uint16_t c = h->count[bits];
-		for (uint16_t j = 0; j < c; j++) {
-			uint16_t codev = (uint16_t)(fc + j);
-			uint16_t symv = h->syms[fs + j];
-			/* reverse bits for LSB-first deflate */
-			uint16_t r = 0;
-			for (int k = 0; k < bits; k++) r = (uint16_t)((r << 1) | ((codev >> k) & 1u));
-			uint16_t fill = (uint16_t)(1u << (9 - bits));
-			for (uint16_t t = 0; t < fill; t++) {
-				/* bitbuf stores bits LSB-first in the low bits, so table index is r in low bits */
-				uint16_t idx = (uint16_t)(((uint16_t)t << bits) | r);
-				h->len[idx] = (uint8_t)bits;
-				h->sym[idx] = symv;
-			}
-		}
-	}
-	h->valid = 1;
-	return 0;
-}
-
-static int br_peek9(struct bitr *b, uint32_t *out)
-{
-	if (br_need(b, 9) != 0) return -1;
-	*out = b->bitbuf & 0x1ffu;
-	return 0;
-}
-
-static int br_drop(struct bitr *b, uint32_t n)
-{
-	if (n > b->bitcount) return -1;
-	b->bitbuf >>= n;
-	b->bitcount -= n;
-	return 0;
-}
-
-static int htab_decode(struct bitr *b, const struct htab *h, uint32_t *out_sym)
-{
-	if (!b || !h || !out_sym || !h->valid) return -1;
-	uint32_t peek = 0;
-	if (br_peek9(b, &peek) != 0) return -1;
-	uint8_t L = h->len[peek];
-	if (L) {
-		uint16_t s = h->sym[peek];
-		if (br_drop(b, L) != 0) return -1;
-		*out_sym = s;
-		return 0;
-	}
-	/* Slow path for >9 bits: accumulate bits and search canonical ranges.
-	 * Note: we must reverse the code bits because deflate is LSB-first.
-	 */
-	uint32_t code = 0;
-	for (uint32_t bits = 1; bits <= h->maxbits; bits++) {
-		uint32_t bit = 0;
-		if (br_get_bits(b, 1, &bit) != 0) return -1;
-		code |= (bit << (bits - 1u));
-		/* reverse 'bits' bits */
-		uint32_t r = 0;
-		for (uint32_t k = 0; k < bits; k++) r = (r << 1) | ((code >> k) & 1u);
-		uint16_t fc = h->first_code[bits];
-		uint16_t cnt = h->count[bits];
-		if (cnt) {
-			int32_t diff = (int32_t)r - (int32_t)fc;
-			if (diff >= 0 && (uint32_t)diff < cnt) {
-				uint16_t idx = (uint16_t)(h->first_sym[bits] + (uint16_t)diff);
-				if (idx >= 288) return -1;
-				*out_sym = h->syms[idx];
-				return 0;
-			}
-		}
-	}
-	return -1;
-}
-
-static int build_fixed(struct htab *litlen, struct htab *dist)
-{
-	uint8_t ll[288];
-	uint8_t dl[32];
-	for (uint32_t i = 0; i < 288; i++) {
-		if (i <= 143) ll[i] = 8;
-		else if (i <= 255) ll[i] = 9;
-		else if (i <= 279) ll[i] = 7;
-		else ll[i] = 8;
-	}
-	for (uint32_t i = 0; i < 32; i++) dl[i] = 5;
-	if (htab_build(litlen, ll, 288) != 0) return -1;
-	if (htab_build(dist, dl, 32) != 0) return -1;
-	return 0;
-}
-
-static const uint16_t len_base[29] = {
-	3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
-	35,43,51,59,67,83,99,115,131,163,195,227,258
-};
-static const uint8_t len_extra[29] = {
-	0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,
-	3,3,3,3,4,4,4,4,5,5,5,5,0
-};
-static const uint16_t dist_base[30] = {
-	1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
-	257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577
-};
-static const uint8_t dist_extra[30] = {
-	0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,
-	7,7,8,8,9,9,10,10,11,11,12,12,13,13
-};
-
-static int build_dynamic(struct bitr *b, struct htab *litlen, struct htab *dist)
-{
-	uint32_t HLIT = 0, HDIST = 0, HCLEN = 0;
-	if (br_get_bits(b, 5, &HLIT) != 0) return -1;
-	if (br_get_bits(b, 5, &HDIST) != 0) return -1;
-	if (br_get_bits(b, 4, &HCLEN) != 0) return -1;
-	HLIT += 257;
-	HDIST += 1;
-	HCLEN += 4;
-	if (HLIT > 286 || HDIST > 30) return -1;
-
-	static const uint8_t order[19] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
-	uint8_t cl[19];
-	for (int i = 0; i < 19; i++) cl[i] = 0;
-	for (uint32_t i = 0; i < HCLEN; i++) {
-		uint32_t v = 0;
-		if (br_get_bits(b, 3, &v) != 0) return -1;
-		cl[order[i]] = (uint8_t)v;
-	}
-	struct htab cht;
-	if (htab_build(&cht, cl, 19) != 0) return -1;
-
-	uint32_t total = HLIT + HDIST;
-	uint8_t lens[288 + 32];
-	for (uint32_t i = 0; i < total; i++) lens[i] = 0;
-
-	uint32_t i = 0;
-	uint8_t prev = 0;
-	while (i < total) {
-		uint32_t sym = 0;
-		if (htab_decode(b, &cht, &sym) != 0) return -1;
-		if (sym <= 15) {
-			prev = (uint8_t)sym;
-			lens[i++] = prev;
-			continue;
-		}
-		if (sym == 16) {
-			uint32_t extra = 0;
-			if (br_get_bits(b, 2, &extra) != 0) return -1;
-			uint32_t rep = 3 + extra;
-			for (uint32_t k = 0; k < rep && i < total; k++) lens[i++] = prev;
-			continue;
-		}
-		if (sym == 17) {
-			uint32_t extra = 0;
-			if (br_get_bits(b, 3, &extra) != 0) return -1;
-			uint32_t rep = 3 + extra;
-			prev = 0;
-			for (uint32_t k = 0; k < rep && i < total; k++) lens[i++] = 0;
-			continue;
-		}
-		if (sym == 18) {
-			uint32_t extra = 0;
-			if (br_get_bits(b, 7, &extra) != 0) return -1;
-			uint32_t rep = 11 + extra;
-			prev = 0;
-			for (uint32_t k = 0; k < rep && i < total; k++) lens[i++] = 0;
-			continue;
-		}
-		return -1;
-	}
-
-	if (htab_build(litlen, lens, HLIT) != 0) return -1;
-	if (htab_build(dist, lens + HLIT, HDIST) != 0) return -1;
-	return 0;
-}
-
+/* --- zlib stream split across IDAT chunks --- */
 static int inflate_zlib_segments(const uint8_t *const *segs,
 				const size_t *lens,
 				size_t nseg,
@@ -345,108 +48,12 @@ static int inflate_zlib_segments(const uint8_t *const *segs,
 	*out_len = 0;
 	if (!segs || !lens || nseg == 0) return -1;
 
-	struct seg_reader rd;
-	rd.segs = segs;
-	rd.lens = lens;
-	rd.nseg = nseg;
-	rd.si = 0;
-	rd.off = 0;
-
-	/* zlib header: CMF, FLG */
-	uint8_t cmf = 0, flg = 0;
-	if (seg_get_byte(&rd, &cmf) != 0) return -1;
-	if (seg_get_byte(&rd, &flg) != 0) return -1;
-	if ((cmf & 0x0fu) != 8u) return -1; /* deflate */
-	uint16_t chk = (uint16_t)(((uint16_t)cmf << 8) | (uint16_t)flg);
-	if ((chk % 31u) != 0) return -1;
-	if (flg & 0x20u) return -1; /* preset dictionary not supported */
-
-	struct bitr b;
-	b.r = &rd;
-	b.bitbuf = 0;
-	b.bitcount = 0;
-
-	struct htab fixed_ll, fixed_d;
-	int have_fixed = 0;
-
-	int last = 0;
-	while (!last) {
-		uint32_t bfinal = 0, btype = 0;
-		if (br_get_bits(&b, 1, &bfinal) != 0) return -1;
-		if (br_get_bits(&b, 2, &btype) != 0) return -1;
-		last = (bfinal != 0);
-
-		if (btype == 0) {
-			/* Stored */
-			if (br_align_byte(&b) != 0) return -1;
-			uint8_t lo1=0, hi1=0, lo2=0, hi2=0;
-			if (br_get_byte(&b, &lo1) != 0) return -1;
-			if (br_get_byte(&b, &hi1) != 0) return -1;
-			if (br_get_byte(&b, &lo2) != 0) return -1;
-			if (br_get_byte(&b, &hi2) != 0) return -1;
-			uint16_t l = (uint16_t)((uint16_t)lo1 | ((uint16_t)hi1 << 8));
-			uint16_t nl = (uint16_t)((uint16_t)lo2 | ((uint16_t)hi2 << 8));
-			if ((uint16_t)(l ^ 0xffffu) != nl) return -1;
-			if (*out_len + (size_t)l > out_cap) return -1;
-			for (uint16_t i = 0; i < l; i++) {
-				uint8_t by = 0;
-				if (br_get_byte(&b, &by) != 0) return -1;
-				out[(*out_len)++] = by;
-			}
-			continue;
-		}
-
-		struct htab litlen, dist;
-		if (btype == 1) {
-			if (!have_fixed) {
-				if (build_fixed(&fixed_ll, &fixed_d) != 0) return -1;
-				have_fixed = 1;
-			}
-			litlen = fixed_ll;
-			dist = fixed_d;
-		} else if (btype == 2) {
-			if (build_dynamic(&b, &litlen, &dist) != 0) return -1;
-		} else {
-			return -1;
-		}
-
-		for (;;) {
-			uint32_t sym = 0;
-			if (htab_decode(&b, &litlen, &sym) != 0) return -1;
-			if (sym < 256u) {
-				if (*out_len + 1 > out_cap) return -1;
-				out[(*out_len)++] = (uint8_t)sym;
-				continue;
-			}
-			if (sym == 256u) break;
-			if (sym < 257u || sym > 285u) return -1;
-			uint32_t li = sym - 257u;
-			size_t length = (size_t)len_base[li];
-			uint32_t ex = (uint32_t)len_extra[li];
-			uint32_t ev = 0;
-			if (ex && br_get_bits(&b, ex, &ev) != 0) return -1;
-			length += (size_t)ev;
-
-			uint32_t ds = 0;
-			if (htab_decode(&b, &dist, &ds) != 0) return -1;
-			if (ds > 29u) return -1;
-			size_t distv = (size_t)dist_base[ds];
-			uint32_t dex = (uint32_t)dist_extra[ds];
-			uint32_t dv = 0;
-			if (dex && br_get_bits(&b, dex, &dv) != 0) return -1;
-			distv += (size_t)dv;
-
-			if (distv == 0 || distv > *out_len) return -1;
-			if (*out_len + length > out_cap) return -1;
-			size_t src = *out_len - distv;
-			for (size_t i = 0; i < length; i++) {
-				out[*out_len] = out[src + i];
-				(*out_len)++;
-			}
-		}
-	}
-
-	/* Adler32 follows; we ignore/skip validation. */
+	struct inflate_stream z;
+	inflate_init(&z, INFLATE_ZLIB, out, out_cap);
+	int r = INFLATE_NEED_INPUT;
+	for (size_t i = 0; i < nseg && r == INFLATE_NEED_INPUT; i++) r = inflate_feed(&z, segs[i], lens[i]);
+	if (r != INFLATE_DONE) return -1;
+	*out_len = z.out_len;
 	return 0;
 }
 
@@ -0,0 +1,521 @@
+#include "inflate.h"
+
+#include "util.h"
+
+/* Helper results: the unit being decoded is incomplete, so the caller
+ * rewinds to its mark and waits for more input.
+ */
+enum {
+	INF_OK = 0,
+	INF_MORE = 1,
+};
+
+enum {
+	ST_HEADER = 0,
+	ST_BLOCK,
+	ST_STORED,
+	ST_HUFF,
+	ST_END,
+};
+
+struct inf_mark {
+	size_t in_pos;
+	uint32_t bitbuf;
+	uint32_t bitcount;
+};
+
+static void inf_mark(const struct inflate_stream *s, struct inf_mark *m)
+{
+	m->in_pos = s->in_pos;
+	m->bitbuf = s->bitbuf;
+	m->bitcount = s->bitcount;
+}
+
+static void inf_rewind(struct inflate_stream *s, const struct inf_mark *m)
+{
+	s->in_pos = m->in_pos;
+	s->bitbuf = m->bitbuf;
+	s->bitcount = m->bitcount;
+}
+
+static int inf_need(struct inflate_stream *s, uint32_t n)
+{
+	while (s->bitcount < n) {
+		if (s->in_pos >= s->in_len) return INF_MORE;
+		s->bitbuf |= ((uint32_t)s->in[s->in_pos++]) << s->bitcount;
+		s->bitcount += 8;
+	}
+	return INF_OK;
+}
+
+static int inf_bits(struct inflate_stream *s, uint32_t n, uint32_t *out)
+{
+	if (n == 0) { *out = 0; return INF_OK; }
+	if (n > 24) return -1;
+	int r = inf_need(s, n);
+	if (r != INF_OK) return r;
+	*out = s->bitbuf & ((1u << n) - 1u);
+	s->bitbuf >>= n;
+	s->bitcount -= n;
+	return INF_OK;
+}
+
+static void inf_align_byte(struct inflate_stream *s)
+{
+	uint32_t drop = s->bitcount & 7u;
+	s->bitbuf >>= drop;
+	s->bitcount -= drop;
+}
+
+static int huff_build(struct inflate_huff *h, const uint8_t *lens, uint32_t nsyms)
+{
+	if (!h || !lens || nsyms == 0 || nsyms > 288) return -1;
+	c_memset(h, 0, sizeof(*h));
+	uint16_t cnt[16 + 1];
+	c_memset(cnt, 0, sizeof(cnt));
+	uint8_t maxb = 0;
+	for (uint32_t i = 0; i < nsyms; i++) {
+		uint8_t L = lens[i];
+		if (L > 15) return -1;
+		if (L) { cnt[L]++; if (L > maxb) maxb = L; }
+	}
+	h->maxbits = maxb;
+	for (int i = 0; i <= 15; i++) h->count[i] = cnt[i];
+	uint16_t code = 0;
+	uint16_t sym = 0;
+	for (int bits = 1; bits <= 15; bits++) {
+		code = (uint16_t)((code + cnt[bits - 1]) << 1);
+		h->first_code[bits] = code;
+		h->first_sym[bits] = sym;
+		sym = (uint16_t)(sym + cnt[bits]);
+		if (sym > nsyms) return -1;
+	}
+	/* Build symbol list ordered by (len, code). */
+	uint16_t next[16 + 1];
+	for (int bits = 1; bits <= 15; bits++) next[bits] = h->first_sym[bits];
+	for (uint32_t s = 0; s < nsyms; s++) {
+		uint8_t L = lens[s];
+		if (!L) continue;
+		uint16_t idx = next[L]++;
+		if (idx >= nsyms) return -1;
+		h->syms[idx] = (uint16_t)s;
+	}
+	/* Fast table for first 9 bits */
+	for (int bits = 1; bits <= 9; bits++) {
+		uint16_t fc = h->first_code[bits];
+		uint16_t fs = h->first_sym[bits];
+		uint16_t c = h->count[bits];
+		for (uint16_t j = 0; j < c; j++) {
+			uint16_t codev = (uint16_t)(fc + j);
+			uint16_t symv = h->syms[fs + j];
+			/* reverse bits for LSB-first deflate */
+			uint16_t r = 0;
+			for (int k = 0; k < bits; k++) r = (uint16_t)((r << 1) | ((codev >> k) & 1u));
+			uint16_t fill = (uint16_t)(1u << (9 - bits));
+			for (uint16_t t = 0; t < fill; t++) {
+				/* bitbuf stores bits LSB-first in the low bits, so table index is r in low bits */
+				uint16_t idx = (uint16_t)(((uint16_t)t << bits) | r);
+				h->len[idx] = (uint8_t)bits;
+				h->sym[idx] = symv;
+			}
+		}
+	}
+	h->valid = 1;
+	return 0;
+}
+
+static int huff_decode(struct inflate_stream *s, const struct inflate_huff *h, uint32_t *out_sym)
+{
+	if (!h->valid) return -1;
+	/* Near the end of the data fewer than 9 bits may be left; the missing
+	 * high bits read as zero, and a code that fits in what is there is
+	 * still decoded correctly.
+	 */
+	int need = inf_need(s, 9);
+	if (need < 0) return need;
+	uint32_t peek = s->bitbuf & 0x1ffu;
+	uint8_t L = h->len[peek];
+	if (L && L <= s->bitcount) {
+		s->bitbuf >>= L;
+		s->bitcount -= L;
+		*out_sym = h->sym[peek];
+		return INF_OK;
+	}
+	if (need == INF_MORE) return INF_MORE;
+	/* Slow path for >9 bits: accumulate bits and search canonical ranges.
+	 * Note: we must reverse the code bits because deflate is LSB-first.
+	 */
+	uint32_t code = 0;
+	for (uint32_t bits = 1; bits <= h->maxbits; bits++) {
+		uint32_t bit = 0;
+		int r = inf_bits(s, 1, &bit);
+		if (r != INF_OK) return r;
+		code |= (bit << (bits - 1u));
+		/* reverse 'bits' bits */
+		uint32_t rev = 0;
+		for (uint32_t k = 0; k < bits; k++) rev = (rev << 1) | ((code >> k) & 1u);
+		uint16_t fc = h->first_code[bits];
+		uint16_t cnt = h->count[bits];
+		if (cnt) {
+			int32_t diff = (int32_t)rev - (int32_t)fc;
+			if (diff >= 0 && (uint32_t)diff < cnt) {
+				uint16_t idx = (uint16_t)(h->first_sym[bits] + (uint16_t)diff);
+				if (idx >= 288) return -1;
+				*out_sym = h->syms[idx];
+				return INF_OK;
+			}
+		}
+	}
+	return -1;
+}
+
+static int build_fixed(struct inflate_huff *litlen, struct inflate_huff *dist)
+{
+	uint8_t ll[288];
+	uint8_t dl[32];
+	for (uint32_t i = 0; i < 288; i++) {
+		if (i <= 143) ll[i] = 8;
+		else if (i <= 255) ll[i] = 9;
+		else if (i <= 279) ll[i] = 7;
+		else ll[i] = 8;
+	}
+	for (uint32_t i = 0; i < 32; i++) dl[i] = 5;
+	if (huff_build(litlen, ll, 288) != 0) return -1;
+	if (huff_build(dist, dl, 32) != 0) return -1;
+	return 0;
+}
+
+static const uint16_t len_base[29] = {
+	3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
+	35,43,51,59,67,83,99,115,131,163,195,227,258
+};
+static const uint8_t len_extra[29] = {
+	0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,
+	3,3,3,3,4,4,4,4,5,5,5,5,0
+};
+static const uint16_t dist_base[30] = {
+	1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
+	257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577
+};
+static const uint8_t dist_extra[30] = {
+	0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,
+	7,7,8,8,9,9,10,10,11,11,12,12,13,13
+};
+
+static int build_dynamic(struct inflate_stream *s)
+{
+	uint32_t HLIT = 0, HDIST = 0, HCLEN = 0;
+	int r;
+	if ((r = inf_bits(s, 5, &HLIT)) != INF_OK) return r;
+	if ((r = inf_bits(s, 5, &HDIST)) != INF_OK) return r;
+	if ((r = inf_bits(s, 4, &HCLEN)) != INF_OK) return r;
+	HLIT += 257;
+	HDIST += 1;
+	HCLEN += 4;
+	if (HLIT > 286 || HDIST > 30) return -1;
+
+	static const uint8_t order[19] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+	uint8_t cl[19];
+	for (int i = 0; i < 19; i++) cl[i] = 0;
+	for (uint32_t i = 0; i < HCLEN; i++) {
+		uint32_t v = 0;
+		if ((r = inf_bits(s, 3, &v)) != INF_OK) return r;
+		cl[order[i]] = (uint8_t)v;
+	}
+	struct inflate_huff cht;
+	if (huff_build(&cht, cl, 19) != 0) return -1;
+
+	uint32_t total = HLIT + HDIST;
+	uint8_t lens[288 + 32];
+	for (uint32_t i = 0; i < total; i++) lens[i] = 0;
+
+	uint32_t i = 0;
+	uint8_t prev = 0;
+	while (i < total) {
+		uint32_t sym = 0;
+		if ((r = huff_decode(s, &cht, &sym)) != INF_OK) return r;
+		if (sym <= 15) {
+			prev = (uint8_t)sym;
+			lens[i++] = prev;
+			continue;
+		}
+		uint32_t extra = 0;
+		uint32_t rep = 0;
+		if (sym == 16) {
+			if ((r = inf_bits(s, 2, &extra)) != INF_OK) return r;
+			rep = 3 + extra;
+		} else if (sym == 17) {
+			if ((r = inf_bits(s, 3, &extra)) != INF_OK) return r;
+			rep = 3 + extra;
+			prev = 0;
+		} else if (sym == 18) {
+			if ((r = inf_bits(s, 7, &extra)) != INF_OK) return r;
+			rep = 11 + extra;
+			prev = 0;
+		} else {
+			return -1;
+		}
+		for (uint32_t k = 0; k < rep && i < total; k++) lens[i++] = prev;
+	}
+
+	if (huff_build(&s->litlen, lens, HLIT) != 0) return -1;
+	if (huff_build(&s->dist, lens + HLIT, HDIST) != 0) return -1;
+	return INF_OK;
+}
+
+static int inf_skip_bytes(struct inflate_stream *s, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t v = 0;
+		int r = inf_bits(s, 8, &v);
+		if (r != INF_OK) return r;
+	}
+	return INF_OK;
+}
+
+static int inf_skip_cstring(struct inflate_stream *s)
+{
+	for (;;) {
+		uint32_t v = 0;
+		int r = inf_bits(s, 8, &v);
+		if (r != INF_OK) return r;
+		if (v == 0) return INF_OK;
+	}
+}
+
+/* zlib or gzip header; the stream is still byte aligned here. */
+static int inf_header(struct inflate_stream *s)
+{
+	int r;
+	if (s->framing == INFLATE_ZLIB_OR_RAW) {
+		if (s->in_len - s->in_pos < 2u) return INF_MORE;
+		uint8_t cmf = s->in[s->in_pos];
+		uint8_t flg = s->in[s->in_pos + 1];
+		uint16_t chk = (uint16_t)(((uint16_t)cmf << 8) | (uint16_t)flg);
+		int zlib = ((cmf & 0x0fu) == 8u && (cmf >> 4) <= 7u && (chk % 31u) == 0);
+		s->framing = zlib ? INFLATE_ZLIB : INFLATE_RAW;
+	}
+	if (s->framing == INFLATE_RAW) return INF_OK;
+
+	if (s->framing == INFLATE_ZLIB) {
+		/* zlib header: CMF, FLG */
+		uint32_t cmf = 0, flg = 0;
+		if ((r = inf_bits(s, 8, &cmf)) != INF_OK) return r;
+		if ((r = inf_bits(s, 8, &flg)) != INF_OK) return r;
+		if ((cmf & 0x0fu) != 8u) return -1; /* deflate */
+		if ((((cmf << 8) | flg) % 31u) != 0) return -1;
+		if (flg & 0x20u) return -1; /* preset dictionary not supported */
+		return INF_OK;
+	}
+
+	/* gzip member header: ID1 ID2 CM FLG MTIME(4) XFL OS, then optional fields. */
+	uint32_t id1 = 0, id2 = 0, cm = 0, flg = 0;
+	if ((r = inf_bits(s, 8, &id1)) != INF_OK) return r;
+	if ((r = inf_bits(s, 8, &id2)) != INF_OK) return r;
+	if ((r = inf_bits(s, 8, &cm)) != INF_OK) return r;
+	if ((r = inf_bits(s, 8, &flg)) != INF_OK) return r;
+	if (id1 != 0x1fu || id2 != 0x8bu || cm != 8u || (flg & 0xe0u)) return -1;
+	if ((r = inf_skip_bytes(s, 6)) != INF_OK) return r;
+	if (flg & 0x04u) { /* FEXTRA */
+		uint32_t xlen = 0;
+		if ((r = inf_bits(s, 16, &xlen)) != INF_OK) return r;
+		if ((r = inf_skip_bytes(s, xlen)) != INF_OK) return r;
+	}
+	if ((flg & 0x08u) && (r = inf_skip_cstring(s)) != INF_OK) return r; /* FNAME */
+	if ((flg & 0x10u) && (r = inf_skip_cstring(s)) != INF_OK) return r; /* FCOMMENT */
+	if ((flg & 0x02u) && (r = inf_skip_bytes(s, 2)) != INF_OK) return r; /* FHCRC */
+	return INF_OK;
+}
+
+static int inf_block_header(struct inflate_stream *s)
+{
+	uint32_t bfinal = 0, btype = 0;
+	int r;
+	if ((r = inf_bits(s, 1, &bfinal)) != INF_OK) return r;
+	if ((r = inf_bits(s, 2, &btype)) != INF_OK) return r;
+
+	if (btype == 0) {
+		/* Stored: LEN and NLEN on the next byte boundary. */
+		inf_align_byte(s);
+		uint32_t l = 0, nl = 0;
+		if ((r = inf_bits(s, 16, &l)) != INF_OK) return r;
+		if ((r = inf_bits(s, 16, &nl)) != INF_OK) return r;
+		if (l + nl != 0xffffu) return -1;
+		s->stored_rem = l;
+		s->state = ST_STORED;
+	} else if (btype == 1) {
+		if (build_fixed(&s->litlen, &s->dist) != 0) return -1;
+		s->state = ST_HUFF;
+	} else if (btype == 2) {
+		if ((r = build_dynamic(s)) != INF_OK) return r;
+		s->state = ST_HUFF;
+	} else {
+		return -1;
+	}
+	s->last_block = (uint8_t)(bfinal != 0);
+	return INF_OK;
+}
+
+static int inf_stored(struct inflate_stream *s)
+{
+	while (s->stored_rem) {
+		if (s->out_len >= s->out_cap) return INFLATE_FULL;
+		if (s->bitcount >= 8u) {
+			/* Whole bytes left in the bit buffer after the block header. */
+			s->out[s->out_len++] = (uint8_t)s->bitbuf;
+			s->bitbuf >>= 8;
+			s->bitcount -= 8;
+			s->stored_rem--;
+			continue;
+		}
+		size_t avail = s->in_len - s->in_pos;
+		if (avail == 0) return INF_MORE;
+		size_t n = s->stored_rem;
+		if (n > avail) n = avail;
+		if (n > s->out_cap - s->out_len) n = s->out_cap - s->out_len;
+		c_memcpy(s->out + s->out_len, s->in + s->in_pos, n);
+		s->out_len += n;
+		s->in_pos += n;
+		s->stored_rem -= (uint32_t)n;
+	}
+	s->state = s->last_block ? ST_END : ST_BLOCK;
+	return INF_OK;
+}
+
+/* One literal, one match, or the end of the block. */
+static int inf_symbol(struct inflate_stream *s)
+{
+	uint32_t sym = 0;
+	int r;
+	if ((r = huff_decode(s, &s->litlen, &sym)) != INF_OK) return r;
+	if (sym < 256u) {
+		if (s->out_len >= s->out_cap) return INFLATE_FULL;
+		s->out[s->out_len++] = (uint8_t)sym;
+		return INF_OK;
+	}
+	if (sym == 256u) {
+		s->state = s->last_block ? ST_END : ST_BLOCK;
+		return INF_OK;
+	}
+	if (sym > 285u) return -1;
+	uint32_t li = sym - 257u;
+	size_t length = (size_t)len_base[li];
+	uint32_t ev = 0;
+	if ((r = inf_bits(s, len_extra[li], &ev)) != INF_OK) return r;
+	length += (size_t)ev;
+
+	uint32_t ds = 0;
+	if ((r = huff_decode(s, &s->dist, &ds)) != INF_OK) return r;
+	if (ds > 29u) return -1;
+	size_t distv = (size_t)dist_base[ds];
+	uint32_t dv = 0;
+	if ((r = inf_bits(s, dist_extra[ds], &dv)) != INF_OK) return r;
+	distv += (size_t)dv;
+
+	/* The output buffer is the whole window. */
+	if (distv > s->out_len) return -1;
+	int full = 0;
+	if (length > s->out_cap - s->out_len) {
+		length = s->out_cap - s->out_len;
+		full = 1;
+	}
+	uint8_t *dst = s->out + s->out_len;
+	const uint8_t *src = dst - distv;
+	for (size_t i = 0; i < length; i++) dst[i] = src[i];
+	s->out_len += length;
+	return full ? INFLATE_FULL : INF_OK;
+}
+
+/* Runs the state machine over the buffered input. Each header, block header
+ * and symbol is all-or-nothing: if the input ends inside one, the reader is
+ * rewound to its start.
+ */
+static int inf_run(struct inflate_stream *s)
+{
+	for (;;) {
+		struct inf_mark m;
+		int r;
+		switch (s->state) {
+		case ST_HEADER:
+			inf_mark(s, &m);
+			r = inf_header(s);
+			if (r == INF_MORE) { inf_rewind(s, &m); return INFLATE_NEED_INPUT; }
+			if (r < 0) return -1;
+			s->state = ST_BLOCK;
+			break;
+		case ST_BLOCK:
+			inf_mark(s, &m);
+			r = inf_block_header(s);
+			if (r == INF_MORE) { inf_rewind(s, &m); return INFLATE_NEED_INPUT; }
+			if (r < 0) return -1;
+			break;
+		case ST_STORED:
+			/* Copies as it goes, so nothing to rewind. */
+			r = inf_stored(s);
+			if (r == INF_MORE) return INFLATE_NEED_INPUT;
+			if (r != INF_OK) return r;
+			break;
+		case ST_HUFF:
+			inf_mark(s, &m);
+			r = inf_symbol(s);
+			if (r == INF_MORE) { inf_rewind(s, &m); return INFLATE_NEED_INPUT; }
+			if (r != INF_OK) return r; /* INFLATE_FULL or -1 */
+			break;
+		default:
+			/* Trailer (Adler-32 / CRC-32 + ISIZE) is not checked. */
+			return INFLATE_DONE;
+		}
+	}
+}
+
+void inflate_init(struct inflate_stream *s, int framing, uint8_t *out, size_t out_cap)
+{
+	if (!s) return;
+	s->out = out;
+	s->out_cap = out ? out_cap : 0;
+	s->out_len = 0;
+	s->status = 0;
+	s->framing = (uint8_t)framing;
+	s->state = ST_HEADER;
+	s->last_block = 0;
+	s->stored_rem = 0;
+	s->bitbuf = 0;
+	s->bitcount = 0;
+	s->in_pos = 0;
+	s->in_len = 0;
+	s->litlen.valid = 0;
+	s->dist.valid = 0;
+}
+
+int inflate_feed(struct inflate_stream *s, const uint8_t *in, size_t n)
+{
+	if (!s || (!in && n)) return -1;
+	if (s->status) return s->status;
+	for (;;) {
+		/* Keep only the unread tail (it starts at the last rewind mark). */
+		if (s->in_pos) {
+			size_t rem = s->in_len - s->in_pos;
+			for (size_t i = 0; i < rem; i++) s->in[i] = s->in[s->in_pos + i];
+			s->in_len = rem;
+			s->in_pos = 0;
+		}
+		size_t k = INFLATE_IN_BUF - s->in_len;
+		if (k > n) k = n;
+		if (k) c_memcpy(s->in + s->in_len, in, k);
+		s->in_len += k;
+		in += k;
+		n -= k;
+
+		int r = inf_run(s);
+		if (r != INFLATE_NEED_INPUT) {
+			s->status = r;
+			return r;
+		}
+		if (n == 0) return INFLATE_NEED_INPUT;
+		/* A single header or symbol larger than the buffer: not deflate data. */
+		if (k == 0) {
+			s->status = -1;
+			return -1;
+		}
+	}
+}
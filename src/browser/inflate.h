@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../core/syscall.h"
+
+/* Streaming inflate (RFC 1951) with zlib (RFC 1950) or gzip (RFC 1952)
+ * framing, for PNG IDAT data and gzip/deflate HTTP bodies.
+ *
+ * The caller owns one flat output buffer and it doubles as the LZ77 window,
+ * so there is no 32 KiB history copy. Input can arrive in pieces of any
+ * size: a symbol cut off by the end of a piece is rolled back and decoded
+ * again once inflate_feed() is called with more bytes.
+ *
+ * Checksums (Adler-32, CRC-32) are not verified, and preset dictionaries
+ * are rejected.
+ */
+
+enum {
+	INFLATE_RAW = 0,
+	INFLATE_ZLIB = 1,
+	INFLATE_GZIP = 2,
+	INFLATE_ZLIB_OR_RAW = 3, /* HTTP "deflate": zlib per RFC, raw from some servers */
+};
+
+/* inflate_feed() results. */
+enum {
+	INFLATE_NEED_INPUT = 0,
+	INFLATE_DONE = 1,  /* final block decoded; later input is ignored */
+	INFLATE_FULL = 2,  /* output buffer filled; later input is ignored */
+};
+
+enum {
+	INFLATE_IN_BUF = 4096,
+};
+
+struct inflate_huff {
+	/* Canonical Huffman decoding via fast table for up to 9 bits + slow fallback */
+	uint16_t sym[1u << 9];
+	uint8_t len[1u << 9];
+	uint16_t first_code[16 + 1];
+	uint16_t first_sym[16 + 1];
+	uint16_t count[16 + 1];
+	uint16_t syms[288];
+	uint8_t maxbits;
+	uint8_t valid;
+};
+
+struct inflate_stream {
+	uint8_t *out;
+	size_t out_cap;
+	size_t out_len;
+
+	int status; /* INFLATE_DONE, INFLATE_FULL or -1 once finished, else 0 */
+	uint8_t framing;
+	uint8_t state;
+	uint8_t last_block;
+	uint32_t stored_rem;
+
+	/* Bit reader over in[in_pos..in_len). */
+	uint32_t bitbuf;
+	uint32_t bitcount;
+	size_t in_pos;
+	size_t in_len;
+	uint8_t in[INFLATE_IN_BUF];
+
+	struct inflate_huff litlen;
+	struct inflate_huff dist;
+};
+
+void inflate_init(struct inflate_stream *s, int framing, uint8_t *out, size_t out_cap);
+
+/* Decodes as much of in[0..n) as possible into the output buffer.
+ * Returns INFLATE_NEED_INPUT, INFLATE_DONE, INFLATE_FULL, or -1 on corrupt
+ * data. s->out_len is the number of bytes produced so far.
+ */
+int inflate_feed(struct inflate_stream *s, const uint8_t *in, size_t n);
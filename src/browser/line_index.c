@@ -0,0 +1,191 @@
+#include "line_index.h"
+
+int line_index_parse_img_marker(const char *line, struct img_marker *out)
+{
+	if (!line || !out) return 0;
+	if (!(line[0] == (char)0x1e && line[1] == 'I' && line[2] == 'M' && line[3] == 'G' && line[4] == ' ')) return 0;
+
+	uint32_t rows = 0;
+	size_t p = 5;
+	while (line[p] >= '0' && line[p] <= '9') {
+		rows = rows * 10u + (uint32_t)(line[p] - '0');
+		p++;
+	}
+	while (line[p] == ' ') p++;
+
+	/* Placeholder token: "?" or "FR<cols>". */
+	size_t tok = p;
+	while (line[p] && line[p] != ' ' && line[p] != '\n' && (uint8_t)line[p] != 0x1f) p++;
+	uint32_t fcols = 0;
+	if (p - tok >= 2u && line[tok] == 'F' && line[tok + 1u] == 'R') {
+		for (size_t k = tok + 2u; k < p && line[k] >= '0' && line[k] <= '9'; k++) {
+			fcols = fcols * 10u + (uint32_t)(line[k] - '0');
+		}
+	}
+	while (line[p] == ' ') p++;
+
+	size_t label = p;
+	while (line[p] && line[p] != '\n' && (uint8_t)line[p] != 0x1f) p++;
+	out->rows = rows;
+	out->float_cols = fcols;
+	out->label = &line[label];
+	out->label_len = p - label;
+	out->url = 0;
+	out->url_len = 0;
+	if ((uint8_t)line[p] == 0x1f) {
+		size_t u = p + 1u;
+		size_t e = u;
+		while (line[e] && line[e] != '\n') e++;
+		out->url = &line[u];
+		out->url_len = e - u;
+	}
+	return 1;
+}
+
+uint32_t line_index_float_text_cols(uint32_t max_cols, uint32_t float_cols)
+{
+	if (max_cols == 0) return 1u;
+	uint32_t fcols = float_cols;
+	if (max_cols > 12u) {
+		if (fcols > max_cols - 10u) fcols = max_cols - 10u;
+	} else {
+		if (fcols > max_cols - 1u) fcols = max_cols - 1u;
+	}
+	uint32_t use_cols = (max_cols > (fcols + 1u)) ? (max_cols - fcols - 1u) : 1u;
+	if (use_cols < 1u) use_cols = 1u;
+	return use_cols;
+}
+
+int line_index_step(const char *text, uint32_t max_cols, struct line_state *st)
+{
+	if (!text || !st || max_cols == 0) return 1;
+
+	uint32_t use_cols = max_cols;
+	if (st->float_active) use_cols = line_index_float_text_cols(max_cols, st->float_cols);
+
+	size_t pos = st->pos;
+	size_t start = 0;
+	char line[1024];
+	if (text_layout_next_line_ex(text, &pos, use_cols, line, sizeof(line), &start) != 0) return 1;
+
+	if (st->img_active) {
+		st->img_row_in_box++;
+		if (st->img_row_in_box >= st->img_rows_total) st->img_active = 0;
+		st->pos = (uint32_t)pos;
+		return 0;
+	}
+
+	/* Marker rows are never wrapped, so the source line is intact. */
+	struct img_marker m;
+	if (line_index_parse_img_marker(text + start, &m)) {
+		uint32_t rows = m.rows;
+		if (rows < 2u) rows = 2u;
+		if (rows > 200u) rows = 200u;
+		if (m.float_cols > 0) {
+			uint32_t fcols = m.float_cols;
+			if (fcols < 6u) fcols = 6u;
+			if (fcols > 80u) fcols = 80u;
+			st->float_active = 1;
+			st->float_marker = (uint32_t)start;
+			st->float_rows_total = (uint16_t)rows;
+			st->float_row_in_box = 0;
+			st->float_cols = (uint8_t)fcols;
+
+			/* The renderer draws the float label row and also consumes the next
+			 * wrapped text line in the *same* visual row.
+			 */
+			uint32_t use_cols2 = line_index_float_text_cols(max_cols, fcols);
+			(void)text_layout_next_line(text, &pos, use_cols2, line, sizeof(line));
+		} else {
+			st->img_active = 1;
+			st->img_marker = (uint32_t)start;
+			st->img_rows_total = (uint16_t)rows;
+			st->img_row_in_box = 1; /* marker row is the first slice */
+		}
+	}
+	if (st->float_active) {
+		st->float_row_in_box++;
+		if (st->float_row_in_box >= st->float_rows_total) st->float_active = 0;
+	}
+	st->pos = (uint32_t)pos;
+	return 0;
+}
+
+static void line_state_init(struct line_state *st)
+{
+	st->pos = 0;
+	st->img_marker = LINE_INDEX_NO_MARKER;
+	st->float_marker = LINE_INDEX_NO_MARKER;
+	st->img_rows_total = 0;
+	st->img_row_in_box = 0;
+	st->float_rows_total = 0;
+	st->float_row_in_box = 0;
+	st->float_cols = 0;
+	st->img_active = 0;
+	st->float_active = 0;
+	st->reserved = 0;
+}
+
+void line_index_reset(struct line_index *ix)
+{
+	if (!ix) return;
+	ix->valid = 0;
+	ix->complete = 0;
+	ix->n_rows = 0;
+	ix->text = 0;
+	ix->max_cols = 0;
+}
+
+void line_index_ensure(struct line_index *ix, const char *text, uint32_t max_cols)
+{
+	if (!ix || !text || max_cols == 0) return;
+	if (ix->valid && ix->text == text && ix->max_cols == max_cols) return;
+
+	struct line_state st;
+	line_state_init(&st);
+	uint32_t n = 0;
+	ix->complete = 0;
+	while (n < (uint32_t)LINE_INDEX_MAX_ROWS) {
+		struct line_state next = st;
+		if (line_index_step(text, max_cols, &next) != 0) {
+			ix->complete = 1;
+			break;
+		}
+		ix->rows[n++] = st;
+		st = next;
+	}
+	ix->n_rows = n;
+	ix->text = text;
+	ix->max_cols = max_cols;
+	ix->gen++;
+	ix->valid = 1;
+}
+
+int line_index_seek(struct line_index *ix, const char *text, uint32_t max_cols, uint32_t row, struct line_state *out)
+{
+	if (!text || !out || max_cols == 0) return 1;
+
+	struct line_state st;
+	uint32_t r = 0;
+	line_state_init(&st);
+	if (ix) {
+		line_index_ensure(ix, text, max_cols);
+		if (row < ix->n_rows) {
+			*out = ix->rows[row];
+			return 0;
+		}
+		if (ix->complete) return 1;
+		if (ix->n_rows > 0) {
+			r = ix->n_rows - 1u;
+			st = ix->rows[r];
+		}
+	}
+	for (; r < row; r++) {
+		if (line_index_step(text, max_cols, &st) != 0) return 1;
+	}
+	/* Only report rows that actually exist. */
+	struct line_state probe = st;
+	if (line_index_step(text, max_cols, &probe) != 0) return 1;
+	*out = st;
+	return 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "text_layout.h"
+
+/*
+ * Per-row layout checkpoints for the wrapped page body.
+ *
+ * The renderer lays out the visible-text stream row by row, tracking whether a
+ * row falls inside a block image placeholder or next to a float-right image.
+ * Scrolling used to replay that layout from byte 0 on every frame; the index
+ * records the layout state at the start of every visual row once per
+ * (text, max_cols), so the renderer can jump straight to its first visible row.
+ *
+ * The index is allocation-free and bounded. Rows past LINE_INDEX_MAX_ROWS are
+ * still reachable: line_index_seek() continues stepping from the last indexed row.
+ */
+
+enum {
+	LINE_INDEX_MAX_ROWS = 65536,
+	LINE_INDEX_NO_MARKER = 0xffffffffu,
+};
+
+/* Layout state at the start of one visual row. Marker offsets point at the
+ * 0x1e byte of the image placeholder line that opened the active box, so the
+ * caller can re-parse it (e.g. to look up the image URL).
+ */
+struct line_state {
+	uint32_t pos;
+	uint32_t img_marker;
+	uint32_t float_marker;
+	uint16_t img_rows_total;
+	uint16_t img_row_in_box;
+	uint16_t float_rows_total;
+	uint16_t float_row_in_box;
+	uint8_t float_cols;
+	uint8_t img_active;
+	uint8_t float_active;
+	uint8_t reserved;
+};
+
+struct line_index {
+	const char *text;
+	uint32_t max_cols;
+	uint32_t gen;      /* bumped on every rebuild; keys derived caches */
+	uint32_t n_rows;   /* rows recorded in rows[] */
+	uint8_t valid;
+	uint8_t complete;  /* 1 if the whole text fit into rows[] */
+	struct line_state rows[LINE_INDEX_MAX_ROWS];
+};
+
+/* Parsed image placeholder marker row:
+ * 0x1e "IMG <rows> <token> <label>" 0x1f "<url>".
+ * Token is either "?" (block placeholder) or "FR<cols>" (float-right).
+ * Returns 1 if `line` is a marker row, 0 otherwise. Values are unclamped.
+ */
+struct img_marker {
+	uint32_t rows;
+	uint32_t float_cols; /* 0 for block placeholders */
+	const char *label;   /* not NUL-terminated; ends at 0x1f or line end */
+	size_t label_len;
+	const char *url;     /* not NUL-terminated; ends at '\n' or NUL */
+	size_t url_len;
+};
+
+int line_index_parse_img_marker(const char *line, struct img_marker *out);
+
+/* Width (in columns) left for text next to an active float of `float_cols`. */
+uint32_t line_index_float_text_cols(uint32_t max_cols, uint32_t float_cols);
+
+/* Advances `st` by one visual row, using the same rules as the page renderer.
+ * Returns 0 on success, 1 at end of text.
+ */
+int line_index_step(const char *text, uint32_t max_cols, struct line_state *st);
+
+/* Drops the index; call whenever the text buffer is rewritten. */
+void line_index_reset(struct line_index *ix);
+
+/* (Re)builds the index for `text` at `max_cols` if it is stale. */
+void line_index_ensure(struct line_index *ix, const char *text, uint32_t max_cols);
+
+/* Returns the layout state at the start of visual row `row`.
+ * Returns 0 on success, 1 if the text ends before that row.
+ */
+int line_index_seek(struct line_index *ix, const char *text, uint32_t max_cols, uint32_t row, struct line_state *out);
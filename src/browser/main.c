@@ -1,4 +1,5 @@
 #include "../core/text.h"
+#include "../core/log.h"
 #include "fb_shm.h"
 #include "url.h"
 
@@ -15,20 +16,36 @@
 
 #include "browser_defs.h"
 #include "browser_img.h"
+#include "page_tiles.h"
+#include "frame_sched.h"
+#include "dns_cache.h"
+#include "tls13_ticket.h"
 
 #include "browser_nav.h"
 #include "browser_ui.h"
 
-static uint8_t g_body[512 * 1024];
+enum {
+	/* Address space, not memory: the page arena only commits what a page
+	 * actually writes (see arena.h).
+	 */
+	PAGE_BODY_MAX = 256u * 1024u * 1024u,
+	PAGE_VISIBLE_MAX = 256u * 1024u * 1024u,
+	PAGE_ARENA_RESERVE = PAGE_BODY_MAX + PAGE_VISIBLE_MAX + 16u * 1024u * 1024u,
+};
+
+static struct arena g_page_arena;
+static uint8_t *g_body;
 static size_t g_body_len;
 
-static char g_visible[512 * 1024];
+static char *g_visible;
+static struct line_index g_lines;
 static char g_status_bar[128];
 static char g_url_bar[URL_BUF_LEN];
 static char g_active_host[HOST_BUF_LEN];
-static struct html_links g_links;
-static struct html_spans g_spans;
-static struct html_inline_imgs g_inline_imgs;
+static struct html_links *g_links;
+static struct html_spans *g_spans;
+static struct html_style_runs *g_runs;
+static struct html_inline_imgs *g_inline_imgs;
 static uint32_t g_scroll_rows;
 static int g_have_page;
 
@@ -148,9 +165,9 @@ static void redraw_now(struct shm_fb *fb,
 		       const char *active_host,
 		       const char *status_bar,
 		       const char *visible,
-		       const struct html_links *links,
-		       const struct html_spans *spans,
+		       const struct html_style_runs *runs,
 		       const struct html_inline_imgs *inline_imgs,
+		       struct line_index *lines,
 		       uint32_t scroll_rows,
 		       int have_page)
 {
@@ -158,23 +175,39 @@ static void redraw_now(struct shm_fb *fb,
 	char url_tmp[URL_BUF_LEN + 2u];
 	const char *disp_url = url_bar_display(url_tmp, sizeof(url_tmp));
 	const char *disp_status = g_url_edit_active ? "" : (status_bar ? status_bar : "");
-	if (have_page && visible && links && spans && inline_imgs) {
-		browser_render_page(fb, active_host, disp_url, disp_status, visible, links, spans, inline_imgs, scroll_rows);
+	if (have_page && visible && runs && inline_imgs) {
+		browser_render_page(fb, active_host, disp_url, disp_status, visible, runs, inline_imgs, lines, scroll_rows);
 	} else {
 		browser_draw_ui(fb, active_host, disp_url, disp_status, "", "", "");
-		fb->hdr->frame_counter++;
+		shm_fb_present(fb);
 	}
 }
 
+/* Carves the page buffers out of g_page_arena. Returns 0, or -1 if the
+ * address space could not be reserved.
+ */
+static int page_arena_init(void)
+{
+	if (arena_init(&g_page_arena, PAGE_ARENA_RESERVE) != 0) return -1;
+	g_body = (uint8_t *)arena_alloc(&g_page_arena, PAGE_BODY_MAX);
+	g_visible = (char *)arena_alloc(&g_page_arena, PAGE_VISIBLE_MAX);
+	g_links = (struct html_links *)arena_alloc(&g_page_arena, sizeof(*g_links));
+	g_spans = (struct html_spans *)arena_alloc(&g_page_arena, sizeof(*g_spans));
+	g_runs = (struct html_style_runs *)arena_alloc(&g_page_arena, sizeof(*g_runs));
+	g_inline_imgs = (struct html_inline_imgs *)arena_alloc(&g_page_arena, sizeof(*g_inline_imgs));
+	if (!g_body || !g_visible || !g_links || !g_spans || !g_runs || !g_inline_imgs) return -1;
+	return 0;
+}
+
 static struct browser_page make_page(void)
 {
 	struct browser_page page;
 	page.body = g_body;
-	page.body_cap = sizeof(g_body);
+	page.body_cap = PAGE_BODY_MAX;
 	page.body_len = &g_body_len;
 
 	page.visible = g_visible;
-	page.visible_cap = sizeof(g_visible);
+	page.visible_cap = PAGE_VISIBLE_MAX;
 
 	page.status_bar = g_status_bar;
 	page.status_bar_cap = sizeof(g_status_bar);
@@ -185,26 +218,63 @@ static struct browser_page make_page(void)
 	page.url_bar = g_url_bar;
 	page.url_bar_cap = sizeof(g_url_bar);
 
-	page.links = &g_links;
-	page.spans = &g_spans;
-	page.inline_imgs = &g_inline_imgs;
+	page.links = g_links;
+	page.spans = g_spans;
+	page.runs = g_runs;
+	page.inline_imgs = g_inline_imgs;
+	page.lines = &g_lines;
 
 	page.scroll_rows = &g_scroll_rows;
 	page.have_page = &g_have_page;
+	page.arena = &g_page_arena;
 	return page;
 }
 
+enum {
+	IDLE_WAIT_MS = 1000,
+	LARGE_IMG_QUIET_MS = 1000,
+};
+
+static void msg_append(char *msg, size_t cap, size_t *o, const char *s)
+{
+	for (size_t i = 0; s[i] && *o + 1 < cap; i++) msg[(*o)++] = s[i];
+	msg[*o] = 0;
+}
+
+/* "dropped N of M frames (budget X us)" */
+static void log_frame_drops(const struct frame_sched *fs)
+{
+	char msg[96];
+	char num[16];
+	size_t o = 0;
+	msg_append(msg, sizeof(msg), &o, "dropped ");
+	u32_to_dec(num, (uint32_t)fs->dropped);
+	msg_append(msg, sizeof(msg), &o, num);
+	msg_append(msg, sizeof(msg), &o, " of ");
+	u32_to_dec(num, (uint32_t)(fs->frames + fs->dropped));
+	msg_append(msg, sizeof(msg), &o, num);
+	msg_append(msg, sizeof(msg), &o, " frames (budget ");
+	u32_to_dec(num, (uint32_t)(fs->budget_ns / 1000u));
+	msg_append(msg, sizeof(msg), &o, num);
+	msg_append(msg, sizeof(msg), &o, " us)");
+	LOGI("frame", msg);
+}
+
 int main(int argc, char **argv)
 {
 	struct shm_fb fb;
-	if (shm_fb_open(&fb, FB_W, FB_H) < 0) {
+	if (shm_fb_open(&fb, FB_W, FB_H, FB_BUFFERS) < 0) {
+		return 1;
+	}
+	if (page_arena_init() != 0) {
+		LOGW("mem", "page arena: mmap failed");
 		return 1;
 	}
 
 	int crypto_ok = tls_crypto_selftest();
 	if (!crypto_ok) {
 		browser_draw_ui(&fb, "", "", "", "CRYPTO SELFTEST: FAIL", "Refusing to continue.", "Run: make test");
-		fb.hdr->frame_counter++;
+		shm_fb_present(&fb);
 		for (;;) {
 			struct timespec req;
 			req.tv_sec = 0;
@@ -213,6 +283,10 @@ int main(int argc, char **argv)
 		}
 	}
 
+	/* Shared with the image workers, so these must exist before they fork. */
+	(void)dns_cache_init();
+	(void)tls13_ticket_cache_init();
+	img_workers_set_wake(fb.hdr);
 	img_workers_init();
 
 	char host[HOST_BUF_LEN];
@@ -230,41 +304,45 @@ int main(int argc, char **argv)
 	}
 	browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 	browser_draw_ui(&fb, host, url_bar, "", "CRYPTO SELFTEST: OK", "Click EN / DE / Reload", host);
-	fb.hdr->frame_counter++;
+	shm_fb_present(&fb);
 
 	struct browser_page page = make_page();
 	browser_do_https_status(&fb, host, path, url_bar, page);
 
-	/* Idle loop: poll shm click events so UI is interactive. */
-	struct timespec req;
-	req.tv_sec = 0;
-	req.tv_nsec = 10 * 1000 * 1000;
+	/* Event loop: input writers and image workers bump the header's wake
+	 * word, so between events we sleep in a futex instead of polling.
+	 */
 	uint64_t last_mouse_event = fb.hdr->mouse_event_counter;
+	uint64_t last_wheel_counter = cfb_wheel_counter(fb.hdr);
+	int64_t last_wheel_accum = cfb_wheel_accum_y(fb.hdr);
 	uint32_t last_keyq_wpos = fb.hdr->keyq_wpos;
-	uint32_t idle_ticks = 0;
+	struct frame_sched frames;
+	frame_sched_init(&frames, FRAME_SCHED_BUDGET_60HZ_NS);
+	uint64_t last_interact_ms = c_mono_ms();
+	uint64_t last_large_ms = last_interact_ms;
 	for (;;) {
+		uint32_t wake_seen = cfb_wake_seq(fb.hdr);
 		int did_interact = 0;
-		char url_tmp[URL_BUF_LEN + 2u];
-		const char *disp_url = url_bar_display(url_tmp, sizeof(url_tmp));
-		const char *disp_status = g_url_edit_active ? "" : g_status_bar;
-		/* Mouse wheel scroll (shared header reserved fields). */
-		static uint64_t last_wheel_counter = 0;
+		/* Mouse wheel scroll (shared header reserved fields). The header sums
+		 * every delta, so events that piled up while the loop was busy
+		 * scroll by exactly what they add up to.
+		 */
 		uint64_t wc = cfb_wheel_counter(fb.hdr);
 		if (wc != last_wheel_counter) {
 			last_wheel_counter = wc;
-			int32_t dy = cfb_wheel_delta_y(fb.hdr);
+			int64_t acc = cfb_wheel_accum_y(fb.hdr);
+			int64_t dy = acc - last_wheel_accum;
+			last_wheel_accum = acc;
 			did_interact = 1;
-			uint32_t step = 12u;
 			if (dy > 0) {
-				uint32_t dec = (uint32_t)dy * step;
-				g_scroll_rows = (g_scroll_rows > dec) ? (g_scroll_rows - dec) : 0u;
+				uint64_t dec = (uint64_t)dy * 12u;
+				g_scroll_rows = ((uint64_t)g_scroll_rows > dec) ? (g_scroll_rows - (uint32_t)dec) : 0u;
 			} else if (dy < 0) {
-				uint32_t inc = (uint32_t)(-dy) * step;
-				g_scroll_rows += inc;
-			}
-			if (g_have_page) {
-				browser_render_page(&fb, g_active_host, disp_url, disp_status, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows);
+				uint64_t inc = (uint64_t)(-dy) * 12u;
+				uint64_t rows = (uint64_t)g_scroll_rows + inc;
+				g_scroll_rows = (rows > 0xffffffffu) ? 0xffffffffu : (uint32_t)rows;
 			}
+			if (g_have_page) frame_sched_request(&frames);
 		}
 
 		/* Keyboard/text events from dev viewer (CFB v3+). */
@@ -292,7 +370,7 @@ int main(int argc, char **argv)
 							url_edit_cancel();
 							browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 							browser_draw_ui(&fb, host, url_bar, "", "Fetching ...", host, path);
-							fb.hdr->frame_counter++;
+							shm_fb_present(&fb);
 							browser_do_https_status(&fb, host, path, url_bar, page);
 						}
 					}
@@ -302,12 +380,7 @@ int main(int argc, char **argv)
 					}
 				}
 
-				if (g_have_page) {
-					char url_tmp2[URL_BUF_LEN + 2u];
-					const char *disp_url2 = url_bar_display(url_tmp2, sizeof(url_tmp2));
-					const char *disp_status2 = g_url_edit_active ? "" : g_status_bar;
-					browser_render_page(&fb, g_active_host, disp_url2, disp_status2, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows);
-				}
+				if (g_have_page) frame_sched_request(&frames);
 			}
 		}
 
@@ -323,7 +396,7 @@ int main(int argc, char **argv)
 					if (g_url_edit_active && a != UI_FOCUS_URLBAR) {
 						/* Click outside the URL bar cancels editing. */
 						url_edit_cancel();
-						redraw_now(&fb, g_active_host, g_status_bar, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows, g_have_page);
+						redraw_now(&fb, g_active_host, g_status_bar, g_visible, g_runs, g_inline_imgs, &g_lines, g_scroll_rows, g_have_page);
 					}
 					if (a == UI_GO_SP) {
 						(void)c_strlcpy_s(host, sizeof(host), "www.spiegel.de");
@@ -331,7 +404,7 @@ int main(int argc, char **argv)
 						g_scroll_rows = 0;
 						browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 						browser_draw_ui(&fb, host, url_bar, "", "SP clicked", host, "Fetching ...");
-						fb.hdr->frame_counter++;
+						shm_fb_present(&fb);
 						browser_do_https_status(&fb, host, path, url_bar, page);
 					} else if (a == UI_GO_EN) {
 						(void)c_strlcpy_s(host, sizeof(host), "en.wikipedia.org");
@@ -339,7 +412,7 @@ int main(int argc, char **argv)
 						g_scroll_rows = 0;
 						browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 						browser_draw_ui(&fb, host, url_bar, "", "EN clicked", host, "Fetching ...");
-						fb.hdr->frame_counter++;
+						shm_fb_present(&fb);
 						browser_do_https_status(&fb, host, path, url_bar, page);
 					} else if (a == UI_GO_DE) {
 						(void)c_strlcpy_s(host, sizeof(host), "de.wikipedia.org");
@@ -347,22 +420,22 @@ int main(int argc, char **argv)
 						g_scroll_rows = 0;
 						browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 						browser_draw_ui(&fb, host, url_bar, "", "DE clicked", host, "Fetching ...");
-						fb.hdr->frame_counter++;
+						shm_fb_present(&fb);
 						browser_do_https_status(&fb, host, path, url_bar, page);
 					} else if (a == UI_RELOAD) {
 						g_scroll_rows = 0;
 						browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 						browser_draw_ui(&fb, host, url_bar, "", "Reload clicked", host, "Fetching ...");
-						fb.hdr->frame_counter++;
+						shm_fb_present(&fb);
 						browser_do_https_status(&fb, host, path, url_bar, page);
 					} else if (a == UI_FOCUS_URLBAR) {
 						url_edit_begin();
-						redraw_now(&fb, g_active_host, g_status_bar, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows, g_have_page);
+						redraw_now(&fb, g_active_host, g_status_bar, g_visible, g_runs, g_inline_imgs, &g_lines, g_scroll_rows, g_have_page);
 					} else {
 						/* Body link click */
 						char href[HTML_HREF_MAX];
 						href[0] = 0;
-						if (g_have_page && browser_ui_try_link_click(x, y, fb.width, g_visible, &g_links, g_scroll_rows, href, sizeof(href))) {
+						if (g_have_page && browser_ui_try_link_click(x, y, fb.width, g_visible, g_links, &g_lines, g_scroll_rows, href, sizeof(href))) {
 							char new_host[HOST_BUF_LEN];
 							char new_path[PATH_BUF_LEN];
 							if (url_apply_location(host, href, new_host, sizeof(new_host), new_path, sizeof(new_path)) == 0) {
@@ -371,7 +444,7 @@ int main(int argc, char **argv)
 								g_scroll_rows = 0;
 								browser_compose_url_bar(url_bar, sizeof(url_bar), host, path);
 								browser_draw_ui(&fb, host, url_bar, "", "Link clicked", href, "Fetching ...");
-								fb.hdr->frame_counter++;
+								shm_fb_present(&fb);
 								browser_do_https_status(&fb, host, path, url_bar, page);
 							}
 						}
@@ -380,42 +453,68 @@ int main(int argc, char **argv)
 			}
 		}
 
-		if (did_interact) {
-			idle_ticks = 0;
-		} else {
-			idle_ticks++;
-		}
+		uint64_t now = c_mono_ms();
+		if (did_interact) last_interact_ms = now;
 
 		if (g_have_page) {
 			int dims_changed = 0;
 			int pixels_changed = 0;
 			if (img_workers_pump(&dims_changed, &pixels_changed)) {
+				page_tiles_images_changed();
 				if (dims_changed && g_body_len > 0) {
 					struct img_dim_ctx ctx = { .active_host = g_active_host };
 					(void)html_visible_text_extract_links_spans_and_inline_imgs_ex(g_body,
 									      g_body_len,
 									      g_visible,
-									      sizeof(g_visible),
-									      &g_links,
-									      &g_spans,
-									      &g_inline_imgs,
+									      PAGE_VISIBLE_MAX,
+									      g_links,
+									      g_spans,
+									      g_inline_imgs,
 									      browser_html_img_dim_lookup,
 									      &ctx);
-					prefetch_page_images(g_active_host, g_visible, &g_inline_imgs);
-				}
-				if (dims_changed || pixels_changed) {
-					browser_render_page(&fb, g_active_host, g_url_bar, g_status_bar, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows);
+					html_style_runs_build(g_links, g_spans, g_runs);
+					line_index_reset(&g_lines);
+					prefetch_page_images(g_active_host, g_visible, g_inline_imgs);
 				}
+				if (dims_changed || pixels_changed) frame_sched_request(&frames);
 			}
 		}
 
-		/* Large-image fallback: keep it slow to avoid stutter. */
-		if (!did_interact && g_have_page && idle_ticks > 100u && (idle_ticks % 100u) == 0u) {
-			if (img_decode_large_pump_one()) {
-				browser_render_page(&fb, g_active_host, g_url_bar, g_status_bar, g_visible, &g_links, &g_spans, &g_inline_imgs, g_scroll_rows);
+		/* Large-image fallback: keep it slow to avoid stutter. It decodes in
+		 * this process, so only run it after a quiet second, once per second.
+		 */
+		uint32_t timeout_ms = IDLE_WAIT_MS;
+		if (g_have_page && img_decode_large_pending()) {
+			uint64_t due = ((last_interact_ms > last_large_ms) ? last_interact_ms : last_large_ms) + LARGE_IMG_QUIET_MS;
+			if (now >= due) {
+				last_large_ms = now;
+				if (img_decode_large_pump_one()) {
+					page_tiles_images_changed();
+					frame_sched_request(&frames);
+				}
+				due = now + LARGE_IMG_QUIET_MS;
+			}
+			if (due - now < timeout_ms) timeout_ms = (uint32_t)(due - now);
+		}
+		/* One render for everything requested since the last frame. */
+		uint64_t wait_ns = (uint64_t)timeout_ms * 1000000u;
+		uint64_t frame_start = c_mono_ns();
+		if (frame_sched_begin(&frames, frame_start, &wait_ns)) {
+			if (g_have_page) {
+				char url_tmp[URL_BUF_LEN + 2u];
+				const char *disp_url = url_bar_display(url_tmp, sizeof(url_tmp));
+				const char *disp_status = g_url_edit_active ? "" : g_status_bar;
+				browser_render_page(&fb, g_active_host, disp_url, disp_status, g_visible, g_runs, g_inline_imgs, &g_lines, g_scroll_rows);
 			}
+			uint64_t dropped = frames.dropped;
+			frame_sched_end(&frames, frame_start, c_mono_ns());
+			if (frames.dropped != dropped) log_frame_drops(&frames);
 		}
-		sys_nanosleep(&req, 0);
+		if (wait_ns < (uint64_t)timeout_ms * 1000000u) timeout_ms = (uint32_t)((wait_ns + 999999u) / 1000000u);
+		/* Worker results and input wake us early; the timeout paces pending
+		 * frames and the fallback above and bounds the damage of a lost wakeup.
+		 */
+		cfb_wait(fb.hdr, wake_seen, timeout_ms);
 	}
 	return 0;
 }
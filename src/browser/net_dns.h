@@ -2,15 +2,22 @@
 
 #include "net_ip4.h"
 #include "net_ip6.h"
+#include "dns_cache.h"
+#include "net_resolv.h"
 
 /* DNS resolver over UDP.
- * - Prefers Google DNS via IPv6:
+ * - Names listed in /etc/hosts never reach DNS.
+ * - Asks the nameservers from /etc/resolv.conf first, in file order.
+ * - Then Google DNS via IPv6:
  *   - 2001:4860:4860::8888
  *   - 2001:4860:4860::8844
- * - Falls back to Google DNS via IPv4:
+ * - Then Google DNS via IPv4:
  *   - 8.8.8.8
  *   - 8.8.4.4
  * Supports AAAA and A queries.
+ *
+ * Answers (and NXDOMAIN/NODATA) are kept in dns_cache for their TTL, so only
+ * the first connection to a host pays for the round trip.
  */
 
 static inline void google_dns_primary(struct in6_addr *out)
@@ -27,6 +34,20 @@ static inline void google_dns_secondary(struct in6_addr *out)
 	c_memcpy(out->s6_addr, ip, 16);
 }
 
+enum {
+	DNS_TYPE_A = 1,
+	DNS_TYPE_SOA = 6,
+	DNS_TYPE_AAAA = 28,
+	DNS_CLASS_IN = 1,
+};
+
+/* dns_parse_response() results. */
+enum {
+	DNS_ERROR = -1,    /* no usable response; try the next server */
+	DNS_ANSWER = 0,
+	DNS_NO_ANSWER = 1, /* NXDOMAIN, or the name has no record of that type */
+};
+
 struct dns_header {
 	uint16_t id;
 	uint16_t flags;
@@ -80,239 +101,183 @@ static inline size_t dns_skip_name(const uint8_t *msg, size_t len, size_t off)
 	}
 }
 
-static inline int dns_try_server_aaaa(const struct in6_addr *ns_ip, const char *host, uint8_t out_ip[16])
+static inline uint32_t dns_rd_u32(const uint8_t *p)
 {
-	int fd = sys_socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
-	if (fd < 0) return -1;
-
-	/* Set a small recv timeout so we can try secondary server. */
-	struct timeval tv;
-	tv.tv_sec = 1;
-	tv.tv_usec = 0;
-	(void)sys_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
-
-	struct sockaddr_in6 ns;
-	c_memset(&ns, 0, sizeof(ns));
-	ns.sin6_family = (uint16_t)AF_INET6;
-	ns.sin6_port = htons(53);
-	ns.sin6_addr = *ns_ip;
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
 
-	uint8_t pkt[512];
-	c_memset(pkt, 0, sizeof(pkt));
+/* Builds a recursive query for (host, qtype). Returns its length or 0. */
+static inline size_t dns_build_query(uint8_t *pkt, size_t cap, const char *host, uint16_t qtype, uint16_t id)
+{
+	if (cap < sizeof(struct dns_header)) return 0;
+	c_memset(pkt, 0, sizeof(struct dns_header));
 	struct dns_header *h = (struct dns_header *)pkt;
-
-	uint16_t id = 0x1234;
-	/* Best effort randomize id if available */
-	uint16_t rid = 0;
-	if (sys_getrandom(&rid, sizeof(rid), 0) == (long)sizeof(rid)) {
-		id = rid;
-	}
-
 	h->id = htons(id);
 	h->flags = htons(0x0100); /* RD */
 	h->qdcount = htons(1);
 
 	size_t off = sizeof(struct dns_header);
-	size_t qn = dns_write_qname(&pkt[off], sizeof(pkt) - off, host);
-	if (qn == 0) {
-		sys_close(fd);
-		return -1;
-	}
+	size_t qn = dns_write_qname(&pkt[off], cap - off, host);
+	if (qn == 0) return 0;
 	off += qn;
-	if (off + 4 > sizeof(pkt)) {
-		sys_close(fd);
-		return -1;
-	}
-	/* QTYPE AAAA (28), QCLASS IN (1) */
-	pkt[off + 0] = 0;
-	pkt[off + 1] = 28;
+	if (off + 4 > cap) return 0;
+	pkt[off + 0] = (uint8_t)(qtype >> 8);
+	pkt[off + 1] = (uint8_t)qtype;
 	pkt[off + 2] = 0;
-	pkt[off + 3] = 1;
-	off += 4;
-
-	ssize_t sent = sys_sendto(fd, pkt, off, 0, &ns, (uint32_t)sizeof(ns));
-	if (sent < 0) {
-		sys_close(fd);
-		return -1;
-	}
+	pkt[off + 3] = DNS_CLASS_IN;
+	return off + 4;
+}
 
-	uint8_t resp[512];
-	struct sockaddr_in6 from;
-	socklen_t fromlen = (socklen_t)sizeof(from);
-	ssize_t rcv = sys_recvfrom(fd, resp, sizeof(resp), 0, &from, &fromlen);
-	sys_close(fd);
-	if (rcv < (ssize_t)sizeof(struct dns_header)) {
-		return -1;
-	}
+/* Whether resp answers query (id, qtype): the id and the type of the first
+ * question must both match.
+ */
+static inline int dns_response_matches(const uint8_t *resp, size_t rlen, uint16_t id, uint16_t qtype)
+{
+	if (rlen < sizeof(struct dns_header)) return 0;
+	const struct dns_header *rh = (const struct dns_header *)resp;
+	if (ntohs(rh->id) != id || ntohs(rh->qdcount) < 1) return 0;
+	size_t noff = dns_skip_name(resp, rlen, sizeof(struct dns_header));
+	if (noff == 0 || noff + 4 > rlen) return 0;
+	return (uint16_t)((resp[noff] << 8) | resp[noff + 1]) == qtype;
+}
 
-	size_t rlen = (size_t)rcv;
+/* Parses the response to query `id`. On DNS_ANSWER copies the first record
+ * of `qtype` (addr_len bytes of rdata) to out. *out_ttl is the time the
+ * result may be cached: the smallest TTL along the answer chain, or for
+ * DNS_NO_ANSWER the SOA minimum from the authority section (RFC 2308),
+ * DNS_CACHE_NEG_TTL_S without one.
+ */
+static inline int dns_parse_response(const uint8_t *resp, size_t rlen, uint16_t id, uint16_t qtype, uint8_t *out, size_t addr_len, uint32_t *out_ttl)
+{
+	*out_ttl = 0;
+	if (!dns_response_matches(resp, rlen, id, qtype)) return DNS_ERROR;
 	const struct dns_header *rh = (const struct dns_header *)resp;
-	if (ntohs(rh->id) != id) {
-		return -1;
-	}
 	uint16_t flags = ntohs(rh->flags);
-	if ((flags & 0x8000u) == 0) {
-		return -1; /* not a response */
-	}
-	if ((flags & 0x000Fu) != 0) {
-		return -1; /* rcode != 0 */
-	}
+	if ((flags & 0x8000u) == 0) return DNS_ERROR; /* not a response */
+	uint16_t rcode = (uint16_t)(flags & 0x000Fu);
+	if (rcode != 0 && rcode != 3) return DNS_ERROR; /* SERVFAIL, REFUSED, ... */
 
 	uint16_t qd = ntohs(rh->qdcount);
 	uint16_t an = ntohs(rh->ancount);
-	if (qd < 1 || an < 1) {
-		return -1;
-	}
+	uint16_t ns = ntohs(rh->nscount);
+	if (qd < 1) return DNS_ERROR;
 
 	size_t roff = sizeof(struct dns_header);
 	/* Skip questions */
 	for (uint16_t qi = 0; qi < qd; qi++) {
 		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 4 > rlen) return -1;
-		off = noff + 4;
-		roff = off;
+		if (noff == 0 || noff + 4 > rlen) return DNS_ERROR;
+		roff = noff + 4;
 	}
 
-	/* Parse answers; take first AAAA record */
+	/* Answers: take the first record of qtype; CNAMEs before it bound the TTL. */
+	uint32_t chain_ttl = 0xffffffffu;
 	for (uint16_t ai = 0; ai < an; ai++) {
 		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 10 > rlen) return -1;
+		if (noff == 0 || noff + 10 > rlen) return DNS_ERROR;
 		uint16_t type = (uint16_t)((resp[noff + 0] << 8) | resp[noff + 1]);
 		uint16_t cls = (uint16_t)((resp[noff + 2] << 8) | resp[noff + 3]);
+		uint32_t ttl = dns_rd_u32(&resp[noff + 4]);
 		uint16_t rdlen = (uint16_t)((resp[noff + 8] << 8) | resp[noff + 9]);
 		size_t rdata = noff + 10;
-		if (rdata + rdlen > rlen) return -1;
+		if (rdata + rdlen > rlen) return DNS_ERROR;
+		if (ttl < chain_ttl) chain_ttl = ttl;
 
-		if (type == 28 && cls == 1 && rdlen == 16) {
-			c_memcpy(out_ip, &resp[rdata], 16);
-			return 0;
+		if (type == qtype && cls == DNS_CLASS_IN && rdlen == addr_len) {
+			c_memcpy(out, &resp[rdata], addr_len);
+			*out_ttl = chain_ttl;
+			return DNS_ANSWER;
 		}
 		roff = rdata + rdlen;
 	}
 
-	return -1;
+	/* No record of that type (or NXDOMAIN): look for the SOA minimum. */
+	uint32_t neg_ttl = DNS_CACHE_NEG_TTL_S;
+	for (uint16_t ni = 0; ni < ns; ni++) {
+		size_t noff = dns_skip_name(resp, rlen, roff);
+		if (noff == 0 || noff + 10 > rlen) break;
+		uint16_t type = (uint16_t)((resp[noff + 0] << 8) | resp[noff + 1]);
+		uint32_t ttl = dns_rd_u32(&resp[noff + 4]);
+		uint16_t rdlen = (uint16_t)((resp[noff + 8] << 8) | resp[noff + 9]);
+		size_t rdata = noff + 10;
+		if (rdata + rdlen > rlen) break;
+		if (type == DNS_TYPE_SOA) {
+			/* MNAME, RNAME, then serial/refresh/retry/expire/minimum. */
+			size_t p = dns_skip_name(resp, rdata + rdlen, rdata);
+			if (p) p = dns_skip_name(resp, rdata + rdlen, p);
+			if (p && p + 20 <= rdata + rdlen) {
+				uint32_t minimum = dns_rd_u32(&resp[p + 16]);
+				neg_ttl = (ttl < minimum) ? ttl : minimum;
+			}
+			break;
+		}
+		roff = rdata + rdlen;
+	}
+	*out_ttl = neg_ttl;
+	return DNS_NO_ANSWER;
 }
 
-static inline int dns_try_server_aaaa4(const struct in_addr *ns_ip, const char *host, uint8_t out_ip[16])
+static inline uint16_t dns_new_id(void)
 {
-	int fd = sys_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-	if (fd < 0) return -1;
-
-	struct timeval tv;
-	tv.tv_sec = 1;
-	tv.tv_usec = 0;
-	(void)sys_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
-
-	struct sockaddr_in ns;
-	c_memset(&ns, 0, sizeof(ns));
-	ns.sin_family = (uint16_t)AF_INET;
-	ns.sin_port = htons(53);
-	ns.sin_addr = *ns_ip;
-
-	uint8_t pkt[512];
-	c_memset(pkt, 0, sizeof(pkt));
-	struct dns_header *h = (struct dns_header *)pkt;
-
 	uint16_t id = 0x1234;
+	/* Best effort randomize id if available */
 	uint16_t rid = 0;
 	if (sys_getrandom(&rid, sizeof(rid), 0) == (long)sizeof(rid)) {
 		id = rid;
 	}
+	return id;
+}
 
-	h->id = htons(id);
-	h->flags = htons(0x0100);
-	h->qdcount = htons(1);
+/* One query/response over UDP to ns (a sockaddr_in6 or sockaddr_in). */
+static inline int dns_query_server(int family, const void *ns, uint32_t ns_len, const char *host, uint16_t qtype, uint8_t *out, size_t addr_len, uint32_t *out_ttl)
+{
+	uint8_t pkt[512];
+	uint16_t id = dns_new_id();
+	size_t qlen = dns_build_query(pkt, sizeof(pkt), host, qtype, id);
+	if (qlen == 0) return DNS_ERROR;
 
-	size_t off = sizeof(struct dns_header);
-	size_t qn = dns_write_qname(&pkt[off], sizeof(pkt) - off, host);
-	if (qn == 0) {
-		sys_close(fd);
-		return -1;
-	}
-	off += qn;
-	if (off + 4 > sizeof(pkt)) {
-		sys_close(fd);
-		return -1;
-	}
-	/* QTYPE AAAA (28), QCLASS IN (1) */
-	pkt[off + 0] = 0;
-	pkt[off + 1] = 28;
-	pkt[off + 2] = 0;
-	pkt[off + 3] = 1;
-	off += 4;
+	int fd = sys_socket(family, SOCK_DGRAM, IPPROTO_UDP);
+	if (fd < 0) return DNS_ERROR;
 
-	ssize_t sent = sys_sendto(fd, pkt, off, 0, &ns, (uint32_t)sizeof(ns));
+	/* Set a small recv timeout so we can try secondary server. */
+	struct timeval tv;
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	(void)sys_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
+
+	ssize_t sent = sys_sendto(fd, pkt, qlen, 0, ns, ns_len);
 	if (sent < 0) {
 		sys_close(fd);
-		return -1;
+		return DNS_ERROR;
 	}
 
 	uint8_t resp[512];
-	struct sockaddr_in from;
+	struct sockaddr_in6 from;
 	socklen_t fromlen = (socklen_t)sizeof(from);
 	ssize_t rcv = sys_recvfrom(fd, resp, sizeof(resp), 0, &from, &fromlen);
 	sys_close(fd);
-	if (rcv < (ssize_t)sizeof(struct dns_header)) {
-		return -1;
-	}
-
-	size_t rlen = (size_t)rcv;
-	const struct dns_header *rh = (const struct dns_header *)resp;
-	if (ntohs(rh->id) != id) {
-		return -1;
-	}
-	uint16_t flags = ntohs(rh->flags);
-	if ((flags & 0x8000u) == 0) return -1;
-	if ((flags & 0x000Fu) != 0) return -1;
-
-	uint16_t qd = ntohs(rh->qdcount);
-	uint16_t an = ntohs(rh->ancount);
-	if (qd < 1 || an < 1) return -1;
-
-	size_t roff = sizeof(struct dns_header);
-	for (uint16_t qi = 0; qi < qd; qi++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 4 > rlen) return -1;
-		off = noff + 4;
-		roff = off;
-	}
-
-	for (uint16_t ai = 0; ai < an; ai++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 10 > rlen) return -1;
-		uint16_t type = (uint16_t)((resp[noff + 0] << 8) | resp[noff + 1]);
-		uint16_t cls = (uint16_t)((resp[noff + 2] << 8) | resp[noff + 3]);
-		uint16_t rdlen = (uint16_t)((resp[noff + 8] << 8) | resp[noff + 9]);
-		size_t rdata = noff + 10;
-		if (rdata + rdlen > rlen) return -1;
-
-		if (type == 28 && cls == 1 && rdlen == 16) {
-			c_memcpy(out_ip, &resp[rdata], 16);
-			return 0;
-		}
-		roff = rdata + rdlen;
-	}
-
-	return -1;
+	if (rcv < 0) return DNS_ERROR;
+	return dns_parse_response(resp, (size_t)rcv, id, qtype, out, addr_len, out_ttl);
 }
 
-static inline void google_dns4_primary(struct in_addr *out);
-static inline void google_dns4_secondary(struct in_addr *out);
-
-static inline int dns_resolve_aaaa_google(const char *host, uint8_t out_ip[16])
+static inline int dns_query_server6(const struct in6_addr *ns_ip, const char *host, uint16_t qtype, uint8_t *out, size_t addr_len, uint32_t *out_ttl)
 {
-	struct in6_addr ns;
-	google_dns_primary(&ns);
-	if (dns_try_server_aaaa(&ns, host, out_ip) == 0) return 0;
-	google_dns_secondary(&ns);
-	if (dns_try_server_aaaa(&ns, host, out_ip) == 0) return 0;
+	struct sockaddr_in6 ns;
+	c_memset(&ns, 0, sizeof(ns));
+	ns.sin6_family = (uint16_t)AF_INET6;
+	ns.sin6_port = htons(53);
+	ns.sin6_addr = *ns_ip;
+	return dns_query_server(AF_INET6, &ns, (uint32_t)sizeof(ns), host, qtype, out, addr_len, out_ttl);
+}
 
-	/* Fallback: query Google DNS over IPv4 if IPv6 DNS path is unavailable. */
-	struct in_addr ns4;
-	google_dns4_primary(&ns4);
-	if (dns_try_server_aaaa4(&ns4, host, out_ip) == 0) return 0;
-	google_dns4_secondary(&ns4);
-	return dns_try_server_aaaa4(&ns4, host, out_ip);
+static inline int dns_query_server4(const struct in_addr *ns_ip, const char *host, uint16_t qtype, uint8_t *out, size_t addr_len, uint32_t *out_ttl)
+{
+	struct sockaddr_in ns;
+	c_memset(&ns, 0, sizeof(ns));
+	ns.sin_family = (uint16_t)AF_INET;
+	ns.sin_port = htons(53);
+	ns.sin_addr = *ns_ip;
+	return dns_query_server(AF_INET, &ns, (uint32_t)sizeof(ns), host, qtype, out, addr_len, out_ttl);
 }
 
 static inline void google_dns4_primary(struct in_addr *out)
@@ -329,230 +294,269 @@ static inline void google_dns4_secondary(struct in_addr *out)
 	out->s_addr = htonl(host);
 }
 
-static inline int dns_try_server_a4(const struct in_addr *ns_ip, const char *host, uint8_t out_ip4[4])
-{
-	int fd = sys_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-	if (fd < 0) return -1;
-
-	struct timeval tv;
-	tv.tv_sec = 1;
-	tv.tv_usec = 0;
-	(void)sys_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
-
-	struct sockaddr_in ns;
-	c_memset(&ns, 0, sizeof(ns));
-	ns.sin_family = (uint16_t)AF_INET;
-	ns.sin_port = htons(53);
-	ns.sin_addr = *ns_ip;
-
-	uint8_t pkt[512];
-	c_memset(pkt, 0, sizeof(pkt));
-	struct dns_header *h = (struct dns_header *)pkt;
-
-	uint16_t id = 0x1234;
-	uint16_t rid = 0;
-	if (sys_getrandom(&rid, sizeof(rid), 0) == (long)sizeof(rid)) {
-		id = rid;
-	}
-
-	h->id = htons(id);
-	h->flags = htons(0x0100);
-	h->qdcount = htons(1);
-
-	size_t off = sizeof(struct dns_header);
-	size_t qn = dns_write_qname(&pkt[off], sizeof(pkt) - off, host);
-	if (qn == 0) {
-		sys_close(fd);
-		return -1;
-	}
-	off += qn;
-	if (off + 4 > sizeof(pkt)) {
-		sys_close(fd);
-		return -1;
-	}
-	/* QTYPE A (1), QCLASS IN (1) */
-	pkt[off + 0] = 0;
-	pkt[off + 1] = 1;
-	pkt[off + 2] = 0;
-	pkt[off + 3] = 1;
-	off += 4;
-
-	ssize_t sent = sys_sendto(fd, pkt, off, 0, &ns, (uint32_t)sizeof(ns));
-	if (sent < 0) {
-		sys_close(fd);
-		return -1;
-	}
+enum {
+	DNS_MAX_SERVERS = RESOLV_MAX_NAMESERVERS + 4,
+};
 
-	uint8_t resp[512];
-	struct sockaddr_in from;
-	socklen_t fromlen = (socklen_t)sizeof(from);
-	ssize_t rcv = sys_recvfrom(fd, resp, sizeof(resp), 0, &from, &fromlen);
-	sys_close(fd);
-	if (rcv < (ssize_t)sizeof(struct dns_header)) {
-		return -1;
-	}
+struct dns_server {
+	int family;
+	uint32_t len;
+	union {
+		struct sockaddr_in6 in6;
+		struct sockaddr_in in4;
+	} sa;
+};
 
-	size_t rlen = (size_t)rcv;
-	const struct dns_header *rh = (const struct dns_header *)resp;
-	if (ntohs(rh->id) != id) {
-		return -1;
-	}
-	uint16_t flags = ntohs(rh->flags);
-	if ((flags & 0x8000u) == 0) return -1;
-	if ((flags & 0x000Fu) != 0) return -1;
+static inline void dns_server_set6(struct dns_server *s, const uint8_t ip[16])
+{
+	c_memset(s, 0, sizeof(*s));
+	s->family = AF_INET6;
+	s->len = (uint32_t)sizeof(s->sa.in6);
+	s->sa.in6.sin6_family = (uint16_t)AF_INET6;
+	s->sa.in6.sin6_port = htons(53);
+	c_memcpy(s->sa.in6.sin6_addr.s6_addr, ip, 16);
+}
 
-	uint16_t qd = ntohs(rh->qdcount);
-	uint16_t an = ntohs(rh->ancount);
-	if (qd < 1 || an < 1) return -1;
+static inline void dns_server_set4(struct dns_server *s, const struct in_addr *ip)
+{
+	c_memset(s, 0, sizeof(*s));
+	s->family = AF_INET;
+	s->len = (uint32_t)sizeof(s->sa.in4);
+	s->sa.in4.sin_family = (uint16_t)AF_INET;
+	s->sa.in4.sin_port = htons(53);
+	s->sa.in4.sin_addr = *ip;
+}
 
-	size_t roff = sizeof(struct dns_header);
-	for (uint16_t qi = 0; qi < qd; qi++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 4 > rlen) return -1;
-		off = noff + 4;
-		roff = off;
+/* Query order: resolv.conf nameservers, then Google over IPv6 (some setups
+ * have IPv6 but not IPv4), then Google over IPv4. Returns the count.
+ */
+static inline uint32_t dns_server_list(struct dns_server out[DNS_MAX_SERVERS])
+{
+	uint32_t n = 0;
+	const struct resolv_conf *rc = resolv_system_conf();
+	for (uint32_t i = 0; i < rc->n; i++) {
+		if (rc->ns[i].family == AF_INET6) {
+			dns_server_set6(&out[n++], rc->ns[i].addr);
+		} else {
+			struct in_addr a;
+			c_memcpy(&a.s_addr, rc->ns[i].addr, 4);
+			dns_server_set4(&out[n++], &a);
+		}
 	}
+	struct in6_addr ns6;
+	google_dns_primary(&ns6);
+	dns_server_set6(&out[n++], ns6.s6_addr);
+	google_dns_secondary(&ns6);
+	dns_server_set6(&out[n++], ns6.s6_addr);
+	struct in_addr ns4;
+	google_dns4_primary(&ns4);
+	dns_server_set4(&out[n++], &ns4);
+	google_dns4_secondary(&ns4);
+	dns_server_set4(&out[n++], &ns4);
+	return n;
+}
 
-	for (uint16_t ai = 0; ai < an; ai++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 10 > rlen) return -1;
-		uint16_t type = (uint16_t)((resp[noff + 0] << 8) | resp[noff + 1]);
-		uint16_t cls = (uint16_t)((resp[noff + 2] << 8) | resp[noff + 3]);
-		uint16_t rdlen = (uint16_t)((resp[noff + 8] << 8) | resp[noff + 9]);
-		size_t rdata = noff + 10;
-		if (rdata + rdlen > rlen) return -1;
-
-		if (type == 1 && cls == 1 && rdlen == 4) {
-			out_ip4[0] = resp[rdata + 0];
-			out_ip4[1] = resp[rdata + 1];
-			out_ip4[2] = resp[rdata + 2];
-			out_ip4[3] = resp[rdata + 3];
-			return 0;
-		}
-		roff = rdata + rdlen;
+/* Walks dns_server_list(). A definite answer, positive or negative, ends
+ * the search.
+ */
+static inline int dns_query_servers(const char *host, uint16_t qtype, uint8_t *out, size_t addr_len, uint32_t *out_ttl)
+{
+	struct dns_server servers[DNS_MAX_SERVERS];
+	uint32_t n = dns_server_list(servers);
+	int r = DNS_ERROR;
+	for (uint32_t i = 0; i < n && r == DNS_ERROR; i++) {
+		r = dns_query_server(servers[i].family, &servers[i].sa, servers[i].len, host, qtype, out, addr_len, out_ttl);
 	}
+	return r;
+}
 
-	return -1;
+/* /etc/hosts for one qtype: DNS_ANSWER, DNS_NO_ANSWER (listed with the other
+ * family only), or DNS_ERROR when the name is not listed.
+ */
+static inline int dns_hosts_lookup(const char *host, uint16_t qtype, uint8_t *out)
+{
+	int r = resolv_system_hosts(host, (qtype == DNS_TYPE_AAAA) ? AF_INET6 : AF_INET, out);
+	if (r == RESOLV_HOSTS_FOUND) return DNS_ANSWER;
+	if (r == RESOLV_HOSTS_NODATA) return DNS_NO_ANSWER;
+	return DNS_ERROR;
 }
 
-static inline int dns_try_server_a6(const struct in6_addr *ns_ip, const char *host, uint8_t out_ip4[4])
+/* Remembers the outcome of a dns_query_*() call; errors are not cached. */
+static inline void dns_cache_remember(const char *host, uint16_t qtype, uint64_t now, int r, uint32_t ttl, const uint8_t *addr, size_t addr_len)
 {
-	int fd = sys_socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
-	if (fd < 0) return -1;
+	if (r == DNS_ANSWER) dns_cache_store(host, qtype, now, ttl, addr, addr_len);
+	else if (r == DNS_NO_ANSWER) dns_cache_store(host, qtype, now, ttl, 0, 0);
+}
 
-	struct timeval tv;
-	tv.tv_sec = 1;
-	tv.tv_usec = 0;
-	(void)sys_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
+/* Returns 0 and the address, or -1. Consults /etc/hosts, then dns_cache. */
+static inline int dns_resolve_cached(const char *host, uint16_t qtype, uint8_t *out, size_t addr_len)
+{
+	int h = dns_hosts_lookup(host, qtype, out);
+	if (h != DNS_ERROR) return (h == DNS_ANSWER) ? 0 : -1;
+	uint64_t now = c_mono_ms();
+	enum dns_cache_result c = dns_cache_lookup(host, qtype, now, out, addr_len);
+	if (c == DNS_CACHE_HIT) return 0;
+	if (c == DNS_CACHE_NEGATIVE) return -1;
+
+	uint32_t ttl = 0;
+	int r = dns_query_servers(host, qtype, out, addr_len, &ttl);
+	dns_cache_remember(host, qtype, now, r, ttl, out, addr_len);
+	return (r == DNS_ANSWER) ? 0 : -1;
+}
 
-	struct sockaddr_in6 ns;
-	c_memset(&ns, 0, sizeof(ns));
-	ns.sin6_family = (uint16_t)AF_INET6;
-	ns.sin6_port = htons(53);
-	ns.sin6_addr = *ns_ip;
+static inline int dns_resolve_aaaa(const char *host, uint8_t out_ip[16])
+{
+	return dns_resolve_cached(host, DNS_TYPE_AAAA, out_ip, 16);
+}
 
-	uint8_t pkt[512];
-	c_memset(pkt, 0, sizeof(pkt));
-	struct dns_header *h = (struct dns_header *)pkt;
+static inline int dns_resolve_a4(const char *host, uint8_t out_ip4[4])
+{
+	return dns_resolve_cached(host, DNS_TYPE_A, out_ip4, 4);
+}
 
-	uint16_t id = 0x1234;
-	uint16_t rid = 0;
-	if (sys_getrandom(&rid, sizeof(rid), 0) == (long)sizeof(rid)) {
-		id = rid;
-	}
+enum {
+	/* RFC 8305 Resolution Delay: once one family has an address, wait
+	 * this long for the other before giving up on it.
+	 */
+	DNS_RESOLUTION_DELAY_MS = 50,
+	DNS_SERVER_TIMEOUT_MS = 1000,
+};
 
-	h->id = htons(id);
-	h->flags = htons(0x0100);
-	h->qdcount = htons(1);
+/* One lookup of a dns_resolve_both() pair. */
+struct dns_pending {
+	uint16_t qtype;
+	uint16_t id;
+	uint8_t *out;
+	size_t addr_len;
+	int result;   /* DNS_ERROR until answered */
+	uint32_t ttl;
+	uint8_t sent; /* outstanding at the current server */
+};
 
-	size_t off = sizeof(struct dns_header);
-	size_t qn = dns_write_qname(&pkt[off], sizeof(pkt) - off, host);
-	if (qn == 0) {
-		sys_close(fd);
-		return -1;
-	}
-	off += qn;
-	if (off + 4 > sizeof(pkt)) {
-		sys_close(fd);
-		return -1;
+static inline int dns_id_in_use(const struct dns_pending *q, uint32_t n, uint16_t id)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		if (q[i].sent && q[i].id == id) return 1;
 	}
-	/* QTYPE A (1), QCLASS IN (1) */
-	pkt[off + 0] = 0;
-	pkt[off + 1] = 1;
-	pkt[off + 2] = 0;
-	pkt[off + 3] = 1;
-	off += 4;
+	return 0;
+}
 
-	ssize_t sent = sys_sendto(fd, pkt, off, 0, &ns, (uint32_t)sizeof(ns));
-	if (sent < 0) {
-		sys_close(fd);
-		return -1;
+/* Sends every unanswered query of q[0..n) to one server from a single
+ * non-blocking socket and polls for the answers. Responses are matched by
+ * id and question type, so they may arrive in any order.
+ */
+static inline void dns_query_server_multi(int family, const void *ns, uint32_t ns_len, const char *host, struct dns_pending *q, uint32_t n)
+{
+	int fd = sys_socket(family, SOCK_DGRAM, IPPROTO_UDP);
+	if (fd < 0) return;
+	int nb = 1;
+	(void)sys_ioctl(fd, FIONBIO, &nb);
+
+	uint32_t outstanding = 0;
+	for (uint32_t i = 0; i < n; i++) {
+		q[i].sent = 0;
+		if (q[i].result != DNS_ERROR) continue;
+		uint8_t pkt[512];
+		/* Responses are matched by id, so the ids must differ. Without
+		 * getrandom() dns_new_id() is constant; step past it then.
+		 */
+		uint16_t id = dns_new_id();
+		while (dns_id_in_use(q, i, id)) {
+			uint16_t r = dns_new_id();
+			id = (r != id) ? r : (uint16_t)(id + 1u);
+		}
+		q[i].id = id;
+		size_t qlen = dns_build_query(pkt, sizeof(pkt), host, q[i].qtype, q[i].id);
+		if (qlen == 0 || sys_sendto(fd, pkt, qlen, 0, ns, ns_len) < 0) continue;
+		q[i].sent = 1;
+		outstanding++;
+	}
+
+	uint64_t deadline = c_mono_ms() + DNS_SERVER_TIMEOUT_MS;
+	int have_addr = 0;
+	while (outstanding) {
+		uint64_t now = c_mono_ms();
+		if (now >= deadline) break;
+		struct pollfd pfd;
+		pfd.fd = fd;
+		pfd.events = (short)POLLIN;
+		pfd.revents = 0;
+		if (sys_poll(&pfd, 1, (int)(deadline - now)) <= 0) break;
+
+		for (;;) {
+			uint8_t resp[512];
+			struct sockaddr_in6 from;
+			socklen_t fromlen = (socklen_t)sizeof(from);
+			ssize_t rcv = sys_recvfrom(fd, resp, sizeof(resp), 0, &from, &fromlen);
+			if (rcv < 2) break;
+			uint16_t id = (uint16_t)((resp[0] << 8) | resp[1]);
+			for (uint32_t i = 0; i < n; i++) {
+				/* A response for the wrong type is not this query's. */
+				if (!q[i].sent || !dns_response_matches(resp, (size_t)rcv, q[i].id, q[i].qtype)) continue;
+				q[i].result = dns_parse_response(resp, (size_t)rcv, id, q[i].qtype, q[i].out, q[i].addr_len, &q[i].ttl);
+				q[i].sent = 0;
+				outstanding--;
+				if (q[i].result == DNS_ANSWER && !have_addr) {
+					have_addr = 1;
+					uint64_t d = c_mono_ms() + DNS_RESOLUTION_DELAY_MS;
+					if (d < deadline) deadline = d;
+				}
+				break;
+			}
+		}
 	}
-
-	uint8_t resp[512];
-	struct sockaddr_in6 from;
-	socklen_t fromlen = (socklen_t)sizeof(from);
-	ssize_t rcv = sys_recvfrom(fd, resp, sizeof(resp), 0, &from, &fromlen);
 	sys_close(fd);
-	if (rcv < (ssize_t)sizeof(struct dns_header)) {
-		return -1;
-	}
-
-	size_t rlen = (size_t)rcv;
-	const struct dns_header *rh = (const struct dns_header *)resp;
-	if (ntohs(rh->id) != id) {
-		return -1;
+	/* Given up after the resolution delay: not worth asking another server.
+	 * ttl 0 keeps this non-answer out of the cache.
+	 */
+	if (have_addr) {
+		for (uint32_t i = 0; i < n; i++) {
+			if (!q[i].sent) continue;
+			q[i].result = DNS_NO_ANSWER;
+			q[i].ttl = 0;
+		}
 	}
-	uint16_t flags = ntohs(rh->flags);
-	if ((flags & 0x8000u) == 0) return -1;
-	if ((flags & 0x000Fu) != 0) return -1;
-
-	uint16_t qd = ntohs(rh->qdcount);
-	uint16_t an = ntohs(rh->ancount);
-	if (qd < 1 || an < 1) return -1;
+}
 
-	size_t roff = sizeof(struct dns_header);
-	for (uint16_t qi = 0; qi < qd; qi++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 4 > rlen) return -1;
-		off = noff + 4;
-		roff = off;
+/* Resolves AAAA and A for host together: both queries go out at once and
+ * the pair moves through dns_server_list() in order. /etc/hosts and the
+ * cache are consulted first. Sets *ok6 and *ok4 to whether ip6/ip4 were
+ * filled.
+ */
+static inline void dns_resolve_both(const char *host, uint8_t ip6[16], int *ok6, uint8_t ip4[4], int *ok4)
+{
+	struct dns_pending q[2];
+	c_memset(q, 0, sizeof(q));
+	q[0].qtype = DNS_TYPE_AAAA;
+	q[0].out = ip6;
+	q[0].addr_len = 16;
+	q[1].qtype = DNS_TYPE_A;
+	q[1].out = ip4;
+	q[1].addr_len = 4;
+
+	uint64_t now = c_mono_ms();
+	int cached[2];
+	for (uint32_t i = 0; i < 2; i++) {
+		q[i].result = dns_hosts_lookup(host, q[i].qtype, q[i].out);
+		if (q[i].result == DNS_ERROR) {
+			enum dns_cache_result c = dns_cache_lookup(host, q[i].qtype, now, q[i].out, q[i].addr_len);
+			if (c == DNS_CACHE_HIT) q[i].result = DNS_ANSWER;
+			if (c == DNS_CACHE_NEGATIVE) q[i].result = DNS_NO_ANSWER;
+		}
+		cached[i] = (q[i].result != DNS_ERROR);
 	}
 
-	for (uint16_t ai = 0; ai < an; ai++) {
-		size_t noff = dns_skip_name(resp, rlen, roff);
-		if (noff == 0 || noff + 10 > rlen) return -1;
-		uint16_t type = (uint16_t)((resp[noff + 0] << 8) | resp[noff + 1]);
-		uint16_t cls = (uint16_t)((resp[noff + 2] << 8) | resp[noff + 3]);
-		uint16_t rdlen = (uint16_t)((resp[noff + 8] << 8) | resp[noff + 9]);
-		size_t rdata = noff + 10;
-		if (rdata + rdlen > rlen) return -1;
-
-		if (type == 1 && cls == 1 && rdlen == 4) {
-			out_ip4[0] = resp[rdata + 0];
-			out_ip4[1] = resp[rdata + 1];
-			out_ip4[2] = resp[rdata + 2];
-			out_ip4[3] = resp[rdata + 3];
-			return 0;
+	if (!cached[0] || !cached[1]) {
+		struct dns_server servers[DNS_MAX_SERVERS];
+		uint32_t n = dns_server_list(servers);
+		for (uint32_t i = 0; i < n && (q[0].result == DNS_ERROR || q[1].result == DNS_ERROR); i++) {
+			dns_query_server_multi(servers[i].family, &servers[i].sa, servers[i].len, host, q, 2);
 		}
-		roff = rdata + rdlen;
 	}
 
-	return -1;
-}
-
-static inline int dns_resolve_a_google4(const char *host, uint8_t out_ip4[4])
-{
-	/* Prefer Google DNS via IPv6 for A too (some setups have IPv6 but not IPv4). */
-	struct in6_addr ns6;
-	google_dns_primary(&ns6);
-	if (dns_try_server_a6(&ns6, host, out_ip4) == 0) return 0;
-	google_dns_secondary(&ns6);
-	if (dns_try_server_a6(&ns6, host, out_ip4) == 0) return 0;
-
-	struct in_addr ns;
-	google_dns4_primary(&ns);
-	if (dns_try_server_a4(&ns, host, out_ip4) == 0) return 0;
-	google_dns4_secondary(&ns);
-	return dns_try_server_a4(&ns, host, out_ip4);
+	for (uint32_t i = 0; i < 2; i++) {
+		if (!cached[i]) dns_cache_remember(host, q[i].qtype, now, q[i].result, q[i].ttl, q[i].out, q[i].addr_len);
+	}
+	*ok6 = (q[0].result == DNS_ANSWER);
+	*ok4 = (q[1].result == DNS_ANSWER);
 }
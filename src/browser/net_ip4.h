@@ -55,3 +55,25 @@ static inline void ip4_to_str(char out[16], const uint8_t ip[4])
 	}
 	*p = 0;
 }
+
+/* Parses dotted decimal "a.b.c.d" (exactly n bytes). Returns 0 on success. */
+static inline int ip4_parse(const char *s, size_t n, uint8_t out[4])
+{
+	size_t i = 0;
+	for (int part = 0; part < 4; part++) {
+		if (part > 0) {
+			if (i >= n || s[i] != '.') return -1;
+			i++;
+		}
+		uint32_t v = 0;
+		size_t digits = 0;
+		while (i < n && s[i] >= '0' && s[i] <= '9' && digits < 3) {
+			v = v * 10u + (uint32_t)(s[i] - '0');
+			i++;
+			digits++;
+		}
+		if (digits == 0 || v > 255u) return -1;
+		out[part] = (uint8_t)v;
+	}
+	return (i == n) ? 0 : -1;
+}
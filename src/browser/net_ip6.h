@@ -74,3 +74,64 @@ static inline int ip6_eq(const uint8_t a[16], const uint8_t b[16])
 	for (int i = 0; i < 16; i++) acc |= (uint8_t)(a[i] ^ b[i]);
 	return acc == 0;
 }
+
+static inline int ip6__hex(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+/* Parses hex groups with at most one "::" (exactly n bytes; no embedded
+ * dotted IPv4, no %scope). Returns 0 on success.
+ */
+static inline int ip6_parse(const char *s, size_t n, uint8_t out[16])
+{
+	uint16_t head[8];
+	uint16_t tail[8];
+	uint32_t nh = 0;
+	uint32_t nt = 0;
+	int gap = 0;
+	size_t i = 0;
+	if (n >= 2 && s[0] == ':' && s[1] == ':') {
+		gap = 1;
+		i = 2;
+	}
+	while (i < n) {
+		uint32_t v = 0;
+		size_t digits = 0;
+		int d;
+		while (i < n && digits < 4 && (d = ip6__hex(s[i])) >= 0) {
+			v = (v << 4) | (uint32_t)d;
+			i++;
+			digits++;
+		}
+		if (digits == 0) return -1;
+		if (nh + nt >= 8) return -1;
+		if (gap) tail[nt++] = (uint16_t)v;
+		else head[nh++] = (uint16_t)v;
+		if (i == n) break;
+		if (s[i] != ':') return -1;
+		i++;
+		if (i < n && s[i] == ':') {
+			if (gap) return -1;
+			gap = 1;
+			i++;
+		} else if (i == n) {
+			return -1; /* trailing single ':' */
+		}
+	}
+	if (gap ? (nh + nt > 7) : (nh != 8)) return -1;
+	c_memset(out, 0, 16);
+	for (uint32_t k = 0; k < nh; k++) {
+		out[k * 2] = (uint8_t)(head[k] >> 8);
+		out[k * 2 + 1] = (uint8_t)head[k];
+	}
+	for (uint32_t k = 0; k < nt; k++) {
+		uint32_t g = 8u - nt + k;
+		out[g * 2] = (uint8_t)(tail[k] >> 8);
+		out[g * 2 + 1] = (uint8_t)tail[k];
+	}
+	return 0;
+}
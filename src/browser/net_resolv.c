@@ -0,0 +1,136 @@
+#include "net_resolv.h"
+
+static int resolv_is_blank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static char resolv_lower(char c)
+{
+	return (c >= 'A' && c <= 'Z') ? (char)(c + 32) : c;
+}
+
+/* Next whitespace-separated word of the line [*pos, end); comments end it. */
+static int resolv_next_word(const char *text, size_t end, size_t *pos, size_t *w0, size_t *w1)
+{
+	size_t i = *pos;
+	while (i < end && resolv_is_blank(text[i])) i++;
+	if (i >= end || text[i] == '#' || text[i] == ';') return 0;
+	*w0 = i;
+	while (i < end && !resolv_is_blank(text[i]) && text[i] != '#') i++;
+	*w1 = i;
+	*pos = i;
+	return 1;
+}
+
+static int resolv_word_eq(const char *text, size_t w0, size_t w1, const char *s)
+{
+	size_t i = 0;
+	for (; w0 + i < w1; i++) {
+		if (!s[i] || resolv_lower(text[w0 + i]) != resolv_lower(s[i])) return 0;
+	}
+	return s[i] == 0;
+}
+
+static size_t resolv_line_end(const char *text, size_t len, size_t pos)
+{
+	while (pos < len && text[pos] != '\n' && text[pos] != 0) pos++;
+	return pos;
+}
+
+void resolv_conf_parse(const char *text, size_t len, struct resolv_conf *out)
+{
+	out->n = 0;
+	size_t pos = 0;
+	while (pos < len && text[pos] != 0) {
+		size_t end = resolv_line_end(text, len, pos);
+		size_t p = pos;
+		size_t k0, k1, a0, a1;
+		if (out->n < RESOLV_MAX_NAMESERVERS && resolv_next_word(text, end, &p, &k0, &k1) &&
+		    resolv_word_eq(text, k0, k1, "nameserver") && resolv_next_word(text, end, &p, &a0, &a1)) {
+			struct resolv_nameserver *ns = &out->ns[out->n];
+			if (ip4_parse(&text[a0], a1 - a0, ns->addr) == 0) {
+				ns->family = AF_INET;
+				out->n++;
+			} else if (ip6_parse(&text[a0], a1 - a0, ns->addr) == 0) {
+				ns->family = AF_INET6;
+				out->n++;
+			}
+		}
+		pos = end + 1;
+	}
+}
+
+int resolv_hosts_find(const char *text, size_t len, const char *name, int family, uint8_t *out)
+{
+	int listed = 0;
+	size_t pos = 0;
+	while (pos < len && text[pos] != 0) {
+		size_t end = resolv_line_end(text, len, pos);
+		size_t p = pos;
+		size_t a0, a1;
+		if (resolv_next_word(text, end, &p, &a0, &a1)) {
+			uint8_t addr[16];
+			int fam = 0;
+			if (ip4_parse(&text[a0], a1 - a0, addr) == 0) fam = AF_INET;
+			else if (ip6_parse(&text[a0], a1 - a0, addr) == 0) fam = AF_INET6;
+			size_t n0, n1;
+			while (fam && resolv_next_word(text, end, &p, &n0, &n1)) {
+				if (!resolv_word_eq(text, n0, n1, name)) continue;
+				if (fam == family) {
+					c_memcpy(out, addr, (family == AF_INET6) ? 16u : 4u);
+					return RESOLV_HOSTS_FOUND;
+				}
+				listed = 1;
+				break;
+			}
+		}
+		pos = end + 1;
+	}
+	return listed ? RESOLV_HOSTS_NODATA : RESOLV_HOSTS_MISS;
+}
+
+static struct resolv_conf g_resolv_conf;
+static char g_resolv_hosts[RESOLV_HOSTS_MAX];
+static size_t g_resolv_hosts_len;
+static int g_resolv_loaded;
+
+static size_t resolv_read_file(const char *path, char *buf, size_t cap)
+{
+	int fd = sys_openat(AT_FDCWD, path, O_RDONLY, 0);
+	if (fd < 0) return 0;
+	size_t n = 0;
+	while (n < cap) {
+		ssize_t r = sys_read(fd, buf + n, cap - n);
+		if (r <= 0) break;
+		n += (size_t)r;
+	}
+	sys_close(fd);
+	/* A truncated last line would read as a shorter name or address. */
+	if (n == cap) {
+		while (n > 0 && buf[n - 1] != '\n') n--;
+	}
+	return n;
+}
+
+static void resolv_load(void)
+{
+	if (g_resolv_loaded) return;
+	g_resolv_loaded = 1;
+	static char conf[RESOLV_CONF_MAX];
+	size_t n = resolv_read_file("/etc/resolv.conf", conf, sizeof(conf));
+	resolv_conf_parse(conf, n, &g_resolv_conf);
+	g_resolv_hosts_len = resolv_read_file("/etc/hosts", g_resolv_hosts, sizeof(g_resolv_hosts));
+}
+
+const struct resolv_conf *resolv_system_conf(void)
+{
+	resolv_load();
+	return &g_resolv_conf;
+}
+
+int resolv_system_hosts(const char *name, int family, uint8_t *out)
+{
+	resolv_load();
+	return resolv_hosts_find(g_resolv_hosts, g_resolv_hosts_len, name, family, out);
+}
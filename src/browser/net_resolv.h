@@ -0,0 +1,47 @@
+#pragma once
+
+#include "net_ip4.h"
+#include "net_ip6.h"
+
+/*
+ * System resolver configuration, read with plain syscalls.
+ *
+ * /etc/resolv.conf supplies up to RESOLV_MAX_NAMESERVERS "nameserver" lines
+ * (IPv4 or IPv6; scoped link-local addresses are skipped). /etc/hosts is
+ * kept as text (up to RESOLV_HOSTS_MAX bytes) and scanned on lookup.
+ * Both files are read once per process, on first use.
+ */
+
+enum {
+	RESOLV_MAX_NAMESERVERS = 3,
+	RESOLV_CONF_MAX = 4096,
+	RESOLV_HOSTS_MAX = 64 * 1024,
+};
+
+struct resolv_nameserver {
+	int family; /* AF_INET6 or AF_INET */
+	uint8_t addr[16];
+};
+
+struct resolv_conf {
+	uint32_t n;
+	struct resolv_nameserver ns[RESOLV_MAX_NAMESERVERS];
+};
+
+/* resolv_hosts_find() results. */
+enum {
+	RESOLV_HOSTS_MISS = 0,   /* name not listed: ask DNS */
+	RESOLV_HOSTS_FOUND = 1,  /* address of the requested family copied out */
+	RESOLV_HOSTS_NODATA = 2, /* listed, but only with the other family */
+};
+
+void resolv_conf_parse(const char *text, size_t len, struct resolv_conf *out);
+
+/* Looks up name (case-insensitive) in hosts(5) text for family
+ * AF_INET6 (16-byte out) or AF_INET (4-byte out).
+ */
+int resolv_hosts_find(const char *text, size_t len, const char *name, int family, uint8_t *out);
+
+/* The same against this process's /etc/resolv.conf and /etc/hosts. */
+const struct resolv_conf *resolv_system_conf(void);
+int resolv_system_hosts(const char *name, int family, uint8_t *out);
@@ -9,6 +9,11 @@ static inline int tcp__set_blocking(int fd, int is_blocking)
 	return sys_ioctl(fd, FIONBIO, &nb);
 }
 
+enum {
+	/* From linux/tcp.h (level IPPROTO_TCP). */
+	TCP_NODELAY = 1,
+};
+
 static inline void tcp__set_timeouts(int fd, int sec)
 {
 	struct timeval tv;
@@ -18,6 +23,15 @@ static inline void tcp__set_timeouts(int fd, int sec)
 	(void)sys_setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, (uint32_t)sizeof(tv));
 }
 
+/* The TLS layer already hands each flight to one write; Nagle would only
+ * hold a request back until the ACK for the client Finished comes in.
+ */
+static inline void tcp__set_nodelay(int fd)
+{
+	int one = 1;
+	(void)sys_setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, (uint32_t)sizeof(one));
+}
+
 static inline int tcp__connect_with_timeout(int fd, const void *sa, uint32_t sa_len, int timeout_ms)
 {
 	if (tcp__set_blocking(fd, 0) < 0) return -1;
@@ -79,6 +93,7 @@ static inline int tcp6_connect(const uint8_t ip[16], uint16_t port)
 
 	/* Prevent TLS/HTTP from blocking forever on reads/writes. */
 	tcp__set_timeouts(fd, 5);
+	tcp__set_nodelay(fd);
 
 	return fd;
 }
@@ -107,6 +122,164 @@ static inline int tcp4_connect(const uint8_t ip[4], uint16_t port)
 
 	/* Prevent TLS/HTTP from blocking forever on reads/writes. */
 	tcp__set_timeouts(fd, 5);
+	tcp__set_nodelay(fd);
+
+	return fd;
+}
+
+enum {
+	/* RFC 8305 Connection Attempt Delay: head start for IPv6. */
+	TCP_CONNECT_ATTEMPT_DELAY_MS = 250,
+	TCP_CONNECT_TIMEOUT_MS = 3000,
+};
 
+/* Starts a non-blocking connect. Returns the fd, or a negative errno if the
+ * attempt failed at once; *out_done is set if it connected immediately.
+ */
+static inline int tcp__start_connect(int family, const void *sa, uint32_t sa_len, int *out_done)
+{
+	*out_done = 0;
+	int fd = sys_socket(family, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) return fd;
+	if (tcp__set_blocking(fd, 0) < 0) {
+		sys_close(fd);
+		return -1;
+	}
+	int rc = sys_connect(fd, sa, sa_len);
+	if (rc == 0) {
+		*out_done = 1;
+		return fd;
+	}
+	if (rc != -EINPROGRESS) {
+		sys_close(fd);
+		return rc;
+	}
 	return fd;
 }
+
+/* Happy Eyeballs (RFC 8305): connects to whichever of ip6/ip4 (either may be
+ * NULL) answers first. IPv6 starts first; IPv4 follows after
+ * TCP_CONNECT_ATTEMPT_DELAY_MS, or at once if IPv6 fails early. Each attempt
+ * gets TCP_CONNECT_TIMEOUT_MS. Returns the winning fd (blocking, with I/O
+ * timeouts) and its family in *out_family, or the last negative errno.
+ * *out_err6 and *out_err4 (if non-NULL) receive each family's error, 0 if it
+ * won or was never tried.
+ */
+static inline int tcp_connect_race(const uint8_t *ip6, const uint8_t *ip4, uint16_t port, int *out_family, int *out_err6, int *out_err4)
+{
+	struct sockaddr_in6 sa6;
+	c_memset(&sa6, 0, sizeof(sa6));
+	sa6.sin6_family = (uint16_t)AF_INET6;
+	sa6.sin6_port = htons(port);
+	if (ip6) c_memcpy(sa6.sin6_addr.s6_addr, ip6, 16);
+
+	struct sockaddr_in sa4;
+	c_memset(&sa4, 0, sizeof(sa4));
+	sa4.sin_family = (uint16_t)AF_INET;
+	sa4.sin_port = htons(port);
+	if (ip4) {
+		uint32_t host = ((uint32_t)ip4[0] << 24u) | ((uint32_t)ip4[1] << 16u) | ((uint32_t)ip4[2] << 8u) | (uint32_t)ip4[3];
+		sa4.sin_addr.s_addr = htonl(host);
+	}
+
+	/* Slot 0 is IPv6, slot 1 IPv4. */
+	int fd[2] = { -1, -1 };
+	int err[2] = { 0, 0 };
+	int todo[2] = { ip6 != 0, ip4 != 0 };
+	uint64_t start[2] = { 0, 0 };
+	int winner = -1;
+	uint64_t t0 = c_mono_ms();
+	uint64_t v4_at = ip6 ? t0 + TCP_CONNECT_ATTEMPT_DELAY_MS : t0;
+
+	for (;;) {
+		uint64_t now = c_mono_ms();
+		for (int k = 0; k < 2 && winner < 0; k++) {
+			if (!todo[k]) continue;
+			/* IPv4 waits for its turn unless IPv6 is already out of the race. */
+			if (k == 1 && now < v4_at && (todo[0] || fd[0] >= 0)) continue;
+			todo[k] = 0;
+			int done = 0;
+			int r = (k == 0) ? tcp__start_connect(AF_INET6, &sa6, (uint32_t)sizeof(sa6), &done)
+					 : tcp__start_connect(AF_INET, &sa4, (uint32_t)sizeof(sa4), &done);
+			if (r < 0) {
+				err[k] = r;
+				continue;
+			}
+			fd[k] = r;
+			start[k] = now;
+			if (done) winner = k;
+		}
+		if (winner >= 0) break;
+		if (fd[0] < 0 && fd[1] < 0) {
+			if (!todo[1]) break;
+			continue; /* IPv6 failed at once: start IPv4 now */
+		}
+
+		/* Wait for a connect to finish, an attempt to time out, or IPv4's turn. */
+		struct pollfd pfd[2];
+		int slot[2];
+		nfds_t np = 0;
+		uint64_t wake = (uint64_t)-1;
+		for (int k = 0; k < 2; k++) {
+			if (fd[k] < 0) continue;
+			pfd[np].fd = fd[k];
+			pfd[np].events = (short)(POLLOUT | POLLERR | POLLHUP);
+			pfd[np].revents = 0;
+			slot[np++] = k;
+			uint64_t dl = start[k] + TCP_CONNECT_TIMEOUT_MS;
+			if (dl < wake) wake = dl;
+		}
+		if (todo[1] && v4_at < wake) wake = v4_at;
+		int timeout = (wake > now) ? (int)(wake - now) : 0;
+		int prc = sys_poll(pfd, np, timeout);
+		if (prc < 0) {
+			winner = -1;
+			err[0] = err[0] ? err[0] : prc;
+			break;
+		}
+
+		now = c_mono_ms();
+		for (nfds_t i = 0; i < np; i++) {
+			int k = slot[i];
+			int failed = 0;
+			if (pfd[i].revents) {
+				int soerr = 0;
+				uint32_t optlen = (uint32_t)sizeof(soerr);
+				int grc = sys_getsockopt(fd[k], SOL_SOCKET, SO_ERROR, &soerr, &optlen);
+				if (grc == 0 && soerr == 0) {
+					winner = k;
+					break;
+				}
+				err[k] = (grc < 0) ? grc : -soerr;
+				failed = 1;
+			} else if (now >= start[k] + TCP_CONNECT_TIMEOUT_MS) {
+				err[k] = -ETIMEDOUT;
+				failed = 1;
+			}
+			if (failed) {
+				sys_close(fd[k]);
+				fd[k] = -1;
+				/* A failed IPv6 attempt hands over to IPv4 right away. */
+				if (k == 0) v4_at = now;
+			}
+		}
+		if (winner >= 0) break;
+	}
+
+	for (int k = 0; k < 2; k++) {
+		if (fd[k] >= 0 && k != winner) sys_close(fd[k]);
+	}
+	if (out_err6) *out_err6 = err[0];
+	if (out_err4) *out_err4 = err[1];
+	if (winner < 0) {
+		int e = err[1] ? err[1] : err[0];
+		return e ? e : -1;
+	}
+	int sock = fd[winner];
+	(void)tcp__set_blocking(sock, 1);
+	/* Prevent TLS/HTTP from blocking forever on reads/writes. */
+	tcp__set_timeouts(sock, 5);
+	tcp__set_nodelay(sock);
+	if (out_family) *out_family = (winner == 0) ? AF_INET6 : AF_INET;
+	return sock;
+}
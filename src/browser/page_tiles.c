@@ -0,0 +1,156 @@
+#include "page_tiles.h"
+
+static struct page_tile g_tiles[PAGE_TILE_POOL];
+static uint32_t g_tile_use_tick;
+static uint32_t g_tile_img_epoch;
+static uint32_t g_tile_serial;
+
+static void tile_ref_snapshot(struct page_tile_ref *r, const struct img_sniff_cache_entry *e)
+{
+	r->entry = e;
+	r->hash = e->hash;
+	r->pix_off = e->pix_off;
+	r->state = e->state;
+	r->has_dims = e->has_dims;
+	r->has_pixels = e->has_pixels;
+	r->fmt = (uint8_t)e->fmt;
+}
+
+static int tile_ref_still_valid(const struct page_tile_ref *r)
+{
+	const struct img_sniff_cache_entry *e = r->entry;
+	if (!e || !e->used) return 0;
+	return e->hash == r->hash &&
+	       e->pix_off == r->pix_off &&
+	       e->state == r->state &&
+	       e->has_dims == r->has_dims &&
+	       e->has_pixels == r->has_pixels &&
+	       (uint8_t)e->fmt == r->fmt;
+}
+
+static int tile_images_still_valid(struct page_tile *t)
+{
+	if (t->img_epoch == g_tile_img_epoch) return 1;
+	if (t->refs_unresolved || t->refs_overflow) return 0;
+	for (uint32_t i = 0; i < t->n_refs; i++) {
+		if (!tile_ref_still_valid(&t->refs[i])) return 0;
+	}
+	/* Nothing this tile shows changed; revalidate cheaply for this epoch. */
+	t->img_epoch = g_tile_img_epoch;
+	return 1;
+}
+
+struct page_tile *page_tiles_lookup(uint32_t index, uint32_t layout_gen)
+{
+	for (uint32_t i = 0; i < (uint32_t)PAGE_TILE_POOL; i++) {
+		struct page_tile *t = &g_tiles[i];
+		if (!t->used || t->index != index || t->layout_gen != layout_gen) continue;
+		if (!tile_images_still_valid(t)) {
+			t->used = 0;
+			return 0;
+		}
+		t->last_use = ++g_tile_use_tick;
+		return t;
+	}
+	return 0;
+}
+
+struct page_tile *page_tiles_alloc(uint32_t index, uint32_t layout_gen)
+{
+	struct page_tile *slot = 0;
+	for (uint32_t i = 0; i < (uint32_t)PAGE_TILE_POOL; i++) {
+		struct page_tile *t = &g_tiles[i];
+		if (!t->used) {
+			slot = t;
+			break;
+		}
+		if (!slot || t->last_use < slot->last_use) slot = t;
+	}
+	slot->used = 1;
+	slot->refs_unresolved = 0;
+	slot->refs_overflow = 0;
+	slot->index = index;
+	slot->layout_gen = layout_gen;
+	slot->img_epoch = g_tile_img_epoch;
+	slot->last_use = ++g_tile_use_tick;
+	if (++g_tile_serial == 0) g_tile_serial = 1;
+	slot->serial = g_tile_serial;
+	slot->n_refs = 0;
+	for (uint32_t r = 0; r < (uint32_t)PAGE_TILE_ROWS; r++) {
+		slot->hits[r].n = 0;
+		slot->hits[r].overflow = 0;
+	}
+	return slot;
+}
+
+void page_tiles_note_image(struct page_tile *t, const struct img_sniff_cache_entry *e)
+{
+	if (!t) return;
+	if (!e) {
+		t->refs_unresolved = 1;
+		return;
+	}
+	for (uint32_t i = 0; i < t->n_refs; i++) {
+		if (t->refs[i].entry == e) return;
+	}
+	if (t->n_refs >= (uint32_t)PAGE_TILE_MAX_REFS) {
+		t->refs_overflow = 1;
+		return;
+	}
+	tile_ref_snapshot(&t->refs[t->n_refs++], e);
+}
+
+void page_tiles_note_link(struct page_tile_row_hits *row_hits, uint32_t x0, uint32_t x1, uint16_t link)
+{
+	if (!row_hits || x1 <= x0) return;
+	if (x1 > 0xffffu) x1 = 0xffffu;
+	if (x0 >= x1) return;
+	if (row_hits->n > 0) {
+		/* A link broken into differently styled segments stays one span. */
+		struct page_tile_hit *last = &row_hits->spans[row_hits->n - 1u];
+		if (last->link == link && last->x1 == x0) {
+			last->x1 = (uint16_t)x1;
+			return;
+		}
+	}
+	if (row_hits->n >= (uint8_t)PAGE_TILE_MAX_HITS) {
+		row_hits->overflow = 1;
+		return;
+	}
+	struct page_tile_hit *h = &row_hits->spans[row_hits->n++];
+	h->x0 = (uint16_t)x0;
+	h->x1 = (uint16_t)x1;
+	h->link = link;
+}
+
+int page_tiles_link_at(uint32_t doc_row, uint32_t x, uint32_t layout_gen, uint16_t *out_link)
+{
+	uint32_t index = doc_row / (uint32_t)PAGE_TILE_ROWS;
+	for (uint32_t i = 0; i < (uint32_t)PAGE_TILE_POOL; i++) {
+		const struct page_tile *t = &g_tiles[i];
+		if (!t->used || t->index != index || t->layout_gen != layout_gen) continue;
+		/* Link positions depend only on the layout, so a tile whose images
+		 * went stale still has a valid map.
+		 */
+		const struct page_tile_row_hits *rh = &t->hits[doc_row % (uint32_t)PAGE_TILE_ROWS];
+		if (rh->overflow) return -1;
+		for (uint32_t k = 0; k < rh->n; k++) {
+			if (x >= rh->spans[k].x0 && x < rh->spans[k].x1) {
+				if (out_link) *out_link = rh->spans[k].link;
+				return 1;
+			}
+		}
+		return 0;
+	}
+	return -1;
+}
+
+void page_tiles_images_changed(void)
+{
+	g_tile_img_epoch++;
+}
+
+void page_tiles_invalidate_all(void)
+{
+	for (uint32_t i = 0; i < (uint32_t)PAGE_TILE_POOL; i++) g_tiles[i].used = 0;
+}
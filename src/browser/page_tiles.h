@@ -0,0 +1,96 @@
+#pragma once
+
+#include "browser_defs.h"
+#include "browser_img.h"
+
+/*
+ * Bounded pool of pre-rendered page-body tiles.
+ *
+ * A tile is a full-width strip of PAGE_TILE_H document pixel rows (XRGB),
+ * rendered once from the current layout. Scrolling then becomes row copies
+ * from cached tiles instead of clearing and rasterizing the content area.
+ *
+ * Tiles are keyed by (tile index, layout generation). A new layout generation
+ * (text re-extracted or width changed) makes every tile stale. While rendering,
+ * a tile records the image cache entries it looked up; after
+ * page_tiles_images_changed() only tiles whose images actually changed state
+ * are re-rendered.
+ *
+ * Rendering also records where link text landed in each row of the tile, so a
+ * click on the page resolves to a link with a short scan of one row instead of
+ * replaying the text layout.
+ */
+
+enum {
+	PAGE_TILE_H = 256,
+	PAGE_TILE_ROWS = PAGE_TILE_H / 16,
+	PAGE_TILE_POOL = 8,
+	PAGE_TILE_MAX_REFS = 16,
+	PAGE_TILE_MAX_HITS = 32,
+};
+
+/* Pixel span [x0, x1) of link `link` (index into html_links) in one row. */
+struct page_tile_hit {
+	uint16_t x0;
+	uint16_t x1;
+	uint16_t link;
+};
+
+struct page_tile_row_hits {
+	uint8_t n;
+	uint8_t overflow; /* more link spans than spans[] can hold */
+	struct page_tile_hit spans[PAGE_TILE_MAX_HITS];
+};
+
+struct page_tile_ref {
+	const struct img_sniff_cache_entry *entry;
+	uint32_t hash;
+	uint32_t pix_off;
+	uint8_t state;
+	uint8_t has_dims;
+	uint8_t has_pixels;
+	uint8_t fmt;
+};
+
+struct page_tile {
+	uint8_t used;
+	uint8_t refs_unresolved; /* looked up an image that was not done yet */
+	uint8_t refs_overflow;   /* more images than refs[] can track */
+	uint32_t index;          /* document y / PAGE_TILE_H */
+	uint32_t layout_gen;
+	uint32_t img_epoch;
+	uint32_t last_use;
+	uint32_t serial;         /* unique per render; never 0 */
+	uint32_t n_refs;
+	struct page_tile_ref refs[PAGE_TILE_MAX_REFS];
+	struct page_tile_row_hits hits[PAGE_TILE_ROWS];
+	uint32_t pixels[FB_W * PAGE_TILE_H];
+};
+
+/* Returns a valid cached tile, or NULL if it must be (re)rendered. */
+struct page_tile *page_tiles_lookup(uint32_t index, uint32_t layout_gen);
+
+/* Claims a pool slot (evicting the least recently used tile) for rendering.
+ * The caller fills pixels[] and records image lookups with page_tiles_note_image().
+ */
+struct page_tile *page_tiles_alloc(uint32_t index, uint32_t layout_gen);
+
+/* Records an image cache lookup made while rendering `t` (`e` may be NULL). */
+void page_tiles_note_image(struct page_tile *t, const struct img_sniff_cache_entry *e);
+
+/* Records a link span drawn into `row_hits` (`row_hits` may be NULL). */
+void page_tiles_note_link(struct page_tile_row_hits *row_hits, uint32_t x0, uint32_t x1, uint16_t link);
+
+/* Looks up the link under pixel `x` in document row `doc_row`, using the hit
+ * map of a cached tile of `layout_gen`. Returns 1 and sets *out_link on a hit,
+ * 0 if the row has no link there, -1 if no tile holds a complete map for the
+ * row (the caller has to resolve the click from the layout instead).
+ * Does not touch LRU state.
+ */
+int page_tiles_link_at(uint32_t doc_row, uint32_t x, uint32_t layout_gen, uint16_t *out_link);
+
+/* Call when image workers report new sniff/dims/pixel results. */
+void page_tiles_images_changed(void);
+
+/* Drops every cached tile. */
+void page_tiles_invalidate_all(void);
@@ -1,7 +1,12 @@
 #include "tls13_client.h"
+#include "tls13_ticket.h"
 
 #include "http.h"
 #include "http_parse.h"
+#include "inflate.h"
+#if defined(HAVE_BROTLI)
+#include "brotli.h"
+#endif
 #include "net_ip6.h"
 #include "url.h"
 #include "util.h"
@@ -19,16 +24,21 @@
 
 #define TLS13_MAX_RECORD (18432u)
 
-static int read_full(int fd, uint8_t *buf, size_t n)
-{
-	size_t off = 0;
-	while (off < n) {
-		long r = sys_read(fd, buf + off, n - off);
-		if (r <= 0) return -1;
-		off += (size_t)r;
-	}
-	return 0;
-}
+/* ClientHello handshake message, room for SNI and a TLS13_TICKET_MAX ticket. */
+#define TLS13_CH_MAX (1280u)
+
+/* Largest TLSInnerPlaintext content per record (RFC 8446 5.2). */
+#define TLS13_MAX_PLAINTEXT (16384u)
+
+/* Outgoing records are sealed back to back in one buffer and sent with one
+ * write, so a flight (ClientHello + 0-RTT request, EndOfEarlyData + Finished)
+ * or a request leaves in one segment. Longer data is split into records and
+ * flushed whenever the buffer fills.
+ */
+struct tls13_tx {
+	size_t len;
+	uint8_t buf[8192];
+};
 
 static int write_full(int fd, const uint8_t *buf, size_t n)
 {
@@ -79,30 +89,114 @@ struct http_resp_feed_ctx {
 
 	uint64_t body_total_read;
 	size_t body_stored;
+
+	/* gzip/deflate (and br) bodies are decoded into body as they arrive. */
+	struct inflate_stream *inflate;
+	int coding; /* INFLATE_* framing or HTTP_CODING_BR from Content-Encoding, or -1 */
+	int decoding;
+	int encoded; /* body still carries a Content-Encoding we do not undo */
 };
 
-static int http_resp_feed_body(struct http_resp_feed_ctx *ctx, const uint8_t *in, size_t in_len)
+#if defined(HAVE_BROTLI)
+enum {
+	HTTP_CODING_BR = INFLATE_ZLIB_OR_RAW + 1,
+};
+
+/* Over a megabyte of prefix code tables, so not on the stack. Each process
+ * reads one response at a time (image workers are forked).
+ */
+static struct brotli_stream g_brotli;
+#endif
+
+/* Framing for a Content-Encoding we can undo, or -1 (identity, unknown, or
+ * several codings stacked).
+ */
+static int http_coding_framing(const char *v)
 {
-	if (!ctx || !in) return -1;
+	for (size_t i = 0; v[i]; i++) {
+		if (v[i] == ',') return -1;
+	}
+	if (http_value_has_token_ci(v, "gzip") || http_value_has_token_ci(v, "x-gzip")) return INFLATE_GZIP;
+	if (http_value_has_token_ci(v, "deflate")) return INFLATE_ZLIB_OR_RAW;
+#if defined(HAVE_BROTLI)
+	if (http_value_has_token_ci(v, "br")) return HTTP_CODING_BR;
+#endif
+	return -1;
+}
+
+static void http_resp_decode_init(struct http_resp_feed_ctx *ctx)
+{
+#if defined(HAVE_BROTLI)
+	if (ctx->coding == HTTP_CODING_BR) {
+		brotli_init(&g_brotli, ctx->body, ctx->body_cap);
+		return;
+	}
+#endif
+	inflate_init(ctx->inflate, ctx->coding, ctx->body, ctx->body_cap);
+}
+
+/* Decoded body bytes go to body (capped at body_cap). */
+static int http_resp_store(struct http_resp_feed_ctx *ctx, const uint8_t *in, size_t n)
+{
+	if (ctx->decoding) {
+		/* INFLATE_FULL / BROTLI_FULL: the prefix the caller wanted is there; drop the rest. */
+#if defined(HAVE_BROTLI)
+		if (ctx->coding == HTTP_CODING_BR) {
+			if (brotli_feed(&g_brotli, in, n) < 0) return -1;
+			ctx->body_stored = g_brotli.out_len;
+			return 0;
+		}
+#endif
+		if (inflate_feed(ctx->inflate, in, n) < 0) return -1;
+		ctx->body_stored = ctx->inflate->out_len;
+		return 0;
+	}
+	if (ctx->body && ctx->body_stored < ctx->body_cap) {
+		size_t cap = ctx->body_cap - ctx->body_stored;
+		size_t to_store = (n < cap) ? n : cap;
+		if (to_store) {
+			/* conn_get may have decrypted the record straight into place. */
+			if (in != ctx->body + ctx->body_stored) crypto_memcpy(ctx->body + ctx->body_stored, in, to_store);
+			ctx->body_stored += to_store;
+		}
+	}
+	return 0;
+}
+
+/* Consumes body bytes up to the end of the framing; *out_used says how many. */
+static int http_resp_feed_body(struct http_resp_feed_ctx *ctx, const uint8_t *in, size_t in_len, size_t *out_used)
+{
+	if (!ctx || !in || !out_used) return -1;
+	*out_used = 0;
 
 	if (ctx->is_chunked) {
 		size_t off = 0;
-		while (off < in_len) {
+		while (off < in_len && !ctx->chunked_done) {
 			size_t in_used = 0;
 			size_t wrote = 0;
-			uint8_t *outp = (ctx->body && ctx->body_stored < ctx->body_cap) ? (ctx->body + ctx->body_stored) : 0;
-			size_t out_cap2 = (ctx->body && ctx->body_stored < ctx->body_cap) ? (ctx->body_cap - ctx->body_stored) : 0;
-			int r = http_chunked_feed(ctx->chunked,
-						in + off, in_len - off, &in_used,
-						outp, out_cap2, &wrote);
-			ctx->body_stored += wrote;
+			int r;
+			if (ctx->decoding) {
+				/* De-chunk through a bounce buffer; output never exceeds input. */
+				uint8_t tmp[4096];
+				size_t n = in_len - off;
+				if (n > sizeof(tmp)) n = sizeof(tmp);
+				r = http_chunked_feed(ctx->chunked, in + off, n, &in_used, tmp, sizeof(tmp), &wrote);
+				if (r >= 0 && http_resp_store(ctx, tmp, wrote) != 0) return -1;
+			} else {
+				uint8_t *outp = (ctx->body && ctx->body_stored < ctx->body_cap) ? (ctx->body + ctx->body_stored) : 0;
+				size_t out_cap2 = (ctx->body && ctx->body_stored < ctx->body_cap) ? (ctx->body_cap - ctx->body_stored) : 0;
+				r = http_chunked_feed(ctx->chunked,
+							in + off, in_len - off, &in_used,
+							outp, out_cap2, &wrote);
+				ctx->body_stored += wrote;
+			}
 			ctx->body_total_read += wrote;
 			if (r < 0) return -1;
 			if (r == 1) ctx->chunked_done = 1;
-			if (in_used == 0) return -1;
+			if (in_used == 0 && !ctx->chunked_done) return -1;
 			off += in_used;
-			if (ctx->chunked_done) break;
 		}
+		*out_used = off;
 		return 0;
 	}
 
@@ -112,16 +206,9 @@ static int http_resp_feed_body(struct http_resp_feed_ctx *ctx, const uint8_t *in
 		uint64_t remain = ctx->content_len - ctx->body_total_read;
 		if ((uint64_t)can_read > remain) can_read = (size_t)remain;
 	}
-
-	if (ctx->body && ctx->body_stored < ctx->body_cap) {
-		size_t cap = ctx->body_cap - ctx->body_stored;
-		size_t to_store = (can_read < cap) ? can_read : cap;
-		if (to_store) {
-			crypto_memcpy(ctx->body + ctx->body_stored, in, to_store);
-			ctx->body_stored += to_store;
-		}
-	}
+	if (http_resp_store(ctx, in, can_read) != 0) return -1;
 	ctx->body_total_read += (uint64_t)can_read;
+	*out_used = can_read;
 	return 0;
 }
 
@@ -183,10 +270,14 @@ static int http_resp_feed(struct http_resp_feed_ctx *ctx, const uint8_t *in, siz
 							(void)c_strlcpy_s(ctx->content_type_out, ctx->content_type_out_len, tmp);
 						}
 					}
-					if (ctx->content_encoding_out && ctx->content_encoding_out_len && ctx->content_encoding_out[0] == 0) {
+					{
 						char tmp[256];
 						if (http_header_extract_value(ctx->line, "Content-Encoding", tmp, sizeof(tmp)) == 0) {
-							(void)c_strlcpy_s(ctx->content_encoding_out, ctx->content_encoding_out_len, tmp);
+							ctx->coding = http_coding_framing(tmp);
+							ctx->encoded = !http_value_has_token_ci(tmp, "identity");
+							if (ctx->content_encoding_out && ctx->content_encoding_out_len && ctx->content_encoding_out[0] == 0) {
+								(void)c_strlcpy_s(ctx->content_encoding_out, ctx->content_encoding_out_len, tmp);
+							}
 						}
 					}
 				}
@@ -197,20 +288,30 @@ static int http_resp_feed(struct http_resp_feed_ctx *ctx, const uint8_t *in, siz
 			size_t hdr_end = 0;
 			if (http_find_header_end(ctx->header_buf, ctx->header_len, &hdr_end) == 0) {
 				ctx->got_headers_end = 1;
+				/* A coding we undo here is no longer on the body the caller sees. */
+				if (ctx->coding >= 0 && ctx->inflate) {
+					http_resp_decode_init(ctx);
+					ctx->decoding = 1;
+					ctx->encoded = 0;
+					if (ctx->content_encoding_out && ctx->content_encoding_out_len) ctx->content_encoding_out[0] = 0;
+				}
 				/* Flush any bytes already beyond header end as body. */
 				size_t pre_body = ctx->header_len - hdr_end;
 				if (pre_body) {
 					const uint8_t *pb = ctx->header_buf + hdr_end;
-					if (http_resp_feed_body(ctx, pb, pre_body) != 0) return -1;
+					size_t took = 0;
+					if (http_resp_feed_body(ctx, pb, pre_body, &took) != 0) return -1;
 				}
 			}
+			used++;
 		} else {
-			/* Body */
-			if (http_resp_feed_body(ctx, &b, 1) != 0) return -1;
+			/* Body: everything up to the end of the framing in one go. */
+			size_t took = 0;
+			if (http_resp_feed_body(ctx, in + used, in_len - used, &took) != 0) return -1;
+			used += took;
+			if (took == 0) break;
 		}
 
-		used++;
-
 		if (ctx->got_headers_end) {
 			if (ctx->is_chunked) {
 				if (ctx->chunked_done) break;
@@ -283,13 +384,16 @@ static void tls13_aead_invalidate(struct tls13_aead *a)
 }
 
 static int build_client_hello(const char *host,
-			    uint8_t out_hs[1024], size_t *out_hs_len,
+			    const struct tls13_ticket *ticket, int offer_early, uint64_t now_ms,
+			    uint8_t out_hs[TLS13_CH_MAX], size_t *out_hs_len,
 			    uint8_t priv[X25519_KEY_SIZE], uint8_t pub[X25519_KEY_SIZE]);
-static int send_plain_handshake_record(int fd, const uint8_t *hs, size_t hs_len);
-static int tls_read_record(int fd, uint8_t hdr[5], uint8_t *payload, size_t payload_cap, size_t *payload_len);
-static int parse_server_hello(const uint8_t *hs, size_t hs_len, uint8_t server_pub[X25519_KEY_SIZE]);
+static int tls_tx_plain(int fd, struct tls13_tx *t, uint8_t type, const uint8_t *in, size_t in_len);
+static int tls_rx_record(int fd, struct tls13_rx *rx, const uint8_t **hdr, uint8_t **payload, size_t *payload_len);
+static int parse_server_hello(const uint8_t *hs, size_t hs_len, uint8_t server_pub[X25519_KEY_SIZE], int *out_psk_selected);
 static int derive_hs_traffic(const struct sha256_ctx *transcript,
+			     const uint8_t early_secret[32],
 			     const uint8_t shared[X25519_KEY_SIZE],
+			     uint8_t handshake_secret[32],
 			     uint8_t c_hs_traffic[32], uint8_t s_hs_traffic[32],
 			     struct tls13_aead *out_tx_hs, struct tls13_aead *out_rx_hs);
 static int tls13_open_record(struct tls13_aead *rx,
@@ -298,22 +402,100 @@ static int tls13_open_record(struct tls13_aead *rx,
 			    uint8_t *out, size_t out_cap,
 			    uint8_t *out_type, size_t *out_len);
 static int derive_app_traffic(const struct sha256_ctx *transcript,
-			      const uint8_t shared[X25519_KEY_SIZE],
+			      const uint8_t handshake_secret[32],
+			      uint8_t master_secret[32],
 			      uint8_t c_ap_traffic[32], uint8_t s_ap_traffic[32],
 			      struct tls13_aead *out_tx_app, struct tls13_aead *out_rx_app);
-static int tls13_seal_record(int fd, struct tls13_aead *tx,
-			    uint8_t inner_type,
-			    const uint8_t *in, size_t in_len);
-static int tls_read_record_stream(int fd,
-				 uint8_t hdr[5],
-				 uint8_t *payload, size_t payload_cap,
-				 size_t *payload_len);
-
-static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead *out_tx_app, struct tls13_aead *out_rx_app)
+static int tls_tx_seal(int fd, struct tls13_tx *t, struct tls13_aead *a,
+		       uint8_t inner_type,
+		       const uint8_t *in, size_t in_len);
+static int tls_tx_flush(int fd, struct tls13_tx *t);
+
+/* Stores each NewSessionTicket in a decrypted post-handshake record (inner
+ * type 0x16) for host. A message split across records is dropped; the next
+ * connection simply does a full handshake.
+ */
+static void tls13_store_tickets(const char *host, const uint8_t res_master[32], const uint8_t *msg, size_t len)
 {
-	if (!host || !out_tx_app || !out_rx_app) return -1;
+	size_t off = 0;
+	while (off + 4u <= len) {
+		uint8_t hs_type = msg[off];
+		size_t bl = (size_t)get_u24(&msg[off + 1]);
+		if (off + 4u + bl > len) return;
+		const uint8_t *p = &msg[off + 4];
+		const uint8_t *end = p + bl;
+		off += 4u + bl;
+		if (hs_type != 0x04) continue; /* KeyUpdate etc. */
+
+		/* lifetime(4) age_add(4) nonce<0..255> ticket<1..2^16-1> extensions<0..2^16-2> */
+		if (end - p < 9) continue;
+		uint32_t lifetime = ((uint32_t)get_u16(p) << 16) | get_u16(p + 2);
+		uint32_t age_add = ((uint32_t)get_u16(p + 4) << 16) | get_u16(p + 6);
+		p += 8;
+		uint8_t nonce_len = *p++;
+		if ((size_t)(end - p) < (size_t)nonce_len + 2u) continue;
+		const uint8_t *nonce = p;
+		p += nonce_len;
+		uint16_t tlen = get_u16(p);
+		p += 2;
+		if (tlen == 0 || (size_t)(end - p) < (size_t)tlen + 2u) continue;
+		const uint8_t *ticket = p;
+		p += tlen;
+		uint16_t exts_len = get_u16(p);
+		p += 2;
+		if ((size_t)(end - p) < (size_t)exts_len) continue;
+		uint32_t max_early_data = 0;
+		const uint8_t *e = p;
+		const uint8_t *e_end = p + exts_len;
+		while (e + 4 <= e_end) {
+			uint16_t et = get_u16(e);
+			uint16_t el = get_u16(e + 2);
+			e += 4;
+			if (e + el > e_end) break;
+			if (et == 0x002a && el == 4) max_early_data = ((uint32_t)get_u16(e) << 16) | get_u16(e + 2);
+			e += el;
+		}
+
+		if (lifetime == 0 || tlen > TLS13_TICKET_MAX) continue;
+		if (lifetime > TLS13_TICKET_MAX_LIFETIME_S) lifetime = TLS13_TICKET_MAX_LIFETIME_S;
+		struct tls13_ticket t;
+		crypto_memset(&t, 0, sizeof(t));
+		if (tls13_resumption_psk_sha256(res_master, nonce, nonce_len, t.psk) != 0) continue;
+		t.age_add = age_add;
+		t.max_early_data = max_early_data;
+		t.issued_ms = c_mono_ms();
+		t.expires_ms = t.issued_ms + (uint64_t)lifetime * 1000u;
+		t.len = tlen;
+		crypto_memcpy(t.identity, ticket, tlen);
+		tls13_ticket_store(host, t.issued_ms, &t);
+		crypto_memset(&t, 0, sizeof(t));
+	}
+}
+
+/* Full handshake, or a PSK (psk_dhe_ke) resumption when a ticket for host
+ * is cached and the server accepts it. Also exports the resumption master
+ * secret for tickets the server sends afterwards.
+ *
+ * early (may be NULL) is an idempotent request to send as 0-RTT data right
+ * behind the ClientHello, if the ticket allows that much early data.
+ * *out_early_accepted tells the caller whether the server took it; if not,
+ * the request must be sent again under the application keys.
+ */
+static int tls13_handshake_to_app(int sock,
+				  struct tls13_rx *rx,
+				  const char *host,
+				  const uint8_t *early, size_t early_len,
+				  struct tls13_aead *out_tx_app,
+				  struct tls13_aead *out_rx_app,
+				  uint8_t out_res_master[32],
+				  uint8_t *out_resumed,
+				  uint8_t *out_early_accepted)
+{
+	if (!rx || !host || !out_tx_app || !out_rx_app || !out_res_master || !out_resumed || !out_early_accepted) return -1;
 	*out_tx_app = (struct tls13_aead){0};
 	*out_rx_app = (struct tls13_aead){0};
+	*out_resumed = 0;
+	*out_early_accepted = 0;
 
 	/* Avoid hanging forever during bring-up. */
 	{
@@ -327,25 +509,52 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 	struct sha256_ctx transcript;
 	sha256_init(&transcript);
 
+	struct tls13_ticket ticket;
+	uint64_t now_ms = c_mono_ms();
+	int have_ticket = (tls13_ticket_take(host, now_ms, &ticket) == 0);
+	int send_early = (have_ticket && early && early_len && early_len <= ticket.max_early_data);
+
 	uint8_t priv[X25519_KEY_SIZE];
 	uint8_t pub[X25519_KEY_SIZE];
-	uint8_t ch_hs[1024];
+	uint8_t ch_hs[TLS13_CH_MAX];
 	size_t ch_hs_len = 0;
-	if (build_client_hello(host, ch_hs, &ch_hs_len, priv, pub) != 0) return -1;
+	if (build_client_hello(host, have_ticket ? &ticket : NULL, send_early, now_ms, ch_hs, &ch_hs_len, priv, pub) != 0) return -1;
 
-	/* Send ClientHello */
-	if (send_plain_handshake_record(sock, ch_hs, ch_hs_len) != 0) return -1;
+	/* ClientHello, and the 0-RTT request right behind it in the same write. */
+	struct tls13_tx flight;
+	flight.len = 0;
+	if (tls_tx_plain(sock, &flight, 0x16, ch_hs, ch_hs_len) != 0) return -1;
 	sha256_update(&transcript, ch_hs, ch_hs_len);
 
+	/* 0-RTT: client_early_traffic_secret = Derive-Secret(early, "c e traffic", ClientHello). */
+	struct tls13_aead tx_early = (struct tls13_aead){0};
+	if (send_early) {
+		uint8_t early_secret[32];
+		uint8_t c_e_traffic[32];
+		uint8_t th[32];
+		tls13_early_secret_sha256(ticket.psk, early_secret);
+		sha256_ctx_digest(&transcript, th);
+		int rc = tls13_derive_secret_sha256(early_secret, "c e traffic", th, c_e_traffic);
+		if (rc == 0) rc = tls13_hkdf_expand_label_sha256(c_e_traffic, "key", NULL, 0, tx_early.key, 16);
+		if (rc == 0) rc = tls13_hkdf_expand_label_sha256(c_e_traffic, "iv", NULL, 0, tx_early.iv, 12);
+		crypto_memset(early_secret, 0, sizeof(early_secret));
+		crypto_memset(c_e_traffic, 0, sizeof(c_e_traffic));
+		crypto_memset(th, 0, sizeof(th));
+		if (rc != 0) return -1;
+		tx_early.valid = 1;
+		if (tls_tx_seal(sock, &flight, &tx_early, 0x17, early, early_len) != 0) return -1;
+	}
+	if (tls_tx_flush(sock, &flight) != 0) return -1;
+
 	/* Read until ServerHello */
-	uint8_t hdr[5];
-	uint8_t payload[TLS13_MAX_RECORD];
+	const uint8_t *hdr = 0;
+	uint8_t *payload = 0;
 	size_t payload_len = 0;
 	uint8_t server_pub[X25519_KEY_SIZE];
 	uint8_t sh_hs[1024];
 	size_t sh_hs_len = 0;
 	for (;;) {
-		if (tls_read_record(sock, hdr, payload, sizeof(payload), &payload_len) != 0) return -1;
+		if (tls_rx_record(sock, rx, &hdr, &payload, &payload_len) != 0) return -1;
 		uint8_t typ = hdr[0];
 		if (typ == 0x14) {
 			/* ChangeCipherSpec: ignore. */
@@ -357,12 +566,16 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 		uint32_t body_len = get_u24(&payload[1]);
 		if (hs_type != 0x02) return -1;
 		if ((size_t)body_len + 4u > payload_len) return -1;
+		if ((size_t)body_len + 4u > sizeof(sh_hs)) return -1;
 		sh_hs_len = (size_t)body_len + 4u;
 		crypto_memcpy(sh_hs, payload, sh_hs_len);
 		break;
 	}
 
-	if (parse_server_hello(sh_hs, sh_hs_len, server_pub) != 0) return -1;
+	int psk_selected = 0;
+	if (parse_server_hello(sh_hs, sh_hs_len, server_pub, &psk_selected) != 0) return -1;
+	/* We offer at most one identity; selecting one we did not offer is fatal. */
+	if (psk_selected && !have_ticket) return -1;
 	sha256_update(&transcript, sh_hs, sh_hs_len);
 
 	uint8_t shared[32];
@@ -371,30 +584,40 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 	crypto_memset(pub, 0, sizeof(pub));
 	crypto_memset(server_pub, 0, sizeof(server_pub));
 
+	uint8_t early_secret[32];
+	tls13_early_secret_sha256(psk_selected ? ticket.psk : NULL, early_secret);
+	crypto_memset(&ticket, 0, sizeof(ticket));
+
 	struct tls13_aead tx_hs = (struct tls13_aead){0};
 	struct tls13_aead rx_hs = (struct tls13_aead){0};
 	struct tls13_aead tx_app = (struct tls13_aead){0};
 	struct tls13_aead rx_app = (struct tls13_aead){0};
+	uint8_t handshake_secret[32];
 	uint8_t c_hs_traffic[32];
 	uint8_t s_hs_traffic[32];
-	if (derive_hs_traffic(&transcript, shared, c_hs_traffic, s_hs_traffic, &tx_hs, &rx_hs) != 0) return -1;
+	if (derive_hs_traffic(&transcript, early_secret, shared, handshake_secret, c_hs_traffic, s_hs_traffic, &tx_hs, &rx_hs) != 0) return -1;
 
-	/* Process encrypted handshake messages until server Finished. */
+	/* Process encrypted handshake messages until server Finished. A resumed
+	 * handshake has no Certificate/CertificateVerify; the loop does not care.
+	 */
 	uint8_t got_server_finished = 0;
+	uint8_t early_accepted = 0;
 	uint8_t server_finished_verify[32];
 	crypto_memset(server_finished_verify, 0, sizeof(server_finished_verify));
 
-	uint8_t dec[TLS13_MAX_RECORD];
+	uint8_t *dec = 0;
 	uint8_t dec_type = 0;
 	size_t dec_len = 0;
 
 	for (;;) {
-		if (tls_read_record(sock, hdr, payload, sizeof(payload), &payload_len) != 0) return -1;
+		if (tls_rx_record(sock, rx, &hdr, &payload, &payload_len) != 0) return -1;
 		uint8_t typ = hdr[0];
 		if (typ == 0x14) continue;
 		if (typ != 0x17) return -1;
 
-		if (tls13_open_record(&rx_hs, hdr, payload, payload_len, dec, sizeof(dec), &dec_type, &dec_len) != 0) return -1;
+		/* Decrypted in place; the handshake messages are read from rx. */
+		dec = payload;
+		if (tls13_open_record(&rx_hs, hdr, payload, payload_len, dec, payload_len, &dec_type, &dec_len) != 0) return -1;
 		if (dec_type != 0x16) {
 			continue;
 		}
@@ -421,6 +644,21 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 				got_server_finished = 1;
 				break;
 			}
+			if (hs_type == 0x08 && bl >= 2u) {
+				/* EncryptedExtensions: an (empty) early_data extension accepts 0-RTT. */
+				const uint8_t *e = hs_msg + 6;
+				const uint8_t *e_end = hs_msg + 4 + bl;
+				if ((size_t)get_u16(hs_msg + 4) + 2u != bl) return -1;
+				while (e + 4 <= e_end) {
+					uint16_t et = get_u16(e);
+					uint16_t el = get_u16(e + 2);
+					if (e + 4 + el > e_end) return -1;
+					if (et == 0x002a) early_accepted = 1;
+					e += 4 + el;
+				}
+				/* Accepting early data we did not send, or without our PSK, is fatal. */
+				if (early_accepted && (!send_early || !psk_selected)) return -1;
+			}
 
 			sha256_update(&transcript, hs_msg, hs_msg_len);
 			off += hs_msg_len;
@@ -430,13 +668,24 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 	}
 
 	/* Derive application traffic secrets using transcript up to server Finished. */
+	uint8_t master_secret[32];
 	uint8_t c_ap_traffic[32];
 	uint8_t s_ap_traffic[32];
-	if (derive_app_traffic(&transcript, shared, c_ap_traffic, s_ap_traffic, &tx_app, &rx_app) != 0) return -1;
+	if (derive_app_traffic(&transcript, handshake_secret, master_secret, c_ap_traffic, s_ap_traffic, &tx_app, &rx_app) != 0) return -1;
 
 	/* Server may start using application keys after Finished. */
 	tls13_aead_reset(&rx_app);
 
+	/* Accepted 0-RTT ends with EndOfEarlyData under the early keys, and it
+	 * is part of the transcript the client Finished covers.
+	 */
+	if (early_accepted) {
+		uint8_t eoed[4] = { 0x05, 0, 0, 0 };
+		if (tls_tx_seal(sock, &flight, &tx_early, 0x16, eoed, sizeof(eoed)) != 0) return -1;
+		sha256_update(&transcript, eoed, sizeof(eoed));
+	}
+	tls13_aead_invalidate(&tx_early);
+
 	/* Send client Finished under handshake keys. */
 	uint8_t client_finished_key[32];
 	if (tls13_hkdf_expand_label_sha256(c_hs_traffic, "finished", NULL, 0, client_finished_key, 32) != 0) return -1;
@@ -453,40 +702,76 @@ static int tls13_handshake_to_app(int sock, const char *host, struct tls13_aead
 	crypto_memcpy(&fin_hs[4], verify, 32);
 	crypto_memset(verify, 0, sizeof(verify));
 
-	if (tls13_seal_record(sock, &tx_hs, 0x16, fin_hs, sizeof(fin_hs)) != 0) return -1;
+	if (tls_tx_seal(sock, &flight, &tx_hs, 0x16, fin_hs, sizeof(fin_hs)) != 0) return -1;
+	if (tls_tx_flush(sock, &flight) != 0) return -1;
 	sha256_update(&transcript, fin_hs, sizeof(fin_hs));
 	crypto_memset(fin_hs, 0, sizeof(fin_hs));
 
+	/* resumption_master_secret covers the transcript through client Finished. */
+	sha256_ctx_digest(&transcript, th);
+	if (tls13_derive_secret_sha256(master_secret, "res master", th, out_res_master) != 0) return -1;
+	crypto_memset(th, 0, sizeof(th));
+
 	/* Now use application write keys. */
 	tls13_aead_reset(&tx_app);
 
 	/* Export app keys and clear sensitive temporaries. */
 	*out_tx_app = tx_app;
 	*out_rx_app = rx_app;
+	*out_resumed = (uint8_t)psk_selected;
+	*out_early_accepted = early_accepted;
+	if (early_accepted) LOGI("tls", "session resumed (PSK), early data accepted");
+	else if (psk_selected) LOGI("tls", "session resumed (PSK)");
+	if (send_early && !early_accepted) LOGI("tls", "early data rejected, resending");
 
 	crypto_memset(shared, 0, sizeof(shared));
+	crypto_memset(early_secret, 0, sizeof(early_secret));
+	crypto_memset(handshake_secret, 0, sizeof(handshake_secret));
+	crypto_memset(master_secret, 0, sizeof(master_secret));
 	crypto_memset(c_hs_traffic, 0, sizeof(c_hs_traffic));
 	crypto_memset(s_hs_traffic, 0, sizeof(s_hs_traffic));
 	crypto_memset(c_ap_traffic, 0, sizeof(c_ap_traffic));
 	crypto_memset(s_ap_traffic, 0, sizeof(s_ap_traffic));
 	crypto_memset(server_finished_verify, 0, sizeof(server_finished_verify));
-	crypto_memset(dec, 0, sizeof(dec));
-	crypto_memset(payload, 0, sizeof(payload));
 	return 0;
 }
 
 int tls13_https_conn_open(struct tls13_https_conn *c, int sock, const char *host)
+{
+	return tls13_https_conn_open_get(c, sock, host, NULL);
+}
+
+int tls13_https_conn_open_get(struct tls13_https_conn *c, int sock, const char *host, const char *early_path)
 {
 	if (!c || sock < 0 || !host || !host[0]) return -1;
 	c->sock = sock;
 	c->alive = 0;
 	c->stash_len = 0;
+	c->rx.off = 0;
+	c->rx.len = 0;
+	c->early_pending = 0;
+	c->on_body = 0;
+	c->on_body_arg = 0;
 	(void)c_strlcpy_s(c->host, sizeof(c->host), host);
 	tls13_aead_invalidate(&c->tx_app);
 	tls13_aead_invalidate(&c->rx_app);
-	if (tls13_handshake_to_app(sock, host, &c->tx_app, &c->rx_app) != 0) {
-		return -1;
+
+	/* Exactly the bytes the first keep-alive GET would send, so that GET can
+	 * recognise its request as already sent.
+	 */
+	char req[768];
+	int req_len = -1;
+	if (early_path) req_len = http_format_get_ex(req, sizeof(req), host, early_path, 1);
+	uint8_t early_accepted = 0;
+	int rc = tls13_handshake_to_app(sock, &c->rx, host,
+					(const uint8_t *)req, req_len > 0 ? (size_t)req_len : 0,
+					&c->tx_app, &c->rx_app, c->res_master, &c->resumed, &early_accepted);
+	if (rc == 0 && early_accepted) {
+		sha256((const uint8_t *)req, (size_t)req_len, c->early_req_hash);
+		c->early_pending = 1;
 	}
+	crypto_memset(req, 0, sizeof(req));
+	if (rc != 0) return -1;
 	c->alive = 1;
 	return 0;
 }
@@ -500,6 +785,9 @@ void tls13_https_conn_close(struct tls13_https_conn *c)
 	c->sock = -1;
 	c->alive = 0;
 	c->stash_len = 0;
+	c->resumed = 0;
+	c->early_pending = 0;
+	crypto_memset(c->res_master, 0, sizeof(c->res_master));
 	tls13_aead_invalidate(&c->tx_app);
 	tls13_aead_invalidate(&c->rx_app);
 }
@@ -535,13 +823,27 @@ int tls13_https_conn_get_status_location_and_body(struct tls13_https_conn *c,
 	char req[768];
 	int req_len = http_format_get_ex(req, sizeof(req), c->host, path, keep_alive_request ? 1 : 0);
 	if (req_len < 0) return -1;
-	if (tls13_seal_record(c->sock, &c->tx_app, 0x17, (const uint8_t *)req, (size_t)req_len) != 0) return -1;
+	/* The server already has this request if it went out as accepted 0-RTT data. */
+	int already_sent = 0;
+	if (c->early_pending) {
+		uint8_t h[32];
+		sha256((const uint8_t *)req, (size_t)req_len, h);
+		already_sent = crypto_memeq(h, c->early_req_hash, sizeof(h));
+		c->early_pending = 0;
+	}
+	if (!already_sent) {
+		struct tls13_tx out;
+		out.len = 0;
+		if (tls_tx_seal(c->sock, &out, &c->tx_app, 0x17, (const uint8_t *)req, (size_t)req_len) != 0) return -1;
+		if (tls_tx_flush(c->sock, &out) != 0) return -1;
+	}
 	crypto_memset(req, 0, sizeof(req));
 
 	char line[512];
 	uint8_t header_buf[8192];
 	struct http_chunked_dec chunked;
 	http_chunked_init(&chunked);
+	struct inflate_stream inflate;
 
 	struct http_resp_feed_ctx feed;
 	feed.status_line = status_line;
@@ -571,13 +873,18 @@ int tls13_https_conn_get_status_location_and_body(struct tls13_https_conn *c,
 	feed.chunked_done = 0;
 	feed.body_total_read = 0;
 	feed.body_stored = 0;
+	feed.inflate = &inflate;
+	feed.coding = -1;
+	feed.decoding = 0;
+	feed.encoded = 0;
 
-	uint8_t hdr[5];
-	uint8_t payload[TLS13_MAX_RECORD];
+	const uint8_t *hdr = 0;
+	uint8_t *payload = 0;
 	size_t payload_len = 0;
-	uint8_t dec[TLS13_MAX_RECORD];
+	uint8_t *dec = 0;
 	uint8_t dec_type = 0;
 	size_t dec_len = 0;
+	size_t reported = 0;
 
 	/* Consume any stashed plaintext bytes first. */
 	if (c->stash_len) {
@@ -598,7 +905,7 @@ int tls13_https_conn_get_status_location_and_body(struct tls13_https_conn *c,
 	}
 
 	for (;;) {
-		int rr = tls_read_record_stream(c->sock, hdr, payload, sizeof(payload), &payload_len);
+		int rr = tls_rx_record(c->sock, &c->rx, &hdr, &payload, &payload_len);
 		if (rr == 1) {
 			/* EOF */
 			feed.peer_close = 1;
@@ -608,11 +915,26 @@ int tls13_https_conn_get_status_location_and_body(struct tls13_https_conn *c,
 		uint8_t typ = hdr[0];
 		if (typ == 0x14) continue;
 		if (typ != 0x17) continue;
-		if (tls13_open_record(&c->rx_app, hdr, payload, payload_len, dec, sizeof(dec), &dec_type, &dec_len) != 0) return -1;
+		/* Past the headers of an identity body, decrypt straight into the
+		 * body buffer; http_resp_store then finds the bytes already in
+		 * place. Everything else is decrypted in place in rx.
+		 */
+		size_t dec_cap = payload_len;
+		dec = payload;
+		if (body && feed.got_headers_end && !feed.is_chunked && !feed.decoding &&
+		    payload_len >= GCM_TAG_SIZE && payload_len - GCM_TAG_SIZE <= body_cap - feed.body_stored) {
+			dec = body + feed.body_stored;
+			dec_cap = body_cap - feed.body_stored;
+		}
+		if (tls13_open_record(&c->rx_app, hdr, payload, payload_len, dec, dec_cap, &dec_type, &dec_len) != 0) return -1;
 		if (dec_type == 0x15) {
 			feed.peer_close = 1;
 			break;
 		}
+		if (dec_type == 0x16) {
+			tls13_store_tickets(c->host, c->res_master, dec, dec_len);
+			continue;
+		}
 		if (dec_type != 0x17) continue;
 
 		size_t used = 0;
@@ -632,6 +954,16 @@ int tls13_https_conn_get_status_location_and_body(struct tls13_https_conn *c,
 			}
 			break;
 		}
+		/* Redirect bodies are never shown, and a coding still on the body
+		 * is not a readable prefix.
+		 */
+		if (c->on_body && feed.body_stored > reported && !feed.encoded) {
+			int code = http_parse_status_code(status_line);
+			if (code < 300 || code >= 400) {
+				reported = feed.body_stored;
+				c->on_body(c->on_body_arg, body, reported);
+			}
+		}
 	}
 
 out_done:
@@ -651,16 +983,46 @@ out_done:
 	return 0;
 }
 
-static int tls_read_record(int fd, uint8_t hdr[5], uint8_t *payload, size_t payload_cap, size_t *payload_len)
+/* Next record from rx. Reads from fd only when rx holds less than a whole
+ * record, and then as much as fits, so one sys_read usually brings in several
+ * records. *hdr and *payload point into rx->buf and stay valid until the next
+ * call; the payload may be decrypted in place. Returns 0, 1 on clean EOF
+ * before a record, -1 on error.
+ */
+static int tls_rx_record(int fd, struct tls13_rx *rx, const uint8_t **hdr, uint8_t **payload, size_t *payload_len)
 {
-	if (read_full(fd, hdr, 5) != 0) return -1;
-	size_t len = ((size_t)hdr[3] << 8) | (size_t)hdr[4];
-	if (len > payload_cap) return -1;
-	if (read_full(fd, payload, len) != 0) return -1;
-	*payload_len = len;
+	size_t need = 5;
+	for (;;) {
+		if (rx->len >= 5) {
+			const uint8_t *h = rx->buf + rx->off;
+			need = 5u + (((size_t)h[3] << 8) | (size_t)h[4]);
+			if (need - 5u > TLS13_MAX_RECORD) return -1;
+			if (rx->len >= need) break;
+		}
+		/* Only a partial record is left; move it to the front so the read
+		 * gets all the free space.
+		 */
+		if (rx->off) {
+			for (uint32_t i = 0; i < rx->len; i++) rx->buf[i] = rx->buf[rx->off + i];
+			rx->off = 0;
+		}
+		long r = sys_read(fd, rx->buf + rx->len, sizeof(rx->buf) - rx->len);
+		if (r == 0) return rx->len ? -1 : 1;
+		if (r < 0) return -1;
+		rx->len += (uint32_t)r;
+	}
+	*hdr = rx->buf + rx->off;
+	*payload = rx->buf + rx->off + 5;
+	*payload_len = need - 5u;
+	rx->off += (uint32_t)need;
+	rx->len -= (uint32_t)need;
 	return 0;
 }
 
+/* Decrypts one record into out, which may be payload itself: GCM checks the
+ * tag over the ciphertext before it writes any plaintext. On success out
+ * holds the content and the inner type and padding that follow it.
+ */
 static int tls13_open_record(struct tls13_aead *rx,
 			    const uint8_t hdr[5],
 			    const uint8_t *payload, size_t payload_len,
@@ -691,63 +1053,79 @@ static int tls13_open_record(struct tls13_aead *rx,
 	return 0;
 }
 
-static int tls13_seal_record(int fd, struct tls13_aead *tx,
-			    uint8_t inner_type,
-			    const uint8_t *in, size_t in_len)
+/* Seals in[0..in_len) as application-data records (inner type inner_type)
+ * into t. The plaintext is copied once, into its place in t, and encrypted
+ * there.
+ */
+static int tls_tx_seal(int fd, struct tls13_tx *t, struct tls13_aead *a,
+		       uint8_t inner_type,
+		       const uint8_t *in, size_t in_len)
 {
-	if (!tx || !tx->valid) return -1;
-	if (in_len + 1u > (TLS13_MAX_RECORD - 5u - GCM_TAG_SIZE)) return -1;
-
-	uint8_t hdr[5];
-	uint8_t nonce[12];
-	uint8_t tag[GCM_TAG_SIZE];
-
-	uint8_t pt[TLS13_MAX_RECORD];
-	size_t pt_len = in_len + 1u;
-	crypto_memcpy(pt, in, in_len);
-	pt[in_len] = inner_type;
-
-	size_t rec_len = pt_len + GCM_TAG_SIZE;
-	hdr[0] = 0x17;
-	hdr[1] = 0x03;
-	hdr[2] = 0x03;
-	hdr[3] = (uint8_t)((rec_len >> 8) & 0xffu);
-	hdr[4] = (uint8_t)(rec_len & 0xffu);
-
-	uint8_t ct[TLS13_MAX_RECORD];
-	nonce_from_iv_seq(nonce, tx->iv, tx->seq);
-	aes128_gcm_encrypt(tx->key, nonce, sizeof(nonce), hdr, 5, pt, pt_len, ct, tag);
-	crypto_memset(nonce, 0, sizeof(nonce));
-	crypto_memset(pt, 0, pt_len);
-
-	if (write_full(fd, hdr, 5) != 0) return -1;
-	if (write_full(fd, ct, pt_len) != 0) return -1;
-	if (write_full(fd, tag, sizeof(tag)) != 0) return -1;
-	crypto_memset(ct, 0, pt_len);
-	crypto_memset(tag, 0, sizeof(tag));
-
-	tx->seq++;
+	if (!a || !a->valid) return -1;
+	do {
+		size_t room = sizeof(t->buf) - t->len;
+		if (room < 5u + 1u + GCM_TAG_SIZE + 1u) {
+			if (tls_tx_flush(fd, t) != 0) return -1;
+			room = sizeof(t->buf);
+		}
+		size_t n = room - 5u - 1u - GCM_TAG_SIZE;
+		if (n > TLS13_MAX_PLAINTEXT) n = TLS13_MAX_PLAINTEXT;
+		if (n > in_len) n = in_len;
+
+		size_t rec_len = n + 1u + GCM_TAG_SIZE;
+		uint8_t *hdr = t->buf + t->len;
+		hdr[0] = 0x17;
+		hdr[1] = 0x03;
+		hdr[2] = 0x03;
+		hdr[3] = (uint8_t)((rec_len >> 8) & 0xffu);
+		hdr[4] = (uint8_t)(rec_len & 0xffu);
+		uint8_t *pt = hdr + 5;
+		crypto_memcpy(pt, in, n);
+		pt[n] = inner_type;
+
+		uint8_t nonce[12];
+		nonce_from_iv_seq(nonce, a->iv, a->seq);
+		aes128_gcm_encrypt(a->key, nonce, sizeof(nonce), hdr, 5, pt, n + 1u, pt, pt + n + 1u);
+		crypto_memset(nonce, 0, sizeof(nonce));
+		a->seq++;
+
+		t->len += 5u + rec_len;
+		in += n;
+		in_len -= n;
+	} while (in_len);
 	return 0;
 }
 
-static int send_plain_handshake_record(int fd, const uint8_t *hs, size_t hs_len)
+/* Sends everything sealed into t with one write (barring short writes). */
+static int tls_tx_flush(int fd, struct tls13_tx *t)
 {
-	uint8_t hdr[5];
-	hdr[0] = 0x16; /* handshake */
+	int rc = write_full(fd, t->buf, t->len);
+	t->len = 0;
+	return rc;
+}
+
+/* Appends one plaintext record (the ClientHello) to t. */
+static int tls_tx_plain(int fd, struct tls13_tx *t, uint8_t type, const uint8_t *in, size_t in_len)
+{
+	if (in_len > TLS13_MAX_PLAINTEXT || 5u + in_len > sizeof(t->buf)) return -1;
+	if (5u + in_len > sizeof(t->buf) - t->len && tls_tx_flush(fd, t) != 0) return -1;
+	uint8_t *hdr = t->buf + t->len;
+	hdr[0] = type;
 	hdr[1] = 0x03;
 	hdr[2] = 0x01; /* legacy record version */
-	hdr[3] = (uint8_t)((hs_len >> 8) & 0xffu);
-	hdr[4] = (uint8_t)(hs_len & 0xffu);
-	if (write_full(fd, hdr, 5) != 0) return -1;
-	if (write_full(fd, hs, hs_len) != 0) return -1;
+	hdr[3] = (uint8_t)((in_len >> 8) & 0xffu);
+	hdr[4] = (uint8_t)(in_len & 0xffu);
+	crypto_memcpy(hdr + 5, in, in_len);
+	t->len += 5u + in_len;
 	return 0;
 }
 
 static int build_client_hello(const char *host,
-			    uint8_t out_hs[1024], size_t *out_hs_len,
+			    const struct tls13_ticket *ticket, int offer_early, uint64_t now_ms,
+			    uint8_t out_hs[TLS13_CH_MAX], size_t *out_hs_len,
 			    uint8_t priv[X25519_KEY_SIZE], uint8_t pub[X25519_KEY_SIZE])
 {
-	uint8_t ch_body[512];
+	uint8_t ch_body[TLS13_CH_MAX - 4u];
 	uint8_t rnd[32];
 	if (sys_getrandom(rnd, sizeof(rnd), 0) != (long)sizeof(rnd)) return -1;
 	if (sys_getrandom(priv, X25519_KEY_SIZE, 0) != (long)X25519_KEY_SIZE) return -1;
@@ -873,21 +1251,84 @@ static int build_client_hello(const char *host,
 		p += X25519_KEY_SIZE;
 	}
 
+	/* psk_key_exchange_modes: psk_dhe_ke only. Sent even without a ticket,
+	 * since servers only issue tickets to clients that list a mode.
+	 */
+	{
+		put_u16(p, 0x002d);
+		p += 2;
+		put_u16(p, 2);
+		p += 2;
+		*p++ = 1;
+		*p++ = 1; /* psk_dhe_ke */
+	}
+
+	/* early_data (empty in the ClientHello); only with a ticket that allows it. */
+	if (ticket && offer_early) {
+		put_u16(p, 0x002a);
+		p += 2;
+		put_u16(p, 0);
+		p += 2;
+	}
+
+	/* pre_shared_key must be the last extension: its binder signs the
+	 * ClientHello up to (not including) the binders list.
+	 */
+	size_t binders_len = 0;
+	if (ticket) {
+		if (ticket->len == 0 || ticket->len > TLS13_TICKET_MAX) return -1;
+		uint32_t age_ms = (uint32_t)(now_ms - ticket->issued_ms);
+		uint32_t obfuscated_age = age_ms + ticket->age_add;
+		uint16_t identities_len = (uint16_t)(2u + ticket->len + 4u);
+		binders_len = 2u + 1u + 32u;
+		put_u16(p, 0x0029);
+		p += 2;
+		put_u16(p, (uint16_t)(2u + identities_len + binders_len));
+		p += 2;
+		put_u16(p, identities_len);
+		p += 2;
+		put_u16(p, ticket->len);
+		p += 2;
+		crypto_memcpy(p, ticket->identity, ticket->len);
+		p += ticket->len;
+		put_u16(p, (uint16_t)(obfuscated_age >> 16));
+		put_u16(p + 2, (uint16_t)obfuscated_age);
+		p += 4;
+		put_u16(p, (uint16_t)(1u + 32u));
+		p += 2;
+		*p++ = 32;
+		crypto_memset(p, 0, 32); /* filled in below */
+		p += 32;
+	}
+
 	uint16_t ext_len = (uint16_t)(p - ext_start);
 	put_u16(ext_len_p, ext_len);
 
 	size_t ch_len = (size_t)(p - ch_body);
-	if (ch_len + 4u > 1024u) return -1;
+	if (ch_len + 4u > TLS13_CH_MAX) return -1;
 	out_hs[0] = 0x01; /* ClientHello */
 	put_u24(&out_hs[1], (uint32_t)ch_len);
 	crypto_memcpy(&out_hs[4], ch_body, ch_len);
 	*out_hs_len = ch_len + 4u;
+
+	if (ticket) {
+		size_t truncated = *out_hs_len - binders_len;
+		uint8_t hello_hash[32];
+		uint8_t early_secret[32];
+		sha256(out_hs, truncated, hello_hash);
+		tls13_early_secret_sha256(ticket->psk, early_secret);
+		int rc = tls13_psk_binder_sha256(early_secret, hello_hash, &out_hs[truncated + 3u]);
+		crypto_memset(early_secret, 0, sizeof(early_secret));
+		if (rc != 0) return -1;
+	}
 	return 0;
 }
 
 static int parse_server_hello(const uint8_t *hs, size_t hs_len,
-			     uint8_t server_pub[X25519_KEY_SIZE])
+			     uint8_t server_pub[X25519_KEY_SIZE],
+			     int *out_psk_selected)
 {
+	*out_psk_selected = 0;
 	if (hs_len < 4u) return -1;
 	if (hs[0] != 0x02) return -1;
 	uint32_t body_len = get_u24(&hs[1]);
@@ -940,6 +1381,10 @@ static int parse_server_hello(const uint8_t *hs, size_t hs_len,
 			if (4u + (size_t)klen != (size_t)el) return -1;
 			crypto_memcpy(server_pub, p + 4, X25519_KEY_SIZE);
 			got_ks = 1;
+		} else if (et == 0x0029) {
+			/* pre_shared_key: selected_identity; we only ever offer #0. */
+			if (el != 2 || get_u16(p) != 0) return -1;
+			*out_psk_selected = 1;
 		}
 		p += el;
 	}
@@ -947,24 +1392,15 @@ static int parse_server_hello(const uint8_t *hs, size_t hs_len,
 }
 
 static int derive_hs_traffic(const struct sha256_ctx *transcript,
+			     const uint8_t early_secret[32],
 			     const uint8_t shared_secret[32],
+			     uint8_t handshake_secret[32],
 			     uint8_t c_hs_traffic[32],
 			     uint8_t s_hs_traffic[32],
 			     struct tls13_aead *tx_hs,
 			     struct tls13_aead *rx_hs)
 {
-	static const uint8_t sha256_empty[32] = {
-		0xe3,0xb0,0xc4,0x42,0x98,0xfc,0x1c,0x14,0x9a,0xfb,0xf4,0xc8,0x99,0x6f,0xb9,0x24,
-		0x27,0xae,0x41,0xe4,0x64,0x9b,0x93,0x4c,0xa4,0x95,0x99,0x1b,0x78,0x52,0xb8,0x55,
-	};
-	static const uint8_t psk_zeros[32] = {0};
-	uint8_t early_secret[32];
-	hkdf_extract_sha256(NULL, 0, psk_zeros, sizeof(psk_zeros), early_secret);
-	uint8_t derived[32];
-	if (tls13_derive_secret_sha256(early_secret, "derived", sha256_empty, derived) != 0) return -1;
-
-	uint8_t handshake_secret[32];
-	hkdf_extract_sha256(derived, 32, shared_secret, 32, handshake_secret);
+	if (tls13_next_secret_sha256(early_secret, shared_secret, handshake_secret) != 0) return -1;
 
 	uint8_t thash[32];
 	sha256_ctx_digest(transcript, thash);
@@ -980,36 +1416,20 @@ static int derive_hs_traffic(const struct sha256_ctx *transcript,
 	rx_hs->seq = 0;
 	tx_hs->valid = 1;
 	rx_hs->valid = 1;
-	crypto_memset(early_secret, 0, sizeof(early_secret));
-	crypto_memset(derived, 0, sizeof(derived));
-	crypto_memset(handshake_secret, 0, sizeof(handshake_secret));
 	crypto_memset(thash, 0, sizeof(thash));
 	return 0;
 }
 
 static int derive_app_traffic(const struct sha256_ctx *transcript,
-			      const uint8_t shared_secret[32],
+			      const uint8_t handshake_secret[32],
+			      uint8_t master_secret[32],
 			      uint8_t c_ap_traffic[32],
 			      uint8_t s_ap_traffic[32],
 			      struct tls13_aead *tx_app,
 			      struct tls13_aead *rx_app)
 {
-	static const uint8_t sha256_empty[32] = {
-		0xe3,0xb0,0xc4,0x42,0x98,0xfc,0x1c,0x14,0x9a,0xfb,0xf4,0xc8,0x99,0x6f,0xb9,0x24,
-		0x27,0xae,0x41,0xe4,0x64,0x9b,0x93,0x4c,0xa4,0x95,0x99,0x1b,0x78,0x52,0xb8,0x55,
-	};
-	static const uint8_t psk_zeros[32] = {0};
-	uint8_t early_secret[32];
-	hkdf_extract_sha256(NULL, 0, psk_zeros, sizeof(psk_zeros), early_secret);
-	uint8_t derived1[32];
-	if (tls13_derive_secret_sha256(early_secret, "derived", sha256_empty, derived1) != 0) return -1;
-	uint8_t handshake_secret[32];
-	hkdf_extract_sha256(derived1, 32, shared_secret, 32, handshake_secret);
-	uint8_t derived2[32];
-	if (tls13_derive_secret_sha256(handshake_secret, "derived", sha256_empty, derived2) != 0) return -1;
-	uint8_t master_secret[32];
 	/* TLS 1.3 uses a string of Hash.length zeros here (not an empty string). */
-	hkdf_extract_sha256(derived2, 32, psk_zeros, sizeof(psk_zeros), master_secret);
+	if (tls13_next_secret_sha256(handshake_secret, NULL, master_secret) != 0) return -1;
 
 	uint8_t thash[32];
 	sha256_ctx_digest(transcript, thash);
@@ -1024,11 +1444,6 @@ static int derive_app_traffic(const struct sha256_ctx *transcript,
 	rx_app->seq = 0;
 	tx_app->valid = 1;
 	rx_app->valid = 1;
-	crypto_memset(early_secret, 0, sizeof(early_secret));
-	crypto_memset(derived1, 0, sizeof(derived1));
-	crypto_memset(handshake_secret, 0, sizeof(handshake_secret));
-	crypto_memset(derived2, 0, sizeof(derived2));
-	crypto_memset(master_secret, 0, sizeof(master_secret));
 	crypto_memset(thash, 0, sizeof(thash));
 	return 0;
 }
@@ -1076,32 +1491,6 @@ int tls13_https_get_status_and_location(int sock,
 					 0);
 }
 
-static int tls_read_record_stream(int fd,
-				 uint8_t hdr[5],
-				 uint8_t *payload,
-				 size_t payload_cap,
-				 size_t *payload_len)
-{
-	/* Like tls_read_record, but returns 1 on clean EOF before reading a record. */
-	size_t off = 0;
-	while (off < 5) {
-		long r = sys_read(fd, hdr + off, 5 - off);
-		if (r == 0) return 1;
-		if (r < 0) return -1;
-		off += (size_t)r;
-	}
-	size_t len = ((size_t)hdr[3] << 8) | (size_t)hdr[4];
-	if (len > payload_cap) return -1;
-	off = 0;
-	while (off < len) {
-		long r = sys_read(fd, payload + off, len - off);
-		if (r <= 0) return -1;
-		off += (size_t)r;
-	}
-	*payload_len = len;
-	return 0;
-}
-
 int tls13_https_get_status_location_and_body(int sock,
 					const char *host,
 					const char *path,
@@ -1128,179 +1517,40 @@ int tls13_https_get_status_location_and_body(int sock,
 	if (body_len_out) *body_len_out = 0;
 	if (content_length_out) *content_length_out = 0;
 
-	/* Avoid hanging forever during bring-up. */
-	{
-		struct timeval tv;
-		tv.tv_sec = 3;
-		tv.tv_usec = 0;
-		(void)sys_setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, (uint32_t)sizeof(tv));
-		(void)sys_setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, (uint32_t)sizeof(tv));
-	}
-
-	LOGI("tls", "building ClientHello\n");
-
-	struct sha256_ctx transcript;
-	sha256_init(&transcript);
-
-	uint8_t priv[X25519_KEY_SIZE];
-	uint8_t pub[X25519_KEY_SIZE];
-	uint8_t ch_hs[1024];
-	size_t ch_hs_len = 0;
-	if (build_client_hello(host, ch_hs, &ch_hs_len, priv, pub) != 0) return -1;
-
-	/* Send ClientHello */
-	LOGI("tls", "sending ClientHello\n");
-	if (send_plain_handshake_record(sock, ch_hs, ch_hs_len) != 0) return -1;
-	sha256_update(&transcript, ch_hs, ch_hs_len);
-	LOGI("tls", "ClientHello sent\n");
-
-	/* Read until ServerHello */
-	uint8_t hdr[5];
-	uint8_t payload[TLS13_MAX_RECORD];
-	size_t payload_len = 0;
-	uint8_t server_pub[X25519_KEY_SIZE];
-	uint8_t sh_hs[1024];
-	size_t sh_hs_len = 0;
-	for (;;) {
-		if (tls_read_record(sock, hdr, payload, sizeof(payload), &payload_len) != 0) return -1;
-		uint8_t typ = hdr[0];
-		if (typ == 0x14) {
-			/* ChangeCipherSpec: ignore. */
-			continue;
-		}
-		if (typ != 0x16) return -1;
-		/* Parse handshake messages; expect first is ServerHello. */
-		if (payload_len < 4) return -1;
-		uint8_t hs_type = payload[0];
-		uint32_t body_len = get_u24(&payload[1]);
-		if (hs_type != 0x02) return -1;
-		if ((size_t)body_len + 4u > payload_len) return -1;
-		sh_hs_len = (size_t)body_len + 4u;
-		crypto_memcpy(sh_hs, payload, sh_hs_len);
-		break;
-	}
-	LOGI("tls", "got ServerHello\n");
-
-	LOGI("tls", "parsing ServerHello\n");
-	if (parse_server_hello(sh_hs, sh_hs_len, server_pub) != 0) {
-		LOGE("tls", "parse ServerHello failed (cipher/extension mismatch?)\n");
-		return -1;
-	}
-	LOGI("tls", "ServerHello ok\n");
-	sha256_update(&transcript, sh_hs, sh_hs_len);
-
-	LOGI("tls", "computing shared secret (x25519)\n");
-	uint8_t shared[32];
-	x25519(shared, priv, server_pub);
-	LOGI("tls", "shared secret computed\n");
-	crypto_memset(priv, 0, sizeof(priv));
-	crypto_memset(pub, 0, sizeof(pub));
-	crypto_memset(server_pub, 0, sizeof(server_pub));
+	/* The request is known up front, so it can ride along as 0-RTT data. */
+	char req[768];
+	int req_len = http_format_get(req, sizeof(req), host, path);
+	if (req_len < 0) return -1;
 
-	struct tls13_aead tx_hs = {0};
-	struct tls13_aead rx_hs = {0};
 	struct tls13_aead tx_app = {0};
 	struct tls13_aead rx_app = {0};
-	uint8_t c_hs_traffic[32];
-	uint8_t s_hs_traffic[32];
-	LOGI("tls", "deriving handshake keys\n");
-	if (derive_hs_traffic(&transcript, shared, c_hs_traffic, s_hs_traffic, &tx_hs, &rx_hs) != 0) {
-		LOGE("tls", "derive handshake keys failed\n");
+	uint8_t res_master[32];
+	uint8_t resumed = 0;
+	uint8_t early_accepted = 0;
+	/* Not on the stack: each process reads one response at a time. */
+	static struct tls13_rx rx;
+	rx.off = 0;
+	rx.len = 0;
+	if (tls13_handshake_to_app(sock, &rx, host, (const uint8_t *)req, (size_t)req_len,
+				   &tx_app, &rx_app, res_master, &resumed, &early_accepted) != 0) {
+		LOGE("tls", "handshake failed\n");
 		return -1;
 	}
-	LOGI("tls", "derived handshake keys\n");
-
-	/* Process encrypted handshake messages until server Finished. */
-	uint8_t got_server_finished = 0;
-	uint8_t server_finished_verify[32];
-	crypto_memset(server_finished_verify, 0, sizeof(server_finished_verify));
 
-	uint8_t dec[TLS13_MAX_RECORD];
+	const uint8_t *hdr = 0;
+	uint8_t *payload = 0;
+	size_t payload_len = 0;
+	uint8_t *dec = 0;
 	uint8_t dec_type = 0;
 	size_t dec_len = 0;
 
-	for (;;) {
-		if (tls_read_record(sock, hdr, payload, sizeof(payload), &payload_len) != 0) return -1;
-		uint8_t typ = hdr[0];
-		if (typ == 0x14) continue; /* CCS */
-		if (typ != 0x17) return -1;
-
-		if (tls13_open_record(&rx_hs, hdr, payload, payload_len, dec, sizeof(dec), &dec_type, &dec_len) != 0) return -1;
-		if (dec_type != 0x16) {
-			/* Ignore non-handshake until handshake done. */
-			continue;
-		}
-
-		/* One or more handshake messages. */
-		size_t off = 0;
-		while (off + 4u <= dec_len) {
-			uint8_t hs_type = dec[off];
-			uint32_t bl = get_u24(&dec[off + 1]);
-			if (off + 4u + (size_t)bl > dec_len) return -1;
-			const uint8_t *hs_msg = &dec[off];
-			size_t hs_msg_len = 4u + (size_t)bl;
-
-			if (hs_type == 0x14) {
-				/* Verify server Finished before adding it to transcript. */
-				uint8_t finished_key[32];
-				if (tls13_hkdf_expand_label_sha256(s_hs_traffic, "finished", NULL, 0, finished_key, 32) != 0) return -1;
-				uint8_t th[32];
-				sha256_ctx_digest(&transcript, th);
-				hmac_sha256(finished_key, 32, th, 32, server_finished_verify);
-				crypto_memset(finished_key, 0, sizeof(finished_key));
-				crypto_memset(th, 0, sizeof(th));
-				if (bl != 32u) return -1;
-				if (!crypto_memeq(server_finished_verify, hs_msg + 4, 32)) return -1;
-				sha256_update(&transcript, hs_msg, hs_msg_len);
-				got_server_finished = 1;
-				LOGI("tls", "server Finished verified\n");
-				break;
-			}
-
-			sha256_update(&transcript, hs_msg, hs_msg_len);
-			off += hs_msg_len;
-		}
-
-		if (got_server_finished) break;
+	/* Send HTTP request as application data, unless 0-RTT already carried it. */
+	if (!early_accepted) {
+		struct tls13_tx out;
+		out.len = 0;
+		if (tls_tx_seal(sock, &out, &tx_app, 0x17, (const uint8_t *)req, (size_t)req_len) != 0) return -1;
+		if (tls_tx_flush(sock, &out) != 0) return -1;
 	}
-
-	/* Derive application traffic secrets using transcript up to server Finished. */
-	uint8_t c_ap_traffic[32];
-	uint8_t s_ap_traffic[32];
-	if (derive_app_traffic(&transcript, shared, c_ap_traffic, s_ap_traffic, &tx_app, &rx_app) != 0) return -1;
-
-	/* Server may start using application keys after Finished. */
-	tls13_aead_reset(&rx_app);
-
-	/* Send client Finished under handshake keys. */
-	uint8_t client_finished_key[32];
-	if (tls13_hkdf_expand_label_sha256(c_hs_traffic, "finished", NULL, 0, client_finished_key, 32) != 0) return -1;
-	uint8_t th[32];
-	sha256_ctx_digest(&transcript, th);
-	uint8_t verify[32];
-	hmac_sha256(client_finished_key, 32, th, 32, verify);
-	crypto_memset(client_finished_key, 0, sizeof(client_finished_key));
-	crypto_memset(th, 0, sizeof(th));
-
-	uint8_t fin_hs[4 + 32];
-	fin_hs[0] = 0x14;
-	put_u24(&fin_hs[1], 32);
-	crypto_memcpy(&fin_hs[4], verify, 32);
-	crypto_memset(verify, 0, sizeof(verify));
-
-	if (tls13_seal_record(sock, &tx_hs, 0x16, fin_hs, sizeof(fin_hs)) != 0) return -1;
-	sha256_update(&transcript, fin_hs, sizeof(fin_hs));
-	crypto_memset(fin_hs, 0, sizeof(fin_hs));
-	LOGI("tls", "client Finished sent\n");
-
-	/* Now use application write keys. */
-	tls13_aead_reset(&tx_app);
-
-	/* Send HTTP request as application data. */
-	char req[768];
-	int req_len = http_format_get(req, sizeof(req), host, path);
-	if (req_len < 0) return -1;
-	if (tls13_seal_record(sock, &tx_app, 0x17, (const uint8_t *)req, (size_t)req_len) != 0) return -1;
 	crypto_memset(req, 0, sizeof(req));
 	LOGI("tls", "HTTP request sent\n");
 
@@ -1323,7 +1573,7 @@ int tls13_https_get_status_location_and_body(int sock,
 
 	LOGI("tls", "waiting for HTTP response...\n");
 	for (;;) {
-		int rr = tls_read_record_stream(sock, hdr, payload, sizeof(payload), &payload_len);
+		int rr = tls_rx_record(sock, &rx, &hdr, &payload, &payload_len);
 		if (rr == 1) {
 			/* EOF: if we had no Content-Length, treat as end-of-body. */
 			break;
@@ -1335,25 +1585,36 @@ int tls13_https_get_status_location_and_body(int sock,
 		uint8_t typ = hdr[0];
 		if (typ == 0x14) continue;
 		if (typ != 0x17) continue;
-		if (tls13_open_record(&rx_app, hdr, payload, payload_len, dec, sizeof(dec), &dec_type, &dec_len) != 0) {
-			/* Helpful during bring-up: check if the peer is still using handshake keys. */
-			struct tls13_aead tmp = rx_hs;
-			uint8_t t_type = 0;
-			size_t t_len = 0;
-			if (tls13_open_record(&tmp, hdr, payload, payload_len, dec, sizeof(dec), &t_type, &t_len) == 0) {
-				rx_hs = tmp;
-				if (t_type == 0x15) LOGI("tls", "got alert under handshake keys\n");
-				else if (t_type == 0x16) LOGI("tls", "got handshake under handshake keys\n");
-				else if (t_type == 0x17) LOGI("tls", "got appdata under handshake keys\n");
-				else LOGW("tls", "got unknown inner type under handshake keys\n");
-				return -1;
-			}
+		/* Identity body bytes are decrypted straight into body; the rest
+		 * in place in rx.
+		 */
+		size_t dec_cap = payload_len;
+		int direct = 0;
+		dec = payload;
+		if (got_headers_end && !is_chunked && body &&
+		    payload_len >= GCM_TAG_SIZE && payload_len - GCM_TAG_SIZE <= body_cap - body_len) {
+			dec = body + body_len;
+			dec_cap = body_cap - body_len;
+			direct = 1;
+		}
+		if (tls13_open_record(&rx_app, hdr, payload, payload_len, dec, dec_cap, &dec_type, &dec_len) != 0) {
 			LOGE("tls", "decrypt app record failed\n");
 			return -1;
 		}
 		if (dec_type == 0x15) return -1;
+		if (dec_type == 0x16) {
+			tls13_store_tickets(host, res_master, dec, dec_len);
+			continue;
+		}
 		if (dec_type != 0x17) continue;
 
+		if (direct) {
+			size_t want = body_cap;
+			if (have_content_len && content_len < (uint64_t)want) want = (size_t)content_len;
+			if (body_len < want) body_len += (dec_len < want - body_len) ? dec_len : want - body_len;
+			dec_len = 0;
+		}
+
 		for (size_t i = 0; i < dec_len; i++) {
 			uint8_t b = dec[i];
 
@@ -1492,13 +1753,8 @@ int tls13_https_get_status_location_and_body(int sock,
 	if (content_length_out) *content_length_out = (!is_chunked && have_content_len) ? content_len : 0;
 	LOGI("tls", "got HTTP response headers/body\n");
 
-	crypto_memset(shared, 0, sizeof(shared));
-	crypto_memset(c_hs_traffic, 0, sizeof(c_hs_traffic));
-	crypto_memset(s_hs_traffic, 0, sizeof(s_hs_traffic));
-	crypto_memset(c_ap_traffic, 0, sizeof(c_ap_traffic));
-	crypto_memset(s_ap_traffic, 0, sizeof(s_ap_traffic));
-	crypto_memset(server_finished_verify, 0, sizeof(server_finished_verify));
-	crypto_memset(dec, 0, sizeof(dec));
-	crypto_memset(payload, 0, sizeof(payload));
+	crypto_memset(&tx_app, 0, sizeof(tx_app));
+	crypto_memset(&rx_app, 0, sizeof(rx_app));
+	crypto_memset(res_master, 0, sizeof(res_master));
 	return 0;
 }
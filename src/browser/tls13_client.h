@@ -6,8 +6,9 @@
  * TCP socket.
  *
  * Current scope (intentionally tiny):
- * - IPv6 TCP connect is done by caller.
- * - X25519 key share, no PSK, no 0-RTT.
+ * - The caller connects the socket (tcp_connect_race() over IPv6 and IPv4).
+ * - X25519 key share; PSK resumption (psk_dhe_ke) from tickets kept in
+ *   tls13_ticket, with the GET sent as 0-RTT data when the ticket allows it.
  * - No certificate validation yet (insecure; for bring-up only).
  */
 
@@ -70,6 +71,20 @@ struct tls13_aead {
 	int valid;
 };
 
+enum {
+	TLS13_RX_BUF = 65536,
+};
+
+/* Ciphertext read ahead of the record being processed. Records are handed
+ * out in place; only a partial one is ever moved (to the front, before the
+ * next read).
+ */
+struct tls13_rx {
+	uint32_t off; /* first unconsumed byte */
+	uint32_t len; /* unconsumed bytes from off */
+	uint8_t buf[TLS13_RX_BUF];
+};
+
 /* Reusable keep-alive connection (single host per connection).
  *
  * Notes:
@@ -83,17 +98,43 @@ struct tls13_https_conn {
 	uint8_t alive;
 	/* Application traffic keys (TLS 1.3). */
 	struct tls13_aead tx_app, rx_app;
+	/* Turns NewSessionTickets on this connection into resumption PSKs. */
+	uint8_t res_master[32];
+	uint8_t resumed; /* this handshake used a ticket */
+	/* Accepted 0-RTT request (SHA-256 of its bytes) not yet answered. */
+	uint8_t early_pending;
+	uint8_t early_req_hash[32];
 	/* Plaintext bytes that were read but belong to the next response. */
 	uint8_t stash[8192];
 	size_t stash_len;
+	struct tls13_rx rx;
+	/* Optional: called after each record that added body bytes, with the
+	 * (decoded) body received so far, so a caller can show a page while it
+	 * is still loading. Not called for the record that completes the body,
+	 * for 3xx responses, or while the body still carries a Content-Encoding.
+	 */
+	void (*on_body)(void *arg, const uint8_t *body, size_t body_len);
+	void *on_body_arg;
 };
 
 int tls13_https_conn_open(struct tls13_https_conn *c, int sock, const char *host);
+
+/* Like tls13_https_conn_open, but on a resumed handshake sends the keep-alive
+ * GET for early_path as 0-RTT early data (idempotent requests only). The next
+ * tls13_https_conn_get_status_location_and_body() for that path then only
+ * reads the response; if the server rejected the early data, it sends the
+ * request as usual.
+ */
+int tls13_https_conn_open_get(struct tls13_https_conn *c, int sock, const char *host, const char *early_path);
 void tls13_https_conn_close(struct tls13_https_conn *c);
 
 /* Performs an HTTP/1.1 GET over an established TLS13 connection.
  *
- * - keep_alive_request: if nonzero, emits Connection: keep-alive.
+ * - keep_alive_request: if nonzero, emits Connection: keep-alive (and
+ *   Accept-Encoding: gzip, deflate).
+ * - gzip and deflate bodies are inflated into body as records arrive;
+ *   content_encoding_out is then empty, so it only ever names a coding the
+ *   body still carries. content_length_out stays the encoded length.
  * - out_peer_wants_close: set to 1 if the peer requests close or if the
  *   response framing is not compatible with keep-alive.
  * - body receives up to body_cap bytes (may be a prefix); the full response
@@ -0,0 +1,87 @@
+#include "tls13_pool.h"
+
+#include "util.h"
+
+static struct tls13_pool_conn g_tls13_pool[TLS13_POOL_SLOTS];
+
+static int tls13_pool_host_eq(const char *a, const char *b)
+{
+	size_t i = 0;
+	for (; a[i] && b[i]; i++) {
+		char ca = a[i];
+		char cb = b[i];
+		if (ca >= 'A' && ca <= 'Z') ca = (char)(ca + 32);
+		if (cb >= 'A' && cb <= 'Z') cb = (char)(cb + 32);
+		if (ca != cb) return 0;
+	}
+	return a[i] == b[i];
+}
+
+/* An idle keep-alive socket has nothing to read. If it polls readable the
+ * server has closed it (FIN or close_notify) or sent something unexpected;
+ * either way it cannot carry the next request.
+ */
+static int tls13_pool_idle_ok(const struct tls13_pool_conn *pc)
+{
+	if (!pc->conn.alive || pc->conn.sock < 0) return 0;
+	if (pc->conn.stash_len || pc->conn.rx.len) return 0;
+	struct pollfd pfd;
+	pfd.fd = pc->conn.sock;
+	pfd.events = (short)POLLIN;
+	pfd.revents = 0;
+	int r = sys_poll(&pfd, 1, 0);
+	return r == 0;
+}
+
+struct tls13_pool_conn *tls13_pool_get(const char *host, uint64_t now_ms, int *out_reused)
+{
+	if (out_reused) *out_reused = 0;
+	if (!host || !host[0]) return 0;
+
+	struct tls13_pool_conn *hit = 0;
+	struct tls13_pool_conn *free_slot = 0;
+	struct tls13_pool_conn *oldest = 0;
+	for (uint32_t i = 0; i < TLS13_POOL_SLOTS; i++) {
+		struct tls13_pool_conn *pc = &g_tls13_pool[i];
+		if (pc->in_use) continue;
+		if (pc->conn.alive && (now_ms - pc->idle_since_ms >= TLS13_POOL_IDLE_MS || !tls13_pool_idle_ok(pc))) {
+			tls13_https_conn_close(&pc->conn);
+		}
+		if (!pc->conn.alive) {
+			if (!free_slot) free_slot = pc;
+			continue;
+		}
+		if (!hit && tls13_pool_host_eq(pc->conn.host, host)) {
+			hit = pc;
+			continue;
+		}
+		if (!oldest || pc->idle_since_ms < oldest->idle_since_ms) oldest = pc;
+	}
+
+	if (hit) {
+		hit->in_use = 1;
+		if (out_reused) *out_reused = 1;
+		return hit;
+	}
+	struct tls13_pool_conn *pc = free_slot ? free_slot : oldest;
+	if (!pc) return 0;
+	tls13_https_conn_close(&pc->conn);
+	pc->family = 0;
+	pc->in_use = 1;
+	return pc;
+}
+
+void tls13_pool_put(struct tls13_pool_conn *pc, uint64_t now_ms)
+{
+	if (!pc) return;
+	if (!pc->conn.alive) tls13_https_conn_close(&pc->conn);
+	pc->idle_since_ms = now_ms;
+	pc->in_use = 0;
+}
+
+void tls13_pool_close_all(void)
+{
+	for (uint32_t i = 0; i < TLS13_POOL_SLOTS; i++) {
+		if (!g_tls13_pool[i].in_use) tls13_https_conn_close(&g_tls13_pool[i].conn);
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "tls13_client.h"
+
+/* Idle keep-alive TLS connections, keyed by host, for the navigation path.
+ *
+ * A navigation asks for a connection to its host; if an idle one is pooled
+ * (and the server has not closed it meanwhile) it skips DNS, TCP connect and
+ * the TLS handshake. Otherwise it gets an empty slot and opens a fresh
+ * connection into it. Either way it hands the slot back when done; slots
+ * whose connection is no longer alive simply become free again.
+ *
+ * Single-threaded: only the main process uses the pool. Forked children
+ * call tls13_pool_close_all() so their copies of the pooled sockets do not
+ * keep connections open that the parent has since evicted.
+ */
+
+enum {
+	TLS13_POOL_SLOTS = 4,
+	/* Below common server keep-alive timeouts, so a reused connection is
+	 * rarely one the server is about to close.
+	 */
+	TLS13_POOL_IDLE_MS = 30000,
+};
+
+struct tls13_pool_conn {
+	struct tls13_https_conn conn;
+	int family;              /* AF_INET6 or AF_INET, set by the opener */
+	uint64_t idle_since_ms;
+	uint8_t in_use;
+};
+
+/* Returns a slot for host, or 0 if every slot is in use. *out_reused is 1
+ * when slot->conn is a live pooled connection to host; otherwise the slot's
+ * connection is closed and the caller opens it (tls13_https_conn_open()).
+ * Idle connections older than TLS13_POOL_IDLE_MS are closed on the way.
+ */
+struct tls13_pool_conn *tls13_pool_get(const char *host, uint64_t now_ms, int *out_reused);
+
+/* Hands a slot back. A live connection stays pooled for later requests. */
+void tls13_pool_put(struct tls13_pool_conn *pc, uint64_t now_ms);
+
+/* Closes every idle pooled connection. */
+void tls13_pool_close_all(void);
@@ -0,0 +1,114 @@
+#include "tls13_ticket.h"
+
+struct tls13_ticket_entry {
+	uint32_t seq; /* even: stable, odd: being written */
+	uint32_t hash;
+	char host[TLS13_TICKET_HOST_MAX];
+	struct tls13_ticket t; /* t.expires_ms == 0: empty */
+};
+
+static struct tls13_ticket_entry *g_tls13_tickets;
+
+static uint8_t tls13_ticket_lower(uint8_t c)
+{
+	return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + 32u) : c;
+}
+
+/* FNV-1a over the lowercased host; returns 0 if the host does not fit. */
+static uint32_t tls13_ticket_hash(const char *host, size_t *out_len)
+{
+	uint32_t h = 2166136261u;
+	size_t n = 0;
+	while (host[n]) {
+		if (n + 1 >= TLS13_TICKET_HOST_MAX) return 0;
+		h ^= tls13_ticket_lower((uint8_t)host[n]);
+		h *= 16777619u;
+		n++;
+	}
+	*out_len = n;
+	return h ? h : 1u;
+}
+
+static int tls13_ticket_host_eq(const char *stored, const char *host, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (tls13_ticket_lower((uint8_t)stored[i]) != tls13_ticket_lower((uint8_t)host[i])) return 0;
+	}
+	return stored[len] == 0;
+}
+
+int tls13_ticket_cache_init(void)
+{
+	if (g_tls13_tickets) return 0;
+	void *p = sys_mmap(0, sizeof(struct tls13_ticket_entry) * (size_t)TLS13_TICKET_ENTRIES, PROT_READ | PROT_WRITE,
+			   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED) return -1;
+	/* Fresh anonymous pages are zero: every entry starts empty. */
+	g_tls13_tickets = (struct tls13_ticket_entry *)p;
+	return 0;
+}
+
+int tls13_ticket_take(const char *host, uint64_t now_ms, struct tls13_ticket *out)
+{
+	if (!g_tls13_tickets || !host || !out) return -1;
+	size_t len = 0;
+	uint32_t h = tls13_ticket_hash(host, &len);
+	if (!h) return -1;
+	for (uint32_t i = 0; i < TLS13_TICKET_ENTRIES; i++) {
+		struct tls13_ticket_entry *e = &g_tls13_tickets[i];
+		uint32_t seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1u) continue;
+		if (e->hash != h || e->t.expires_ms <= now_ms) continue;
+		/* Claim before reading: whoever wins the CAS owns this ticket. */
+		if (!__atomic_compare_exchange_n(&e->seq, &seq, seq + 1u, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) continue;
+		int ok = (e->hash == h && e->t.expires_ms > now_ms && tls13_ticket_host_eq(e->host, host, len));
+		if (ok) {
+			*out = e->t;
+			c_memset(&e->t, 0, sizeof(e->t));
+			e->hash = 0;
+		}
+		__atomic_store_n(&e->seq, seq + 2u, __ATOMIC_RELEASE);
+		if (ok) return 0;
+	}
+	return -1;
+}
+
+void tls13_ticket_store(const char *host, uint64_t now_ms, const struct tls13_ticket *t)
+{
+	if (!g_tls13_tickets || !host || !t || t->len == 0 || t->len > TLS13_TICKET_MAX) return;
+	if (t->expires_ms <= now_ms) return;
+	size_t len = 0;
+	uint32_t h = tls13_ticket_hash(host, &len);
+	if (!h) return;
+
+	/* An empty or expired slot; else the host's oldest ticket once it has
+	 * TLS13_TICKET_PER_HOST; else the ticket expiring soonest.
+	 */
+	struct tls13_ticket_entry *free_slot = 0;
+	struct tls13_ticket_entry *host_oldest = 0;
+	struct tls13_ticket_entry *soonest = 0;
+	uint32_t host_n = 0;
+	for (uint32_t i = 0; i < TLS13_TICKET_ENTRIES; i++) {
+		struct tls13_ticket_entry *e = &g_tls13_tickets[i];
+		uint32_t seq = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1u) continue;
+		if (e->t.expires_ms <= now_ms) {
+			if (!free_slot) free_slot = e;
+			continue;
+		}
+		if (e->hash == h && tls13_ticket_host_eq(e->host, host, len)) {
+			host_n++;
+			if (!host_oldest || e->t.issued_ms < host_oldest->t.issued_ms) host_oldest = e;
+		}
+		if (!soonest || e->t.expires_ms < soonest->t.expires_ms) soonest = e;
+	}
+	struct tls13_ticket_entry *pick = (host_n >= TLS13_TICKET_PER_HOST) ? host_oldest : (free_slot ? free_slot : soonest);
+	if (!pick) return;
+	uint32_t seq = __atomic_load_n(&pick->seq, __ATOMIC_ACQUIRE);
+	/* Another process may be writing the same slot; then it is simply not kept. */
+	if ((seq & 1u) || !__atomic_compare_exchange_n(&pick->seq, &seq, seq + 1u, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) return;
+	pick->hash = h;
+	c_memcpy(pick->host, host, len + 1u);
+	pick->t = *t;
+	__atomic_store_n(&pick->seq, seq + 2u, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "util.h"
+
+/*
+ * TLS 1.3 session tickets (NewSessionTicket) in a MAP_SHARED segment.
+ *
+ * tls13_ticket_cache_init() must run before the image workers are forked,
+ * like dns_cache_init(); a ticket issued on any connection (navigation or
+ * worker) can then resume the next handshake to that host from any process.
+ *
+ * Tickets are single-use: tls13_ticket_take() removes the ticket it returns,
+ * so two connections never present the same identity (RFC 8446 C.4). Servers
+ * usually issue one or more per connection, and each host keeps at most
+ * TLS13_TICKET_PER_HOST of them so one busy image host cannot push out the
+ * rest. Entries are seqlocks claimed with a CAS, as in dns_cache.
+ */
+
+enum {
+	TLS13_TICKET_ENTRIES = 32,
+	TLS13_TICKET_PER_HOST = 4,
+	TLS13_TICKET_HOST_MAX = 128,
+	TLS13_TICKET_MAX = 512,                /* larger identities are not kept */
+	TLS13_TICKET_MAX_LIFETIME_S = 604800,  /* 7 days (RFC 8446 4.6.1) */
+};
+
+struct tls13_ticket {
+	uint8_t psk[32];
+	uint32_t age_add;
+	uint32_t max_early_data; /* early_data extension; 0 = no 0-RTT */
+	uint64_t issued_ms;      /* CLOCK_MONOTONIC */
+	uint64_t expires_ms;
+	uint16_t len;
+	uint8_t identity[TLS13_TICKET_MAX];
+};
+
+int tls13_ticket_cache_init(void);
+
+/* Removes and returns an unexpired ticket for host. Returns 0 or -1. */
+int tls13_ticket_take(const char *host, uint64_t now_ms, struct tls13_ticket *out);
+
+/* Keeps t (expires_ms set by the caller) for host. */
+void tls13_ticket_store(const char *host, uint64_t now_ms, const struct tls13_ticket *t);
@@ -36,6 +36,20 @@ static inline int c_is_space(char c)
 	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
 }
 
+/* CLOCK_MONOTONIC in nanoseconds (0 if the clock is unavailable). */
+static inline uint64_t c_mono_ns(void)
+{
+	struct timespec ts;
+	if (sys_clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return 0;
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* CLOCK_MONOTONIC in milliseconds (0 if the clock is unavailable). */
+static inline uint64_t c_mono_ms(void)
+{
+	return c_mono_ns() / 1000000u;
+}
+
 static inline uint16_t bswap16(uint16_t v)
 {
 	return (uint16_t)((v << 8) | (v >> 8));
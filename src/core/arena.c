@@ -0,0 +1,36 @@
+#include "arena.h"
+
+enum {
+	ARENA_PAGE = 4096,
+};
+
+int arena_init(struct arena *a, size_t reserve)
+{
+	a->base = 0;
+	a->reserved = 0;
+	a->used = 0;
+	if (reserve == 0) return -1;
+	reserve = (reserve + ARENA_PAGE - 1u) & ~(size_t)(ARENA_PAGE - 1u);
+	void *p = sys_mmap(0, reserve, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	/* Raw syscall: errors come back as -errno, not MAP_FAILED. */
+	if ((unsigned long)p >= (unsigned long)-4095) return -1;
+	a->base = (uint8_t *)p;
+	a->reserved = reserve;
+	return 0;
+}
+
+void *arena_alloc(struct arena *a, size_t size)
+{
+	if (!a->base) return 0;
+	size_t off = (a->used + ARENA_ALIGN - 1u) & ~(size_t)(ARENA_ALIGN - 1u);
+	if (off > a->reserved || size > a->reserved - off) return 0;
+	a->used = off + size;
+	return a->base + off;
+}
+
+void arena_discard(struct arena *a)
+{
+	if (!a->base || a->used == 0) return;
+	size_t len = (a->used + ARENA_PAGE - 1u) & ~(size_t)(ARENA_PAGE - 1u);
+	(void)sys_madvise(a->base, len, MADV_DONTNEED);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "syscall.h"
+
+/* Bump allocator over one large anonymous mapping (no libc).
+ *
+ * arena_init() only reserves address space: the mapping is MAP_NORESERVE, so
+ * the kernel commits a page when it is first written and a worst-case sized
+ * buffer costs only what its contents touch. Allocations never move and are
+ * not freed one by one. arena_discard() returns every touched page with
+ * MADV_DONTNEED; the allocations stay valid and read as zero afterwards.
+ */
+
+enum {
+	ARENA_ALIGN = 64,
+};
+
+struct arena {
+	uint8_t *base;
+	size_t reserved;
+	size_t used;
+};
+
+/* Reserves `reserve` bytes (rounded up to whole pages). Returns 0, or -1 if
+ * the mapping failed.
+ */
+int arena_init(struct arena *a, size_t reserve);
+
+/* ARENA_ALIGN-aligned, zeroed block of `size` bytes, or NULL once the
+ * reservation is used up.
+ */
+void *arena_alloc(struct arena *a, size_t size);
+
+/* Drops the pages behind every allocation (they read as zero again). */
+void arena_discard(struct arena *a);
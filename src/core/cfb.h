@@ -20,6 +20,8 @@ enum {
 
 enum {
 	CFB_KEYQ_SIZE = 32,
+	CFB_DAMAGE_RING_SIZE = 64,
+	CFB_MAX_BUFFERS = 4,
 };
 
 struct cfb_key_event {
@@ -27,6 +29,16 @@ struct cfb_key_event {
 	uint32_t ch; /* For CFB_KEY_TEXT: byte value (usually ASCII). */
 };
 
+/* Dirty rectangle in pixels. Producers may report rects that extend past the
+ * frame; consumers clip.
+ */
+struct cfb_damage_rect {
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+};
+
 struct cfb_header {
 	uint32_t magic;
 	uint32_t version;
@@ -35,10 +47,10 @@ struct cfb_header {
 	uint32_t stride_bytes;
 	uint32_t format;
 	uint32_t reserved0; /* used: wheel_delta_y (int32_t) */
-	uint32_t reserved1;
+	uint32_t wake_seq;  /* futex (version >= 6): bumped by every input writer, see cfb_wake() */
 	uint64_t frame_counter;
 	uint64_t reserved2; /* used: wheel_event_counter */
-	uint64_t reserved3;
+	uint64_t reserved3; /* used (version >= 7): wheel_accum_y (int64_t) */
 	/* Input events (written by dev-only viewer or future input layer).
 	 * Counters are monotonically increasing.
 	 */
@@ -57,6 +69,28 @@ struct cfb_header {
 	uint32_t keyq_wpos;
 	uint32_t reserved4;
 	struct cfb_key_event keyq[CFB_KEYQ_SIZE];
+	/* Damage list (version >= 4, written by the producer).
+	 * Rects are appended after the pixels they cover have been written, then
+	 * damage_wpos is advanced. A consumer remembers the last damage_wpos it
+	 * handled; if it fell more than CFB_DAMAGE_RING_SIZE rects behind it must
+	 * refresh the whole frame.
+	 */
+	uint32_t damage_wpos;
+	uint32_t reserved5;
+	struct cfb_damage_rect damage[CFB_DAMAGE_RING_SIZE];
+	/* Multi-buffer layout (version >= 5).
+	 * buffer_count pixel buffers of height * stride_bytes follow the header
+	 * back to back. The producer draws into a back buffer and publishes it
+	 * under the present_seq seqlock (odd while front_index/front_damage_wpos
+	 * are being changed). front_damage_wpos is the damage_wpos the front
+	 * buffer is complete up to. Buffers rotate in order, so with N buffers a
+	 * reader copying the front buffer is safe as long as at most N - 2
+	 * presents happened during the copy (see cfb_front_read_ok()).
+	 */
+	uint32_t buffer_count;
+	uint32_t front_index;
+	uint32_t front_damage_wpos;
+	uint32_t present_seq;
 };
 
 static inline int32_t cfb_wheel_delta_y(const struct cfb_header *h)
@@ -81,7 +115,105 @@ static inline void cfb_bump_wheel_counter(struct cfb_header *h)
 	h->reserved2++;
 }
 
+/* Sum of every wheel delta so far (version >= 7). A consumer that falls
+ * behind the wheel counter still scrolls by exactly the missed amount.
+ */
+static inline int64_t cfb_wheel_accum_y(const struct cfb_header *h)
+{
+	return h ? (int64_t)h->reserved3 : 0;
+}
+
+static inline void cfb_add_wheel_accum_y(struct cfb_header *h, int32_t dy)
+{
+	if (!h) return;
+	h->reserved3 += (uint64_t)(int64_t)dy;
+}
+
+/* Wakeup word (version >= 6).
+ * Anything that hands the producer new work (input writers, the browser's
+ * image workers) bumps wake_seq after publishing it and FUTEX_WAKEs. The
+ * producer reads cfb_wake_seq() before looking for work and sleeps in
+ * cfb_wait() with that value, so a bump in between makes the wait return
+ * at once. The header lives in a shared file mapping, so the futex ops are
+ * the process-shared (non-PRIVATE) ones.
+ */
+static inline uint32_t cfb_wake_seq(const struct cfb_header *h)
+{
+	return h ? __atomic_load_n(&h->wake_seq, __ATOMIC_ACQUIRE) : 0;
+}
+
+static inline void cfb_wake(struct cfb_header *h)
+{
+	if (!h) return;
+	__atomic_add_fetch(&h->wake_seq, 1u, __ATOMIC_RELEASE);
+	(void)sys_futex(&h->wake_seq, FUTEX_WAKE, 0x7fffffffu, 0);
+}
+
+/* Blocks until wake_seq moves past `seen` or `timeout_ms` elapsed
+ * (0 = no timeout). Spurious returns are fine: callers re-check their state.
+ */
+static inline void cfb_wait(struct cfb_header *h, uint32_t seen, uint32_t timeout_ms)
+{
+	if (!h) return;
+	struct timespec ts;
+	ts.tv_sec = (int64_t)(timeout_ms / 1000u);
+	ts.tv_nsec = (int64_t)(timeout_ms % 1000u) * 1000000;
+	(void)sys_futex(&h->wake_seq, FUTEX_WAIT, seen, timeout_ms ? &ts : 0);
+}
+
+static inline void cfb_push_damage(struct cfb_header *h, uint32_t x, uint32_t y, uint32_t w, uint32_t h_px)
+{
+	if (!h || w == 0 || h_px == 0) return;
+	if (x > 0xffffu || y > 0xffffu) return;
+	if (w > 0xffffu - x) w = 0xffffu - x;
+	if (h_px > 0xffffu - y) h_px = 0xffffu - y;
+	uint32_t wpos = h->damage_wpos;
+	struct cfb_damage_rect *r = &h->damage[wpos % CFB_DAMAGE_RING_SIZE];
+	r->x = (uint16_t)x;
+	r->y = (uint16_t)y;
+	r->w = (uint16_t)w;
+	r->h = (uint16_t)h_px;
+	/* Publish the rect (and the pixels under it) before the new write position. */
+	__atomic_store_n(&h->damage_wpos, wpos + 1u, __ATOMIC_RELEASE);
+}
+
 static inline size_t cfb_pixel_bytes(uint32_t width, uint32_t height)
 {
 	return (size_t)width * (size_t)height * 4u;
 }
+
+static inline uint32_t cfb_buffer_count(const struct cfb_header *h)
+{
+	if (!h || h->version < 5 || h->buffer_count == 0) return 1;
+	return (h->buffer_count > CFB_MAX_BUFFERS) ? CFB_MAX_BUFFERS : h->buffer_count;
+}
+
+/* Consumer side of the front-buffer seqlock. Returns 0 and a sequence token
+ * if front_index/front_damage_wpos were read consistently, -1 if a present is
+ * in progress (retry).
+ */
+static inline int cfb_front_begin(const struct cfb_header *h, uint32_t *out_seq, uint32_t *out_index, uint32_t *out_damage_wpos)
+{
+	uint32_t seq = __atomic_load_n(&h->present_seq, __ATOMIC_ACQUIRE);
+	if (seq & 1u) return -1;
+	uint32_t idx = __atomic_load_n(&h->front_index, __ATOMIC_RELAXED);
+	uint32_t dw = __atomic_load_n(&h->front_damage_wpos, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	if (__atomic_load_n(&h->present_seq, __ATOMIC_RELAXED) != seq) return -1;
+	*out_seq = seq;
+	*out_index = idx % cfb_buffer_count(h);
+	*out_damage_wpos = dw;
+	return 0;
+}
+
+/* Returns 1 if the front buffer observed at `seq` was not reused by the
+ * producer while it was being copied.
+ */
+static inline int cfb_front_read_ok(const struct cfb_header *h, uint32_t seq)
+{
+	uint32_t n = cfb_buffer_count(h);
+	if (n < 2u) return 1; /* single buffer: nothing to protect against */
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	uint32_t now = __atomic_load_n(&h->present_seq, __ATOMIC_RELAXED);
+	return (now - seq) <= 2u * (n - 2u);
+}
@@ -47,6 +47,24 @@ struct font_surface_u32 {
 void font_log_missing_glyph(unsigned char ch);
 #endif
 
+/* Glyph row blitters for full 8-pixel rows. FONT_BLIT_AUTO picks the best
+ * one the CPU supports (CPUID); clipped rows always use the scalar loop.
+ */
+enum font_blit_impl {
+	FONT_BLIT_AUTO = 0,
+	FONT_BLIT_SCALAR = 1,
+	FONT_BLIT_SSE2 = 2,
+	FONT_BLIT_AVX2 = 3,
+};
+
+/* Selects a blitter; unsupported requests fall back to the next best one.
+ * Returns the implementation now in use.
+ */
+int font_blit_select(int impl);
+
+/* Row byte -> 8 lane masks (generated by tools/fontgen.c). */
+extern const uint32_t g_font_row_masks[256][8];
+
 extern const struct bitmap_font g_font_8x8;
 extern const struct bitmap_font g_font_8x16;
 
@@ -37,6 +37,106 @@ static inline uint32_t *font_pixel_ptr_u32(void *base, uint32_t stride_bytes, ui
 	return (uint32_t *)((uint8_t *)base + (size_t)y * (size_t)stride_bytes) + x;
 }
 
+typedef void (*font_blit8_fn)(uint32_t *p, size_t pitch_px, const uint8_t *rows, uint32_t n_rows, struct font_draw_style st);
+
+static void font_blit8_scalar(uint32_t *p, size_t pitch_px, const uint8_t *rows, uint32_t n_rows, struct font_draw_style st)
+{
+	for (uint32_t row = 0; row < n_rows; row++, p += pitch_px) {
+		uint8_t bits = rows[row];
+		for (uint32_t col = 0; col < 8u; col++) {
+			if (bits & (0x80u >> col)) {
+				p[col] = st.fg_xrgb;
+			} else if (st.opaque_bg) {
+				p[col] = st.bg_xrgb;
+			}
+		}
+	}
+}
+
+#if defined(__x86_64__)
+/* Lane vectors with 4-byte alignment: pixel rows are not 16/32-byte aligned. */
+typedef uint32_t font_v4u32 __attribute__((vector_size(16), aligned(4)));
+typedef uint32_t font_v8u32 __attribute__((vector_size(32), aligned(4)));
+
+/* SSE2 is part of the x86-64 baseline. */
+static void font_blit8_sse2(uint32_t *p, size_t pitch_px, const uint8_t *rows, uint32_t n_rows, struct font_draw_style st)
+{
+	const font_v4u32 zero = {0, 0, 0, 0};
+	const font_v4u32 fg = zero + st.fg_xrgb;
+	const font_v4u32 bg = zero + st.bg_xrgb;
+	for (uint32_t row = 0; row < n_rows; row++, p += pitch_px) {
+		uint8_t bits = rows[row];
+		if (bits == 0 && !st.opaque_bg) continue;
+		const font_v4u32 *m = (const font_v4u32 *)g_font_row_masks[bits];
+		font_v4u32 *d = (font_v4u32 *)p;
+		font_v4u32 b0 = st.opaque_bg ? bg : d[0];
+		font_v4u32 b1 = st.opaque_bg ? bg : d[1];
+		d[0] = (fg & m[0]) | (b0 & ~m[0]);
+		d[1] = (fg & m[1]) | (b1 & ~m[1]);
+	}
+}
+
+__attribute__((target("avx2")))
+static void font_blit8_avx2(uint32_t *p, size_t pitch_px, const uint8_t *rows, uint32_t n_rows, struct font_draw_style st)
+{
+	const font_v8u32 zero = {0, 0, 0, 0, 0, 0, 0, 0};
+	const font_v8u32 fg = zero + st.fg_xrgb;
+	const font_v8u32 bg = zero + st.bg_xrgb;
+	for (uint32_t row = 0; row < n_rows; row++, p += pitch_px) {
+		uint8_t bits = rows[row];
+		if (bits == 0 && !st.opaque_bg) continue;
+		const font_v8u32 m = *(const font_v8u32 *)g_font_row_masks[bits];
+		font_v8u32 *d = (font_v8u32 *)p;
+		font_v8u32 b = st.opaque_bg ? bg : *d;
+		*d = (fg & m) | (b & ~m);
+	}
+}
+
+static void font_cpuid(uint32_t leaf, uint32_t sub, uint32_t out[4])
+{
+	__asm__ volatile("cpuid" : "=a"(out[0]), "=b"(out[1]), "=c"(out[2]), "=d"(out[3]) : "a"(leaf), "c"(sub));
+}
+
+static int font_cpu_has_avx2(void)
+{
+	uint32_t r[4];
+	font_cpuid(0, 0, r);
+	if (r[0] < 7u) return 0;
+	font_cpuid(1, 0, r);
+	/* OSXSAVE + AVX, and the OS must save YMM state. */
+	if ((r[2] & (1u << 27)) == 0 || (r[2] & (1u << 28)) == 0) return 0;
+	uint32_t xcr0_lo, xcr0_hi;
+	__asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	(void)xcr0_hi;
+	if ((xcr0_lo & 6u) != 6u) return 0;
+	font_cpuid(7, 0, r);
+	return (r[1] & (1u << 5)) != 0;
+}
+#endif
+
+static font_blit8_fn font_blit8;
+
+int font_blit_select(int impl)
+{
+#if defined(__x86_64__)
+	if (impl == FONT_BLIT_AUTO || impl == FONT_BLIT_AVX2) {
+		if (font_cpu_has_avx2()) {
+			font_blit8 = font_blit8_avx2;
+			return FONT_BLIT_AVX2;
+		}
+		impl = FONT_BLIT_SSE2;
+	}
+	if (impl == FONT_BLIT_SSE2) {
+		font_blit8 = font_blit8_sse2;
+		return FONT_BLIT_SSE2;
+	}
+#else
+	(void)impl;
+#endif
+	font_blit8 = font_blit8_scalar;
+	return FONT_BLIT_SCALAR;
+}
+
 static inline void font_draw_glyph_rows_u32(struct font_surface_u32 dst,
 				   uint32_t x,
 				   uint32_t y,
@@ -64,6 +164,12 @@ static inline void font_draw_glyph_rows_u32(struct font_surface_u32 dst,
 		max_col = w_px - x;
 	}
 
+	if (max_col == 8u && (dst.stride_bytes & 3u) == 0) {
+		if (!font_blit8) font_blit_select(FONT_BLIT_AUTO);
+		font_blit8(font_pixel_ptr_u32(dst.pixels, dst.stride_bytes, x, y), dst.stride_bytes / 4u, rows, max_row, st);
+		return;
+	}
+
 	for (uint32_t row = 0; row < max_row; row++) {
 		uint8_t bits = rows[row];
 		uint32_t *p = font_pixel_ptr_u32(dst.pixels, dst.stride_bytes, x, y + row);
@@ -39,12 +39,17 @@ enum {
 	SYS_getrandom = 318,
 	SYS_mmap = 9,
 	SYS_munmap = 11,
+	SYS_madvise = 28,
 	SYS_nanosleep = 35,
 	SYS_ioctl = 16,
 	SYS_ftruncate = 77,
 	SYS_openat = 257,
 	SYS_clock_gettime = 228,
 	SYS_exit = 60,
+	SYS_clone = 56,
+	SYS_futex = 202,
+	SYS_sched_getaffinity = 204,
+	SYS_exit_group = 231,
 };
 
 enum {
@@ -89,15 +94,42 @@ enum {
 	MAP_SHARED = 0x01,
 	MAP_PRIVATE = 0x02,
 	MAP_ANONYMOUS = 0x20,
+	MAP_NORESERVE = 0x4000,
+};
+
+enum {
+	MADV_DONTNEED = 4,
 };
 
 #define MAP_FAILED ((void *)-1)
 
+enum {
+	/* From linux/sched.h */
+	CLONE_VM = 0x00000100,
+	CLONE_FS = 0x00000200,
+	CLONE_FILES = 0x00000400,
+	CLONE_SIGHAND = 0x00000800,
+	CLONE_THREAD = 0x00010000,
+	CLONE_SYSVSEM = 0x00040000,
+};
+
+enum {
+	/* From linux/futex.h */
+	FUTEX_WAIT = 0,
+	FUTEX_WAKE = 1,
+	FUTEX_WAIT_PRIVATE = 0 | 128,
+	FUTEX_WAKE_PRIVATE = 1 | 128,
+};
+
 struct timespec {
 	int64_t tv_sec;
 	int64_t tv_nsec;
 };
 
+enum {
+	CLOCK_MONOTONIC = 1,
+};
+
 static inline long sys_call0(long n)
 {
 	long r;
@@ -276,11 +308,21 @@ static inline int sys_munmap(void *addr, size_t length)
 	return (int)sys_call2(SYS_munmap, (long)addr, (long)length);
 }
 
+static inline int sys_madvise(void *addr, size_t length, int advice)
+{
+	return (int)sys_call3(SYS_madvise, (long)addr, (long)length, (long)advice);
+}
+
 static inline int sys_nanosleep(const struct timespec *req, struct timespec *rem)
 {
 	return (int)sys_call2(SYS_nanosleep, (long)req, (long)rem);
 }
 
+static inline int sys_clock_gettime(int clk, struct timespec *ts)
+{
+	return (int)sys_call2(SYS_clock_gettime, (long)clk, (long)ts);
+}
+
 static inline int sys_ioctl(int fd, ulong request, void *argp)
 {
 	return (int)sys_call3(SYS_ioctl, (long)fd, (long)request, (long)argp);
@@ -292,6 +334,23 @@ static inline void sys_exit(int code)
 	__builtin_unreachable();
 }
 
+/* Exits every thread of the process (sys_exit() only ends the caller). */
+static inline void sys_exit_group(int code)
+{
+	sys_call1(SYS_exit_group, (long)code);
+	__builtin_unreachable();
+}
+
+static inline long sys_futex(uint32_t *uaddr, int op, uint32_t val, const struct timespec *timeout)
+{
+	return sys_call4(SYS_futex, (long)uaddr, (long)op, (long)val, (long)timeout);
+}
+
+static inline int sys_sched_getaffinity(int pid, size_t len, void *mask)
+{
+	return (int)sys_call3(SYS_sched_getaffinity, (long)pid, (long)len, (long)mask);
+}
+
 static inline size_t c_strlen(const char *s)
 {
 	size_t n = 0;
@@ -0,0 +1,122 @@
+#include "thread_pool.h"
+
+static void tpool_claim_jobs(struct tpool *p)
+{
+	tpool_fn fn = p->fn;
+	void *ctx = p->ctx;
+	uint32_t n = p->n_jobs;
+	for (;;) {
+		uint32_t j = __atomic_fetch_add(&p->next, 1u, __ATOMIC_RELAXED);
+		if (j >= n) break;
+		fn(ctx, j);
+	}
+}
+
+static void tpool_worker(struct tpool *p)
+{
+	uint32_t seen = 0;
+	for (;;) {
+		uint32_t seq;
+		while ((seq = __atomic_load_n(&p->seq, __ATOMIC_ACQUIRE)) == seen) {
+			(void)sys_futex(&p->seq, FUTEX_WAIT_PRIVATE, seen, 0);
+		}
+		seen = seq;
+		tpool_claim_jobs(p);
+		if (__atomic_sub_fetch(&p->pending, 1u, __ATOMIC_ACQ_REL) == 0) {
+			(void)sys_futex(&p->pending, FUTEX_WAKE_PRIVATE, 1u, 0);
+		}
+	}
+}
+
+/* clone() with a fresh stack. The child runs tpool_worker(p) and never
+ * returns into this frame: it starts with the parent's registers but only
+ * the new stack, so everything it needs is passed in registers.
+ */
+static long tpool_spawn(struct tpool *p, void *stack_top)
+{
+	long r;
+	register long r10 __asm__("r10") = 0; /* child_tid */
+	register long r8 __asm__("r8") = 0;   /* tls */
+	void (*fn)(struct tpool *) = tpool_worker;
+	__asm__ volatile("syscall\n\t"
+			 "test %%rax, %%rax\n\t"
+			 "jnz 1f\n\t"
+			 "xor %%ebp, %%ebp\n\t"
+			 "mov %[arg], %%rdi\n\t"
+			 "call *%[fn]\n\t"
+			 "mov $60, %%eax\n\t"
+			 "xor %%edi, %%edi\n\t"
+			 "syscall\n\t"
+			 "1:\n\t"
+			 : "=a"(r)
+			 : "a"((long)SYS_clone),
+			   "D"((long)(CLONE_VM | CLONE_FS | CLONE_FILES | CLONE_SIGHAND | CLONE_THREAD | CLONE_SYSVSEM)),
+			   "S"(stack_top), "d"(0L), "r"(r10), "r"(r8), [fn] "r"(fn), [arg] "r"(p)
+			 : "rcx", "r11", "memory");
+	return r;
+}
+
+/* No libgcc: __builtin_popcountll() would call __popcountdi2 without -mpopcnt. */
+static uint32_t tpool_popcount64(uint64_t v)
+{
+	v = v - ((v >> 1) & 0x5555555555555555ull);
+	v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+	v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0full;
+	return (uint32_t)((v * 0x0101010101010101ull) >> 56);
+}
+
+uint32_t tpool_cpu_count(void)
+{
+	uint64_t mask[16];
+	for (uint32_t i = 0; i < 16; i++) mask[i] = 0;
+	int n = sys_sched_getaffinity(0, sizeof(mask), mask);
+	if (n <= 0) return 1u;
+	uint32_t cpus = 0;
+	for (uint32_t i = 0; i < (uint32_t)n / 8u && i < 16u; i++) cpus += tpool_popcount64(mask[i]);
+	return cpus ? cpus : 1u;
+}
+
+uint32_t tpool_start(struct tpool *p, uint32_t n_threads)
+{
+	p->n_threads = 0;
+	p->seq = 0;
+	p->pending = 0;
+	p->next = 0;
+	p->n_jobs = 0;
+	p->fn = 0;
+	p->ctx = 0;
+	if (n_threads > TPOOL_MAX_THREADS) n_threads = TPOOL_MAX_THREADS;
+	for (uint32_t i = 0; i < n_threads; i++) {
+		uint8_t *stack = (uint8_t *)sys_mmap(0, TPOOL_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (stack == MAP_FAILED) break;
+		if (tpool_spawn(p, stack + TPOOL_STACK_SIZE) < 0) {
+			(void)sys_munmap(stack, TPOOL_STACK_SIZE);
+			break;
+		}
+		p->n_threads++;
+	}
+	return p->n_threads;
+}
+
+void tpool_run(struct tpool *p, tpool_fn fn, void *ctx, uint32_t n_jobs)
+{
+	if (n_jobs == 0) return;
+	if (p->n_threads == 0 || n_jobs == 1) {
+		for (uint32_t j = 0; j < n_jobs; j++) fn(ctx, j);
+		return;
+	}
+	p->fn = fn;
+	p->ctx = ctx;
+	p->n_jobs = n_jobs;
+	p->next = 0;
+	__atomic_store_n(&p->pending, p->n_threads, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&p->seq, 1u, __ATOMIC_RELEASE);
+	(void)sys_futex(&p->seq, FUTEX_WAKE_PRIVATE, p->n_threads, 0);
+
+	tpool_claim_jobs(p);
+
+	uint32_t left;
+	while ((left = __atomic_load_n(&p->pending, __ATOMIC_ACQUIRE)) != 0) {
+		(void)sys_futex(&p->pending, FUTEX_WAIT_PRIVATE, left, 0);
+	}
+}
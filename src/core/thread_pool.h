@@ -0,0 +1,45 @@
+#pragma once
+
+#include "syscall.h"
+
+/* Fixed-size worker pool on raw clone() threads (no libc, no TLS).
+ *
+ * Workers share the address space and sleep on a futex between batches.
+ * tpool_run() publishes one batch of `n_jobs` jobs, works on it from the
+ * calling thread as well, and returns once every job has finished. Jobs are
+ * claimed with an atomic counter, so uneven jobs balance themselves.
+ *
+ * Job functions must not touch state another job of the same batch writes;
+ * the pool only guarantees that everything written before tpool_run() is
+ * visible to the jobs and everything the jobs wrote is visible after it.
+ */
+
+enum {
+	TPOOL_MAX_THREADS = 8,
+	TPOOL_STACK_SIZE = 256 * 1024,
+};
+
+typedef void (*tpool_fn)(void *ctx, uint32_t job);
+
+struct tpool {
+	uint32_t n_threads; /* workers, not counting the caller */
+	uint32_t seq;       /* futex: bumped to publish a batch */
+	uint32_t pending;   /* futex: workers still inside the current batch */
+	uint32_t next;      /* next unclaimed job */
+	uint32_t n_jobs;
+	tpool_fn fn;
+	void *ctx;
+};
+
+/* Online CPUs usable by this process (at least 1). */
+uint32_t tpool_cpu_count(void);
+
+/* Starts up to `n_threads` workers (clamped to TPOOL_MAX_THREADS). Returns
+ * the number started; with 0 the pool still works and runs jobs inline.
+ */
+uint32_t tpool_start(struct tpool *p, uint32_t n_threads);
+
+/* Runs fn(ctx, 0..n_jobs-1) across the pool and the caller; blocks until done.
+ * Not reentrant: call it from one thread only.
+ */
+void tpool_run(struct tpool *p, tpool_fn fn, void *ctx, uint32_t n_jobs);
@@ -208,6 +208,7 @@ int main(int argc, char **argv)
 		uint32_t cur_y = hdr->mouse_y;
 
 		int had_any = 0;
+		int had_event = 0;
 		for (uint32_t fi = 0; fi < input_fd_count; fi++) {
 			int fd = input_fds[fi];
 			if (fd < 0) continue;
@@ -233,8 +234,10 @@ int main(int argc, char **argv)
 					} else if (ev[i].code == REL_WHEEL) {
 						/* Wheel: reuse reserved fields (see core/cfb.h helpers). */
 						cfb_set_wheel_delta_y(hdr, ev[i].value);
+						cfb_add_wheel_accum_y(hdr, ev[i].value);
 						cfb_bump_wheel_counter(hdr);
 						hdr->input_counter++;
+						had_event = 1;
 					}
 					continue;
 				}
@@ -255,6 +258,7 @@ int main(int argc, char **argv)
 					hdr->mouse_last_state = ev[i].value ? 1u : 0u;
 					hdr->mouse_event_counter++;
 					hdr->input_counter++;
+					had_event = 1;
 
 					if (btn_id == 1u) {
 						LOGI("inputd", ev[i].value ? "left down\n" : "left up\n");
@@ -266,6 +270,8 @@ int main(int argc, char **argv)
 		/* Publish latest cursor position even if no click happened. */
 		hdr->mouse_x = cur_x;
 		hdr->mouse_y = cur_y;
+		/* Cursor motion alone is not worth waking the browser for. */
+		if (had_event) cfb_wake(hdr);
 
 		if (!had_any) {
 			struct timespec ts = {0, 5000000}; /* 5ms */
@@ -5,8 +5,8 @@
 #include "tls13_kdf.h"
 #include "x25519.h"
 
-/* Test vectors from RFC 4231 (HMAC-SHA-256), RFC 5869 (HKDF-SHA-256), and
- * common SHA-256 vectors.
+/* Test vectors from RFC 4231 (HMAC-SHA-256), RFC 5869 (HKDF-SHA-256),
+ * RFC 8448 (TLS 1.3 traces), and common SHA-256 vectors.
  */
 
 static int test_sha256_empty(void)
@@ -129,6 +129,38 @@ static int hex_to_bytes(uint8_t *out, size_t out_len, const char *hex)
 	return 1;
 }
 
+static int test_tls13_resumption_rfc8448(void)
+{
+	/* RFC 8448, Section 3 resumption master secret and ticket nonce 00 00,
+	 * then Section 4 (Resumed 0-RTT Handshake): PSK, early secret, and the
+	 * binder over the truncated ClientHello hash.
+	 */
+	static const char *res_master_hex = "7df235f2031d2a051287d02b0241b0bfdaf86cc856231f2d5aba46c434ec196c";
+	static const char *psk_hex = "4ecd0eb6ec3b4d87f5d6028f922ca4c5851a277fd41311c9e62d2c9492e1c4f3";
+	static const char *early_hex = "9b2188e9b2fc6d64d71dc329900e20bb41915000f678aa839cbb797cb7d8332c";
+	static const char *hello_hash_hex = "63224b2e4573f2d3454ca84b9d009a04f6be9e05711a8396473aefa01e924a14";
+	static const char *binder_hex = "3add4fb2d8fdf822a0ca3cf7678ef5e88dae990141c5924d57bb6fa31b9e5f9d";
+	static const uint8_t nonce[2] = {0x00, 0x00};
+
+	uint8_t res_master[32], psk_expect[32], early_expect[32], hello_hash[32], binder_expect[32];
+	if (!hex_to_bytes(res_master, 32, res_master_hex)) return 0;
+	if (!hex_to_bytes(psk_expect, 32, psk_hex)) return 0;
+	if (!hex_to_bytes(early_expect, 32, early_hex)) return 0;
+	if (!hex_to_bytes(hello_hash, 32, hello_hash_hex)) return 0;
+	if (!hex_to_bytes(binder_expect, 32, binder_hex)) return 0;
+
+	uint8_t psk[32], early[32], binder[32];
+	if (tls13_resumption_psk_sha256(res_master, nonce, sizeof(nonce), psk) != 0) return 0;
+	if (!crypto_memeq(psk, psk_expect, 32)) return 0;
+	tls13_early_secret_sha256(psk, early);
+	if (!crypto_memeq(early, early_expect, 32)) return 0;
+	if (tls13_psk_binder_sha256(early, hello_hash, binder) != 0) return 0;
+	int ok = crypto_memeq(binder, binder_expect, 32);
+	crypto_memset(psk, 0, sizeof(psk));
+	crypto_memset(early, 0, sizeof(early));
+	return ok;
+}
+
 static int test_x25519_rfc7748(void)
 {
 	/* RFC 7748 section 5.2 test vectors are specified as 32-byte strings.
@@ -188,6 +220,7 @@ int tls_crypto_selftest_detail(int *failed_step)
 	step++; if (!test_hmac_rfc4231_case1()) { if (failed_step) *failed_step = step; return 0; }
 	step++; if (!test_hkdf_rfc5869_case1()) { if (failed_step) *failed_step = step; return 0; }
 	step++; if (!test_tls13_derive_secret_rfc8448_derived()) { if (failed_step) *failed_step = step; return 0; }
+	step++; if (!test_tls13_resumption_rfc8448()) { if (failed_step) *failed_step = step; return 0; }
 
 	/* AES-128 single-block test: key=0, pt=0 -> 66e94bd4ef8a2c3b884cfa59ca342b2e */
 	step++;
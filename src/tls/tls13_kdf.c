@@ -58,3 +58,47 @@ int tls13_derive_secret_sha256(const uint8_t secret[TLS13_HASH_SIZE],
 {
 	return tls13_hkdf_expand_label_sha256(secret, label, transcript_hash, TLS13_HASH_SIZE, out, TLS13_HASH_SIZE);
 }
+
+static const uint8_t tls13_sha256_empty[TLS13_HASH_SIZE] = {
+	0xe3,0xb0,0xc4,0x42,0x98,0xfc,0x1c,0x14,0x9a,0xfb,0xf4,0xc8,0x99,0x6f,0xb9,0x24,
+	0x27,0xae,0x41,0xe4,0x64,0x9b,0x93,0x4c,0xa4,0x95,0x99,0x1b,0x78,0x52,0xb8,0x55,
+};
+
+static const uint8_t tls13_zeros[TLS13_HASH_SIZE] = {0};
+
+void tls13_early_secret_sha256(const uint8_t *psk, uint8_t out[TLS13_HASH_SIZE])
+{
+	hkdf_extract_sha256(NULL, 0, psk ? psk : tls13_zeros, TLS13_HASH_SIZE, out);
+}
+
+int tls13_next_secret_sha256(const uint8_t secret[TLS13_HASH_SIZE],
+			     const uint8_t *ikm,
+			     uint8_t out[TLS13_HASH_SIZE])
+{
+	uint8_t derived[TLS13_HASH_SIZE];
+	if (tls13_derive_secret_sha256(secret, "derived", tls13_sha256_empty, derived) != 0) return -1;
+	hkdf_extract_sha256(derived, TLS13_HASH_SIZE, ikm ? ikm : tls13_zeros, TLS13_HASH_SIZE, out);
+	crypto_memset(derived, 0, sizeof(derived));
+	return 0;
+}
+
+int tls13_psk_binder_sha256(const uint8_t early_secret[TLS13_HASH_SIZE],
+			    const uint8_t truncated_hello_hash[TLS13_HASH_SIZE],
+			    uint8_t out[TLS13_HASH_SIZE])
+{
+	uint8_t binder_key[TLS13_HASH_SIZE];
+	uint8_t finished_key[TLS13_HASH_SIZE];
+	int rc = tls13_derive_secret_sha256(early_secret, "res binder", tls13_sha256_empty, binder_key);
+	if (rc == 0) rc = tls13_hkdf_expand_label_sha256(binder_key, "finished", NULL, 0, finished_key, TLS13_HASH_SIZE);
+	if (rc == 0) hmac_sha256(finished_key, TLS13_HASH_SIZE, truncated_hello_hash, TLS13_HASH_SIZE, out);
+	crypto_memset(binder_key, 0, sizeof(binder_key));
+	crypto_memset(finished_key, 0, sizeof(finished_key));
+	return rc;
+}
+
+int tls13_resumption_psk_sha256(const uint8_t res_master[TLS13_HASH_SIZE],
+				const uint8_t *nonce, size_t nonce_len,
+				uint8_t out[TLS13_HASH_SIZE])
+{
+	return tls13_hkdf_expand_label_sha256(res_master, "resumption", nonce, nonce_len, out, TLS13_HASH_SIZE);
+}
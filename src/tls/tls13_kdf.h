@@ -24,3 +24,33 @@ int tls13_derive_secret_sha256(const uint8_t secret[TLS13_HASH_SIZE],
 			       const char *label,
 			       const uint8_t transcript_hash[TLS13_HASH_SIZE],
 			       uint8_t out[TLS13_HASH_SIZE]);
+
+/* Key schedule stages (RFC 8446 section 7.1).
+ *
+ * Early Secret = HKDF-Extract(0, PSK); psk == NULL means no PSK, which the
+ * schedule treats as Hash.length zeros.
+ */
+void tls13_early_secret_sha256(const uint8_t *psk, uint8_t out[TLS13_HASH_SIZE]);
+
+/* The next stage: HKDF-Extract(Derive-Secret(secret, "derived", ""), ikm).
+ * Early -> Handshake Secret takes the (EC)DHE output; Handshake -> Master
+ * Secret passes ikm == NULL (Hash.length zeros).
+ */
+int tls13_next_secret_sha256(const uint8_t secret[TLS13_HASH_SIZE],
+			     const uint8_t *ikm,
+			     uint8_t out[TLS13_HASH_SIZE]);
+
+/* PSK binder for a resumption PSK: HMAC(finished_key, hash) with the
+ * finished key taken from binder_key = Derive-Secret(early, "res binder", "").
+ * truncated_hello_hash covers the ClientHello up to the binders list.
+ */
+int tls13_psk_binder_sha256(const uint8_t early_secret[TLS13_HASH_SIZE],
+			    const uint8_t truncated_hello_hash[TLS13_HASH_SIZE],
+			    uint8_t out[TLS13_HASH_SIZE]);
+
+/* PSK of one NewSessionTicket:
+ * HKDF-Expand-Label(resumption_master_secret, "resumption", ticket_nonce, Hash.length).
+ */
+int tls13_resumption_psk_sha256(const uint8_t res_master[TLS13_HASH_SIZE],
+				const uint8_t *nonce, size_t nonce_len,
+				uint8_t out[TLS13_HASH_SIZE]);
@@ -16,6 +16,7 @@
  *  - consistent formatting
  *  - reproducible output
  *  - optional 8x16 generation via deterministic vertical scaling
+ *  - the row-byte -> lane-mask table used by the SIMD glyph blitters
  */
 
 struct glyph8 {
@@ -375,6 +376,31 @@ static void generate_font_file_8x16_scaled(const char *out_path)
 	free(buf);
 }
 
+/* Row byte -> per-pixel lane masks used by the vectorized glyph blitters in
+ * font_render.c (MSB = leftmost pixel, all-ones where the bit is set).
+ */
+static void generate_row_masks_file(const char *out_path)
+{
+	char *buf = NULL;
+	size_t len = 0, cap = 0;
+
+	buf_append(&buf, &len, &cap,
+		"/* Auto-generated by tools/fontgen.c. Do not edit by hand. */\n"
+		"#include \"font.h\"\n\n"
+		"const uint32_t g_font_row_masks[256][8] __attribute__((aligned(32))) = {\n");
+	for (unsigned v = 0; v < 256; v++) {
+		buf_append(&buf, &len, &cap, "\t{ ");
+		for (int bit = 0; bit < 8; bit++) {
+			buf_printf(&buf, &len, &cap, "0x%08Xu%s", (v & (0x80u >> bit)) ? 0xffffffffu : 0u, (bit == 7) ? "" : ", ");
+		}
+		buf_printf(&buf, &len, &cap, " }, /* 0x%02X */\n", v);
+	}
+	buf_append(&buf, &len, &cap, "};\n");
+
+	write_if_changed(out_path, buf ? buf : "");
+	free(buf);
+}
+
 static void usage(const char *argv0)
 {
 	fprintf(stderr, "usage: %s [--out-dir DIR]\n", argv0);
@@ -398,10 +424,13 @@ int main(int argc, char **argv)
 
 	char out8[512];
 	char out16[512];
+	char outmasks[512];
 	snprintf(out8, sizeof(out8), "%s/font_builtin_8x8.c", out_dir);
 	snprintf(out16, sizeof(out16), "%s/font_builtin_8x16.c", out_dir);
+	snprintf(outmasks, sizeof(outmasks), "%s/font_row_masks.c", out_dir);
 
 	generate_font_file_8x8(out8);
 	generate_font_file_8x16_scaled(out16);
+	generate_row_masks_file(outmasks);
 	return 0;
 }
@@ -0,0 +1,66 @@
+#include "../src/core/arena.h"
+
+enum {
+	TEST_SYS_MINCORE = 27,
+	TEST_PAGE = 4096,
+};
+
+static struct arena g_arena;
+static uint8_t g_vec[4096];
+
+static int fail(const char *msg)
+{
+	dbg_write(msg);
+	return 1;
+}
+
+/* Pages overlapping [p, p + len) the kernel has backed with memory. */
+static uint32_t resident_pages(const void *p, size_t len)
+{
+	uintptr_t lo = (uintptr_t)p & ~(uintptr_t)(TEST_PAGE - 1u);
+	len += (uintptr_t)p - lo;
+	p = (const void *)lo;
+	size_t n = (len + TEST_PAGE - 1u) / TEST_PAGE;
+	if (n > sizeof(g_vec)) return 0xffffffffu;
+	if (sys_call3(TEST_SYS_MINCORE, (long)p, (long)len, (long)g_vec) != 0) return 0xffffffffu;
+	uint32_t r = 0;
+	for (size_t i = 0; i < n; i++) r += g_vec[i] & 1u;
+	return r;
+}
+
+int main(void)
+{
+	/* Far more than the test touches: reserving must not cost memory. */
+	if (arena_init(&g_arena, (size_t)1 << 34) != 0) return fail("arena: FAIL (reserve)\n");
+
+	uint8_t *a = (uint8_t *)arena_alloc(&g_arena, 100);
+	uint8_t *b = (uint8_t *)arena_alloc(&g_arena, 16u * TEST_PAGE);
+	if (!a || !b) return fail("arena: FAIL (alloc)\n");
+	if (((uintptr_t)a % ARENA_ALIGN) || ((uintptr_t)b % ARENA_ALIGN)) return fail("arena: FAIL (align)\n");
+	if (b < a + 100) return fail("arena: FAIL (overlap)\n");
+	if (resident_pages(b, 16u * TEST_PAGE) != 0) return fail("arena: FAIL (committed before use)\n");
+
+	/* Only the pages that are written get committed. */
+	b[0] = 1;
+	b[5u * TEST_PAGE] = 2;
+	a[0] = 3;
+	uint32_t r = resident_pages(b, 16u * TEST_PAGE);
+	if (r < 2 || r > 3) return fail("arena: FAIL (commit on write)\n");
+
+	/* Discard drops them; the blocks stay usable and read as zero. */
+	arena_discard(&g_arena);
+	if (resident_pages(b, 16u * TEST_PAGE) != 0) return fail("arena: FAIL (discard)\n");
+	if (a[0] != 0 || b[0] != 0 || b[5u * TEST_PAGE] != 0) return fail("arena: FAIL (zero after discard)\n");
+	b[7] = 9;
+	if (b[7] != 9) return fail("arena: FAIL (reuse)\n");
+
+	/* The reservation is a hard limit. */
+	if (arena_alloc(&g_arena, (size_t)1 << 34) != 0) return fail("arena: FAIL (over reserve)\n");
+	if (!arena_alloc(&g_arena, 64)) return fail("arena: FAIL (alloc after refusal)\n");
+
+	struct arena none;
+	if (arena_init(&none, 0) == 0 || arena_alloc(&none, 1) != 0) return fail("arena: FAIL (empty)\n");
+
+	dbg_write("arena selftest: OK\n");
+	return 0;
+}
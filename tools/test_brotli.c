@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/brotli.h"
+
+/* Vectors from the reference encoder (via brotlicffi):
+ * - k_text_q11, k_text_q5: text_ref() at quality 11 / window 22 and
+ *   quality 5 / window 16.
+ * - k_table: table_ref() at quality 11 / window 16; it switches block types.
+ * - k_noise: noise_ref(), which the encoder keeps as an uncompressed
+ *   meta-block.
+ * - k_crafted: assembled by hand and checked against the reference decoder:
+ *   a metadata block, an uncompressed meta-block, then one dictionary word
+ *   per meta-block with the omit-first, omit-last, uppercase-first and
+ *   uppercase-all (on 2- and 3-byte UTF-8) transforms.
+ */
+static const uint8_t k_text_q11[] = {
+	0x1b, 0xf1, 0x3a, 0x20, 0x9c, 0x07, 0x76, 0x2c, 0x6d, 0xda, 0x62, 0xf1, 0x16, 0x1f, 0xa1, 0x92,
+	0x6b, 0xb6, 0x62, 0xd2, 0xde, 0xf6, 0x1f, 0x9c, 0x26, 0x28, 0xf2, 0x2d, 0x2c, 0x29, 0xcf, 0xf0,
+	0xf4, 0x12, 0x64, 0x2e, 0x8f, 0xe2, 0xfb, 0x9b, 0xac, 0xf3, 0x3f, 0x85, 0x92, 0x80, 0x82, 0x2c,
+	0xf1, 0x66, 0x82, 0xc4, 0xe1, 0x01, 0x06, 0x4e, 0x38, 0x0c, 0x02, 0xa9, 0xcb, 0xe0, 0xf6, 0x07,
+	0xe7, 0x1d, 0xd8, 0x09, 0x39, 0xd2, 0xe5, 0xfb, 0x79, 0x43, 0x72, 0x5b, 0x97, 0xee, 0x3f, 0xf9,
+	0xce, 0x4c, 0x7f, 0xfc, 0xff, 0x7e, 0x39, 0x8a, 0xf2, 0xa1, 0xac, 0x7e, 0x6a, 0xa8, 0xa9, 0x96,
+	0xda, 0xea, 0xa8, 0xab, 0x9e, 0xfa, 0x4c, 0x79, 0x9c, 0x0f, 0x79, 0xce, 0x21, 0xa7, 0x5c, 0x72,
+	0xcb, 0x23, 0xaf, 0x7c, 0xea, 0x33, 0x04, 0xc0, 0xe7, 0x90, 0x43, 0x0e, 0x39, 0xe4, 0x90, 0x43,
+	0x0e, 0x39, 0xe4, 0x90, 0x53, 0x4e, 0x39, 0xe5, 0x94, 0x53, 0x4e, 0x39, 0xe5, 0x94, 0x53, 0x4e,
+	0xb9, 0xe4, 0x92, 0x4b, 0x2e, 0xb9, 0xe4, 0x92, 0x4b, 0x2e, 0xb9, 0xe4, 0x92, 0x5b, 0x6e, 0xb9,
+	0xe5, 0x96, 0x5b, 0x6e, 0xb9, 0xe5, 0x96, 0x5b, 0x6e, 0x79, 0xe4, 0x91, 0x47, 0x1e, 0x79, 0xe4,
+	0x91, 0x47, 0x1e, 0x79, 0xe4, 0x91, 0x57, 0x5e, 0x79, 0xe5, 0x95, 0x57, 0x5e, 0x79, 0xe5, 0x95,
+	0x57, 0x5e, 0xf9, 0xe4, 0x93, 0x4f, 0x3e, 0xf9, 0xe4, 0x93, 0x4f, 0x3e, 0xf9, 0xe4, 0x93, 0x9f,
+	0xfc, 0xe4, 0x27, 0x3f, 0xf9, 0xc9, 0x4f, 0x7e, 0xf2, 0x93, 0x9f, 0xfc, 0xfc, 0xe5, 0x7d, 0x9f,
+	0xfb, 0xa7, 0x87, 0x9e, 0x7a, 0xe9, 0xad, 0x8f, 0xbe, 0xfa, 0xc9, 0xcf, 0x94, 0x87, 0x7e, 0xff,
+	0xf4, 0x4f, 0xff, 0xf4, 0x4f, 0xff, 0xf4, 0x4f, 0xff, 0xf4, 0x4f, 0xff, 0xf4, 0xd0, 0x43, 0x0f,
+	0x3d, 0xf4, 0xd0, 0x43, 0x0f, 0x3d, 0xf4, 0xd0, 0x43, 0x4f, 0x3d, 0xf5, 0xd4, 0x53, 0x4f, 0x3d,
+	0xf5, 0xd4, 0x53, 0x4f, 0x3d, 0xf5, 0xd2, 0x4b, 0x2f, 0xbd, 0xf4, 0xd2, 0x4b, 0x2f, 0xbd, 0xf4,
+	0xd2, 0x4b, 0x6f, 0xbd, 0xf5, 0xd6, 0x5b, 0x6f, 0xbd, 0xf5, 0xd6, 0x5b, 0x6f, 0xbd, 0xf5, 0xd1,
+	0x47, 0x1f, 0x7d, 0xf4, 0xd1, 0x47, 0x1f, 0x7d, 0xf4, 0xd1, 0x47, 0x5f, 0x7d, 0xf5, 0xd5, 0x57,
+	0x5f, 0x7d, 0xf5, 0xd5, 0x57, 0x5f, 0x7d, 0xf5, 0xd3, 0x4f, 0x3f, 0xfd, 0xf4, 0xd3, 0x4f, 0x3f,
+	0xfd, 0xf4, 0xd3, 0x4f, 0x7f, 0xfa, 0xd3, 0x9f, 0xfe, 0xf4, 0xa7, 0x3f, 0xfd, 0xe9, 0x4f, 0x7f,
+	0x96, 0x1f,
+};
+static const uint8_t k_text_q5[] = {
+	0x22, 0x5e, 0x07, 0x80, 0xd8, 0x60, 0x99, 0x29, 0xbb, 0x42, 0x1e, 0xd3, 0x80, 0x08, 0x17, 0x23,
+	0x7b, 0xff, 0xc2, 0xf3, 0xb6, 0x03, 0xb0, 0xa9, 0x6c, 0xaa, 0xdd, 0x05, 0x21, 0x44, 0x1e, 0xa0,
+	0x7c, 0x7c, 0x80, 0x51, 0xd4, 0xb6, 0x25, 0x5c, 0xa8, 0xc0, 0x18, 0xbe, 0x19, 0x1c, 0xf7, 0x13,
+	0x33, 0x22, 0xf7, 0xf3, 0xef, 0x9b, 0x97, 0xe3, 0x74, 0xf6, 0xf7, 0x8b, 0xfd, 0x30, 0x6f, 0xc7,
+	0xe5, 0xe7, 0xdb, 0x9f, 0xd7, 0xe3, 0xf6, 0xed, 0xef, 0xf1, 0xf8, 0xf3, 0xf2, 0xfe, 0x75, 0xbc,
+	0xfd, 0xde, 0x7c, 0x6e, 0x59, 0x9e, 0x2f, 0xfe, 0xff, 0x3b, 0xae, 0xdf, 0xee, 0xbe, 0x8a, 0x72,
+	0x70, 0x9b, 0x51, 0x0c, 0x30, 0xc8, 0x10, 0xc3, 0x8c, 0x30, 0x9a, 0x31, 0x8c, 0xa5, 0xd4, 0xa0,
+	0x87, 0x84, 0x54, 0x48, 0x85, 0x54, 0x48, 0x85, 0x54, 0x48, 0x85, 0x54, 0x48, 0x85, 0x00, 0x02,
+	0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
+	0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x08, 0x22, 0x88, 0x20, 0x82, 0x08, 0x22, 0x88, 0x20,
+	0x82, 0x08, 0x22, 0x88, 0x21, 0x86, 0x18, 0x62, 0x88, 0x21, 0x86, 0x18, 0x62, 0x88, 0x21, 0x86,
+	0x04, 0x12, 0x48, 0x20, 0x81, 0x04, 0x12, 0x48, 0x20, 0x81, 0x04, 0x12, 0x48, 0x43, 0x1a, 0xd2,
+	0x90, 0x86, 0x34, 0xa4, 0x21, 0x0d, 0x69, 0x48, 0x43, 0x1a, 0x32, 0x90, 0x81, 0x0c, 0x64, 0x20,
+	0x03, 0x19, 0xc8, 0x40, 0x06, 0x32, 0x90, 0x81, 0x2c, 0x64, 0x21, 0x0b, 0x59, 0xc8, 0x42, 0x16,
+	0xb2, 0x90, 0x85, 0x2c, 0x64, 0xfd, 0x52, 0xa7, 0xd3, 0x7d, 0x4a, 0x51, 0x40, 0x21, 0x45, 0x14,
+	0x53, 0x42, 0x69, 0xca, 0x48, 0x99, 0xfd, 0x9c, 0x57, 0xab, 0x29, 0x4b, 0x29, 0x4a, 0x51, 0x8a,
+	0x52, 0x94, 0xa2, 0x14, 0xa5, 0x28, 0x45, 0x01, 0x05, 0x14, 0x50, 0x40, 0x01, 0x05, 0x14, 0x50,
+	0x40, 0x01, 0x05, 0x14, 0x52, 0x48, 0x21, 0x85, 0x14, 0x52, 0x48, 0x21, 0x85, 0x14, 0x52, 0x48,
+	0x11, 0x45, 0x14, 0x51, 0x44, 0x11, 0x45, 0x14, 0x51, 0x44, 0x11, 0x45, 0x14, 0x53, 0x4c, 0x31,
+	0xc5, 0x14, 0x53, 0x4c, 0x31, 0xc5, 0x14, 0x53, 0x4c, 0x09, 0x25, 0x94, 0x50, 0x42, 0x09, 0x25,
+	0x94, 0x50, 0x42, 0x09, 0x25, 0x94, 0xa6, 0x34, 0xa5, 0x29, 0x4d, 0x69, 0x4a, 0x53, 0x9a, 0xd2,
+	0x94, 0xa6, 0x34, 0x65, 0x28, 0x43, 0x19, 0xca, 0x50, 0x86, 0x32, 0x94, 0xa1, 0x0c, 0x65, 0x28,
+	0x43, 0x59, 0xca, 0x52, 0x96, 0xb2, 0x94, 0xa5, 0x2c, 0x65, 0x29, 0x4b, 0x59, 0xe5, 0x0b,
+};
+static const uint8_t k_table[] = {
+	0xa2, 0x0b, 0x02, 0xbc, 0x65, 0x81, 0x6d, 0x2c, 0x0d, 0xfe, 0x0b, 0x34, 0x6d, 0x36, 0x08, 0x98,
+	0xe3, 0x10, 0x56, 0xd7, 0xf7, 0xc5, 0x6f, 0xa0, 0xce, 0x09, 0x37, 0xd1, 0xbd, 0xbf, 0xd4, 0x02,
+	0x34, 0x25, 0x5c, 0x24, 0xd7, 0x20, 0x3b, 0x03, 0x75, 0xae, 0x83, 0x73, 0x2c, 0x32, 0x33, 0x3d,
+	0x18, 0xca, 0x52, 0x16, 0x98, 0x1f, 0xd4, 0xa6, 0xce, 0xf0, 0x0a, 0xed, 0x2d, 0x41, 0x7c, 0xe6,
+	0xe8, 0x1f, 0x39, 0x11, 0x00, 0x0f, 0x8b, 0xd0, 0xa4, 0x80, 0x2d, 0xd4, 0xa6, 0xb2, 0xf8, 0xd4,
+	0x06, 0xff, 0x21, 0x6c, 0x73, 0x8f, 0xd7, 0xad, 0x88, 0xe0, 0x55, 0xd1, 0x75, 0x09, 0xe5, 0x4e,
+	0x67, 0xfc, 0xf6, 0x1e, 0x1d, 0x3a, 0x57, 0xe3, 0xe7, 0x5a, 0x79, 0x56, 0xe8, 0xfa, 0xb3, 0xea,
+	0x2f, 0x3a, 0xa6, 0xb0, 0xf3, 0xc9, 0x77, 0xb9, 0xf7, 0xe8, 0xfa, 0xb9, 0x6f, 0xa2, 0xfb, 0x2e,
+	0xb5, 0xf6, 0x33, 0x37, 0x22, 0x36, 0xb3, 0xa7, 0x6e, 0x7e, 0xbf, 0xec, 0xb3, 0xf8, 0xf1, 0x24,
+	0x22, 0xf9, 0x7c, 0xb2, 0x26, 0xb9, 0xb4, 0x99, 0xb9, 0x4a, 0x8f, 0x8b, 0x02, 0xaa, 0x24, 0xe6,
+	0xe9, 0x44, 0x72, 0xb3, 0x6c, 0x5c, 0x59, 0x4f, 0x7e, 0x95, 0x95, 0xbd, 0x95, 0x79, 0x5a, 0x2d,
+	0x44, 0x04, 0x89, 0xf9, 0xe2, 0x65, 0x29, 0xff, 0x31, 0x25, 0x61, 0xc5, 0xde, 0x36, 0x90, 0xbd,
+	0xe4, 0xf8, 0x7f, 0x9e, 0xac, 0x6b, 0xff, 0xda, 0x6f, 0x9b, 0x6f, 0x9a, 0xb6, 0x6f, 0xae, 0x45,
+	0x7b, 0xed, 0xd5, 0xa4, 0xcf, 0x78, 0x68, 0xae, 0xe4, 0x0b, 0xaf, 0xc7, 0x09, 0x0d, 0xb3, 0xab,
+	0x42, 0x00, 0x62, 0x5c, 0x49, 0x1c, 0xba, 0x4b, 0x00, 0x0a, 0xc7, 0x80, 0x07, 0x58, 0x36, 0x32,
+	0xe6, 0xf1, 0x1e, 0xf0, 0xf5, 0x63, 0xa0, 0x25, 0x71, 0x0a, 0xf4, 0xdc, 0x25, 0xff, 0x65, 0xd7,
+	0x95, 0x1e, 0xde, 0xf5, 0xa6, 0xa7, 0xf7, 0x77, 0x7e, 0x76, 0x78, 0xab, 0xba, 0x62, 0x7e, 0x23,
+	0xc9, 0x9c, 0xa1, 0x36, 0xc6, 0xb0, 0x42, 0x4c, 0xdf, 0xd3, 0x69, 0x08, 0x02, 0x00, 0xf3, 0xbe,
+	0xfa, 0xa9, 0x71, 0x1f, 0x3e, 0x70, 0x7d, 0xa4, 0xa6, 0x9c, 0xc8, 0x7a, 0x46, 0xd6, 0xfc, 0x5a,
+	0x56, 0x1a, 0x13, 0xdf, 0x13, 0x71, 0x5a, 0x71, 0x6f, 0x7f, 0x1a, 0xff, 0xfb, 0x8b, 0x9a, 0x88,
+	0x75, 0xe4, 0x95, 0x1e, 0x6c, 0x45, 0x7c, 0x5e, 0x45, 0x27, 0xbd, 0x5c, 0x2c, 0x47, 0x91, 0x3d,
+	0x53, 0x00, 0x7f, 0xb6, 0xa0, 0x69, 0xd5, 0xe8, 0xd7, 0x13, 0x48, 0x30, 0x3f, 0x3e, 0x0b, 0x75,
+	0x0f, 0x15, 0x21, 0xb5, 0xa4, 0x1b, 0x82, 0x27, 0x32, 0xaf, 0x3b, 0x39, 0x73, 0x4a, 0x49, 0x59,
+	0xd3, 0xe5, 0x69, 0xe1, 0x6e, 0x7d, 0xe7, 0xe0, 0xc6, 0xc9, 0xa7, 0x6b, 0x26, 0x25, 0x32, 0xb7,
+	0xad, 0x76, 0x69, 0xa6, 0xc5, 0x99, 0x94, 0x9f, 0x3d, 0x10, 0xed, 0xf6, 0x90, 0x3b, 0xa3, 0x08,
+	0x78, 0x9c, 0xd9, 0x25, 0x31, 0x82, 0x64, 0xf0, 0x59, 0xff, 0xc3, 0xe7, 0x30, 0x71, 0x85, 0x7d,
+	0x21, 0xfa, 0xf3, 0x4b, 0x2e, 0x26, 0xdc, 0x93, 0x43, 0xdf, 0xb4, 0x6f, 0xe4, 0x86, 0xf3, 0xbd,
+	0xca, 0xf8, 0xb1, 0x92, 0x81, 0xd2, 0xd6, 0x45, 0x4f, 0x66, 0x52, 0x2b, 0x78, 0x7e, 0x3e, 0x71,
+	0xf1, 0x57, 0x0d, 0xf6, 0x15, 0x8c, 0xf4, 0x1d, 0xee, 0x44, 0x65, 0xcf, 0x92, 0xbf, 0x8c, 0xc0,
+	0x61, 0x39, 0x2a, 0x3b, 0x47, 0x84, 0xcd, 0xf7, 0x4a, 0x71, 0x0d, 0x59, 0xba, 0x69, 0xc5, 0xf3,
+	0x5e, 0xb5, 0x48, 0xd4, 0xeb, 0x3e, 0xda, 0x91, 0x75, 0x22, 0xff, 0x79, 0xb5, 0x75, 0x2d, 0x2b,
+	0xb1, 0x20, 0x67, 0xa4, 0xef, 0x63, 0xd1, 0x7b, 0xe5, 0x1a, 0xbe, 0x5d, 0x38, 0x99, 0x9f, 0x9c,
+	0x2e, 0xe8, 0xd9, 0x28, 0x5c, 0x2f, 0xfb, 0xfa, 0x6a, 0x77, 0x4e, 0x91, 0x30, 0xcb, 0xc4, 0x09,
+	0x00, 0x88, 0xb6, 0x00, 0x5a, 0x42, 0x68, 0xd0, 0x7f, 0xa0, 0xa0, 0x23, 0x5e, 0x67, 0xab, 0x3c,
+	0x46, 0xb0, 0x7a, 0x60, 0x43, 0x24, 0x86, 0x91, 0x28, 0x6f, 0x1d, 0x55, 0x0c, 0xfc, 0xda, 0xdd,
+	0x6e, 0xd7, 0x6e, 0xee, 0x8f, 0x6b, 0xd2, 0x7e, 0x9d, 0x59, 0x9d, 0xff, 0x5e, 0xd1, 0x7e, 0x13,
+	0xd9, 0x32, 0xb8, 0xf2, 0xe9, 0xac, 0x89, 0xcb, 0x23, 0x71, 0x86, 0xa8, 0x8d, 0xf0, 0x03, 0x00,
+	0x35, 0xde, 0x06, 0x36, 0xe6, 0xc0, 0x04, 0xf7, 0x79, 0x04, 0x50, 0xfc, 0x89, 0xb7, 0xa2, 0x6f,
+	0x27, 0x6a, 0x05, 0x1a, 0x49, 0x72, 0xbf, 0x27, 0x75, 0x73, 0xbd, 0xe6, 0x75, 0xe0, 0xef, 0xf4,
+	0xdd, 0x71, 0xb2, 0xee, 0x05, 0x77, 0x37, 0x8b, 0xdc, 0x7b, 0x60, 0x99, 0xbb, 0xa4, 0x6d, 0x2d,
+	0x7f, 0xaa, 0xb2, 0xaf, 0x80, 0xa4, 0x99, 0xed, 0xf3, 0x53, 0x06, 0xdc, 0xdf, 0x32, 0x7f, 0xf8,
+	0x91, 0x53, 0xb1, 0x16, 0xdf, 0x00, 0x7d, 0x6c, 0xe1, 0x31, 0x40, 0x0a, 0xc3, 0x82, 0xb9, 0xf3,
+	0x0b, 0x21, 0x59, 0x7e, 0x1d, 0x6b, 0xbf, 0x5e, 0xdf, 0x7b, 0xcc, 0x3a, 0xa8, 0x5b, 0xf5, 0xf6,
+	0x3c, 0xac, 0xff, 0x44, 0x57, 0x96, 0xd6, 0xa4, 0x4d, 0x3a, 0xaa, 0xcf, 0x97, 0xd7, 0x76, 0xb6,
+	0x97, 0x5f, 0x2e, 0x48, 0x3e, 0x23, 0xa5, 0x05, 0x97, 0xf3, 0xbb, 0x59, 0x95, 0x58, 0x24, 0x10,
+	0x90, 0x28, 0xa4, 0xe8, 0x3c, 0x8f, 0x58, 0xc5, 0xd1, 0x64, 0xb2, 0xa9, 0xa6, 0x1b, 0xe5, 0x4f,
+	0x47, 0xe2, 0x9b, 0x8b, 0xbd, 0x8e, 0x93, 0xb3, 0x91, 0xd3, 0xee, 0x2c, 0xd7, 0xf3, 0xaf, 0xb3,
+	0xfc, 0xf4, 0xa8, 0x7b, 0x39, 0x6d, 0xe8, 0x78, 0x61, 0xbd, 0xd5, 0xe5, 0x89, 0x7d, 0x3d, 0xc8,
+	0xff, 0xeb, 0x27, 0x7f, 0x99, 0x59, 0xf2, 0x1b, 0x04, 0xc9, 0x1f, 0x4b, 0xc0, 0x1b, 0x24, 0x83,
+	0x00, 0xd7, 0xdc, 0x4d, 0x19, 0x07, 0x8b, 0x5b, 0x1a, 0xa0, 0x27, 0x33, 0x01, 0x6a, 0x48, 0xfe,
+	0x73, 0xfa, 0xff, 0xcf, 0xe3, 0x66, 0x56, 0xca, 0xa7, 0xeb, 0x6e, 0x35, 0x71, 0xe6, 0x22, 0x27,
+	0xfd, 0x7f, 0xa9, 0xc2, 0x91, 0xe7, 0x18, 0xca, 0x7c, 0x58, 0xe8, 0xbc, 0x3d, 0x2f, 0x5f, 0x9b,
+	0x25, 0x61, 0x46, 0x63, 0x34, 0xc0, 0x48, 0x1a, 0x9c, 0x90, 0x44, 0xe6, 0x8b, 0xc4, 0x43, 0x31,
+	0xc4, 0x3a, 0x5c, 0x61, 0x05, 0x10, 0x54, 0xd7, 0x7f, 0xa0, 0x4b, 0x59, 0x12, 0x89, 0x72, 0x6f,
+	0x76, 0xcc, 0x6c, 0x6a, 0xdc, 0x7f, 0xf6, 0x87, 0xa3, 0x67, 0x26, 0x6f, 0xee, 0xa2, 0xa9, 0x3d,
+	0xfa, 0x28, 0xff, 0xa1, 0x3d, 0xba, 0xf5, 0x3e, 0xbd, 0xa0, 0xe2, 0xea, 0x7b, 0xbf, 0x9b, 0xc4,
+	0x99, 0x46, 0xb7, 0xe4, 0xfc, 0x54, 0x70, 0xd7, 0xd1, 0xec, 0x9a, 0xaf, 0x98, 0x25, 0x42, 0xb8,
+	0x21, 0x3a, 0xfb, 0xfc, 0xc3, 0x25, 0x38, 0x50, 0x7c, 0xfc, 0x50, 0x4c, 0x92, 0xec, 0x38, 0x8e,
+	0x28, 0x4e, 0x2c, 0x4c, 0x6e, 0xaa, 0x98, 0xca, 0xab, 0x73, 0x26, 0x65, 0xba, 0xf3, 0x22, 0xbe,
+	0xab, 0x77, 0x86, 0x93, 0xc7, 0xb3, 0xca, 0x2b, 0xf3, 0xae, 0x6b, 0x93, 0x47, 0x49, 0x9a, 0x11,
+	0xea, 0x83, 0xac, 0x73, 0x30, 0x21, 0x7c, 0x2e, 0x4b, 0x9f, 0x69, 0x10, 0xaf, 0xb0, 0xb0, 0x55,
+	0x7d, 0x07, 0xa8, 0x34, 0xd7, 0x42, 0xe6, 0x00, 0x32, 0x92, 0xe5, 0xbf, 0xbe, 0xae, 0x48, 0x6f,
+	0x74, 0xd5, 0x61, 0x6b, 0xfc, 0xaf, 0xa7, 0x26, 0xfa, 0x78, 0x6d, 0xb3, 0xae, 0xf3, 0xfd, 0xea,
+	0x77, 0xba, 0xf6, 0xa0, 0xfe, 0x36, 0xbf, 0x70, 0x3b, 0xbf, 0x9e, 0xe4, 0x33, 0x55, 0x95, 0x62,
+	0xf9, 0xe0, 0x94, 0x04, 0x29, 0xdc, 0xd0, 0x5e, 0x7f, 0x5f, 0x0c, 0xf3, 0xa1, 0x8c, 0x12, 0x2d,
+	0x84, 0xe6, 0xcb, 0xd5, 0x79, 0x28, 0xb4, 0xaf, 0x23, 0xfd, 0x9b, 0x3b, 0xcf, 0xce, 0xd3, 0xbf,
+	0x46, 0xfe, 0x63, 0xd3, 0xc1, 0x88, 0xdc, 0xa3, 0x9a, 0xbf, 0xaa, 0xe8, 0x94, 0xc9, 0x0c, 0x47,
+	0xd9, 0xec, 0xf2, 0xcf, 0xc8, 0xd9, 0x64, 0xe2, 0xec, 0x7e, 0x03, 0xf9, 0xcb, 0xd0, 0x21, 0x4c,
+	0xb4, 0x04, 0x70, 0x89, 0x0d, 0x47, 0x08, 0x5d, 0xa1, 0x0f, 0xb7, 0xd0, 0x42, 0xbb, 0xcb, 0x48,
+	0x0b, 0x4a, 0x19, 0xe8, 0x10, 0xad, 0x0c, 0x25, 0xff, 0xf9, 0xe6, 0x61, 0x62, 0xaa, 0xce, 0x5e,
+	0xf6, 0x14, 0xbb, 0xb7, 0x39, 0x5b, 0xb8, 0xd3, 0x71, 0x72, 0x78, 0xe3, 0xdc, 0x8d, 0xca, 0xda,
+	0x07, 0xbd, 0x09, 0x51, 0xd7, 0xf3, 0x11, 0x33, 0xc9, 0x24, 0xcc, 0xca, 0x55, 0xaa, 0xa0, 0xb9,
+	0x28, 0x3c, 0xda, 0xaa, 0x0b, 0x82, 0x28, 0x72, 0x98, 0x70, 0x03, 0x44, 0x80, 0xfd, 0xa1, 0x63,
+	0xf4, 0xa9, 0x48, 0x21, 0x27, 0x24, 0xca, 0xb9, 0x5d, 0xce, 0xd9, 0x1d, 0xd7, 0x6d, 0xd5, 0x4c,
+	0xed, 0xc6, 0x58, 0xf9, 0x70, 0xef, 0x58, 0x57, 0xec, 0xc2, 0xf1, 0x65, 0xbf, 0x77, 0x25, 0x7b,
+	0xf0, 0xfc, 0x76, 0xb8, 0xae, 0x63, 0x83, 0xc4, 0x99, 0xac, 0x11, 0xe5, 0x67, 0x01, 0x15, 0xa8,
+	0xf8, 0xff, 0x42, 0xd5, 0x8e, 0x6a, 0x22, 0x47, 0xc1, 0xa1, 0x00, 0xc1, 0xab, 0x33, 0x9d, 0x14,
+	0x98, 0xfc, 0x8d, 0x24, 0x49, 0x06, 0x2b, 0x36, 0x52, 0x33, 0x4f, 0x66, 0x53, 0x0b, 0x3a, 0x06,
+	0x77, 0xec, 0x5f, 0x60, 0x49, 0xff, 0xc5, 0x57, 0x5f, 0xa2, 0x7d, 0xa0, 0x65, 0xb5, 0xc2, 0xf3,
+	0x78, 0x71, 0x92, 0xdf, 0x47, 0xd2, 0x4c, 0x95, 0x5e, 0xb4, 0x3a, 0x53, 0x14, 0x42, 0x02, 0x82,
+	0x90, 0x14, 0x62, 0x20, 0x4d, 0x92, 0xc1, 0x08, 0x3e, 0x30, 0x22, 0x1a, 0x87, 0x09, 0x50, 0xb0,
+	0x84, 0x40, 0xb2, 0xbc, 0xdd, 0x51, 0xd5, 0xf6, 0x7e, 0x3f, 0x14, 0x71, 0x70, 0xd2, 0xe2, 0x49,
+	0x77, 0xbe, 0x74, 0xb6, 0xde, 0x45, 0x80, 0x8f, 0x25, 0xfb, 0xa0, 0xb3, 0x7b, 0x32, 0xce, 0xfe,
+	0x9e, 0x5d, 0x4d, 0xf2, 0xbf, 0x83, 0x43, 0xc2, 0x33, 0x9b, 0xae, 0xce, 0xb5, 0x8c, 0xc5, 0x58,
+	0x02, 0xc5, 0xbc, 0xd0, 0x84, 0x6e, 0x28, 0x39, 0x42, 0xa1, 0xd3, 0xeb, 0xda, 0x19, 0x5d, 0x2a,
+};
+static const uint8_t k_noise[] = {
+	0x8b, 0x2b, 0x81, 0x63, 0x7a, 0xa0, 0x7e, 0xe1, 0xea, 0xf2, 0x3d, 0xc7, 0x39, 0x6d, 0x0d, 0xa6,
+	0x78, 0x16, 0x80, 0x05, 0x12, 0x3a, 0xa7, 0x4e, 0xde, 0x9f, 0x78, 0x9c, 0x70, 0x63, 0x00, 0x0b,
+	0xe6, 0xc8, 0x25, 0x21, 0x3d, 0xad, 0x22, 0xbc, 0x70, 0xb3, 0x85, 0xda, 0x21, 0x23, 0x63, 0x36,
+	0x17, 0x7b, 0xc3, 0x79, 0xfd, 0x62, 0x6c, 0xf9, 0x66, 0x43, 0xf1, 0x1f, 0xbd, 0x61, 0x63, 0xbd,
+	0x7c, 0x99, 0x90, 0x67, 0xf3, 0xd1, 0x98, 0xf0, 0x8c, 0x88, 0xd3, 0x90, 0x34, 0x3f, 0x14, 0xd1,
+	0xaa, 0xff, 0x72, 0x48, 0x27, 0x35, 0xf9, 0xde, 0x34, 0x4e, 0xb0, 0x4a, 0x10, 0xd8, 0xd5, 0x83,
+	0x7e, 0x10, 0xa4, 0x57, 0x4d, 0xd7, 0x31, 0x39, 0x3c, 0x26, 0x9f, 0x56, 0x69, 0x48, 0x3b, 0x0d,
+	0x32, 0x34, 0xa7, 0x0c, 0x79, 0x3d, 0x1a, 0x24, 0x37, 0xbf, 0xc2, 0x8b, 0xd2, 0x16, 0x20, 0xcf,
+	0x84, 0x7c, 0xbe, 0xc6, 0xba, 0xbb, 0xf4, 0x77, 0x3f, 0x32, 0x89, 0xc9, 0xbb, 0xae, 0xed, 0x0b,
+	0x7d, 0x14, 0xa7, 0x1e, 0xe0, 0xed, 0x3c, 0x0f, 0x8f, 0x3e, 0xb7, 0x78, 0xb6, 0x7e, 0x23, 0x38,
+	0x04, 0x7c, 0x01, 0x4d, 0x4b, 0x54, 0x38, 0xbd, 0xcc, 0x3a, 0xf0, 0x63, 0x23, 0x20, 0xc6, 0x4b,
+	0x4b, 0xfb, 0xff, 0xbd, 0x42, 0x33, 0x75, 0x5f, 0xff, 0x20, 0xe5, 0x40, 0x6d, 0x89, 0x6f, 0xf6,
+	0x43, 0x77, 0xf8, 0xf4, 0x1f, 0x1e, 0x04, 0x87, 0xba, 0x00, 0xe4, 0x21, 0x6e, 0x90, 0xf1, 0x46,
+	0xfd, 0xfd, 0x02, 0x47, 0x05, 0x2a, 0x17, 0x9e, 0x5f, 0xd9, 0x80, 0x78, 0x69, 0x83, 0x0a, 0x73,
+	0x67, 0xd2, 0x82, 0x9c, 0x0b, 0x03, 0xe3, 0xc0, 0xf4, 0x9d, 0x33, 0x74, 0xf1, 0x9f, 0x58, 0x1a,
+	0x8e, 0x02, 0x27, 0x78, 0x51, 0xb6, 0xeb, 0x45, 0x10, 0x6d, 0x4a, 0xad, 0xfe, 0x90, 0x66, 0xc1,
+	0xe1, 0xe6, 0xbf, 0x8c, 0x9d, 0x9f, 0x30, 0xe8, 0xe4, 0x1a, 0xdc, 0x28, 0xb7, 0x40, 0xd7, 0xe3,
+	0x78, 0x2c, 0xcb, 0x8c, 0x01, 0x96, 0x34, 0x26, 0x51, 0xcb, 0x32, 0xab, 0x0a, 0x18, 0x14, 0x3f,
+	0x03, 0xad, 0x2e, 0x12, 0x58, 0x57, 0xd6, 0x7b, 0x4d, 0xda, 0x20, 0xc6, 0xee, 0xf2, 0x4f, 0xe2,
+	0x32, 0xe1, 0x2f, 0x21, 0x7a, 0x79, 0x04, 0x23, 0x65, 0x59, 0xc3, 0x27, 0x19, 0xa5, 0x14, 0x3f,
+	0x4e, 0x2f, 0x73, 0xa9, 0xe6, 0x5d, 0x22, 0x07, 0xc5, 0x1d, 0xbf, 0x1e, 0xb3, 0xd0, 0x2e, 0x12,
+	0x0a, 0x33, 0x3b, 0x66, 0x66, 0x47, 0xe7, 0x7d, 0xa4, 0x3b, 0xbd, 0x19, 0x43, 0xbd, 0xe0, 0x5b,
+	0x02, 0x14, 0x4c, 0x10, 0x96, 0xd5, 0xe4, 0x05, 0x23, 0x57, 0x10, 0x8a, 0x7b, 0xea, 0xda, 0x70,
+	0x66, 0x51, 0x22, 0xc7, 0x7a, 0xbd, 0x57, 0x66, 0xed, 0xdb, 0x6a, 0x81, 0x37, 0x07, 0x40, 0x35,
+	0x68, 0x62, 0xe3, 0x54, 0x33, 0x55, 0x93, 0x89, 0x99, 0x15, 0x43, 0x3d, 0x77, 0x50, 0x7e, 0xe9,
+	0x2c, 0x42, 0x6c, 0x4f, 0x63, 0xce, 0x48, 0x4a, 0x99, 0x3a, 0x57, 0x1a, 0x56, 0x1f, 0x79, 0xf9,
+	0xb5, 0xab, 0xc9, 0x2e, 0x6c, 0xcc, 0x04, 0xcb, 0x99, 0x3e, 0x50, 0x0d, 0x19, 0x4c, 0x1e, 0x4d,
+	0x32, 0x50, 0xb0, 0xb7, 0x68, 0xd7, 0x76, 0xcb, 0xb2, 0x4e, 0x60, 0x87, 0x73, 0xa0, 0xa3, 0xf3,
+	0x34, 0x81, 0x8a, 0x59, 0xe1, 0x21, 0x3f, 0x7c, 0x10, 0x2d, 0x2d, 0xac, 0xdc, 0x16, 0xfb, 0xac,
+	0xc8, 0x10, 0xea, 0x12, 0x24, 0x18, 0xf6, 0x21, 0xb5, 0xeb, 0x01, 0xb2, 0xc0, 0xd3, 0x78, 0x2b,
+	0xa5, 0x86, 0x17, 0x0c, 0xb3, 0xc8, 0xbf, 0x61, 0x67, 0x27, 0x5b, 0x97, 0x3e, 0xe7, 0xfe, 0x21,
+	0x60, 0x61, 0x67, 0x6a, 0xbb, 0xa8, 0x8b, 0x92, 0xa7, 0x3a, 0x79, 0x9d, 0xea, 0x70, 0x5e, 0x2a,
+	0x9d, 0x68, 0x86, 0xbe, 0x2e, 0x8d, 0x58, 0x56, 0xa5, 0x74, 0xbf, 0x7d, 0xe4, 0x76, 0xaa, 0xe3,
+	0x56, 0xfe, 0xbb, 0x5c, 0xd8, 0x9b, 0xad, 0x5d, 0xbb, 0x9f, 0x2d, 0x9d, 0xb4, 0x55, 0x18, 0x49,
+	0xa2, 0x3d, 0x19, 0x63, 0x4f, 0x27, 0xd5, 0x60, 0xcf, 0x83, 0xbc, 0xfb, 0xef, 0x79, 0x62, 0x24,
+	0x1a, 0xa2, 0xbc, 0x41, 0x04, 0x77, 0x53, 0xbc, 0x79, 0xd3, 0x8b, 0x1a, 0x4a, 0xb5, 0xc0, 0xfb,
+	0x9e, 0x02, 0x48, 0xf4, 0x45, 0x35, 0xea, 0x56, 0x5d, 0x70, 0x93, 0x5f, 0xa7, 0xd4, 0xfe, 0x3a,
+	0x6f, 0xd6, 0x7b, 0x03, 0x22, 0x1e, 0x25, 0x0e, 0xc8, 0x2a, 0x24, 0x03,
+};
+static const uint8_t k_crafted[] = {
+	0x2c, 0x02, 0x6d, 0x65, 0x74, 0x61, 0x21, 0x10, 0x00, 0x08, 0x3c, 0x70, 0x3e, 0x18, 0x00, 0x00,
+	0x40, 0x02, 0x2f, 0x0a, 0x89, 0xf5, 0x00, 0x02, 0x02, 0x00, 0x00, 0x12, 0x78, 0x71, 0x48, 0xa8,
+	0x33, 0x33, 0x0a, 0x00, 0x00, 0x90, 0xc0, 0x0b, 0x42, 0x02, 0x3d, 0x54, 0x38, 0x00, 0x00, 0x40,
+	0x02, 0x2f, 0x06, 0x89, 0x55, 0x83, 0xc0, 0x04, 0x00, 0x00, 0x12, 0x78, 0x51, 0x48, 0xb8, 0x22,
+	0x48, 0x30, 0x00, 0x00, 0x40, 0x02, 0x2f, 0x0e, 0x09, 0xd3, 0xeb, 0x63, 0x00, 0x00, 0x80, 0x04,
+	0x5e, 0x0c, 0x12, 0x63, 0x0f,
+};
+static const uint8_t k_crafted_out[] = {
+	0x3c, 0x70, 0x3e, 0x66, 0x69, 0x6c, 0x65, 0xe0, 0xb9, 0x81, 0xe0, 0xb8, 0x92, 0xe0, 0xb8, 0xa7,
+	0xd8, 0x91, 0xd8, 0xaf, 0xd9, 0x88, 0x66, 0x69, 0x72, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x84, 0xe0, 0xb8, 0x97, 0xe0, 0xb8, 0xa2, 0x69, 0x72, 0x73, 0x74,
+};
+
+static uint8_t g_ref[16384];
+static size_t g_ref_len;
+static uint8_t g_out[16384];
+static struct brotli_stream g_b;
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "brotli: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static uint32_t g_xs;
+
+static uint8_t xorshift8(void)
+{
+	g_xs ^= g_xs << 13;
+	g_xs ^= g_xs >> 17;
+	g_xs ^= g_xs << 5;
+	return (uint8_t)g_xs;
+}
+
+static void text_ref(void)
+{
+	g_ref_len = 0;
+	for (int i = 0; i < 200; i++) {
+		g_ref_len += (size_t)snprintf((char *)g_ref + g_ref_len, sizeof(g_ref) - g_ref_len,
+					      "<li class=\"item\">Item %d: the quick brown fox jumps over the lazy dog</li>\n", i);
+	}
+}
+
+/* Table rows, each followed by 32 pseudo-random bytes. */
+static void table_ref(void)
+{
+	g_ref_len = 0;
+	g_xs = 2463534242u;
+	for (int i = 0; i < 40; i++) {
+		g_ref_len += (size_t)snprintf((char *)g_ref + g_ref_len, sizeof(g_ref) - g_ref_len,
+					      "<tr><td>%d</td><td>the quick brown fox jumps over the lazy dog</td></tr>\n", i);
+		for (int j = 0; j < 32; j++) {
+			uint8_t x = xorshift8();
+			g_ref[g_ref_len++] = (i % 2) ? (uint8_t)(x & 0x3f) : (uint8_t)(0x80 | (x & 0x7f));
+		}
+	}
+}
+
+static void noise_ref(void)
+{
+	g_xs = 2463534242u;
+	for (g_ref_len = 0; g_ref_len < 600; g_ref_len++) g_ref[g_ref_len] = xorshift8();
+}
+
+/* Feeds src in pieces of `step` bytes; returns the final brotli_feed() result. */
+static int run(const uint8_t *src, size_t n, size_t step, size_t out_cap)
+{
+	brotli_init(&g_b, g_out, out_cap);
+	int r = BROTLI_NEED_INPUT;
+	for (size_t off = 0; off < n; off += step) {
+		size_t k = (n - off < step) ? n - off : step;
+		r = brotli_feed(&g_b, src + off, k);
+		if (r != BROTLI_NEED_INPUT) break;
+	}
+	return r;
+}
+
+static int expect_ref(const char *what, const uint8_t *src, size_t n)
+{
+	static const size_t steps[] = {1, 2, 7, 100, 1000, 1u << 20};
+	for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+		if (run(src, n, steps[i], sizeof(g_out)) != BROTLI_DONE) return fail(what);
+		if (g_b.out_len != g_ref_len || memcmp(g_out, g_ref, g_ref_len) != 0) return fail(what);
+	}
+	return 0;
+}
+
+int main(void)
+{
+	text_ref();
+	if (expect_ref("text q11", k_text_q11, sizeof(k_text_q11))) return 1;
+	if (expect_ref("text q5", k_text_q5, sizeof(k_text_q5))) return 1;
+
+	/* A small output buffer keeps the prefix and ignores the rest. */
+	if (run(k_text_q11, sizeof(k_text_q11), 5, 1000) != BROTLI_FULL) return fail("full status");
+	if (g_b.out_len != 1000 || memcmp(g_out, g_ref, 1000) != 0) return fail("full prefix");
+	if (brotli_feed(&g_b, k_text_q11, 10) != BROTLI_FULL) return fail("full sticky");
+
+	/* Truncated input just waits for more. */
+	if (run(k_text_q5, sizeof(k_text_q5) / 2, 3, sizeof(g_out)) != BROTLI_NEED_INPUT) return fail("truncated");
+	if (g_b.out_len == 0 || memcmp(g_out, g_ref, g_b.out_len) != 0) return fail("truncated prefix");
+
+	table_ref();
+	if (expect_ref("block switches", k_table, sizeof(k_table))) return 1;
+	if (run(k_table, sizeof(k_table), 64, 3333) != BROTLI_FULL || memcmp(g_out, g_ref, 3333) != 0) return fail("full table");
+
+	noise_ref();
+	if (expect_ref("uncompressed", k_noise, sizeof(k_noise))) return 1;
+	if (run(k_noise, sizeof(k_noise), 100, 250) != BROTLI_FULL || memcmp(g_out, g_ref, 250) != 0) return fail("full uncompressed");
+
+	memcpy(g_ref, k_crafted_out, sizeof(k_crafted_out));
+	g_ref_len = sizeof(k_crafted_out);
+	if (expect_ref("dictionary", k_crafted, sizeof(k_crafted))) return 1;
+	/* Cut inside the first dictionary word. */
+	if (run(k_crafted, sizeof(k_crafted), 1, 5) != BROTLI_FULL || memcmp(g_out, g_ref, 5) != 0) return fail("full dictionary");
+
+	/* Corrupt data fails. */
+	static const uint8_t large_window[] = { 0x11, 0x00, 0x00, 0x00 };
+	if (run(large_window, sizeof(large_window), 1u << 20, sizeof(g_out)) != -1) return fail("large window");
+	static uint8_t bad[sizeof(k_crafted)];
+	memcpy(bad, k_crafted, sizeof(k_crafted));
+	bad[0] |= 0x10; /* metadata reserved bit */
+	if (run(bad, sizeof(bad), 1u << 20, sizeof(g_out)) != -1) return fail("reserved bit");
+	if (brotli_feed(&g_b, k_crafted, sizeof(k_crafted)) != -1) return fail("error sticky");
+
+	printf("brotli selftest: OK\n");
+	return 0;
+}
@@ -0,0 +1,189 @@
+#include "../src/browser/display_list.h"
+#include "../src/browser/util.h"
+
+static struct line_index g_ix;
+static struct display_list g_dl;
+static struct dl_block g_blk;
+static struct html_style_runs g_runs;
+
+static int fail(const char *msg)
+{
+	dbg_write(msg);
+	return 1;
+}
+
+static int str_eq(const char *a, const char *b)
+{
+	while (*a && *a == *b) {
+		a++;
+		b++;
+	}
+	return *a == *b;
+}
+
+static int mem_eq(const char *a, const char *b, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (a[i] != b[i]) return 0;
+	}
+	return 1;
+}
+
+static size_t put_str(char *out, size_t o, const char *s)
+{
+	while (*s) out[o++] = *s++;
+	return o;
+}
+
+static size_t put_u32(char *out, size_t o, uint32_t v)
+{
+	char tmp[10];
+	uint32_t n = 0;
+	do {
+		tmp[n++] = (char)('0' + v % 10u);
+		v /= 10u;
+	} while (v);
+	while (n) out[o++] = tmp[--n];
+	return o;
+}
+
+static int same_item(const struct dl_pool *pa, const struct dl_item *a, const struct dl_pool *pb, const struct dl_item *b)
+{
+	if (a->op != b->op || a->flags != b->flags) return 0;
+	if ((a->img == DL_NO_IMAGE) != (b->img == DL_NO_IMAGE)) return 0;
+	if (a->img != DL_NO_IMAGE) {
+		const struct dl_image *ia = &pa->images[a->img];
+		const struct dl_image *ib = &pb->images[b->img];
+		if (ia->url_len != ib->url_len || !mem_eq(ia->url, ib->url, ia->url_len)) return 0;
+	}
+	if (a->op == DL_TEXT) {
+		return a->u.text.col == b->u.text.col && a->u.text.len == b->u.text.len &&
+		       a->u.text.link == b->u.text.link && a->u.text.fg == b->u.text.fg &&
+		       a->u.text.bg == b->u.text.bg &&
+		       str_eq(pa->chars + a->u.text.off, pb->chars + b->u.text.off);
+	}
+	if (a->u.box.rows_total != b->u.box.rows_total || a->u.box.row_in_box != b->u.box.row_in_box ||
+	    a->u.box.cols != b->u.box.cols) return 0;
+	if (a->op == DL_FLOAT_LABEL) return str_eq(pa->chars + a->u.box.label_off, pb->chars + b->u.box.label_off);
+	return 1;
+}
+
+/* The cached list (built in blocks from line index checkpoints) must match an
+ * uncached build of each block, whatever order the blocks are requested in.
+ */
+static int expect_cached_matches_uncached(const char *fail_msg, const struct dl_source *src, uint32_t rows)
+{
+	line_index_reset(&g_ix);
+	dl_reset(&g_dl);
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		for (uint32_t i = 0; i < rows; i++) {
+			uint32_t row = pass ? (rows - 1u - i) : i;
+			uint32_t n = 0;
+			const struct dl_row *r = dl_ensure_block(&g_dl, &g_ix, src, row, &n);
+			uint32_t first = row - row % (uint32_t)DL_BLOCK_ROWS;
+			uint32_t nb = dl_build_block(&g_blk, 0, src, first);
+			if (!r || n != nb) {
+				return fail(fail_msg);
+			}
+			uint32_t k = row - first;
+			if (k >= n) continue;
+			const struct dl_row *a = &r[k];
+			const struct dl_row *b = &g_blk.rows[k];
+			if (a->n != b->n) {
+				return fail(fail_msg);
+			}
+			for (uint32_t j = 0; j < a->n; j++) {
+				if (!same_item(&g_dl.pool, &g_dl.pool.items[a->first + j], &g_blk.pool, &g_blk.pool.items[b->first + j])) {
+					return fail(fail_msg);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static const struct dl_item *row_item(const struct dl_block *blk, uint32_t row, uint32_t j)
+{
+	if (row >= DL_BLOCK_ROWS || j >= blk->rows[row].n) return 0;
+	return &blk->pool.items[blk->rows[row].first + j];
+}
+
+static int test_styled_runs(void)
+{
+	/* "see docs now": "docs" is link 3, "now" is bold. */
+	const char *text = "see docs now";
+	c_memset(&g_runs, 0, sizeof(g_runs));
+	g_runs.n = 2;
+	g_runs.runs[0] = (struct html_style_run){ .start = 4, .end = 8, .link = 3 };
+	g_runs.runs[1] = (struct html_style_run){ .start = 9, .end = 12, .link = HTML_STYLE_RUN_NO_LINK, .bold = 1 };
+	struct dl_source src = { text, 40, &g_runs, 0, { 0xff808080u, 0xff4080ffu } };
+	if (dl_build_block(&g_blk, 0, &src, 0) != 1 || g_blk.rows[0].n != 4) return fail("display-list runs: FAIL (shape)\n");
+	const struct dl_item *a = row_item(&g_blk, 0, 0);
+	const struct dl_item *b = row_item(&g_blk, 0, 1);
+	const struct dl_item *d = row_item(&g_blk, 0, 3);
+	if (a->op != DL_TEXT || a->u.text.col != 0 || !str_eq(g_blk.pool.chars + a->u.text.off, "see ") ||
+	    a->u.text.fg != 0xff808080u || (a->flags & DL_TEXT_LINK)) return fail("display-list runs: FAIL (plain run)\n");
+	if (!(b->flags & DL_TEXT_LINK) || b->u.text.link != 3 || b->u.text.col != 4 || b->u.text.len != 4 ||
+	    b->u.text.fg != 0xff4080ffu) return fail("display-list runs: FAIL (link run)\n");
+	if (!(d->flags & DL_TEXT_BOLD) || d->u.text.fg != 0xffffffffu || !str_eq(g_blk.pool.chars + d->u.text.off, "now")) return fail("display-list runs: FAIL (bold run)\n");
+	return 0;
+}
+
+static int test_image_boxes(void)
+{
+	const char *text = "intro\n\x1eIMG 3 ? Cat\x1fhttp://x/cat.png\n\n\nafter the image";
+	struct dl_source src = { text, 40, 0, 0, { 0xff808080u, 0xff4080ffu } };
+	uint32_t n = dl_build_block(&g_blk, 0, &src, 0);
+	if (n < 5) return fail("display-list boxes: FAIL (rows)\n");
+	for (uint32_t r = 1; r <= 3; r++) {
+		const struct dl_item *it = row_item(&g_blk, r, 0);
+		if (!it || it->op != DL_IMG_SLICE || it->u.box.rows_total != 3 || it->u.box.row_in_box != r - 1u ||
+		    ((it->flags & DL_BOX_MARKER) != 0) != (r == 1) || it->img == DL_NO_IMAGE) return fail("display-list boxes: FAIL (slice row)\n");
+		const struct dl_image *im = &g_blk.pool.images[it->img];
+		if (im->url_len != 16 || !mem_eq(im->url, "http://x/cat.png", 16)) return fail("display-list boxes: FAIL (url row)\n");
+	}
+	const struct dl_item *t = row_item(&g_blk, 4, 0);
+	if (!t || t->op != DL_TEXT || !str_eq(g_blk.pool.chars + t->u.text.off, "after the image")) return fail("display-list boxes: FAIL (text after box)\n");
+	return 0;
+}
+
+int main(void)
+{
+	if (test_styled_runs()) return 1;
+	if (test_image_boxes()) return 1;
+
+	static char big[64 * 1024];
+	size_t o = 0;
+	for (uint32_t i = 0; i < 200; i++) {
+		if (i % 17 == 5) {
+			o = put_str(big, o, "\x1eIMG ");
+			o = put_u32(big, o, 2u + i % 23u);
+			o = put_str(big, o, " ? Pic\x1fhttp://x/");
+			o = put_u32(big, o, i);
+			o = put_str(big, o, ".png\n");
+			continue;
+		}
+		if (i % 29 == 11) {
+			o = put_str(big, o, "\x1eIMG ");
+			o = put_u32(big, o, 4u + i % 7u);
+			o = put_str(big, o, " FR");
+			o = put_u32(big, o, 12u + i % 9u);
+			o = put_str(big, o, " Side\x1fhttp://x/f");
+			o = put_u32(big, o, i);
+			o = put_str(big, o, ".png\n");
+			continue;
+		}
+		o = put_str(big, o, "Line ");
+		o = put_u32(big, o, i);
+		o = put_str(big, o, " with [img] some words that wrap around the edge\n");
+	}
+	big[o] = 0;
+	c_memset(&g_runs, 0, sizeof(g_runs));
+	g_runs.n = 1;
+	g_runs.runs[0] = (struct html_style_run){ .start = 100, .end = 4000, .link = 1, .underline = 1 };
+	struct dl_source src = { big, 37, &g_runs, 0, { 0xff808080u, 0xff4080ffu } };
+	if (expect_cached_matches_uncached("display-list mixed: FAIL (cached != uncached)\n", &src, 640)) return 1;
+
+	dbg_write("display list selftest: OK\n");
+	return 0;
+}
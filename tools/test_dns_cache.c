@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/net_dns.h"
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "dns cache: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static size_t put_u16(uint8_t *p, size_t o, uint16_t v)
+{
+	p[o++] = (uint8_t)(v >> 8);
+	p[o++] = (uint8_t)v;
+	return o;
+}
+
+static size_t put_u32(uint8_t *p, size_t o, uint32_t v)
+{
+	o = put_u16(p, o, (uint16_t)(v >> 16));
+	return put_u16(p, o, (uint16_t)v);
+}
+
+/* Response header + the question for "www.example.org" type qtype. */
+static size_t put_head(uint8_t *p, uint16_t id, uint16_t flags, uint16_t an, uint16_t ns, uint16_t qtype)
+{
+	size_t o = 0;
+	o = put_u16(p, o, id);
+	o = put_u16(p, o, flags);
+	o = put_u16(p, o, 1);
+	o = put_u16(p, o, an);
+	o = put_u16(p, o, ns);
+	o = put_u16(p, o, 0);
+	o += dns_write_qname(&p[o], 64, "www.example.org");
+	o = put_u16(p, o, qtype);
+	return put_u16(p, o, DNS_CLASS_IN);
+}
+
+/* Record header whose owner is a pointer to the question name. */
+static size_t put_rr(uint8_t *p, size_t o, uint16_t type, uint32_t ttl, uint16_t rdlen)
+{
+	o = put_u16(p, o, 0xc00c);
+	o = put_u16(p, o, type);
+	o = put_u16(p, o, DNS_CLASS_IN);
+	o = put_u32(p, o, ttl);
+	return put_u16(p, o, rdlen);
+}
+
+static int test_parse(void)
+{
+	uint8_t msg[512];
+	uint8_t ip[16];
+	uint32_t ttl = 0;
+
+	/* CNAME (ttl 300) -> AAAA (ttl 900): cacheable for 300 s. */
+	size_t o = put_head(msg, 0x4242, 0x8180, 2, 0, DNS_TYPE_AAAA);
+	o = put_rr(msg, o, 5, 300, 2);
+	o = put_u16(msg, o, 0xc00c);
+	o = put_rr(msg, o, DNS_TYPE_AAAA, 900, 16);
+	for (uint32_t i = 0; i < 16; i++) msg[o++] = (uint8_t)(0x20 + i);
+	if (dns_parse_response(msg, o, 0x4242, DNS_TYPE_AAAA, ip, 16, &ttl) != DNS_ANSWER) return fail("answer");
+	if (ttl != 300 || ip[0] != 0x20 || ip[15] != 0x2f) return fail("answer ttl/addr");
+	if (dns_parse_response(msg, o, 0x4243, DNS_TYPE_AAAA, ip, 16, &ttl) != DNS_ERROR) return fail("id mismatch");
+	/* Same id, but it answers the AAAA question: not the A query's. */
+	if (dns_parse_response(msg, o, 0x4242, DNS_TYPE_A, ip, 4, &ttl) != DNS_ERROR) return fail("qtype mismatch");
+	if (!dns_response_matches(msg, o, 0x4242, DNS_TYPE_AAAA) || dns_response_matches(msg, o, 0x4242, DNS_TYPE_A)) return fail("matches");
+
+	/* NXDOMAIN with SOA (ttl 600, minimum 120): negative for 120 s. */
+	o = put_head(msg, 7, 0x8183, 0, 1, DNS_TYPE_A);
+	o = put_rr(msg, o, DNS_TYPE_SOA, 600, 2 + 2 + 20);
+	o = put_u16(msg, o, 0xc00c); /* MNAME */
+	o = put_u16(msg, o, 0xc00c); /* RNAME */
+	o = put_u32(msg, o, 1);
+	o = put_u32(msg, o, 2);
+	o = put_u32(msg, o, 3);
+	o = put_u32(msg, o, 4);
+	o = put_u32(msg, o, 120);
+	if (dns_parse_response(msg, o, 7, DNS_TYPE_A, ip, 4, &ttl) != DNS_NO_ANSWER || ttl != 120) return fail("nxdomain soa");
+
+	/* NODATA without SOA falls back to the default negative TTL. */
+	o = put_head(msg, 8, 0x8180, 0, 0, DNS_TYPE_AAAA);
+	if (dns_parse_response(msg, o, 8, DNS_TYPE_AAAA, ip, 16, &ttl) != DNS_NO_ANSWER || ttl != DNS_CACHE_NEG_TTL_S) return fail("nodata");
+
+	/* SERVFAIL is not an answer at all. */
+	o = put_head(msg, 9, 0x8182, 0, 0, DNS_TYPE_A);
+	if (dns_parse_response(msg, o, 9, DNS_TYPE_A, ip, 4, &ttl) != DNS_ERROR) return fail("servfail");
+	return 0;
+}
+
+static int test_cache(void)
+{
+	uint8_t ip[4] = {192, 0, 2, 7};
+	uint8_t got[16];
+	if (dns_cache_lookup("a.example", DNS_TYPE_A, 0, got, 4) != DNS_CACHE_MISS) return fail("miss before init");
+	if (dns_cache_init() != 0) return fail("init");
+
+	dns_cache_store("a.example", DNS_TYPE_A, 1000, 60, ip, 4);
+	if (dns_cache_lookup("A.Example", DNS_TYPE_A, 1000 + 59999, got, 4) != DNS_CACHE_HIT || memcmp(got, ip, 4) != 0) return fail("hit");
+	if (dns_cache_lookup("a.example", DNS_TYPE_AAAA, 1000, got, 16) != DNS_CACHE_MISS) return fail("other type");
+	if (dns_cache_lookup("a.example", DNS_TYPE_A, 1000 + 60000, got, 4) != DNS_CACHE_MISS) return fail("expiry");
+
+	dns_cache_store("gone.example", DNS_TYPE_AAAA, 0, 30, 0, 0);
+	if (dns_cache_lookup("gone.example", DNS_TYPE_AAAA, 29999, got, 16) != DNS_CACHE_NEGATIVE) return fail("negative");
+	dns_cache_store("zero.example", DNS_TYPE_A, 0, 0, ip, 4);
+	if (dns_cache_lookup("zero.example", DNS_TYPE_A, 0, got, 4) != DNS_CACHE_MISS) return fail("ttl 0 cached");
+
+	/* TTLs are clamped. */
+	dns_cache_store("long.example", DNS_TYPE_A, 0, 0x7fffffffu, ip, 4);
+	if (dns_cache_lookup("long.example", DNS_TYPE_A, (uint64_t)DNS_CACHE_MAX_TTL_S * 1000u, got, 4) != DNS_CACHE_MISS) return fail("ttl clamp");
+
+	/* Bounded: filling it evicts the entry expiring soonest, recent ones stay. */
+	char name[32];
+	for (uint32_t i = 0; i < 3u * DNS_CACHE_ENTRIES; i++) {
+		snprintf(name, sizeof(name), "h%u.example", i);
+		ip[3] = (uint8_t)i;
+		dns_cache_store(name, DNS_TYPE_A, 2000, 100 + i, ip, 4);
+	}
+	snprintf(name, sizeof(name), "h%u.example", 3u * DNS_CACHE_ENTRIES - 1u);
+	if (dns_cache_lookup(name, DNS_TYPE_A, 2000, got, 4) != DNS_CACHE_HIT || got[3] != (uint8_t)(3u * DNS_CACHE_ENTRIES - 1u)) return fail("bounded");
+
+	/* A forked child (like an image worker) fills the parent's cache. */
+	int pid = sys_fork();
+	if (pid == 0) {
+		uint8_t cip[4] = {198, 51, 100, 1};
+		dns_cache_store("child.example", DNS_TYPE_A, 5000, 60, cip, 4);
+		sys_exit(0);
+	}
+	if (pid < 0) return fail("fork");
+	int st = 0;
+	(void)sys_wait4(pid, &st, 0, 0);
+	if (dns_cache_lookup("child.example", DNS_TYPE_A, 5000, got, 4) != DNS_CACHE_HIT || got[0] != 198) return fail("shared with child");
+	return 0;
+}
+
+int main(void)
+{
+	if (test_parse()) return 1;
+	if (test_cache()) return 1;
+	printf("dns cache selftest: OK\n");
+	return 0;
+}
@@ -0,0 +1,47 @@
+#include "../src/browser/frame_sched.h"
+
+#include <stdio.h>
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "frame sched: FAIL (%s)\n", msg);
+	return 1;
+}
+
+int main(void)
+{
+	enum { B = 16000000 };
+	struct frame_sched fs;
+	frame_sched_init(&fs, B);
+	if (fs.budget_ns != B) return fail("budget");
+
+	uint64_t wait = 77;
+	if (frame_sched_begin(&fs, 1000, &wait) || wait != 77) return fail("idle renders");
+
+	/* First request after idle renders at once. */
+	frame_sched_request(&fs);
+	if (!frame_sched_begin(&fs, 1000, &wait)) return fail("first frame");
+	frame_sched_end(&fs, 1000, 1000 + 2000000);
+
+	/* A burst inside the frame interval folds into one frame at the next slot. */
+	for (int i = 0; i < 40; i++) frame_sched_request(&fs);
+	if (frame_sched_begin(&fs, 5000000, &wait)) return fail("burst not paced");
+	if (wait != 1000 + B - 5000000) return fail("wait");
+	if (!frame_sched_begin(&fs, 1000 + B, &wait)) return fail("burst frame");
+	if (frame_sched_begin(&fs, 1000 + B, &wait)) return fail("burst rendered twice");
+	frame_sched_end(&fs, 1000 + B, 1000 + B + B);
+	if (fs.dropped != 0) return fail("exact budget counted as drop");
+
+	/* A render 2.5 budgets long skips two slots. */
+	uint64_t t = 1000 + 2u * B;
+	frame_sched_request(&fs);
+	if (!frame_sched_begin(&fs, t, &wait)) return fail("overrun frame");
+	frame_sched_end(&fs, t, t + 5u * B / 2u);
+	if (fs.dropped != 2 || fs.frames != 3) return fail("dropped count");
+	frame_sched_request(&fs);
+	if (frame_sched_begin(&fs, t + 5u * B / 2u, &wait) || wait != B / 2u) return fail("next slot after overrun");
+	if (!frame_sched_begin(&fs, t + 3u * B, &wait)) return fail("frame after overrun");
+
+	printf("frame sched selftest: OK\n");
+	return 0;
+}
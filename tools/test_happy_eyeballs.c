@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/net_dns.h"
+#include "../src/browser/net_tcp.h"
+
+/* Server-side socket calls only this test needs. */
+enum { SYS_bind_ = 49, SYS_listen_ = 50 };
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "happy eyeballs: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static int bind_any(int fd, const void *sa, uint32_t len)
+{
+	int one = 1;
+	(void)sys_setsockopt(fd, SOL_SOCKET, 2 /* SO_REUSEADDR */, &one, (uint32_t)sizeof(one));
+	return (int)sys_call3(SYS_bind_, (long)fd, (long)sa, (long)len);
+}
+
+static void loop4(struct sockaddr_in *sa, uint16_t port)
+{
+	memset(sa, 0, sizeof(*sa));
+	sa->sin_family = (uint16_t)AF_INET;
+	sa->sin_port = htons(port);
+	sa->sin_addr.s_addr = htonl(0x7f000001u);
+}
+
+/* Answers two queries in reverse order: A 192.0.2.1 / AAAA 2001:db8::1. */
+static void fake_dns_server(int fd)
+{
+	uint8_t q[2][512];
+	ssize_t qn[2];
+	struct sockaddr_in6 from;
+	socklen_t fromlen = 0;
+	for (int i = 0; i < 2; i++) {
+		fromlen = (socklen_t)sizeof(from);
+		qn[i] = sys_recvfrom(fd, q[i], sizeof(q[i]), 0, &from, &fromlen);
+		if (qn[i] < 12) sys_exit(1);
+	}
+	for (int i = 1; i >= 0; i--) {
+		uint8_t r[512];
+		size_t o = (size_t)qn[i];
+		memcpy(r, q[i], o);
+		uint16_t qtype = (uint16_t)((r[o - 4] << 8) | r[o - 3]);
+		r[2] = 0x81;
+		r[3] = 0x80;
+		r[7] = 1; /* ancount */
+		static const uint8_t rr[] = {0xc0, 0x0c};
+		memcpy(&r[o], rr, 2);
+		o += 2;
+		r[o++] = (uint8_t)(qtype >> 8);
+		r[o++] = (uint8_t)qtype;
+		r[o++] = 0;
+		r[o++] = 1;
+		r[o++] = 0;
+		r[o++] = 0;
+		r[o++] = 0x0e;
+		r[o++] = 0x10; /* ttl 3600 */
+		if (qtype == DNS_TYPE_A) {
+			static const uint8_t a[] = {0, 4, 192, 0, 2, 1};
+			memcpy(&r[o], a, sizeof(a));
+			o += sizeof(a);
+		} else {
+			static const uint8_t aaaa[] = {0, 16, 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+			memcpy(&r[o], aaaa, sizeof(aaaa));
+			o += sizeof(aaaa);
+		}
+		(void)sys_sendto(fd, r, o, 0, &from, fromlen);
+	}
+	sys_exit(0);
+}
+
+static int test_dns_pair(void)
+{
+	struct sockaddr_in ns;
+	loop4(&ns, 53531);
+	int fd = sys_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (fd < 0 || bind_any(fd, &ns, (uint32_t)sizeof(ns)) != 0) return fail("dns bind");
+	int pid = sys_fork();
+	if (pid == 0) fake_dns_server(fd);
+	sys_close(fd);
+
+	uint8_t ip6[16];
+	uint8_t ip4[4];
+	struct dns_pending q[2];
+	memset(q, 0, sizeof(q));
+	q[0] = (struct dns_pending){ .qtype = DNS_TYPE_AAAA, .out = ip6, .addr_len = 16, .result = DNS_ERROR };
+	q[1] = (struct dns_pending){ .qtype = DNS_TYPE_A, .out = ip4, .addr_len = 4, .result = DNS_ERROR };
+	dns_query_server_multi(AF_INET, &ns, (uint32_t)sizeof(ns), "www.example.org", q, 2);
+	int st = 0;
+	(void)sys_wait4(pid, &st, 0, 0);
+	if (q[0].result != DNS_ANSWER || ip6[0] != 0x20 || ip6[15] != 1 || q[0].ttl != 3600) return fail("aaaa answer");
+	if (q[1].result != DNS_ANSWER || ip4[0] != 192 || ip4[3] != 1) return fail("a answer");
+	return 0;
+}
+
+static int listen_on(int family, const void *sa, uint32_t len)
+{
+	int fd = sys_socket(family, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) return -1;
+	if (bind_any(fd, sa, len) != 0 || sys_call3(SYS_listen_, (long)fd, 4, 0) != 0) {
+		sys_close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+static int test_race(void)
+{
+	static const uint8_t lo6[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+	static const uint8_t lo4[4] = {127, 0, 0, 1};
+	const uint16_t port = 53532;
+	struct sockaddr_in sa4;
+	loop4(&sa4, port);
+	int l4 = listen_on(AF_INET, &sa4, (uint32_t)sizeof(sa4));
+	if (l4 < 0) return fail("listen v4");
+
+	/* Nothing on [::1]: IPv6 is refused and IPv4 takes over without waiting. */
+	int family = 0;
+	int err6 = 0;
+	int err4 = 0;
+	uint64_t t0 = c_mono_ms();
+	int s = tcp_connect_race(lo6, lo4, port, &family, &err6, &err4);
+	uint64_t took = c_mono_ms() - t0;
+	if (s < 0 || family != AF_INET || err6 == 0 || err4 != 0) return fail("v6 refused -> v4");
+	if (took >= TCP_CONNECT_ATTEMPT_DELAY_MS) return fail("v4 waited for the attempt delay");
+	sys_close(s);
+
+	/* Only an IPv4 address. */
+	s = tcp_connect_race(0, lo4, port, &family, 0, 0);
+	if (s < 0 || family != AF_INET) return fail("v4 only");
+	sys_close(s);
+
+	/* Both reachable: IPv6 has the head start and wins. */
+	struct sockaddr_in6 sa6;
+	memset(&sa6, 0, sizeof(sa6));
+	sa6.sin6_family = (uint16_t)AF_INET6;
+	sa6.sin6_port = htons(port);
+	memcpy(sa6.sin6_addr.s6_addr, lo6, 16);
+	int l6 = listen_on(AF_INET6, &sa6, (uint32_t)sizeof(sa6));
+	if (l6 >= 0) {
+		s = tcp_connect_race(lo6, lo4, port, &family, 0, 0);
+		if (s < 0 || family != AF_INET6) return fail("v6 preferred");
+		sys_close(s);
+		sys_close(l6);
+	} else {
+		printf("happy eyeballs: no IPv6 loopback, skipping v6 win\n");
+	}
+
+	sys_close(l4);
+	/* Nothing listening anywhere: an error, not a socket. */
+	if (tcp_connect_race(lo6, lo4, port, &family, 0, 0) >= 0) return fail("nothing listening");
+	return 0;
+}
+
+int main(void)
+{
+	if (test_dns_pair()) return 1;
+	if (test_race()) return 1;
+	printf("happy eyeballs selftest: OK\n");
+	return 0;
+}
@@ -37,6 +37,22 @@ int main(void)
 		return 1;
 	}
 
+	n = http_format_get_ex(req, sizeof(req), "example.com", "/", 1);
+#if defined(HAVE_BROTLI)
+	const char *accept_encoding = "Accept-Encoding: gzip, deflate, br\r\n";
+#else
+	const char *accept_encoding = "Accept-Encoding: gzip, deflate\r\n";
+#endif
+	if (n < 0 || !must_contain(req, "Connection: keep-alive\r\n") || !must_contain(req, accept_encoding)) {
+		puts("http selftest: FAIL (keep-alive accept-encoding)");
+		return 1;
+	}
+	n = http_format_get(req, sizeof(req), "example.com", "/");
+	if (n < 0 || must_contain(req, "Accept-Encoding")) {
+		puts("http selftest: FAIL (close without accept-encoding)");
+		return 1;
+	}
+
 	puts("http selftest: OK");
 	return 0;
 }
@@ -0,0 +1,127 @@
+#include <stdio.h>
+
+#include "browser/image/img_scale.h"
+
+static uint32_t g_src[64 * 48];
+static uint32_t g_dst[128 * 96];
+
+static uint32_t pattern_px(uint32_t x, uint32_t y)
+{
+	return 0xff000000u | ((x * 37u + y * 11u) & 0xffu) << 16 | ((x * 5u + y * 91u) & 0xffu) << 8 | ((x ^ y) * 13u & 0xffu);
+}
+
+static void fill_pattern(uint32_t w, uint32_t h)
+{
+	for (uint32_t y = 0; y < h; y++) {
+		for (uint32_t x = 0; x < w; x++) g_src[y * w + x] = pattern_px(x, y);
+	}
+}
+
+/* Nearest must match the old per-pixel division mapping exactly. */
+static int test_nearest_matches_division(void)
+{
+	static const uint32_t sizes[][4] = {
+		{64, 48, 16, 16}, {64, 48, 17, 13}, {37, 23, 128, 96}, {64, 48, 64, 48}, {5, 3, 99, 7},
+	};
+	for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); t++) {
+		uint32_t sw = sizes[t][0], sh = sizes[t][1], dw = sizes[t][2], dh = sizes[t][3];
+		fill_pattern(sw, sh);
+		if (img_scale_xrgb(g_dst, dw, dw, dh, dw, dh, g_src, sw, sh, IMG_SCALE_NEAREST) != 0) {
+			fprintf(stderr, "nearest %ux%u -> %ux%u failed\n", sw, sh, dw, dh);
+			return 1;
+		}
+		for (uint32_t y = 0; y < dh; y++) {
+			uint32_t sy = (uint32_t)(((uint64_t)y * sh) / dh);
+			for (uint32_t x = 0; x < dw; x++) {
+				uint32_t sx = (uint32_t)(((uint64_t)x * sw) / dw);
+				if (g_dst[y * dw + x] != g_src[sy * sw + sx]) {
+					fprintf(stderr, "nearest %ux%u -> %ux%u mismatch at %u,%u\n", sw, sh, dw, dh, x, y);
+					return 1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static int test_constant_stays_constant(void)
+{
+	static const enum img_scale_filter filters[] = {IMG_SCALE_NEAREST, IMG_SCALE_BILINEAR, IMG_SCALE_BOX};
+	static const uint32_t sizes[][4] = {{64, 48, 16, 16}, {13, 7, 128, 96}, {64, 48, 3, 47}};
+	for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); t++) {
+		uint32_t sw = sizes[t][0], sh = sizes[t][1], dw = sizes[t][2], dh = sizes[t][3];
+		for (uint32_t i = 0; i < sw * sh; i++) g_src[i] = 0xff7f10e3u;
+		for (size_t f = 0; f < sizeof(filters) / sizeof(filters[0]); f++) {
+			if (img_scale_xrgb(g_dst, dw, dw, dh, dw, dh, g_src, sw, sh, filters[f]) != 0) return 1;
+			for (uint32_t i = 0; i < dw * dh; i++) {
+				if (g_dst[i] != 0xff7f10e3u) {
+					fprintf(stderr, "filter %u %ux%u -> %ux%u: got 0x%08x\n", (unsigned)filters[f], sw, sh, dw, dh, g_dst[i]);
+					return 1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+/* A 2x box shrink averages each 2x2 block. */
+static int test_box_half(void)
+{
+	fill_pattern(64, 48);
+	if (img_scale_xrgb(g_dst, 32, 32, 24, 32, 24, g_src, 64, 48, IMG_SCALE_BOX) != 0) return 1;
+	for (uint32_t y = 0; y < 24; y++) {
+		for (uint32_t x = 0; x < 32; x++) {
+			uint32_t got = g_dst[y * 32 + x];
+			for (uint32_t sh = 0; sh < 32; sh += 8) {
+				uint32_t sum = 0;
+				for (uint32_t k = 0; k < 4; k++) sum += (g_src[(2 * y + k / 2) * 64 + 2 * x + k % 2] >> sh) & 0xffu;
+				uint32_t c = (got >> sh) & 0xffu;
+				/* Two rounding steps (rows, then columns) may each drop one. */
+				if (c > sum / 4u || c + 1u < sum / 4u) {
+					fprintf(stderr, "box half mismatch at %u,%u shift %u: got %u want %u\n", x, y, sh, c, sum / 4u);
+					return 1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+/* Same size bilinear is the identity; vis_w/vis_h only clip. */
+static int test_bilinear_identity_and_clip(void)
+{
+	fill_pattern(64, 48);
+	if (img_scale_xrgb(g_dst, 64, 64, 48, 64, 48, g_src, 64, 48, IMG_SCALE_BILINEAR) != 0) return 1;
+	for (uint32_t i = 0; i < 64u * 48u; i++) {
+		if (g_dst[i] != g_src[i]) {
+			fprintf(stderr, "bilinear identity mismatch at %u\n", i);
+			return 1;
+		}
+	}
+
+	static uint32_t full[40 * 30];
+	if (img_scale_xrgb(full, 40, 40, 30, 40, 30, g_src, 64, 48, IMG_SCALE_BILINEAR) != 0) return 1;
+	for (uint32_t i = 0; i < sizeof(g_dst) / sizeof(g_dst[0]); i++) g_dst[i] = 0x12345678u;
+	if (img_scale_xrgb(g_dst, 40, 40, 30, 25, 11, g_src, 64, 48, IMG_SCALE_BILINEAR) != 0) return 1;
+	for (uint32_t y = 0; y < 30; y++) {
+		for (uint32_t x = 0; x < 40; x++) {
+			uint32_t want = (x < 25 && y < 11) ? full[y * 40 + x] : 0x12345678u;
+			if (g_dst[y * 40 + x] != want) {
+				fprintf(stderr, "clip mismatch at %u,%u\n", x, y);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+int main(void)
+{
+	if (test_nearest_matches_division()) return 1;
+	if (test_constant_stays_constant()) return 1;
+	if (test_box_half()) return 1;
+	if (test_bilinear_identity_and_clip()) return 1;
+	if (img_scale_xrgb(g_dst, 1, 0, 1, 1, 1, g_src, 1, 1, IMG_SCALE_BOX) == 0) return 1;
+	printf("img scale selftest: OK\n");
+	return 0;
+}
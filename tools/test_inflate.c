@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/inflate.h"
+
+/* Vectors from Python's zlib; all decode to text_ref() below. k_gzip has
+ * FEXTRA, FNAME, FCOMMENT and FHCRC set.
+ */
+static const uint8_t k_gzip[] = {
+	0x1f, 0x8b, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0x00, 0x78, 0x74, 0x72, 0x61,
+	0x21, 0x70, 0x61, 0x67, 0x65, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x00, 0x61, 0x20, 0x63, 0x6f, 0x6d,
+	0x6d, 0x65, 0x6e, 0x74, 0x00, 0x9d, 0x9a, 0x9d, 0xda, 0xcb, 0x71, 0x13, 0x41, 0x00, 0x45, 0xd1,
+	0x3d, 0x51, 0x4c, 0x08, 0xf3, 0xfa, 0xdf, 0x64, 0xc3, 0x47, 0x80, 0x41, 0x58, 0x60, 0x63, 0xc0,
+	0x8e, 0x9e, 0x82, 0x0c, 0x38, 0x6b, 0xd5, 0x5b, 0xe9, 0x94, 0x34, 0x73, 0xbb, 0xaf, 0x77, 0xf7,
+	0x97, 0xe3, 0x7c, 0x7d, 0xfc, 0xf8, 0x74, 0x39, 0xbe, 0x3f, 0xdd, 0xbd, 0xfb, 0x72, 0xbc, 0x7d,
+	0xb8, 0xfd, 0xba, 0x3f, 0x3e, 0xdc, 0x7e, 0x1f, 0x9f, 0x9f, 0xbe, 0x7e, 0x7b, 0x3c, 0x6e, 0x3f,
+	0x2f, 0x0f, 0xff, 0x3e, 0xbe, 0xbe, 0x79, 0x79, 0x3e, 0xde, 0xdf, 0x3e, 0xbe, 0xba, 0xfe, 0xdd,
+	0x04, 0x36, 0x05, 0x36, 0x15, 0x36, 0x0d, 0x36, 0x1d, 0x36, 0x03, 0x36, 0x13, 0x36, 0x0b, 0x36,
+	0x5b, 0xbe, 0x53, 0x82, 0x20, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1a, 0x22, 0x1c,
+	0x22, 0x1e, 0x22, 0x20, 0x22, 0x22, 0x8a, 0x88, 0x28, 0xf4, 0xdb, 0x20, 0x22, 0x8a, 0x88, 0x28,
+	0x22, 0xa2, 0x88, 0x88, 0x22, 0x22, 0x8a, 0x88, 0x28, 0x22, 0xa2, 0x88, 0x88, 0x2a, 0x22, 0xaa,
+	0x88, 0xa8, 0xf4, 0x77, 0x21, 0x22, 0xaa, 0x88, 0xa8, 0x22, 0xa2, 0x8a, 0x88, 0x2a, 0x22, 0xaa,
+	0x88, 0xa8, 0x22, 0xa2, 0x89, 0x88, 0x26, 0x22, 0x9a, 0x88, 0x68, 0xf4, 0x04, 0x21, 0x22, 0x9a,
+	0x88, 0x68, 0x22, 0xa2, 0x89, 0x88, 0x26, 0x22, 0x9a, 0x88, 0xe8, 0x22, 0xa2, 0x8b, 0x88, 0x2e,
+	0x22, 0xba, 0x88, 0xe8, 0xf4, 0x50, 0x29, 0x22, 0xba, 0x88, 0xe8, 0x22, 0xa2, 0x8b, 0x88, 0x2e,
+	0x22, 0x86, 0x88, 0x18, 0x22, 0x62, 0x88, 0x88, 0x21, 0x22, 0x86, 0x88, 0x18, 0xf4, 0x9e, 0x21,
+	0x22, 0x86, 0x88, 0x18, 0x22, 0x62, 0x88, 0x88, 0x29, 0x22, 0xa6, 0x88, 0x98, 0x22, 0x62, 0x8a,
+	0x88, 0x29, 0x22, 0xa6, 0x88, 0x98, 0xf4, 0xea, 0x29, 0x22, 0xa6, 0x88, 0x98, 0x22, 0x62, 0x89,
+	0x88, 0x25, 0x22, 0x96, 0x88, 0x58, 0x22, 0x62, 0x89, 0x88, 0x25, 0x22, 0x96, 0x88, 0x58, 0x54,
+	0x23, 0x44, 0xc4, 0x12, 0x11, 0x5b, 0x44, 0x6c, 0x11, 0xb1, 0x45, 0xc4, 0x16, 0x11, 0x5b, 0x44,
+	0x6c, 0x11, 0xb1, 0x45, 0xc4, 0x16, 0x11, 0x9b, 0x02, 0x95, 0x15, 0x2a, 0x4a, 0x54, 0x27, 0x35,
+	0xaa, 0x93, 0x22, 0xd5, 0x49, 0x95, 0xea, 0xa4, 0x4c, 0x75, 0x52, 0xa7, 0x3a, 0x29, 0x54, 0x9d,
+	0x54, 0xaa, 0x4e, 0x4a, 0x55, 0x27, 0xd9, 0xc0, 0x7c, 0x49, 0x36, 0x2c, 0x60, 0x5a, 0xc1, 0xb4,
+	0x84, 0x69, 0x0d, 0xd3, 0x22, 0xa6, 0x55, 0x4c, 0xcb, 0x98, 0xd4, 0x31, 0x43, 0x21, 0x33, 0xc5,
+	0xda, 0x36, 0xd9, 0xa0, 0x96, 0x19, 0x8a, 0x99, 0xa1, 0x9a, 0x19, 0xca, 0x99, 0xa1, 0x9e, 0x19,
+	0x0a, 0x9a, 0xa1, 0xa2, 0x19, 0x4a, 0x9a, 0xa1, 0xa6, 0x99, 0x6a, 0x07, 0x1f, 0x64, 0x83, 0xb2,
+	0x66, 0xa8, 0x6b, 0x86, 0xc2, 0x66, 0xa8, 0x6c, 0x86, 0xd2, 0x66, 0xa8, 0x6d, 0x86, 0xe2, 0x66,
+	0xa8, 0x6e, 0x86, 0xf2, 0x66, 0x9a, 0x9d, 0x8a, 0x91, 0x0d, 0x2a, 0x9c, 0xa1, 0xc4, 0x19, 0x6a,
+	0x9c, 0xa1, 0xc8, 0x19, 0xaa, 0x9c, 0xa1, 0xcc, 0x19, 0xea, 0x9c, 0xa1, 0xd0, 0x19, 0x2a, 0x9d,
+	0xe9, 0x76, 0x64, 0x4a, 0x36, 0x28, 0x76, 0x86, 0x6a, 0x67, 0x28, 0x77, 0x86, 0x7a, 0x67, 0x28,
+	0x78, 0x86, 0x8a, 0x67, 0x28, 0x79, 0x86, 0x9a, 0x67, 0x28, 0x7a, 0x66, 0xd8, 0x79, 0x3a, 0xd9,
+	0xa0, 0xee, 0x19, 0x0a, 0x9f, 0xa1, 0xf2, 0x19, 0x4a, 0x9f, 0xa1, 0xf6, 0x19, 0x8a, 0x9f, 0xa1,
+	0xfa, 0x19, 0xca, 0x9f, 0xa1, 0xfe, 0x99, 0x69, 0x97, 0x2d, 0xc8, 0x06, 0x25, 0xd0, 0x50, 0x03,
+	0x0d, 0x45, 0xd0, 0x50, 0x05, 0x0d, 0x65, 0xd0, 0x50, 0x07, 0x0d, 0x85, 0xd0, 0x50, 0x09, 0x0d,
+	0xa5, 0xd0, 0x2c, 0xbb, 0x89, 0x43, 0x36, 0xa8, 0x86, 0x86, 0x72, 0x68, 0xa8, 0x87, 0x86, 0x82,
+	0x68, 0xa8, 0x88, 0x86, 0x92, 0x68, 0xa8, 0x89, 0x86, 0xa2, 0x68, 0xa8, 0x8a, 0x66, 0xdb, 0x35,
+	0xad, 0xff, 0xb4, 0xf1, 0x07, 0xf3, 0x2d, 0x39, 0xf2, 0xc2, 0x29, 0x00, 0x00,
+};
+static const uint8_t k_zlib[] = {
+	0x78, 0xda, 0x9d, 0xda, 0xcb, 0x71, 0x13, 0x41, 0x00, 0x45, 0xd1, 0x3d, 0x51, 0x4c, 0x08, 0xf3,
+	0xfa, 0xdf, 0x64, 0xc3, 0x47, 0x80, 0x41, 0x58, 0x60, 0x63, 0xc0, 0x8e, 0x9e, 0x82, 0x0c, 0x38,
+	0x6b, 0xd5, 0x5b, 0xe9, 0x94, 0x34, 0x73, 0xbb, 0xaf, 0x77, 0xf7, 0x97, 0xe3, 0x7c, 0x7d, 0xfc,
+	0xf8, 0x74, 0x39, 0xbe, 0x3f, 0xdd, 0xbd, 0xfb, 0x72, 0xbc, 0x7d, 0xb8, 0xfd, 0xba, 0x3f, 0x3e,
+	0xdc, 0x7e, 0x1f, 0x9f, 0x9f, 0xbe, 0x7e, 0x7b, 0x3c, 0x6e, 0x3f, 0x2f, 0x0f, 0xff, 0x3e, 0xbe,
+	0xbe, 0x79, 0x79, 0x3e, 0xde, 0xdf, 0x3e, 0xbe, 0xba, 0xfe, 0xdd, 0x04, 0x36, 0x05, 0x36, 0x15,
+	0x36, 0x0d, 0x36, 0x1d, 0x36, 0x03, 0x36, 0x13, 0x36, 0x0b, 0x36, 0x5b, 0xbe, 0x53, 0x82, 0x20,
+	0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1a, 0x22, 0x1c, 0x22, 0x1e, 0x22, 0x20, 0x22,
+	0x22, 0x8a, 0x88, 0x28, 0xf4, 0xdb, 0x20, 0x22, 0x8a, 0x88, 0x28, 0x22, 0xa2, 0x88, 0x88, 0x22,
+	0x22, 0x8a, 0x88, 0x28, 0x22, 0xa2, 0x88, 0x88, 0x2a, 0x22, 0xaa, 0x88, 0xa8, 0xf4, 0x77, 0x21,
+	0x22, 0xaa, 0x88, 0xa8, 0x22, 0xa2, 0x8a, 0x88, 0x2a, 0x22, 0xaa, 0x88, 0xa8, 0x22, 0xa2, 0x89,
+	0x88, 0x26, 0x22, 0x9a, 0x88, 0x68, 0xf4, 0x04, 0x21, 0x22, 0x9a, 0x88, 0x68, 0x22, 0xa2, 0x89,
+	0x88, 0x26, 0x22, 0x9a, 0x88, 0xe8, 0x22, 0xa2, 0x8b, 0x88, 0x2e, 0x22, 0xba, 0x88, 0xe8, 0xf4,
+	0x50, 0x29, 0x22, 0xba, 0x88, 0xe8, 0x22, 0xa2, 0x8b, 0x88, 0x2e, 0x22, 0x86, 0x88, 0x18, 0x22,
+	0x62, 0x88, 0x88, 0x21, 0x22, 0x86, 0x88, 0x18, 0xf4, 0x9e, 0x21, 0x22, 0x86, 0x88, 0x18, 0x22,
+	0x62, 0x88, 0x88, 0x29, 0x22, 0xa6, 0x88, 0x98, 0x22, 0x62, 0x8a, 0x88, 0x29, 0x22, 0xa6, 0x88,
+	0x98, 0xf4, 0xea, 0x29, 0x22, 0xa6, 0x88, 0x98, 0x22, 0x62, 0x89, 0x88, 0x25, 0x22, 0x96, 0x88,
+	0x58, 0x22, 0x62, 0x89, 0x88, 0x25, 0x22, 0x96, 0x88, 0x58, 0x54, 0x23, 0x44, 0xc4, 0x12, 0x11,
+	0x5b, 0x44, 0x6c, 0x11, 0xb1, 0x45, 0xc4, 0x16, 0x11, 0x5b, 0x44, 0x6c, 0x11, 0xb1, 0x45, 0xc4,
+	0x16, 0x11, 0x9b, 0x02, 0x95, 0x15, 0x2a, 0x4a, 0x54, 0x27, 0x35, 0xaa, 0x93, 0x22, 0xd5, 0x49,
+	0x95, 0xea, 0xa4, 0x4c, 0x75, 0x52, 0xa7, 0x3a, 0x29, 0x54, 0x9d, 0x54, 0xaa, 0x4e, 0x4a, 0x55,
+	0x27, 0xd9, 0xc0, 0x7c, 0x49, 0x36, 0x2c, 0x60, 0x5a, 0xc1, 0xb4, 0x84, 0x69, 0x0d, 0xd3, 0x22,
+	0xa6, 0x55, 0x4c, 0xcb, 0x98, 0xd4, 0x31, 0x43, 0x21, 0x33, 0xc5, 0xda, 0x36, 0xd9, 0xa0, 0x96,
+	0x19, 0x8a, 0x99, 0xa1, 0x9a, 0x19, 0xca, 0x99, 0xa1, 0x9e, 0x19, 0x0a, 0x9a, 0xa1, 0xa2, 0x19,
+	0x4a, 0x9a, 0xa1, 0xa6, 0x99, 0x6a, 0x07, 0x1f, 0x64, 0x83, 0xb2, 0x66, 0xa8, 0x6b, 0x86, 0xc2,
+	0x66, 0xa8, 0x6c, 0x86, 0xd2, 0x66, 0xa8, 0x6d, 0x86, 0xe2, 0x66, 0xa8, 0x6e, 0x86, 0xf2, 0x66,
+	0x9a, 0x9d, 0x8a, 0x91, 0x0d, 0x2a, 0x9c, 0xa1, 0xc4, 0x19, 0x6a, 0x9c, 0xa1, 0xc8, 0x19, 0xaa,
+	0x9c, 0xa1, 0xcc, 0x19, 0xea, 0x9c, 0xa1, 0xd0, 0x19, 0x2a, 0x9d, 0xe9, 0x76, 0x64, 0x4a, 0x36,
+	0x28, 0x76, 0x86, 0x6a, 0x67, 0x28, 0x77, 0x86, 0x7a, 0x67, 0x28, 0x78, 0x86, 0x8a, 0x67, 0x28,
+	0x79, 0x86, 0x9a, 0x67, 0x28, 0x7a, 0x66, 0xd8, 0x79, 0x3a, 0xd9, 0xa0, 0xee, 0x19, 0x0a, 0x9f,
+	0xa1, 0xf2, 0x19, 0x4a, 0x9f, 0xa1, 0xf6, 0x19, 0x8a, 0x9f, 0xa1, 0xfa, 0x19, 0xca, 0x9f, 0xa1,
+	0xfe, 0x99, 0x69, 0x97, 0x2d, 0xc8, 0x06, 0x25, 0xd0, 0x50, 0x03, 0x0d, 0x45, 0xd0, 0x50, 0x05,
+	0x0d, 0x65, 0xd0, 0x50, 0x07, 0x0d, 0x85, 0xd0, 0x50, 0x09, 0x0d, 0xa5, 0xd0, 0x2c, 0xbb, 0x89,
+	0x43, 0x36, 0xa8, 0x86, 0x86, 0x72, 0x68, 0xa8, 0x87, 0x86, 0x82, 0x68, 0xa8, 0x88, 0x86, 0x92,
+	0x68, 0xa8, 0x89, 0x86, 0xa2, 0x68, 0xa8, 0x8a, 0x66, 0xdb, 0x35, 0xad, 0xff, 0xb4, 0xf1, 0x07,
+	0x79, 0x16, 0x91, 0x07,
+};
+static const uint8_t k_raw_fast[] = {
+	0x9d, 0xd8, 0x4b, 0x76, 0x0d, 0x01, 0x00, 0x45, 0xd1, 0xbe, 0x51, 0xd4, 0x10, 0xea, 0xd4, 0xbf,
+	0xcc, 0xc6, 0xe7, 0x21, 0x3c, 0x79, 0x24, 0x82, 0x64, 0xf4, 0x16, 0x33, 0xb0, 0xdb, 0x77, 0xdd,
+	0xde, 0x6e, 0x9d, 0xeb, 0xdd, 0xfd, 0x65, 0x18, 0x5f, 0x0f, 0x3f, 0x3e, 0x5d, 0x86, 0xef, 0x4f,
+	0x77, 0xef, 0xbe, 0x0c, 0x6f, 0x1f, 0x6e, 0xbf, 0xee, 0x87, 0x0f, 0xb7, 0xdf, 0xc3, 0xe7, 0xa7,
+	0xaf, 0xdf, 0x1e, 0x87, 0xdb, 0xcf, 0xcb, 0xc3, 0xbf, 0xf9, 0xfa, 0xe6, 0xe5, 0x79, 0x78, 0x7f,
+	0xfb, 0xf8, 0xea, 0xfa, 0xf7, 0x13, 0x7c, 0x26, 0xf8, 0xcc, 0xf0, 0x59, 0xe0, 0xb3, 0xc2, 0x67,
+	0x83, 0xcf, 0x0e, 0x9f, 0x03, 0x3e, 0x27, 0x7c, 0x22, 0x08, 0x22, 0x21, 0xa1, 0x90, 0x58, 0x48,
+	0x30, 0x24, 0x1a, 0x12, 0x0e, 0x89, 0x87, 0x04, 0x44, 0x22, 0x62, 0x12, 0x11, 0x93, 0x88, 0x98,
+	0x44, 0xc4, 0x24, 0x22, 0x26, 0x11, 0x31, 0x89, 0x88, 0x49, 0x44, 0x4c, 0x22, 0x62, 0x12, 0x11,
+	0x93, 0x88, 0x98, 0x45, 0xc4, 0x2c, 0x22, 0x66, 0x11, 0x31, 0x8b, 0x88, 0x59, 0x44, 0xcc, 0x22,
+	0x62, 0x16, 0x11, 0xb3, 0x88, 0x98, 0x45, 0xc4, 0x2c, 0x22, 0x16, 0x11, 0xb1, 0x88, 0x88, 0x45,
+	0x44, 0x2c, 0x22, 0x62, 0x11, 0x11, 0x8b, 0x88, 0x58, 0x44, 0xc4, 0x22, 0x22, 0x16, 0x11, 0xb1,
+	0x88, 0x88, 0x55, 0x44, 0xac, 0x22, 0x62, 0x15, 0x11, 0xab, 0x88, 0x58, 0x45, 0xc4, 0x2a, 0x22,
+	0x56, 0x11, 0xb1, 0x8a, 0x88, 0x55, 0x44, 0xac, 0x22, 0x62, 0x13, 0x11, 0x9b, 0x88, 0xd8, 0x44,
+	0xc4, 0x26, 0x22, 0x36, 0x11, 0xb1, 0x89, 0x88, 0x4d, 0x44, 0x6c, 0x22, 0x62, 0x13, 0x11, 0x9b,
+	0x88, 0xd8, 0x45, 0xc4, 0x2e, 0x22, 0x76, 0x11, 0xb1, 0x8b, 0x88, 0x5d, 0x44, 0xec, 0x22, 0x62,
+	0x17, 0x11, 0xbb, 0x88, 0xd8, 0x45, 0xc4, 0x2e, 0x22, 0x0e, 0x11, 0x71, 0x88, 0x88, 0x43, 0x44,
+	0x1c, 0x22, 0xe2, 0x10, 0x11, 0x87, 0x88, 0x38, 0x44, 0xc4, 0x21, 0x22, 0x0e, 0x11, 0x71, 0x88,
+	0x88, 0x53, 0x44, 0x9c, 0x22, 0xe2, 0x14, 0x11, 0xa7, 0x88, 0x38, 0x45, 0xc4, 0x29, 0x22, 0x4e,
+	0x11, 0x71, 0x8a, 0x88, 0x53, 0x44, 0x9c, 0x22, 0xa2, 0x51, 0x48, 0x34, 0x8a, 0x89, 0x46, 0x41,
+	0xd1, 0x28, 0x2a, 0x1a, 0x85, 0x45, 0xa3, 0xb8, 0x68, 0x14, 0x18, 0x8d, 0x22, 0xa3, 0x51, 0x68,
+	0x34, 0x92, 0x0d, 0xcc, 0x97, 0x64, 0xc3, 0x02, 0xa6, 0x15, 0x4c, 0x4b, 0x98, 0xd6, 0x30, 0x2d,
+	0x62, 0x5a, 0xc5, 0xb4, 0x8c, 0x49, 0x1d, 0x33, 0x0a, 0x99, 0x51, 0xc9, 0x8c, 0x52, 0x66, 0xd4,
+	0x32, 0xa3, 0x98, 0x19, 0xd5, 0xcc, 0x28, 0x67, 0x46, 0x3d, 0x33, 0x0a, 0x9a, 0x51, 0xd1, 0x8c,
+	0x92, 0x66, 0xd4, 0x34, 0xa3, 0xa8, 0x19, 0x55, 0xcd, 0x28, 0x6b, 0x46, 0x5d, 0x33, 0x0a, 0x9b,
+	0x51, 0xd9, 0x8c, 0xd2, 0x66, 0xd4, 0x36, 0xa3, 0xb8, 0x19, 0xd5, 0xcd, 0x28, 0x6f, 0x46, 0x7d,
+	0x33, 0x0a, 0x9c, 0x51, 0xe1, 0x8c, 0x12, 0x67, 0xd4, 0x38, 0xa3, 0xc8, 0x19, 0x55, 0xce, 0x28,
+	0x73, 0x46, 0x9d, 0x33, 0x0a, 0x9d, 0x51, 0xe9, 0x8c, 0x52, 0x67, 0xd4, 0x3a, 0xa3, 0xd8, 0x19,
+	0xd5, 0xce, 0x28, 0x77, 0x46, 0xbd, 0x33, 0x0a, 0x9e, 0x51, 0xf1, 0x8c, 0x92, 0x67, 0xd4, 0x3c,
+	0xa3, 0xe8, 0x19, 0x55, 0xcf, 0x28, 0x7b, 0x46, 0xdd, 0x33, 0x0a, 0x9f, 0x51, 0xf9, 0x8c, 0xd2,
+	0x67, 0xd4, 0x3e, 0xa3, 0xf8, 0x19, 0xd5, 0xcf, 0x28, 0x7f, 0x46, 0xfd, 0x33, 0x0a, 0xa0, 0x51,
+	0x01, 0x8d, 0x12, 0x68, 0xd4, 0x40, 0xa3, 0x08, 0x1a, 0x55, 0xd0, 0x28, 0x83, 0x46, 0x1d, 0x34,
+	0x0a, 0xa1, 0x51, 0x09, 0x8d, 0x52, 0x68, 0xd4, 0x42, 0xa3, 0x18, 0x1a, 0xd5, 0xd0, 0x28, 0x87,
+	0x46, 0x3d, 0x34, 0x0a, 0xa2, 0x51, 0x11, 0x8d, 0x92, 0x68, 0xd4, 0x44, 0xa3, 0x28, 0x1a, 0x55,
+	0xd1, 0x28, 0x8b, 0xf6, 0xbf, 0x5d, 0xf4, 0x0f,
+};
+static const uint8_t k_zlib_fixed[] = {
+	0x78, 0x01, 0xcb, 0xc9, 0xcc, 0x4b, 0x55, 0x30, 0xb0, 0x52, 0x28, 0xc9, 0x48, 0x55, 0x28, 0x2c,
+	0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53, 0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a,
+	0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x02, 0x4b, 0xe7, 0x24, 0x56, 0x55, 0x2a, 0xa4,
+	0xe4, 0xa7, 0x73, 0xe5, 0x80, 0xf4, 0x18, 0x92, 0xa1, 0xc7, 0x88, 0x0c, 0x3d, 0xc6, 0x64, 0xe8,
+	0x31, 0x21, 0x43, 0x8f, 0x29, 0x19, 0x7a, 0xcc, 0xc8, 0xd0, 0x63, 0x4e, 0x86, 0x1e, 0x0b, 0x32,
+	0xf4, 0x58, 0x92, 0x13, 0xa7, 0x64, 0x25, 0x04, 0x72, 0x52, 0x82, 0x21, 0x39, 0x49, 0xc1, 0x90,
+	0x9c, 0xb4, 0x60, 0x48, 0x4e, 0x62, 0x30, 0x24, 0x27, 0x35, 0x18, 0x92, 0x93, 0x1c, 0x0c, 0xc9,
+	0x49, 0x0f, 0x86, 0xe4, 0x24, 0x08, 0x43, 0x72, 0x52, 0x84, 0x11, 0x39, 0x29, 0xc2, 0x88, 0xac,
+	0xb2, 0x81, 0x9c, 0x14, 0x61, 0x44, 0x4e, 0x8a, 0x30, 0x22, 0x27, 0x45, 0x18, 0x91, 0x93, 0x22,
+	0x8c, 0xc8, 0x49, 0x11, 0x46, 0xe4, 0xa4, 0x08, 0x23, 0x72, 0x52, 0x84, 0x11, 0x39, 0x29, 0xc2,
+	0x98, 0x9c, 0x14, 0x61, 0x4c, 0x4e, 0x8a, 0x30, 0x26, 0xab, 0xba, 0x20, 0x27, 0x45, 0x18, 0x93,
+	0x93, 0x22, 0x8c, 0xc9, 0x49, 0x11, 0xc6, 0xe4, 0xa4, 0x08, 0x63, 0x72, 0x52, 0x84, 0x31, 0x39,
+	0x29, 0xc2, 0x98, 0x9c, 0x14, 0x61, 0x42, 0x4e, 0x8a, 0x30, 0x21, 0x27, 0x45, 0x98, 0x90, 0x93,
+	0x22, 0x4c, 0xc8, 0x6a, 0x41, 0x90, 0x93, 0x22, 0x4c, 0xc8, 0x49, 0x11, 0x26, 0xe4, 0xa4, 0x08,
+	0x13, 0x72, 0x52, 0x84, 0x09, 0x39, 0x29, 0xc2, 0x84, 0x9c, 0x14, 0x61, 0x4a, 0x4e, 0x8a, 0x30,
+	0x25, 0x27, 0x45, 0x98, 0x92, 0x93, 0x22, 0x4c, 0xc9, 0x49, 0x11, 0xa6, 0x64, 0x35, 0x2a, 0xc9,
+	0x49, 0x11, 0xa6, 0xe4, 0xa4, 0x08, 0x53, 0x72, 0x52, 0x84, 0x29, 0x39, 0x29, 0xc2, 0x94, 0x9c,
+	0x14, 0x61, 0x46, 0x4e, 0x8a, 0x30, 0x23, 0x27, 0x45, 0x98, 0x91, 0x93, 0x22, 0xcc, 0xc8, 0x49,
+	0x11, 0x66, 0xe4, 0xa4, 0x08, 0x33, 0xb2, 0xfa, 0x19, 0xe4, 0xa4, 0x08, 0x33, 0x72, 0x52, 0x84,
+	0x19, 0x39, 0x29, 0xc2, 0x8c, 0x9c, 0x14, 0x61, 0x4e, 0x4e, 0x8a, 0x30, 0x27, 0x27, 0x45, 0x98,
+	0x93, 0x93, 0x22, 0xcc, 0xc9, 0x49, 0x11, 0xe6, 0xe4, 0xa4, 0x08, 0x73, 0x72, 0x52, 0x84, 0x39,
+	0x59, 0x5d, 0x4f, 0x72, 0x52, 0x84, 0x39, 0x39, 0x29, 0xc2, 0x9c, 0x9c, 0x14, 0x61, 0x41, 0x4e,
+	0x8a, 0xb0, 0x20, 0x27, 0x45, 0x58, 0x90, 0x93, 0x22, 0x2c, 0xc8, 0x49, 0x11, 0x16, 0xe4, 0xa4,
+	0x08, 0x0b, 0x72, 0x52, 0x84, 0x05, 0x39, 0x29, 0xc2, 0x82, 0xac, 0xd1, 0x08, 0x72, 0x52, 0x84,
+	0x05, 0x39, 0x29, 0xc2, 0x92, 0x9c, 0x14, 0x61, 0x49, 0x4e, 0x8a, 0xb0, 0x24, 0x27, 0x45, 0x58,
+	0x92, 0x93, 0x22, 0x2c, 0xc9, 0x49, 0x11, 0x96, 0xe4, 0xa4, 0x08, 0x4b, 0x72, 0x52, 0x84, 0x25,
+	0x39, 0x29, 0xc2, 0x92, 0xac, 0x01, 0x2a, 0xf2, 0x46, 0xa8, 0xc8, 0x1a, 0xa2, 0x32, 0x20, 0x6b,
+	0x8c, 0xca, 0x80, 0xac, 0x41, 0x2a, 0x03, 0xb2, 0x46, 0xa9, 0x0c, 0xc8, 0x1a, 0xa6, 0x32, 0x20,
+	0x6b, 0x9c, 0xca, 0x80, 0xac, 0x81, 0x2a, 0x03, 0xb2, 0x46, 0xaa, 0x0c, 0xc8, 0x1a, 0xaa, 0x32,
+	0x20, 0x2b, 0x6d, 0x90, 0x39, 0x7c, 0x49, 0x56, 0xda, 0x20, 0x6f, 0x00, 0x93, 0xbc, 0x11, 0x4c,
+	0xf2, 0x86, 0x30, 0xc9, 0x1b, 0xc3, 0x24, 0x6f, 0x10, 0x93, 0xbc, 0x51, 0x4c, 0xf2, 0x86, 0x31,
+	0xc9, 0x1a, 0xc7, 0x34, 0x24, 0x6b, 0x20, 0xd3, 0xd0, 0x88, 0xbc, 0xb1, 0x6d, 0xb2, 0xd2, 0x06,
+	0x59, 0x63, 0x99, 0x86, 0x64, 0x0d, 0x66, 0x1a, 0x92, 0x35, 0x9a, 0x69, 0x48, 0xd6, 0x70, 0xa6,
+	0x21, 0x59, 0xe3, 0x99, 0x86, 0x64, 0x0d, 0x68, 0x1a, 0x92, 0x35, 0xa2, 0x69, 0x48, 0xd6, 0x90,
+	0xa6, 0x21, 0x59, 0x63, 0x9a, 0x86, 0xc6, 0xe4, 0x4d, 0x7c, 0x90, 0x95, 0x36, 0xc8, 0x1a, 0xd6,
+	0x34, 0x24, 0x6b, 0x5c, 0xd3, 0x90, 0xac, 0x81, 0x4d, 0x43, 0xb2, 0x46, 0x36, 0x0d, 0xc9, 0x1a,
+	0xda, 0x34, 0x24, 0x6b, 0x6c, 0xd3, 0x90, 0xac, 0xc1, 0x4d, 0x43, 0xb2, 0x46, 0x37, 0x0d, 0xc9,
+	0x1a, 0xde, 0x34, 0x34, 0x21, 0x6f, 0x56, 0x8c, 0xac, 0xb4, 0x41, 0xd6, 0x08, 0xa7, 0x21, 0x59,
+	0x43, 0x9c, 0x86, 0x64, 0x8d, 0x71, 0x1a, 0x92, 0x35, 0xc8, 0x69, 0x48, 0xd6, 0x28, 0xa7, 0x21,
+	0x59, 0xc3, 0x9c, 0x86, 0x64, 0x8d, 0x73, 0x1a, 0x92, 0x35, 0xd0, 0x69, 0x48, 0xd6, 0x48, 0xa7,
+	0xa1, 0x29, 0x79, 0x53, 0xa6, 0x64, 0xa5, 0x0d, 0xb2, 0x06, 0x3b, 0x0d, 0xc9, 0x1a, 0xed, 0x34,
+	0x24, 0x6b, 0xb8, 0xd3, 0x90, 0xac, 0xf1, 0x4e, 0x43, 0xb2, 0x06, 0x3c, 0x0d, 0xc9, 0x1a, 0xf1,
+	0x34, 0x24, 0x6b, 0xc8, 0xd3, 0x90, 0xac, 0x31, 0x4f, 0x43, 0xb2, 0x06, 0x3d, 0x0d, 0xcd, 0xc8,
+	0x9b, 0x4f, 0x27, 0x2b, 0x6d, 0x90, 0x35, 0xee, 0x69, 0x48, 0xd6, 0xc0, 0xa7, 0x21, 0x59, 0x23,
+	0x9f, 0x86, 0x64, 0x0d, 0x7d, 0x1a, 0x92, 0x35, 0xf6, 0x69, 0x48, 0xd6, 0xe0, 0xa7, 0x21, 0x59,
+	0xa3, 0x9f, 0x86, 0x64, 0x0d, 0x7f, 0x1a, 0x92, 0x35, 0xfe, 0x69, 0x68, 0x4e, 0xde, 0x62, 0x0b,
+	0xb2, 0xd2, 0x06, 0x59, 0x43, 0xa0, 0x86, 0x64, 0x8d, 0x81, 0x1a, 0x92, 0x35, 0x08, 0x6a, 0x48,
+	0xd6, 0x28, 0xa8, 0x21, 0x59, 0xc3, 0xa0, 0x86, 0x64, 0x8d, 0x83, 0x1a, 0x92, 0x35, 0x10, 0x6a,
+	0x48, 0xd6, 0x48, 0xa8, 0x21, 0x59, 0x43, 0xa1, 0x86, 0x16, 0xe4, 0xad, 0xc4, 0x21, 0x2b, 0x6d,
+	0x90, 0x35, 0x1a, 0x6a, 0x48, 0xd6, 0x70, 0xa8, 0x21, 0x59, 0xe3, 0xa1, 0x86, 0x64, 0x0d, 0x88,
+	0x1a, 0x92, 0x35, 0x22, 0x6a, 0x48, 0xd6, 0x90, 0xa8, 0x21, 0x59, 0x63, 0xa2, 0x86, 0x64, 0x0d,
+	0x8a, 0x1a, 0x92, 0x35, 0x2a, 0x6a, 0x68, 0x49, 0xde, 0x32, 0x2d, 0x12, 0xd3, 0x06, 0x00, 0x79,
+	0x16, 0x91, 0x07,
+};
+
+static uint8_t g_ref[16384];
+static size_t g_ref_len;
+static uint8_t g_out[16384];
+static uint8_t g_stored[16384];
+static struct inflate_stream g_z;
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "inflate: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static void text_ref(void)
+{
+	g_ref_len = 0;
+	for (int i = 0; i < 200; i++) {
+		g_ref_len += (size_t)snprintf((char *)g_ref + g_ref_len, sizeof(g_ref) - g_ref_len,
+					      "line %d: the quick brown fox jumps over the lazy dog\n", i);
+	}
+}
+
+/* Feeds src in pieces of `step` bytes; returns the final inflate_feed() result. */
+static int run(int framing, const uint8_t *src, size_t n, size_t step, size_t out_cap)
+{
+	inflate_init(&g_z, framing, g_out, out_cap);
+	int r = INFLATE_NEED_INPUT;
+	for (size_t off = 0; off < n; off += step) {
+		size_t k = (n - off < step) ? n - off : step;
+		r = inflate_feed(&g_z, src + off, k);
+		if (r != INFLATE_NEED_INPUT) break;
+	}
+	return r;
+}
+
+static int expect_text(const char *what, int framing, const uint8_t *src, size_t n)
+{
+	static const size_t steps[] = {1, 2, 7, 100, 1000, 1u << 20};
+	for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+		if (run(framing, src, n, steps[i], sizeof(g_out)) != INFLATE_DONE) return fail(what);
+		if (g_z.out_len != g_ref_len || memcmp(g_out, g_ref, g_ref_len) != 0) return fail(what);
+	}
+	return 0;
+}
+
+/* zlib header and stored blocks of up to 3000 bytes. */
+static size_t build_stored(void)
+{
+	size_t o = 0;
+	g_stored[o++] = 0x78;
+	g_stored[o++] = 0x01;
+	for (size_t off = 0; off < g_ref_len; off += 3000) {
+		size_t k = (g_ref_len - off < 3000) ? g_ref_len - off : 3000;
+		g_stored[o++] = (off + k == g_ref_len) ? 1 : 0;
+		g_stored[o++] = (uint8_t)k;
+		g_stored[o++] = (uint8_t)(k >> 8);
+		g_stored[o++] = (uint8_t)~k;
+		g_stored[o++] = (uint8_t)(~k >> 8);
+		memcpy(&g_stored[o], &g_ref[off], k);
+		o += k;
+	}
+	return o;
+}
+
+int main(void)
+{
+	text_ref();
+	if (expect_text("gzip", INFLATE_GZIP, k_gzip, sizeof(k_gzip))) return 1;
+	if (expect_text("zlib", INFLATE_ZLIB, k_zlib, sizeof(k_zlib))) return 1;
+	if (expect_text("zlib fixed", INFLATE_ZLIB, k_zlib_fixed, sizeof(k_zlib_fixed))) return 1;
+	if (expect_text("raw", INFLATE_RAW, k_raw_fast, sizeof(k_raw_fast))) return 1;
+	size_t stored_len = build_stored();
+	if (expect_text("stored", INFLATE_ZLIB, g_stored, stored_len)) return 1;
+
+	/* HTTP "deflate" is zlib by the RFC, but some servers send raw deflate. */
+	if (expect_text("deflate as zlib", INFLATE_ZLIB_OR_RAW, k_zlib, sizeof(k_zlib))) return 1;
+	if (expect_text("deflate as raw", INFLATE_ZLIB_OR_RAW, k_raw_fast, sizeof(k_raw_fast))) return 1;
+
+	/* A small output buffer keeps the prefix and ignores the rest. */
+	if (run(INFLATE_GZIP, k_gzip, sizeof(k_gzip), 5, 1000) != INFLATE_FULL) return fail("full status");
+	if (g_z.out_len != 1000 || memcmp(g_out, g_ref, 1000) != 0) return fail("full prefix");
+	if (inflate_feed(&g_z, k_gzip, 10) != INFLATE_FULL) return fail("full sticky");
+	if (run(INFLATE_ZLIB, g_stored, stored_len, 333, 4500) != INFLATE_FULL || memcmp(g_out, g_ref, 4500) != 0) return fail("full stored");
+
+	/* Truncated input just waits for more. */
+	if (run(INFLATE_GZIP, k_gzip, sizeof(k_gzip) / 2, 3, sizeof(g_out)) != INFLATE_NEED_INPUT) return fail("truncated");
+	if (g_z.out_len == 0 || memcmp(g_out, g_ref, g_z.out_len) != 0) return fail("truncated prefix");
+
+	/* Corrupt data fails. */
+	static uint8_t bad[sizeof(k_zlib)];
+	memcpy(bad, k_zlib, sizeof(k_zlib));
+	bad[2] |= 0x06; /* BTYPE 3 */
+	if (run(INFLATE_ZLIB, bad, sizeof(bad), 1u << 20, sizeof(g_out)) != -1) return fail("reserved block type");
+	if (run(INFLATE_GZIP, k_zlib, sizeof(k_zlib), 1u << 20, sizeof(g_out)) != -1) return fail("gzip magic");
+	if (inflate_feed(&g_z, k_gzip, sizeof(k_gzip)) != -1) return fail("error sticky");
+
+	printf("inflate selftest: OK\n");
+	return 0;
+}
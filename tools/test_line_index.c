@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/line_index.h"
+
+static struct line_index g_ix;
+
+/* Replays the layout from row 0 (the pre-index renderer behavior). */
+static int seek_linear(const char *text, uint32_t cols, uint32_t row, struct line_state *out)
+{
+	return line_index_seek(NULL, text, cols, row, out);
+}
+
+static int same_state(const struct line_state *a, const struct line_state *b)
+{
+	return a->pos == b->pos &&
+	       a->img_active == b->img_active &&
+	       a->img_rows_total == b->img_rows_total &&
+	       a->img_row_in_box == b->img_row_in_box &&
+	       a->img_marker == b->img_marker &&
+	       a->float_active == b->float_active &&
+	       a->float_rows_total == b->float_rows_total &&
+	       a->float_row_in_box == b->float_row_in_box &&
+	       a->float_cols == b->float_cols &&
+	       a->float_marker == b->float_marker;
+}
+
+static int expect_matches_linear(const char *name, const char *text, uint32_t cols)
+{
+	line_index_reset(&g_ix);
+	for (uint32_t row = 0; row < 64; row++) {
+		struct line_state a;
+		struct line_state b;
+		int ra = line_index_seek(&g_ix, text, cols, row, &a);
+		int rb = seek_linear(text, cols, row, &b);
+		if (ra != rb) {
+			printf("line-index %s: FAIL (row %u end mismatch %d != %d)\n", name, row, ra, rb);
+			return 1;
+		}
+		if (ra != 0) break;
+		if (!same_state(&a, &b)) {
+			printf("line-index %s: FAIL (row %u state mismatch)\n", name, row);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int main(void)
+{
+	{
+		const char *text = "Hello world, this wraps\n\nSecond paragraph";
+		if (expect_matches_linear("plain", text, 8)) return 1;
+		struct line_state st;
+		if (line_index_seek(&g_ix, text, 8, 2, &st) != 0 || st.pos != 13) {
+			printf("line-index plain: FAIL (row 2 pos)\n");
+			return 1;
+		}
+		if (!g_ix.complete) {
+			printf("line-index plain: FAIL (not complete)\n");
+			return 1;
+		}
+		if (line_index_seek(&g_ix, text, 8, 100, &st) == 0) {
+			printf("line-index plain: FAIL (seek past end)\n");
+			return 1;
+		}
+	}
+	{
+		/* Block image: marker row + 3 reserved rows, then text. */
+		const char *text = "Intro\n\x1eIMG 4 ? cat\x1f//x/cat.png\n\n\n\nAfter";
+		if (expect_matches_linear("block_img", text, 40)) return 1;
+		struct line_state st;
+		if (line_index_seek(&g_ix, text, 40, 3, &st) != 0) {
+			printf("line-index block_img: FAIL (seek)\n");
+			return 1;
+		}
+		if (!st.img_active || st.img_rows_total != 4 || st.img_row_in_box != 2 || st.img_marker != 6) {
+			printf("line-index block_img: FAIL (box state)\n");
+			return 1;
+		}
+		if (line_index_seek(&g_ix, text, 40, 5, &st) != 0 || st.img_active || text[st.pos] != 'A') {
+			printf("line-index block_img: FAIL (after box)\n");
+			return 1;
+		}
+	}
+	{
+		/* Float-right marker consumes the next text line in the same row. */
+		const char *text = "\x1eIMG 3 FR10 pic\x1f//x/p.png\nalpha beta gamma delta\nend";
+		if (expect_matches_linear("float", text, 24)) return 1;
+		struct line_state st;
+		if (line_index_seek(&g_ix, text, 24, 1, &st) != 0) {
+			printf("line-index float: FAIL (seek)\n");
+			return 1;
+		}
+		if (!st.float_active || st.float_cols != 10 || st.float_row_in_box != 1 || st.float_marker != 0) {
+			printf("line-index float: FAIL (float state)\n");
+			return 1;
+		}
+		if (line_index_float_text_cols(24, 10) != 13) {
+			printf("line-index float: FAIL (text cols)\n");
+			return 1;
+		}
+	}
+	{
+		struct img_marker m;
+		const char *line = "\x1eIMG 12 FR30 A label\x1fhttps://h/p.jpg\nnext";
+		if (!line_index_parse_img_marker(line, &m) || m.rows != 12 || m.float_cols != 30) {
+			printf("line-index marker: FAIL (parse)\n");
+			return 1;
+		}
+		if (m.label_len != 7 || memcmp(m.label, "A label", 7) != 0 || m.url_len != 15 || memcmp(m.url, "https://h/p.jpg", 15) != 0) {
+			printf("line-index marker: FAIL (label/url)\n");
+			return 1;
+		}
+		if (line_index_parse_img_marker("plain text", &m)) {
+			printf("line-index marker: FAIL (false positive)\n");
+			return 1;
+		}
+	}
+
+	puts("line-index selftest: OK");
+	return 0;
+}
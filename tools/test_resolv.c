@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/net_resolv.h"
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "resolv: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static int parse4(const char *s, uint8_t out[4])
+{
+	return ip4_parse(s, strlen(s), out);
+}
+
+static int parse6(const char *s, uint8_t out[16])
+{
+	return ip6_parse(s, strlen(s), out);
+}
+
+static int test_ip_parse(void)
+{
+	uint8_t a[4];
+	if (parse4("192.0.2.17", a) != 0 || a[0] != 192 || a[1] != 0 || a[2] != 2 || a[3] != 17) return fail("ip4");
+	if (parse4("256.0.0.1", a) == 0 || parse4("1.2.3", a) == 0 || parse4("1.2.3.4.", a) == 0 ||
+	    parse4("1..3.4", a) == 0 || parse4("1.2.3.4x", a) == 0) return fail("ip4 reject");
+
+	static const uint8_t loop[16] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1};
+	static const uint8_t doc[16] = {0x20,0x01,0x0d,0xb8,0,0,0,0,0,0,0,0,0,0,0x00,0x53};
+	static const uint8_t full[16] = {0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8};
+	static const uint8_t tail0[16] = {0xfe,0x80,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+	uint8_t b[16];
+	if (parse6("::1", b) != 0 || memcmp(b, loop, 16) != 0) return fail("ip6 ::1");
+	if (parse6("2001:DB8::53", b) != 0 || memcmp(b, doc, 16) != 0) return fail("ip6 gap");
+	if (parse6("1:2:3:4:5:6:7:8", b) != 0 || memcmp(b, full, 16) != 0) return fail("ip6 full");
+	if (parse6("fe80::", b) != 0 || memcmp(b, tail0, 16) != 0) return fail("ip6 trailing gap");
+	if (parse6("::", b) != 0) return fail("ip6 any");
+	if (parse6("1:2:3:4:5:6:7", b) == 0 || parse6("1::2::3", b) == 0 || parse6("1:2:3:4:5:6:7:8:9", b) == 0 ||
+	    parse6("12345::", b) == 0 || parse6("1:", b) == 0 || parse6("fe80::1%eth0", b) == 0 ||
+	    parse6("1:2:3:4:5:6:7::8", b) == 0) return fail("ip6 reject");
+	return 0;
+}
+
+static int test_resolv_conf(void)
+{
+	const char *text =
+		"# generated\n"
+		"search example.org\n"
+		"nameserver 192.0.2.53 # primary\n"
+		"  nameserver\t2001:db8::53\r\n"
+		"nameserver fe80::1%eth0\n"
+		"nameserver bogus\n"
+		"options edns0\n"
+		"NAMESERVER 198.51.100.1\n"
+		"nameserver 203.0.113.9\n";
+	struct resolv_conf rc;
+	resolv_conf_parse(text, strlen(text), &rc);
+	if (rc.n != RESOLV_MAX_NAMESERVERS) return fail("conf count");
+	if (rc.ns[0].family != AF_INET || rc.ns[0].addr[0] != 192 || rc.ns[0].addr[3] != 53) return fail("conf v4");
+	if (rc.ns[1].family != AF_INET6 || rc.ns[1].addr[0] != 0x20 || rc.ns[1].addr[15] != 0x53) return fail("conf v6");
+	if (rc.ns[2].family != AF_INET || rc.ns[2].addr[0] != 198) return fail("conf keyword case");
+
+	resolv_conf_parse("", 0, &rc);
+	if (rc.n != 0) return fail("conf empty");
+	return 0;
+}
+
+static int test_hosts(void)
+{
+	const char *text =
+		"127.0.0.1\tlocalhost\n"
+		"::1 localhost ip6-localhost # loopback\n"
+		"# 10.0.0.1 commented.example\n"
+		"192.0.2.10 web.example www.web.example\n"
+		"2001:db8::7 six.example\n"
+		"not-an-ip broken.example\n";
+	size_t len = strlen(text);
+	uint8_t a[16];
+	if (resolv_hosts_find(text, len, "localhost", AF_INET, a) != RESOLV_HOSTS_FOUND || a[0] != 127) return fail("hosts localhost A");
+	if (resolv_hosts_find(text, len, "LocalHost", AF_INET6, a) != RESOLV_HOSTS_FOUND || a[15] != 1) return fail("hosts localhost AAAA");
+	if (resolv_hosts_find(text, len, "www.web.example", AF_INET, a) != RESOLV_HOSTS_FOUND || a[3] != 10) return fail("hosts alias");
+	if (resolv_hosts_find(text, len, "web.example", AF_INET6, a) != RESOLV_HOSTS_NODATA) return fail("hosts other family");
+	if (resolv_hosts_find(text, len, "six.example", AF_INET, a) != RESOLV_HOSTS_NODATA) return fail("hosts v6 only");
+	if (resolv_hosts_find(text, len, "commented.example", AF_INET, a) != RESOLV_HOSTS_MISS) return fail("hosts comment");
+	if (resolv_hosts_find(text, len, "broken.example", AF_INET, a) != RESOLV_HOSTS_MISS) return fail("hosts bad address");
+	if (resolv_hosts_find(text, len, "web.exampl", AF_INET, a) != RESOLV_HOSTS_MISS) return fail("hosts prefix");
+	if (resolv_hosts_find(text, len, "web.example.org", AF_INET, a) != RESOLV_HOSTS_MISS) return fail("hosts longer");
+	return 0;
+}
+
+int main(void)
+{
+	if (test_ip_parse()) return 1;
+	if (test_resolv_conf()) return 1;
+	if (test_hosts()) return 1;
+	printf("resolv selftest: OK\n");
+	return 0;
+}
@@ -62,8 +62,77 @@ static int expect_span(const char *name,
 	return 0;
 }
 
+/* Per-index reference: last entry starting at or before idx, if it still covers idx. */
+static int ref_link_at(const struct html_links *links, uint32_t idx)
+{
+	int hit = -1;
+	for (uint32_t i = 0; i < links->n && links->links[i].start <= idx; i++) hit = (int)i;
+	return (hit >= 0 && idx < links->links[hit].end) ? hit : -1;
+}
+
+static int ref_span_at(const struct html_spans *spans, uint32_t idx)
+{
+	int hit = -1;
+	for (uint32_t i = 0; i < spans->n && spans->spans[i].start <= idx; i++) hit = (int)i;
+	return (hit >= 0 && idx < spans->spans[hit].end) ? hit : -1;
+}
+
+static int expect_runs_match(const char *name, const char *html)
+{
+	static char out[4096];
+	static struct html_links links;
+	static struct html_spans spans;
+	static struct html_style_runs runs;
+	memset(out, 0, sizeof(out));
+	memset(&links, 0, sizeof(links));
+	memset(&spans, 0, sizeof(spans));
+	if (html_visible_text_extract_links_and_spans((const uint8_t *)html, strlen(html), out, sizeof(out), &links, &spans) != 0) {
+		printf("style-runs %s: FAIL (extract)\n", name);
+		return 1;
+	}
+	html_style_runs_build(&links, &spans, &runs);
+	for (uint32_t i = 1; i < runs.n; i++) {
+		if (runs.runs[i].start < runs.runs[i - 1].end) {
+			printf("style-runs %s: FAIL (overlap at run %u)\n", name, i);
+			return 1;
+		}
+	}
+	uint32_t len = (uint32_t)strlen(out);
+	for (uint32_t idx = 0; idx <= len; idx++) {
+		uint32_t ri = html_style_runs_find(&runs, idx);
+		const struct html_style_run *r = (ri < runs.n && runs.runs[ri].start <= idx) ? &runs.runs[ri] : NULL;
+		int li = ref_link_at(&links, idx);
+		int si = ref_span_at(&spans, idx);
+		if (li >= 0) {
+			const struct html_link *ln = &links.links[li];
+			if (!r || r->link != (uint16_t)li || r->has_fg != ln->has_fg || (ln->has_fg && r->fg_xrgb != ln->fg_xrgb) ||
+			    r->bold != ln->bold || r->has_bg != ln->has_bg || !r->underline) {
+				printf("style-runs %s: FAIL (link style at %u)\n", name, idx);
+				return 1;
+			}
+		} else if (si >= 0) {
+			const struct html_span *sp = &spans.spans[si];
+			if (!r || r->link != HTML_STYLE_RUN_NO_LINK || r->has_fg != sp->has_fg || (sp->has_fg && r->fg_xrgb != sp->fg_xrgb) ||
+			    r->bold != sp->bold || r->has_bg != sp->has_bg || r->underline != sp->underline) {
+				printf("style-runs %s: FAIL (span style at %u)\n", name, idx);
+				return 1;
+			}
+		} else if (r) {
+			printf("style-runs %s: FAIL (unexpected run at %u)\n", name, idx);
+			return 1;
+		}
+	}
+	return 0;
+}
+
 int main(void)
 {
+	if (expect_runs_match("mixed",
+			      "<p>plain <span style=\"color:#ff0000\">red <a href=\"/a\">link</a> more</span> "
+			      "<b>bold <a href=\"/b\">b1</a><a href=\"/c\">c1</a></b> "
+			      "<span style=\"background-color:#00ff00\">bg</span><u>under</u> tail</p>")) return 1;
+	if (expect_runs_match("empty", "<p>no styles here</p>")) return 1;
+
 	if (expect_span("p_color",
 			"<p style=\"color:#112233\">Hello</p>",
 			"Hello",
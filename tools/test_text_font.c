@@ -256,5 +256,27 @@ int main(void)
 			if (g[i] != expect[i]) return 1;
 		}
 	}
+	{
+		/* Every glyph blitter must match the scalar reference (opaque and transparent). */
+		enum { W = 40, H = 20 };
+		static uint32_t ref[W * H];
+		static uint32_t got[W * H];
+		struct font_surface_u32 ref_s = { .pixels = ref, .stride_bytes = W * 4u, .w_px = W, .h_px = H };
+		struct font_surface_u32 got_s = { .pixels = got, .stride_bytes = W * 4u, .w_px = W, .h_px = H };
+		for (uint32_t opaque = 0; opaque < 2; opaque++) {
+			struct font_draw_style st = { .fg_xrgb = 0xffaabbccu, .bg_xrgb = 0xff112233u, .opaque_bg = (uint8_t)opaque, .bold = 1 };
+			for (int impl = FONT_BLIT_SSE2; impl <= FONT_BLIT_AVX2; impl++) {
+				for (uint32_t i = 0; i < W * H; i++) ref[i] = got[i] = 0xff000000u | (i * 2654435761u >> 8);
+				font_blit_select(FONT_BLIT_SCALAR);
+				font_draw_text_u32(&g_font_8x16, ref_s, 3, 1, "Ag@|W", st, 0, 0);
+				font_blit_select(impl);
+				font_draw_text_u32(&g_font_8x16, got_s, 3, 1, "Ag@|W", st, 0, 0);
+				for (uint32_t i = 0; i < W * H; i++) {
+					if (ref[i] != got[i]) return 1;
+				}
+			}
+		}
+		font_blit_select(FONT_BLIT_AUTO);
+	}
 	return 0;
 }
@@ -0,0 +1,63 @@
+#include "../src/core/thread_pool.h"
+
+static struct tpool g_pool;
+static uint32_t g_hits[4096];
+static uint64_t g_out[4096];
+
+static int fail(const char *msg)
+{
+	dbg_write(msg);
+	return 1;
+}
+
+struct batch {
+	uint32_t round;
+};
+
+static void job(void *ctx, uint32_t j)
+{
+	const struct batch *b = (const struct batch *)ctx;
+	__atomic_add_fetch(&g_hits[j], 1u, __ATOMIC_RELAXED);
+	/* Some uneven work so jobs overlap across threads. */
+	uint64_t v = (uint64_t)j * 2654435761u + b->round;
+	for (uint32_t i = 0; i < (j % 7u) * 50u; i++) v = v * 6364136223846793005ull + 1442695040888963407ull;
+	g_out[j] = v;
+}
+
+static uint64_t expect_out(uint32_t j, uint32_t round)
+{
+	uint64_t v = (uint64_t)j * 2654435761u + round;
+	for (uint32_t i = 0; i < (j % 7u) * 50u; i++) v = v * 6364136223846793005ull + 1442695040888963407ull;
+	return v;
+}
+
+int main(void)
+{
+	if (tpool_cpu_count() == 0) return fail("thread pool: FAIL (cpu count)\n");
+	if (tpool_start(&g_pool, 3) != 3) return fail("thread pool: FAIL (start)\n");
+
+	static const uint32_t sizes[] = {1, 2, 3, 4, 5, 17, 64, 4096};
+	for (uint32_t round = 0; round < 2000; round++) {
+		uint32_t n = sizes[round % (sizeof(sizes) / sizeof(sizes[0]))];
+		for (uint32_t j = 0; j < n; j++) g_hits[j] = 0;
+		struct batch b = { round };
+		tpool_run(&g_pool, job, &b, n);
+		for (uint32_t j = 0; j < n; j++) {
+			if (g_hits[j] != 1) return fail("thread pool: FAIL (job not run exactly once)\n");
+			if (g_out[j] != expect_out(j, round)) return fail("thread pool: FAIL (result not visible)\n");
+		}
+	}
+
+	/* A pool without workers runs jobs inline. */
+	struct tpool inline_pool;
+	if (tpool_start(&inline_pool, 0) != 0) return fail("thread pool: FAIL (inline start)\n");
+	for (uint32_t j = 0; j < 8; j++) g_hits[j] = 0;
+	struct batch b = { 7 };
+	tpool_run(&inline_pool, job, &b, 8);
+	for (uint32_t j = 0; j < 8; j++) {
+		if (g_hits[j] != 1) return fail("thread pool: FAIL (inline)\n");
+	}
+
+	dbg_write("thread pool selftest: OK\n");
+	return 0;
+}
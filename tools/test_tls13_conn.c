@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/tls13_client.h"
+#include "../src/browser/net_ip6.h"
+#include "../src/tls/gcm.h"
+
+/* Plays the server end of a keep-alive connection over a socketpair: the
+ * response records are sealed with the connection's rx keys and queued
+ * before tls13_https_conn_get_status_location_and_body() reads them.
+ */
+
+enum {
+	TEST_AF_UNIX = 1,
+	TEST_SYS_SOCKETPAIR = 53,
+	TEST_MAX_CALLS = 16,
+};
+
+static const uint8_t k_key[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static const uint8_t k_iv[12] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab };
+
+static struct tls13_https_conn g_conn;
+static int g_peer;
+static uint64_t g_seq;
+
+/* What on_body saw. */
+static uint8_t g_body[256];
+static size_t g_calls;
+static size_t g_lens[TEST_MAX_CALLS];
+static int g_bad_prefix;
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "tls13 conn: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static void on_body(void *arg, const uint8_t *body, size_t body_len)
+{
+	const char *want = (const char *)arg;
+	if (body != g_body || body_len > strlen(want) || memcmp(body, want, body_len) != 0) g_bad_prefix = 1;
+	if (g_calls < TEST_MAX_CALLS) g_lens[g_calls] = body_len;
+	g_calls++;
+}
+
+static int conn_setup(const char *want)
+{
+	int sv[2];
+	if (sys_call4(TEST_SYS_SOCKETPAIR, TEST_AF_UNIX, SOCK_STREAM, 0, (long)sv) != 0) return -1;
+	memset(&g_conn, 0, sizeof(g_conn));
+	g_conn.sock = sv[0];
+	g_conn.alive = 1;
+	strcpy(g_conn.host, "conn.example");
+	memcpy(g_conn.tx_app.key, k_key, sizeof(k_key));
+	memcpy(g_conn.tx_app.iv, k_iv, sizeof(k_iv));
+	g_conn.tx_app.valid = 1;
+	g_conn.rx_app = g_conn.tx_app;
+	g_conn.on_body = on_body;
+	g_conn.on_body_arg = (void *)want;
+	g_peer = sv[1];
+	g_seq = 0;
+	g_calls = 0;
+	g_bad_prefix = 0;
+	memset(g_body, 0, sizeof(g_body));
+	return 0;
+}
+
+/* One application-data record with inner type `type`. */
+static int send_record(uint8_t type, const void *data, size_t len)
+{
+	uint8_t rec[5 + 512 + 1 + GCM_TAG_SIZE];
+	if (len > 512) return -1;
+	size_t ct_len = len + 1u;
+	size_t rec_len = ct_len + GCM_TAG_SIZE;
+	rec[0] = 0x17;
+	rec[1] = 0x03;
+	rec[2] = 0x03;
+	rec[3] = (uint8_t)(rec_len >> 8);
+	rec[4] = (uint8_t)rec_len;
+	memcpy(rec + 5, data, len);
+	rec[5 + len] = type;
+	uint8_t nonce[12];
+	memcpy(nonce, k_iv, sizeof(nonce));
+	for (size_t i = 0; i < 8; i++) nonce[11 - i] ^= (uint8_t)(g_seq >> (8u * i));
+	g_seq++;
+	aes128_gcm_encrypt(k_key, nonce, sizeof(nonce), rec, 5, rec + 5, ct_len, rec + 5, rec + 5 + ct_len);
+	return sys_write(g_peer, rec, 5 + rec_len) == (ssize_t)(5 + rec_len) ? 0 : -1;
+}
+
+static int send_text(const char *s)
+{
+	return send_record(0x17, s, strlen(s));
+}
+
+static int conn_get(size_t *body_len)
+{
+	char status[128];
+	int code = -1;
+	char location[128];
+	char ctype[64];
+	char cenc[64];
+	uint64_t clen = 0;
+	int close = 0;
+	int rc = tls13_https_conn_get_status_location_and_body(&g_conn, "/", status, sizeof(status), &code,
+								location, sizeof(location), ctype, sizeof(ctype),
+								cenc, sizeof(cenc), g_body, sizeof(g_body), body_len,
+								&clen, 1, &close);
+	sys_close(g_conn.sock);
+	sys_close(g_peer);
+	return rc;
+}
+
+int main(void)
+{
+	const char *text = "0123456789abcdefghijklmnopqrst";
+	size_t body_len = 0;
+
+	/* Once per record that adds body bytes, each time a longer prefix; not
+	 * for the headers alone, a ticket record, or the last record.
+	 */
+	if (conn_setup(text) != 0) return fail("socketpair");
+	send_text("HTTP/1.1 200 OK\r\nContent-Length: 30\r\n\r\n");
+	send_text("01234");
+	send_text("56789abcde");
+	send_record(0x16, "", 0);
+	send_text("fghijklmno");
+	send_text("pqrst");
+	if (conn_get(&body_len) != 0 || body_len != 30) return fail("identity get");
+	if (g_bad_prefix) return fail("identity prefix");
+	if (g_calls != 3 || g_lens[0] != 5 || g_lens[1] != 15 || g_lens[2] != 25) return fail("identity calls");
+
+	/* Headers and body in one record. */
+	if (conn_setup(text) != 0) return fail("socketpair");
+	send_text("HTTP/1.1 200 OK\r\nContent-Length: 30\r\n\r\n0123456789");
+	send_text("abcdefghijklmnopqrst");
+	if (conn_get(&body_len) != 0 || body_len != 30) return fail("first record get");
+	if (g_bad_prefix || g_calls != 1 || g_lens[0] != 10) return fail("first record calls");
+
+	/* Redirect bodies are never reported. */
+	if (conn_setup(text) != 0) return fail("socketpair");
+	send_text("HTTP/1.1 301 Moved Permanently\r\nLocation: /x\r\nContent-Length: 30\r\n\r\n");
+	send_text("0123456789");
+	send_text("abcdefghij");
+	send_text("klmnopqrst");
+	if (conn_get(&body_len) != 0 || body_len != 30) return fail("redirect get");
+	if (g_calls != 0) return fail("redirect reported");
+
+	/* Neither is a body that still carries its Content-Encoding. */
+	if (conn_setup(text) != 0) return fail("socketpair");
+	send_text("HTTP/1.1 200 OK\r\nContent-Encoding: compress\r\nContent-Length: 30\r\n\r\n");
+	send_text("0123456789");
+	send_text("abcdefghij");
+	send_text("klmnopqrst");
+	if (conn_get(&body_len) != 0 || body_len != 30) return fail("encoded get");
+	if (g_calls != 0) return fail("encoded reported");
+
+	/* A coding undone here reports the decoded prefix, and a record that
+	 * decodes to nothing is not reported.
+	 */
+	const char *plain = "deflated stored text";
+	if (conn_setup(plain) != 0) return fail("socketpair");
+	send_text("HTTP/1.1 200 OK\r\nContent-Encoding: deflate\r\nContent-Length: 25\r\n\r\n");
+	const uint8_t stored[5] = { 0x01, 20, 0, (uint8_t)~20, 0xff };
+	send_record(0x17, stored, sizeof(stored));
+	send_text("deflated");
+	send_text(" stored ");
+	send_text("text");
+	if (conn_get(&body_len) != 0 || body_len != 20) return fail("deflate get");
+	if (memcmp(g_body, plain, 20) != 0) return fail("deflate body");
+	if (g_bad_prefix || g_calls != 2 || g_lens[0] != 8 || g_lens[1] != 16) return fail("deflate calls");
+
+	printf("tls13 conn selftest: OK\n");
+	return 0;
+}
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/tls13_pool.h"
+#include "../src/browser/net_ip6.h"
+#include "../src/browser/url.h"
+
+enum {
+	TEST_AF_UNIX = 1,
+	TEST_SYS_SOCKETPAIR = 53,
+};
+
+static int g_peer[16];
+static uint32_t g_n_peer;
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "tls13 pool: FAIL (%s)\n", msg);
+	return 1;
+}
+
+/* Stands in for tls13_https_conn_open(): a live connection to host whose
+ * "server" end is kept in g_peer so the test can close it.
+ */
+static int fake_open(struct tls13_pool_conn *pc, const char *host)
+{
+	int sv[2];
+	if (sys_call4(TEST_SYS_SOCKETPAIR, TEST_AF_UNIX, SOCK_STREAM, 0, (long)sv) != 0) return -1;
+	pc->conn.sock = sv[0];
+	pc->conn.alive = 1;
+	pc->conn.stash_len = 0;
+	(void)c_strlcpy_s(pc->conn.host, sizeof(pc->conn.host), host);
+	g_peer[g_n_peer++] = sv[1];
+	return sv[1];
+}
+
+static int fd_is_open(int fd)
+{
+	struct pollfd p = { .fd = fd, .events = 0, .revents = 0 };
+	return sys_poll(&p, 1, 0) == 0;
+}
+
+int main(void)
+{
+	int reused = 1;
+	struct tls13_pool_conn *a = tls13_pool_get("a.example", 1000, &reused);
+	if (!a || reused) return fail("empty pool");
+	if (fake_open(a, "a.example") < 0) return fail("socketpair");
+	int a_sock = a->conn.sock;
+	tls13_pool_put(a, 1000);
+
+	/* Same host (any case) reuses the idle connection. */
+	struct tls13_pool_conn *b = tls13_pool_get("A.Example", 2000, &reused);
+	if (b != a || !reused || b->conn.sock != a_sock) return fail("reuse");
+	/* While in use it is not handed out again. */
+	struct tls13_pool_conn *c = tls13_pool_get("a.example", 2000, &reused);
+	if (!c || c == a || reused) return fail("in use");
+	tls13_pool_put(c, 2000);
+	tls13_pool_put(b, 2000);
+
+	/* A response that asked for close leaves the slot free. */
+	b = tls13_pool_get("a.example", 3000, &reused);
+	tls13_https_conn_close(&b->conn);
+	tls13_pool_put(b, 3000);
+	if (fd_is_open(a_sock)) return fail("closed conn kept open");
+	b = tls13_pool_get("a.example", 3000, &reused);
+	if (reused) return fail("closed conn reused");
+	tls13_pool_put(b, 3000);
+
+	/* Idle timeout. */
+	b = tls13_pool_get("t.example", 4000, &reused);
+	fake_open(b, "t.example");
+	tls13_pool_put(b, 4000);
+	b = tls13_pool_get("t.example", 4000 + TLS13_POOL_IDLE_MS - 1, &reused);
+	if (!reused) return fail("reused before timeout");
+	tls13_pool_put(b, 5000);
+	b = tls13_pool_get("t.example", 5000 + TLS13_POOL_IDLE_MS, &reused);
+	if (reused) return fail("reused after timeout");
+	tls13_pool_put(b, 5000 + TLS13_POOL_IDLE_MS);
+
+	/* The server closed its end while the connection sat idle. */
+	b = tls13_pool_get("s.example", 10000, &reused);
+	int peer = fake_open(b, "s.example");
+	tls13_pool_put(b, 10000);
+	sys_close(peer);
+	b = tls13_pool_get("s.example", 10001, &reused);
+	if (reused) return fail("server-closed conn reused");
+	tls13_pool_put(b, 10001);
+
+	/* A full pool evicts the connection idle the longest. */
+	static const char *hosts[] = { "h0.example", "h1.example", "h2.example", "h3.example", "h4.example" };
+	uint64_t now = 20000;
+	for (uint32_t i = 0; i < 5; i++) {
+		b = tls13_pool_get(hosts[i], now, &reused);
+		if (!b || reused) return fail("fill");
+		fake_open(b, hosts[i]);
+		tls13_pool_put(b, now++);
+	}
+	b = tls13_pool_get("h0.example", now, &reused);
+	if (reused) return fail("oldest not evicted");
+	tls13_pool_put(b, now);
+	for (uint32_t i = 2; i < 5; i++) {
+		b = tls13_pool_get(hosts[i], now, &reused);
+		if (!reused) return fail("newer evicted");
+		tls13_pool_put(b, now);
+	}
+
+	/* Every slot in use: no slot at all. */
+	struct tls13_pool_conn *held[TLS13_POOL_SLOTS];
+	for (uint32_t i = 0; i < TLS13_POOL_SLOTS; i++) {
+		held[i] = tls13_pool_get("busy.example", now, &reused);
+		if (!held[i]) return fail("slot");
+	}
+	if (tls13_pool_get("busy.example", now, &reused)) return fail("over-committed");
+	for (uint32_t i = 0; i < TLS13_POOL_SLOTS; i++) tls13_pool_put(held[i], now);
+
+	tls13_pool_close_all();
+	printf("tls13 pool selftest: OK\n");
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../src/browser/tls13_ticket.h"
+
+static int fail(const char *msg)
+{
+	fprintf(stderr, "tls13 ticket: FAIL (%s)\n", msg);
+	return 1;
+}
+
+static struct tls13_ticket mk(uint8_t tag, uint64_t issued_ms, uint64_t expires_ms)
+{
+	struct tls13_ticket t;
+	memset(&t, 0, sizeof(t));
+	t.psk[0] = tag;
+	t.age_add = 0x01020300u + tag;
+	t.issued_ms = issued_ms;
+	t.expires_ms = expires_ms;
+	t.len = 8;
+	for (uint32_t i = 0; i < 8; i++) t.identity[i] = (uint8_t)(tag + i);
+	return t;
+}
+
+int main(void)
+{
+	struct tls13_ticket got;
+	struct tls13_ticket t = mk(1, 1000, 61000);
+	if (tls13_ticket_take("a.example", 1000, &got) == 0) return fail("take before init");
+	if (tls13_ticket_cache_init() != 0) return fail("init");
+
+	/* Round trip, case-insensitive, single use. */
+	tls13_ticket_store("a.example", 1000, &t);
+	if (tls13_ticket_take("b.example", 1000, &got) == 0) return fail("other host");
+	if (tls13_ticket_take("A.Example", 2000, &got) != 0 || memcmp(&got, &t, sizeof(t)) != 0) return fail("round trip");
+	if (tls13_ticket_take("a.example", 2000, &got) == 0) return fail("taken twice");
+
+	/* Expired tickets are neither stored nor returned. */
+	tls13_ticket_store("a.example", 61000, &t);
+	if (tls13_ticket_take("a.example", 1000, &got) == 0) return fail("stored expired");
+	tls13_ticket_store("a.example", 1000, &t);
+	if (tls13_ticket_take("a.example", 61000, &got) == 0) return fail("expiry");
+
+	/* Oversized or empty identities are not kept. */
+	struct tls13_ticket bad = mk(2, 1000, 61000);
+	bad.len = 0;
+	tls13_ticket_store("c.example", 1000, &bad);
+	if (tls13_ticket_take("c.example", 1000, &got) == 0) return fail("empty identity");
+
+	/* One host keeps at most TLS13_TICKET_PER_HOST; the oldest go first. */
+	for (uint32_t i = 0; i < TLS13_TICKET_PER_HOST + 2u; i++) {
+		struct tls13_ticket h = mk((uint8_t)(10 + i), 1000 + i, 100000);
+		tls13_ticket_store("img.example", 1000 + i, &h);
+	}
+	uint32_t n = 0;
+	while (tls13_ticket_take("img.example", 2000, &got) == 0) {
+		if (got.psk[0] < 12) return fail("per-host oldest kept");
+		n++;
+	}
+	if (n != TLS13_TICKET_PER_HOST) return fail("per-host cap");
+
+	/* Bounded: filling it evicts the ticket expiring soonest. */
+	char name[32];
+	for (uint32_t i = 0; i < 2u * TLS13_TICKET_ENTRIES; i++) {
+		snprintf(name, sizeof(name), "h%u.example", i);
+		struct tls13_ticket h = mk((uint8_t)i, 1000, 100000 + i);
+		tls13_ticket_store(name, 1000, &h);
+	}
+	snprintf(name, sizeof(name), "h%u.example", 2u * TLS13_TICKET_ENTRIES - 1u);
+	if (tls13_ticket_take(name, 1000, &got) != 0 || got.psk[0] != (uint8_t)(2u * TLS13_TICKET_ENTRIES - 1u)) return fail("bounded");
+	if (tls13_ticket_take("h0.example", 1000, &got) == 0) return fail("soonest not evicted");
+
+	/* A ticket a forked image worker received resumes the parent's next handshake. */
+	int pid = sys_fork();
+	if (pid == 0) {
+		struct tls13_ticket c = mk(99, 5000, 90000);
+		tls13_ticket_store("child.example", 5000, &c);
+		sys_exit(0);
+	}
+	if (pid < 0) return fail("fork");
+	int st = 0;
+	(void)sys_wait4(pid, &st, 0, 0);
+	if (tls13_ticket_take("child.example", 5000, &got) != 0 || got.psk[0] != 99) return fail("shared with child");
+
+	printf("tls13 ticket selftest: OK\n");
+	return 0;
+}
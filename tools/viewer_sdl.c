@@ -1,13 +1,17 @@
 #define _GNU_SOURCE
 #include <errno.h>
+#include <limits.h>
 #include <fcntl.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
+#include <linux/futex.h>
+
 #include <SDL2/SDL.h>
 
 /* Must match src/core/cfb.h */
@@ -24,7 +28,7 @@ struct cfb_header {
 	uint32_t stride_bytes;
 	uint32_t format;
 	uint32_t reserved0;
-	uint32_t reserved1;
+	uint32_t wake_seq;
 	uint64_t frame_counter;
 	uint64_t reserved2;
 	uint64_t reserved3;
@@ -43,12 +47,91 @@ struct cfb_header {
 		uint32_t kind;
 		uint32_t ch;
 	} keyq[32];
+	uint32_t damage_wpos;
+	uint32_t reserved5;
+	struct {
+		uint16_t x;
+		uint16_t y;
+		uint16_t w;
+		uint16_t h;
+	} damage[64];
+	uint32_t buffer_count;
+	uint32_t front_index;
+	uint32_t front_damage_wpos;
+	uint32_t present_seq;
 };
 
 enum {
 	CFB_HEADER_V1_SIZE = 56, /* up to reserved3 inclusive */
+	CFB_DAMAGE_RING_SIZE = 64,
+	CFB_MAX_BUFFERS = 4,
 };
 
+/* Tells the producer new input is in the header (version >= 6; see cfb_wake()). */
+static void wake_producer(struct cfb_header *hdr)
+{
+	if (hdr->version < 6) return;
+	__atomic_add_fetch(&hdr->wake_seq, 1u, __ATOMIC_RELEASE);
+	(void)syscall(SYS_futex, &hdr->wake_seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/* Uploads the rects in the damage ring between `rpos` and `wpos`.
+ * Returns 0 if done, -1 if the ring no longer holds them and the whole frame must be uploaded.
+ */
+static int update_damage(SDL_Texture *texture, const struct cfb_header *hdr, const uint8_t *pixels, uint32_t rpos, uint32_t wpos)
+{
+	if (wpos - rpos > CFB_DAMAGE_RING_SIZE) return -1;
+	for (uint32_t i = rpos; i != wpos; i++) {
+		uint32_t x = hdr->damage[i % CFB_DAMAGE_RING_SIZE].x;
+		uint32_t y = hdr->damage[i % CFB_DAMAGE_RING_SIZE].y;
+		uint32_t w = hdr->damage[i % CFB_DAMAGE_RING_SIZE].w;
+		uint32_t h = hdr->damage[i % CFB_DAMAGE_RING_SIZE].h;
+		if (x >= hdr->width || y >= hdr->height) continue;
+		if (w > hdr->width - x) w = hdr->width - x;
+		if (h > hdr->height - y) h = hdr->height - y;
+		if (w == 0 || h == 0) continue;
+		SDL_Rect r = { (int)x, (int)y, (int)w, (int)h };
+		SDL_UpdateTexture(texture, &r, pixels + (size_t)y * hdr->stride_bytes + (size_t)x * 4u, (int)hdr->stride_bytes);
+	}
+	/* The producer may have lapped us while we were reading. */
+	if (__atomic_load_n(&hdr->damage_wpos, __ATOMIC_ACQUIRE) - rpos > CFB_DAMAGE_RING_SIZE) return -1;
+	return 0;
+}
+
+/* Uploads the published front buffer (version >= 5): only the damage since
+ * `*io_rpos`, or everything if `full`. A copy that overlapped the producer
+ * reusing the buffer is retried from the new front buffer, so the texture
+ * never keeps a torn frame. Never blocks the producer.
+ * Returns 0 once the texture matches the front buffer, -1 to try again later.
+ */
+static int upload_front(SDL_Texture *texture, const struct cfb_header *hdr, const uint8_t *buffers, size_t buf_bytes, uint32_t *io_rpos, int full)
+{
+	uint32_t n = hdr->buffer_count ? hdr->buffer_count : 1u;
+	if (n > CFB_MAX_BUFFERS) n = CFB_MAX_BUFFERS;
+	for (int attempt = 0; attempt < 8; attempt++) {
+		uint32_t seq = __atomic_load_n(&hdr->present_seq, __ATOMIC_ACQUIRE);
+		if (seq & 1u) continue;
+		uint32_t idx = __atomic_load_n(&hdr->front_index, __ATOMIC_RELAXED) % n;
+		uint32_t dw = __atomic_load_n(&hdr->front_damage_wpos, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&hdr->present_seq, __ATOMIC_RELAXED) != seq) continue;
+		if (!full && dw == *io_rpos) return 0;
+
+		const uint8_t *pixels = buffers + (size_t)idx * buf_bytes;
+		if (full || update_damage(texture, hdr, pixels, *io_rpos, dw) != 0) {
+			SDL_UpdateTexture(texture, NULL, pixels, (int)hdr->stride_bytes);
+			full = 1;
+		}
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		uint32_t now = __atomic_load_n(&hdr->present_seq, __ATOMIC_RELAXED);
+		if (n < 2u || now - seq <= 2u * (n - 2u)) {
+			*io_rpos = dw;
+			return 0;
+		}
+	}
+	return -1;
+}
+
 static int map_file(const char *path, int *io_fd, void **io_map, size_t *io_len, ino_t *io_ino)
 {
 	if (*io_map && *io_len) {
@@ -126,6 +209,7 @@ int main(int argc, char **argv)
 	size_t mapped_len = 0;
 	ino_t mapped_ino = 0;
 	uint64_t last_frame = (uint64_t)-1;
+	uint32_t damage_rpos = 0;
 
 	SDL_StartTextInput();
 
@@ -148,6 +232,7 @@ int main(int argc, char **argv)
 								hdr->keyq_wpos = w + 1u;
 								hdr->input_counter++;
 							}
+							wake_producer(hdr);
 						} else if (ev.type == SDL_KEYDOWN) {
 							uint32_t kind = 0;
 							switch (ev.key.keysym.sym) {
@@ -163,6 +248,7 @@ int main(int argc, char **argv)
 								hdr->keyq[w & 31u].ch = 0;
 								hdr->keyq_wpos = w + 1u;
 								hdr->input_counter++;
+								wake_producer(hdr);
 							}
 						}
 					}
@@ -173,10 +259,14 @@ int main(int argc, char **argv)
 				if (hdr->magic == CFB_MAGIC && hdr->format == CFB_FORMAT_XRGB8888) {
 					/* Only write into shm if the header supports it (v2+). */
 					if (hdr->version >= 2 && mapped_len >= sizeof(struct cfb_header)) {
-						/* Reuse reserved fields (reserved0=wheel delta y, reserved2=wheel counter). */
+						/* Reuse reserved fields (reserved0=wheel delta y, reserved2=wheel counter,
+						 * reserved3=sum of all deltas for version >= 7).
+						 */
 						hdr->reserved0 = (uint32_t)ev.wheel.y;
+						hdr->reserved3 += (uint64_t)(int64_t)ev.wheel.y;
 						hdr->reserved2++;
 						hdr->input_counter++;
+						wake_producer(hdr);
 					}
 					fprintf(stderr, "mouse wheel y=%d\n", ev.wheel.y);
 					fflush(stderr);
@@ -219,6 +309,7 @@ int main(int argc, char **argv)
 							if (ev.type == SDL_MOUSEBUTTONDOWN) hdr->mouse_buttons |= bit;
 							else hdr->mouse_buttons &= ~bit;
 						}
+						wake_producer(hdr);
 					}
 
 					fprintf(stderr, "mouse %s button=%u at window=(%d,%d) fb=(%u,%u)\n",
@@ -277,7 +368,9 @@ int main(int argc, char **argv)
 		const uint32_t stride = hdr->stride_bytes;
 		size_t pixels_off = sizeof(struct cfb_header);
 		if (hdr->version < 2) pixels_off = CFB_HEADER_V1_SIZE;
-		const size_t need = pixels_off + (size_t)height * (size_t)stride;
+		uint32_t nbuf = (hdr->version >= 5 && hdr->buffer_count) ? hdr->buffer_count : 1u;
+		if (nbuf > CFB_MAX_BUFFERS) nbuf = CFB_MAX_BUFFERS;
+		const size_t need = pixels_off + (size_t)nbuf * (size_t)height * (size_t)stride;
 		if (need > mapped_len || width == 0 || height == 0 || stride < width * 4u) {
 			map_file(path, &fb_fd, &mapped, &mapped_len, &mapped_ino);
 			SDL_Delay(50);
@@ -292,7 +385,13 @@ int main(int argc, char **argv)
 			}
 		}
 
-		if (hdr->frame_counter != last_frame) {
+		if (hdr->version >= 5) {
+			const uint8_t *buffers = (const uint8_t *)mapped + pixels_off;
+			int full = (last_frame == (uint64_t)-1);
+			if (upload_front(texture, hdr, buffers, (size_t)height * (size_t)stride, &damage_rpos, full) == 0) {
+				last_frame = hdr->frame_counter;
+			}
+		} else if (hdr->frame_counter != last_frame) {
 			last_frame = hdr->frame_counter;
 			const void *pixels = (const uint8_t *)mapped + pixels_off;
 			SDL_UpdateTexture(texture, NULL, pixels, (int)stride);